@@ -0,0 +1,248 @@
+//exhaustive test of the xlns16 adders: all 2^32 pairs (x, y), against the exact
+//sum rounded to xlns16, split over the threads of xlnspool.cpp
+//  (every code is taken at its value, so 0x0000 is 2^-128, as xlns16_add treats it;
+//  exact cancellation must give xlns16_zero, and results out of range saturate)
+//for each adder: a histogram of result - ideal in codes, the largest and mean error
+//against the exact sum in units of 2^-7, the worst pairs and the time per addition.
+//the options of xlns16_add (and so of xlns16_add_monte) come from xlns16testcase.h:
+//   g++ -std=c++11 -O2 -march=native -pthread -Dxlns16case=6 test16addexh.cpp -o test16addexh
+//   for c in 0 1 2 3 4 5 6; do g++ ... -Dxlns16case=$c ...; ./test16addexh a; done
+//   ./test16addexh [adders [threads [xstep]]]
+//adders is any of
+//   a   xlns16_add
+//   m   xlns16_add_monte
+//   l   xlns32_add_lpvip on x<<16 and y<<16, >>16
+//   v   the same with the AVX2/AVX-512 kernel, 8 or 16 y at a time, also compared bit
+//       for bit with the scalar xlns32_add_lpvip (a stress test of the SIMD kernel)
+//(default all); xstep > 1 takes every xstep-th x only, for a quicker run
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef xlns16case
+ #include "xlns16testcase.h"
+#endif
+#include "xlnspool.cpp"
+#include "xlns16.cpp"
+#include "xlns32lpvip.cpp"
+#include "xlns16monte.cpp"
+
+#include <chrono>
+
+#define NBIN 11                 //result - ideal: <-4, -4 .. 4, >4
+#define NWORST 4
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//exact log2(1 + 2^(-d/128)) and log2(1 - 2^(-d/128)), in units of 2^-7
+double exsb[1<<15], exdb[1<<15];
+
+struct addstats
+{
+	unsigned long long hist[NBIN], cases, inrange, ends, wrap, sign, cancel, simd;
+	double sumabs, sum, maxin, kernel;
+	struct { double err; xlns16 x, y, r; } worst[NWORST];
+};
+
+addstats combine(const addstats &a, const addstats &b)
+{
+	addstats c = a;
+	int i, j, k;
+	for (i=0; i<NBIN; i++)
+		c.hist[i] += b.hist[i];
+	c.cases += b.cases;
+	c.inrange += b.inrange;
+	c.ends += b.ends;
+	c.wrap += b.wrap;
+	c.sign += b.sign;
+	c.cancel += b.cancel;
+	c.simd += b.simd;
+	c.sumabs += b.sumabs;
+	c.sum += b.sum;
+	c.maxin = (b.maxin > c.maxin) ? b.maxin : c.maxin;
+	c.kernel += b.kernel;
+	for (i=j=k=0; k<NWORST; k++)
+		c.worst[k] = (a.worst[i].err >= b.worst[j].err) ? a.worst[i++] : b.worst[j++];
+	return c;
+}
+
+//the adder under test over one row: r[y] = x + y for every y
+void kernel(char adder, xlns16 x, unsigned *r)
+{
+	unsigned y;
+	switch (adder)
+	{
+	case 'a':
+		for (y=0; y<(1<<16); y++)
+			r[y] = xlns16_add(x, y);
+		break;
+	case 'm':
+		for (y=0; y<(1<<16); y++)
+			r[y] = xlns16_add_monte(x, y);
+		break;
+	case 'l':
+		for (y=0; y<(1<<16); y++)
+			r[y] = xlns32_add_lpvip(((xlns32)x)<<16, y<<16) >> 16;
+		break;
+	case 'v':
+		#if defined(__AVX512F__)
+		{
+			__m512i vx = _mm512_set1_epi32(((xlns32)x)<<16);
+			__m512i vy = _mm512_slli_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), 16);
+			for (y=0; y<(1<<16); y+=16, vy = _mm512_add_epi32(vy, _mm512_set1_epi32(16<<16)))
+				_mm512_storeu_si512(r+y, _mm512_srli_epi32(xlns32_add_lpvip_avx512(vx, vy), 16));
+		}
+		#elif defined(__AVX2__)
+		{
+			__m256i vx = _mm256_set1_epi32(((xlns32)x)<<16);
+			__m256i vy = _mm256_slli_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), 16);
+			for (y=0; y<(1<<16); y+=8, vy = _mm256_add_epi32(vy, _mm256_set1_epi32(8<<16)))
+				_mm256_storeu_si256((__m256i *)(r+y), _mm256_srli_epi32(xlns32_add_lpvip_avx2(vx, vy), 16));
+		}
+		#endif
+		break;
+	}
+}
+
+//compare one row with the exact sums
+void check(char adder, xlns16 x, const unsigned *r, addstats &s)
+{
+	int xl = x & xlns16_logmask, yl, maxl, d, ideal, code, b;
+	unsigned y;
+	double e, err;
+	for (y=0; y<(1<<16); y++)
+	{
+		xlns16 sgn, res = r[y];
+		yl = y & xlns16_logmask;
+		d = (xl > yl) ? xl - yl : yl - xl;
+		maxl = (xl > yl) ? xl : yl;
+		sgn = ((xl > yl) ? x : y) & xlns16_signmask;
+		if (adder == 'v')
+			s.simd += res != (xlns32_add_lpvip(((xlns32)x)<<16, y<<16) >> 16);
+		if (((x ^ y) & xlns16_signmask) && d == 0)
+		{
+			s.cancel += res != xlns16_zero;
+			continue;
+		}
+		e = maxl + (((x ^ y) & xlns16_signmask) ? exdb[d] : exsb[d]);
+		ideal = (int)floor(e + .5);
+		ideal = (ideal < 0) ? 0 : (ideal > xlns16_logmask) ? xlns16_logmask : ideal;
+		code = res & xlns16_logmask;
+		s.sign += code && (res & xlns16_signmask) != sgn;
+		b = code - ideal;
+		s.hist[(b < -4) ? 0 : (b > 4) ? NBIN-1 : b + 5]++;
+		s.cases++;
+		s.wrap += b < -(xlns16_logmask/2) || b > xlns16_logmask/2;
+		if (ideal == 0 || ideal == xlns16_logmask)
+		{
+			s.ends += b != 0;          //the exact sum is out of range: should saturate
+			err = abs(b);
+		}
+		else
+		{
+			err = code - e;
+			s.inrange++;
+			s.sum += err;
+			err = fabs(err);
+			s.sumabs += err;
+			s.maxin = (err > s.maxin) ? err : s.maxin;
+		}
+		if (err > s.worst[NWORST-1].err)
+		{
+			int k;
+			for (k=NWORST-1; k>0 && err > s.worst[k-1].err; k--)
+				s.worst[k] = s.worst[k-1];
+			s.worst[k].err = err;
+			s.worst[k].x = x;
+			s.worst[k].y = y;
+			s.worst[k].r = res;
+		}
+	}
+}
+
+int run(char adder, int xstep)
+{
+	const char *names[] = { "a", "xlns16_add", "m", "xlns16_add_monte", "l", "xlns32_add_lpvip >>16",
+	                        "v", "xlns32_add_lpvip SIMD >>16" };
+	size_t rows = ((1<<16) + xstep - 1)/xstep;
+	int i, ok;
+	for (i=0; i<8 && names[i][0] != adder; i+=2)
+		;
+	if (i == 8)
+		return 0;
+	#if !defined(__AVX512F__) && !defined(__AVX2__)
+	if (adder == 'v')
+	{
+		printf("%s: needs -mavx2 or -mavx512f\n\n", names[i+1]);
+		return 0;
+	}
+	#endif
+	printf("%s", names[i+1]);
+	#ifdef xlns16_whatcase
+	if (adder == 'a' || adder == 'm')
+		printf(", %s", xlns16_whatcase);
+	else
+	#endif
+		printf("\n");
+	double t1 = now();
+	addstats s = xlns_parallel_reduce<addstats>(rows, 16, [&](size_t r0, size_t r1) {
+		addstats p;
+		memset(&p, 0, sizeof(p));
+		std::vector<unsigned> r(1<<16);
+		for (size_t j=r0; j<r1; j++)
+		{
+			xlns16_monte_stream noise(7, j);     //the same noise for each row on any thread
+			double t = now();
+			kernel(adder, j*xstep, r.data());
+			p.kernel += now() - t;
+			check(adder, j*xstep, r.data(), p);
+		}
+		return p;
+	}, combine);
+	double t2 = now();
+	printf("  %llu pairs (and %zu cancellations) in %.1f s on %d threads; the adder alone: %.2f ns per add"
+	       " per thread, %.2f G adds/s\n", s.cases, rows, t2 - t1, xlns_pool_threads(),
+	       1e9*s.kernel/(s.cases + rows), (s.cases + rows)/(s.kernel/xlns_pool_threads())/1e9);
+	printf("  result - ideal (codes)           pairs          %%\n");
+	for (i=0; i<NBIN; i++)
+		if (s.hist[i])
+		{
+			char label[8];
+			snprintf(label, sizeof(label), (i == 0) ? "< -4" : (i == NBIN-1) ? "> 4" : "%d", i-5);
+			printf("  %13s %25llu %10.6f\n", label, s.hist[i], 100.0*s.hist[i]/s.cases);
+		}
+	printf("  sums in range (%llu pairs), error against the exact sum: max %.3f, mean |err| %.4f, mean %+.5f units\n",
+	       s.inrange, s.maxin, s.sumabs/s.inrange, s.sum/s.inrange);
+	printf("  sums out of range (%llu pairs) not saturated as the exact sum: %llu\n", s.cases - s.inrange, s.ends);
+	printf("  worst pairs (|result - exact sum| in units, or in codes out of range):\n");
+	for (i=0; i<NWORST && s.worst[i].err > 0; i++)
+		printf("    %04x + %04x = %04x  (%.3f)\n", s.worst[i].x, s.worst[i].y, s.worst[i].r, s.worst[i].err);
+	ok = s.wrap == 0 && s.sign == 0 && s.cancel == 0 && s.simd == 0;
+	printf("  wrapped around %llu, wrong sign %llu, cancellation not xlns16_zero %llu", s.wrap, s.sign, s.cancel);
+	if (adder == 'v')
+		printf(", differs from scalar %llu", s.simd);
+	printf("      %s\n\n", ok ? "yes" : "NO");
+	return ok;
+}
+
+int main(int argc, char **argv)
+{
+	const char *adders = (argc > 1) ? argv[1] : "amlv";
+	int threads = (argc > 2) ? atoi(argv[2]) : 0;
+	int xstep = (argc > 3) ? atoi(argv[3]) : 1;
+	int d;
+	xlns_pool_init(threads);
+	for (d=1; d<(1<<15); d++)
+	{
+		exsb[d] = log1p(exp2(-d/128.0))/log(2.0)*128;
+		exdb[d] = log1p(-exp2(-d/128.0))/log(2.0)*128;
+	}
+	exsb[0] = 128;
+	xstep = (xstep > 0) ? xstep : 1;
+	for (; *adders; adders++)
+		run(*adders, xstep);
+	return 0;
+}
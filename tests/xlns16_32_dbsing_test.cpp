@@ -0,0 +1,94 @@
+// Test file for the libm-free db near the singularity
+// Functions: xlns16_db_sing (xlns16dbsingtbl.h), xlns32_db_sing, xlns32_db_sing_avx2/avx512 (via xlns32_batch_add_lpvip)
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -I.. xlns16_32_dbsing_test.cpp -o xlns16_32_dbsing_test -lm && ./xlns16_32_dbsing_test
+//         (also try -mavx2 and -mavx512f for the vector db)
+
+#define xlns32_aicasb
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cmath>
+
+// -----------------------------------------------------------
+//  xlns16: table vs xlns16_db_ideal for every 0 < z < 1<<F
+// -----------------------------------------------------------
+void test_db_sing16() {
+    printf("--- xlns16_db_sing (table) vs xlns16_db_ideal ---\n");
+    printf("    z   db_ideal   table  ok\n");
+
+    int bad = 0;
+    for (xlns16_signed z = 1; z < (1<<xlns16_F); z++) {
+        xlns16 ref = xlns16_db_ideal(z);
+        xlns16 got = xlns16_db_sing(z);
+        if (got != ref) bad++;
+        if (z % 21 == 1 || got != ref)
+            printf("  %3d     %04x     %04x   %s\n", z, ref, got, (got == ref) ? "yes" : "NO");
+    }
+    printf("  all %d: %d mismatches  %s\n\n", (1<<xlns16_F)-1, bad, bad ? "NO" : "yes");
+}
+
+// -----------------------------------------------------------
+//  xlns32: xlns32_db_sing vs xlns32_db_ideal for every 0 < z < 1<<F
+// -----------------------------------------------------------
+void test_db_sing32() {
+    printf("--- xlns32_db_sing vs xlns32_db_ideal (all %d z) ---\n", (1<<xlns32_F)-1);
+    printf("         z     db_ideal      db_sing  ok\n");
+
+    const xlns32_signed samples[] = { 1, 2, 3, 255, 32767, 32768, 1<<20, (1<<xlns32_F)-2, (1<<xlns32_F)-1 };
+    for (xlns32_signed z : samples) {
+        xlns32 ref = xlns32_db_ideal(z), got = xlns32_db_sing(z);
+        printf("  %8d   %08x     %08x   %s\n", z, ref, got, (got == ref) ? "yes" : "NO");
+    }
+    long bad = 0;
+    for (xlns32_signed z = 1; z < (1<<xlns32_F); z++)
+        if (xlns32_db_sing(z) != xlns32_db_ideal(z)) bad++;
+    printf("  all: %ld mismatches  %s\n\n", bad, bad ? "NO" : "yes");
+}
+
+// -----------------------------------------------------------
+//  vector db (inside xlns32_batch_add_lpvip) vs scalar xlns32_add_lpvip
+//  x + y with x = 1.0, y = -2^(-d/scale), so z = -d lands in the singularity
+// -----------------------------------------------------------
+void test_db_sing_batch() {
+    printf("--- xlns32_batch_add_lpvip on the singularity ---\n");
+    printf("  pairs      mismatches  ok\n");
+
+    const size_t N = 1<<16;
+    static xlns32 a[N], b[N], c[N];
+    long bad = 0, pairs = 0;
+    for (xlns32_signed d0 = 1; d0 < (1<<xlns32_F); d0 += N) {
+        size_t n = 0;
+        for (xlns32_signed d = d0; d < d0 + (xlns32_signed)N && d < (1<<xlns32_F); d++, n++) {
+            a[n] = xlns32_logsignmask;
+            b[n] = (xlns32_signmask|xlns32_logsignmask) - d;
+        }
+        xlns32_batch_add_lpvip(a, b, c, n);
+        for (size_t i = 0; i < n; i++)
+            if (c[i] != xlns32_add_lpvip(a[i], b[i])) bad++;
+        pairs += n;
+    }
+    printf("  %8ld   %8ld    %s\n\n", pairs, bad, bad ? "NO" : "yes");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  libm-free db near the singularity test                     \n");
+    #if defined(__AVX512F__)
+    printf("  (AVX-512 build)\n");
+    #elif defined(__AVX2__)
+    printf("  (AVX2 build)\n");
+    #else
+    printf("  (portable build)\n");
+    #endif
+    printf("=============================================================\n\n");
+
+    test_db_sing16();
+    test_db_sing32();
+    test_db_sing_batch();
+
+    printf("All tests done.\n");
+    return 0;
+}
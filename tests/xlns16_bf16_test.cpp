@@ -0,0 +1,141 @@
+// Test file for the direct bfloat16 <-> xlns16 conversions
+// Functions: bf162xlns16, xlns162bf16, xlns16_batch_from_bf16, xlns16_batch_to_bf16
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns16_bf16_test.cpp -o xlns16_bf16_test -lm && ./xlns16_bf16_test
+//         (also try -mavx2 and -mavx512bw; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+
+#include <cstdio>
+#include <vector>
+
+// round-to-nearest references computed in double
+static xlns16 ref_from(xlns_bf16 b) {
+    xlns16 s = b & 0x8000;
+    if ((b & 0x7f80) == 0x7f80) return s | xlns16_pos_inf;
+    double v = fabs((double)xlns16_bf162fp(b));
+    if (v == 0.0) return xlns16_zero;
+    long l = (long)floor(128.0*log2(v) + 0.5) + 16384;
+    return (l <= 0) ? xlns16_zero : (xlns16)(s | l);
+}
+
+static xlns_bf16 ref_to(xlns16 x) {
+    long a = x & 0x7fff;
+    if (a == 0) return 0;
+    xlns_bf16 s = x & 0x8000;
+    double v = pow(2.0, (a - 16384)/128.0);
+    if (v < ldexp(1.0, -126))
+        return s | (xlns_bf16)floor(ldexp(v, 133) + 0.5);
+    int e;
+    double f = frexp(v, &e);           // v = f*2^e, f in [0.5,1)
+    return s | (xlns_bf16)((((long)e + 126) << 7) + (long)floor((2.0*f - 1.0)*128.0 + 0.5));
+}
+
+// -----------------------------------------------------------
+//  all 65536 inputs of each direction against the references
+// -----------------------------------------------------------
+void test_exhaustive() {
+    printf("--- exhaustive scalar conversions vs round-to-nearest reference ---\n");
+    printf("  function         inputs  mismatches      ok\n");
+    size_t bad = 0, badt = 0;
+    for (unsigned i = 0; i < 65536; i++) {
+        bad += bf162xlns16((xlns_bf16)i) != ref_from((xlns_bf16)i);
+        badt += xlns162bf16((xlns16)i) != ref_to((xlns16)i);
+    }
+    printf("  %-15s %7d  %10zu      %s\n", "bf162xlns16", 65536, bad, bad == 0 ? "yes" : "NO");
+    printf("  %-15s %7d  %10zu      %s\n", "xlns162bf16", 65536, badt, badt == 0 ? "yes" : "NO");
+
+    // spot values
+    const float vals[] = { 1.0f, -1.0f, 2.0f, 0.5f, 3.0f, -0.1f, 1e30f, -1e-30f };
+    printf("\n  value         bf16   xlns16  expected  back        ok\n");
+    for (int k = 0; k < 8; k++) {
+        xlns_bf16 b;
+        memcpy(&b, (const char *)&vals[k] + 2, 2);     // truncated bf16 of the value (little endian)
+        xlns16 x = bf162xlns16(b);
+        xlns16 e = ref_from(b);
+        printf("  %-12g  %04x   %04x    %04x      %-10g  %s\n", vals[k], b, x, e,
+               xlns16_bf162fp(xlns162bf16(x)), x == e ? "yes" : "NO");
+    }
+
+    // against fp2xlns16, which truncates the log instead of rounding it
+    size_t far = 0;
+    for (unsigned i = 0x0080; i < 0x7f80; i++) {
+        int d = (int)bf162xlns16((xlns_bf16)i) - (int)fp2xlns16(xlns16_bf162fp((xlns_bf16)i));
+        far += (d < -1 || d > 1);
+    }
+    printf("\n  normal bf16 more than 1 from fp2xlns16:  %zu      %s\n\n", far, far == 0 ? "yes" : "NO");
+}
+
+// -----------------------------------------------------------
+//  batch (SIMD) against scalar, at every offset so each block
+//  mixes normal values with zeros, subnormals and infinities
+// -----------------------------------------------------------
+void test_batch() {
+    printf("--- batch conversions vs scalar ---\n");
+    printf("  function                 n    offsets  mismatches      ok\n");
+    const size_t n = 65536 + 40;
+    std::vector<xlns_bf16> b(n), bo(n);
+    std::vector<xlns16> x(n), xo(n);
+    for (size_t i = 0; i < n; i++) {
+        b[i] = (xlns_bf16)(i*40503u);            // all 65536 patterns, scattered
+        x[i] = (xlns16)(i*40503u);
+    }
+    size_t bad = 0, badt = 0;
+    for (size_t off = 0; off < 33; off++) {
+        xlns16_batch_from_bf16(b.data() + off, xo.data(), n - off);
+        xlns16_batch_to_bf16(x.data() + off, bo.data(), n - off);
+        for (size_t i = 0; i < n - off; i++) {
+            bad += xo[i] != bf162xlns16(b[i+off]);
+            badt += bo[i] != xlns162bf16(x[i+off]);
+        }
+    }
+    printf("  %-22s %6zu  %7d  %10zu      %s\n", "xlns16_batch_from_bf16", n, 33, bad, bad == 0 ? "yes" : "NO");
+    printf("  %-22s %6zu  %7d  %10zu      %s\n", "xlns16_batch_to_bf16", n, 33, badt, badt == 0 ? "yes" : "NO");
+
+    // normal values only (the all-SIMD path), 1 and 3 threads
+    const size_t big = 1000003;
+    std::vector<xlns_bf16> nb(big), nbo(big);
+    std::vector<xlns16> nx(big), nxo(big);
+    srand(7);
+    for (size_t i = 0; i < big; i++) {
+        nb[i] = (xlns_bf16)(((rand() & 0xff) + 0x3f00) ^ ((rand() & 1) << 15));
+        nx[i] = (xlns16)((rand() & 0x3fff) + 0x2000);
+    }
+    xlns_parallel_min = 1000;
+    for (int t = 1; t <= 3; t += 2) {
+        xlns_pool_init(t);
+        xlns16_batch_from_bf16(nb.data(), nxo.data(), big);
+        xlns16_batch_to_bf16(nx.data(), nbo.data(), big);
+        bad = badt = 0;
+        for (size_t i = 0; i < big; i++) {
+            bad += nxo[i] != bf162xlns16(nb[i]);
+            badt += nbo[i] != xlns162bf16(nx[i]);
+        }
+        printf("  %-22s %6zu  %4d thr  %10zu      %s\n", "xlns16_batch_from_bf16", big, t, bad, bad == 0 ? "yes" : "NO");
+        printf("  %-22s %6zu  %4d thr  %10zu      %s\n", "xlns16_batch_to_bf16", big, t, badt, badt == 0 ? "yes" : "NO");
+    }
+    xlns_parallel_min = 1<<15;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  bfloat16 <-> xlns16 conversion test                        \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512BW__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_exhaustive();
+    test_batch();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
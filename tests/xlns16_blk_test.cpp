@@ -0,0 +1,160 @@
+// Test file for the block-scaled LNS weight formats
+// Functions: xlns16_quantize_b8, xlns16_quantize_b6, xlns16_dequantize_b8, xlns16_dequantize_b6,
+//            xlns16_vec_dot_b8, xlns16_vec_dot_b6, xlns16_gemv_b8, xlns16_gemv_b6
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns16_blk_test.cpp -o xlns16_blk_test -lm && ./xlns16_blk_test
+//         (also try -mavx2; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// -----------------------------------------------------------
+//  every code of both layouts decodes as xlns16_blk_value,
+//  including bases small enough to clamp
+// -----------------------------------------------------------
+void test_decode() {
+    printf("--- unpack (SIMD) vs xlns16_blk_value, all codes ---\n");
+    printf("  format   bases  mismatches      ok\n");
+    const xlns16 bases[] = { 0, 1, 100, 600, 1500, 0x4000, 0x7fff };
+    size_t bad8 = 0, bad6 = 0;
+    for (int bi = 0; bi < 7; bi++)
+        for (int start = 0; start < 256; start += 32) {
+            xlns16_b8 b8;
+            xlns16_b6 b6;
+            xlns16 out[xlns16_qk];
+            b8.base = b6.base = bases[bi];
+            memset(b6.lo, 0, sizeof(b6.lo));
+            memset(b6.hi, 0, sizeof(b6.hi));
+            for (int k = 0; k < 32; k++) {
+                b8.c[k] = (unsigned char)(start + k);
+                unsigned code = (start/4 + k) & 63;
+                b6.lo[k & 15] |= (code & 0xf) << (4*(k >> 4));
+                b6.hi[k & 7] |= (code >> 4) << (2*(k >> 3));
+            }
+            xlns16_unpack_block(&b8, out);
+            for (int k = 0; k < 32; k++) bad8 += out[k] != xlns16_blk_value(bases[bi], start + k, 7, 3);
+            xlns16_unpack_block(&b6, out);
+            for (int k = 0; k < 32; k++) bad6 += out[k] != xlns16_blk_value(bases[bi], (start/4 + k) & 63, 5, 4);
+        }
+    printf("  %-7s  %5d  %10zu      %s\n", "b8", 7, bad8, bad8 == 0 ? "yes" : "NO");
+    printf("  %-7s  %5d  %10zu      %s\n", "b6", 7, bad6, bad6 == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  quantize/dequantize: within half a step of the log for values
+//  in range, zero below it, and the block maximum exact
+// -----------------------------------------------------------
+void test_roundtrip() {
+    printf("--- quantize / dequantize round trip ---\n");
+    printf("  format       n  worst log err  bound  flushed  max exact      ok\n");
+    const size_t n = 100003;
+    std::vector<xlns16> x(n), r(n);
+    std::vector<xlns16_b8> b8((n + 31)/32);
+    std::vector<xlns16_b6> b6((n + 31)/32);
+    srand(4);
+    for (size_t i = 0; i < n; i++)
+        x[i] = (i % 97 == 0) ? xlns16_zero : fp2xlns16(rndf()*((i % 13 == 0) ? 1e-3f : 1.0f));
+    for (int f = 0; f < 2; f++) {
+        int shift = f ? 4 : 3, cmax = f ? 31 : 127;
+        if (f) { xlns16_quantize_b6(x.data(), b6.data(), n); xlns16_dequantize_b6(b6.data(), r.data(), n); }
+        else   { xlns16_quantize_b8(x.data(), b8.data(), n); xlns16_dequantize_b8(b8.data(), r.data(), n); }
+        int worst = 0;
+        size_t flushed = 0, badmax = 0, wrong = 0;
+        for (size_t b = 0; b < (n + 31)/32; b++) {
+            size_t m = (n - b*32 < 32) ? n - b*32 : 32;
+            xlns16 base = xlns16_blk_base(&x[b*32], m);
+            for (size_t k = 0; k < m; k++) {
+                size_t i = b*32 + k;
+                int a = xlns16_abs(x[i]);
+                if (a == base && a && r[i] != x[i]) badmax++;
+                if (a == 0 || base - a > ((cmax - 1) << shift) - (1 << (shift - 1))) {
+                    flushed += (a != 0);
+                    wrong += (a == 0 && xlns16_abs(r[i]) != 0);
+                    continue;
+                }
+                int err = abs((int)xlns16_abs(r[i]) - a);
+                if (err > worst) worst = err;
+                wrong += xlns16_sign(r[i]) != xlns16_sign(x[i]);
+            }
+        }
+        bool ok = worst <= (1 << (shift - 1)) && badmax == 0 && wrong == 0;
+        printf("  %-7s  %6zu  %13d  %5d  %7zu  %9s      %s\n", f ? "b6" : "b8", n, worst, 1 << (shift - 1),
+               flushed, badmax ? "no" : "yes", ok ? "yes" : "NO");
+    }
+    printf("  (bytes per 32 values: xlns16 64, b8 %d, b6 %d)\n\n", (int)sizeof(xlns16_b8), (int)sizeof(xlns16_b6));
+}
+
+// -----------------------------------------------------------
+//  dot/GEMV equal xlns16_vec_dot on the dequantized weights,
+//  1 and 3 threads
+// -----------------------------------------------------------
+void test_products() {
+    printf("--- block dot / GEMV vs xlns16_vec_dot on dequantized weights ---\n");
+    printf("  function          rows  cols  threads  mismatches      ok\n");
+    const struct { size_t rows, cols; } shapes[] = { { 1, 1 }, { 3, 33 }, { 40, 300 }, { 300, 4096 } };
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < 4; s++) {
+        size_t R = shapes[s].rows, C = shapes[s].cols, nb = (C + 31)/32;
+        std::vector<xlns16> W(R*C), x(C), d(C), y(R), e8(R), e6(R);
+        std::vector<xlns16_b8> W8(R*nb);
+        std::vector<xlns16_b6> W6(R*nb);
+        srand(20 + s);
+        for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns16(rndf());
+        for (size_t i = 0; i < C; i++) x[i] = fp2xlns16(rndf());
+        for (size_t r = 0; r < R; r++) {
+            xlns16_quantize_b8(&W[r*C], &W8[r*nb], C);
+            xlns16_quantize_b6(&W[r*C], &W6[r*nb], C);
+            xlns16_dequantize_b8(&W8[r*nb], d.data(), C);
+            e8[r] = xlns16_vec_dot(d.data(), x.data(), C);
+            xlns16_dequantize_b6(&W6[r*nb], d.data(), C);
+            e6[r] = xlns16_vec_dot(d.data(), x.data(), C);
+        }
+        size_t bad = 0;
+        for (size_t r = 0; r < R; r++)
+            bad += (xlns16_vec_dot_b8(&W8[r*nb], x.data(), C) != e8[r]) + (xlns16_vec_dot_b6(&W6[r*nb], x.data(), C) != e6[r]);
+        printf("  %-16s %5zu %5zu  %7s  %10zu      %s\n", "xlns16_vec_dot_b8/6", R, C, "-", bad, bad == 0 ? "yes" : "NO");
+        for (int t = 1; t <= 3; t += 2) {
+            xlns_pool_init(t);
+            xlns16_gemv_b8(W8.data(), x.data(), y.data(), R, C);
+            bad = 0;
+            for (size_t r = 0; r < R; r++) bad += y[r] != e8[r];
+            printf("  %-16s %5zu %5zu  %7d  %10zu      %s\n", "xlns16_gemv_b8", R, C, t, bad, bad == 0 ? "yes" : "NO");
+            xlns16_gemv_b6(W6.data(), x.data(), y.data(), R, C);
+            bad = 0;
+            for (size_t r = 0; r < R; r++) bad += y[r] != e6[r];
+            printf("  %-16s %5zu %5zu  %7d  %10zu      %s\n", "xlns16_gemv_b6", R, C, t, bad, bad == 0 ? "yes" : "NO");
+        }
+    }
+    xlns_parallel_min = 1<<15;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  block-scaled LNS weight formats test                       \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512F__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_decode();
+    test_roundtrip();
+    test_products();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Test file for the xlns16 matrix-vector products
+// Functions: xlns16_gemv, xlns16_gemv_t, xlns16_gemv_lpvip32, xlns16_gemv_t_lpvip32,
+//            xlns16_gemv_monte, xlns16_gemv_t_monte, consecutive monte calls
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns16_gemv_test.cpp -o xlns16_gemv_test -lm && ./xlns16_gemv_test
+//         (also try -mavx2 and -mavx512f; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+#include "../xlns16monte_bylpvip.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+static const struct { size_t rows, cols; } shapes[] = {
+    { 1, 1 }, { 3, 17 }, { 37, 300 }, { 64, 4097 }, { 513, 700 }, { 1000, 257 }
+};
+static const int nshapes = sizeof(shapes)/sizeof(shapes[0]);
+static const int threads[] = { 1, 2, 4 };
+
+// -----------------------------------------------------------
+//  every output against the matching vector kernel, 1/2/4 threads
+// -----------------------------------------------------------
+void test_against_vec_dot() {
+    printf("--- gemv outputs vs vector kernels ---\n");
+    printf("  function                 rows  cols  threads  mismatches      ok\n");
+    const char *names[] = { "xlns16_gemv", "xlns16_gemv_t", "xlns16_gemv_lpvip32",
+                            "xlns16_gemv_t_lpvip32", "xlns16_gemv_monte" };
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < nshapes; s++) {
+        size_t R = shapes[s].rows, C = shapes[s].cols;
+        std::vector<xlns16> W(R*C), x(C), xt(R), y(C > R ? C : R), col(R), e(C > R ? C : R);
+        srand(10 + s);
+        for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns16(rndf());
+        for (size_t i = 0; i < C; i++) x[i] = fp2xlns16(rndf());
+        for (size_t i = 0; i < R; i++) xt[i] = fp2xlns16(rndf());
+        for (int k = 0; k < 5; k++) {
+            // expected
+            size_t nout = (k == 1 || k == 3) ? C : R;
+            xlns16 base = 7;
+            for (size_t o = 0; o < nout; o++) {
+                if (k == 1 || k == 3) {
+                    for (size_t r = 0; r < R; r++) col[r] = W[r*C + o];
+                    e[o] = (k == 1) ? xlns16_vec_dot(col.data(), xt.data(), R)
+                                    : xlns16_vec_dot_lpvip32(col.data(), xt.data(), R);
+                } else if (k == 0) {
+                    e[o] = xlns16_vec_dot(&W[o*C], x.data(), C);
+                } else if (k == 2) {
+                    e[o] = xlns16_vec_dot_lpvip32_simd(&W[o*C], x.data(), C);
+                } else {
+                    xlns16_monte_stream stream(base, o);
+                    e[o] = xlns16_vec_dot_monte(&W[o*C], x.data(), C);
+                }
+            }
+            for (int t = 0; t < 3; t++) {
+                xlns_pool_init(threads[t]);
+                xlns16_randombits = 7;
+                switch (k) {
+                case 0: xlns16_gemv(W.data(), x.data(), y.data(), R, C); break;
+                case 1: xlns16_gemv_t(W.data(), xt.data(), y.data(), R, C); break;
+                case 2: xlns16_gemv_lpvip32(W.data(), x.data(), y.data(), R, C); break;
+                case 3: xlns16_gemv_t_lpvip32(W.data(), xt.data(), y.data(), R, C); break;
+                case 4: xlns16_gemv_monte(W.data(), x.data(), y.data(), R, C); break;
+                }
+                size_t bad = 0;
+                for (size_t o = 0; o < nout; o++) bad += y[o] != e[o];
+                printf("  %-22s %5zu %5zu  %7d  %10zu      %s\n", names[k], R, C, threads[t], bad,
+                       bad == 0 ? "yes" : "NO");
+            }
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns16_gemv_t_monte: same bits for any thread count
+// -----------------------------------------------------------
+void test_monte_t_threads() {
+    printf("--- xlns16_gemv_t_monte thread sweep ---\n");
+    printf("  rows  cols  threads  differing      ok\n");
+    size_t R = 300, C = 2000;
+    std::vector<xlns16> W(R*C), x(R), y(C), r1(C);
+    srand(20);
+    for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns16(rndf());
+    for (size_t i = 0; i < R; i++) x[i] = fp2xlns16(rndf());
+    xlns_parallel_min = 1000;
+    for (int t = 1; t <= 8; t++) {
+        xlns_pool_init(t);
+        xlns16_randombits = 7;
+        xlns16_gemv_t_monte(W.data(), x.data(), t == 1 ? r1.data() : y.data(), R, C);
+        if (t == 1) continue;
+        size_t diff = 0;
+        for (size_t c = 0; c < C; c++) diff += y[c] != r1[c];
+        printf("  %4zu %5zu  %7d  %9zu      %s\n", R, C, t, diff, diff == 0 ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  consecutive monte calls: different noise each call, and the
+//  same bits again from the same seed
+// -----------------------------------------------------------
+void test_monte_calls() {
+    printf("--- consecutive monte calls from one seed ---\n");
+    printf("  function               call  differ from call 1  repeat differs      ok\n");
+    const char *names[] = { "xlns16_gemv_monte", "xlns16_gemv_t_monte", "xlns16_sum_monte_tree" };
+    size_t R = 300, C = 2000;
+    std::vector<xlns16> W(R*C), x(C), xt(R);
+    srand(30);
+    for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns16(rndf());
+    for (size_t i = 0; i < C; i++) x[i] = fp2xlns16(rndf());
+    for (size_t i = 0; i < R; i++) xt[i] = fp2xlns16(rndf());
+    xlns_parallel_min = 1000;
+    xlns_pool_init(4);
+    for (int k = 0; k < 3; k++) {
+        std::vector<xlns16> y[2][3];
+        for (int rep = 0; rep < 2; rep++) {
+            xlns16_randombits = 7;
+            for (int c = 0; c < 3; c++) {
+                y[rep][c].assign(C, 0);
+                if (k == 0) xlns16_gemv_monte(W.data(), x.data(), y[rep][c].data(), R, C);
+                else if (k == 1) xlns16_gemv_t_monte(W.data(), xt.data(), y[rep][c].data(), R, C);
+                else y[rep][c][0] = xlns16_sum_monte_tree(W.data(), C);   // one chunk
+            }
+        }
+        size_t nout = (k == 0) ? R : (k == 1) ? C : 1;
+        for (int c = 1; c < 3; c++) {
+            size_t diff = 0, again = 0;
+            for (size_t o = 0; o < nout; o++) {
+                diff += y[0][c][o] != y[0][0][o];
+                again += y[1][c][o] != y[0][c][o];
+            }
+            int ok = ((k == 2) ? diff == 1 : diff > nout/2) && again == 0;
+            printf("  %-22s %4d  %18zu  %14zu      %s\n", names[k], c + 1, diff, again, ok ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns16 GEMV test                                           \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512F__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_against_vec_dot();
+    test_monte_t_threads();
+    test_monte_calls();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Test file for the SIMD lpvip32 adder and the multi-lane lpvip32 kernels
+// Functions: xlns32_batch_add_lpvip, xlns16_sum_lpvip32_simd, xlns16_vec_dot_lpvip32_simd,
+//            xlns16_layernorm_lpvip32_simd, xlns16_softmax_lpvip32_simd
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -mavx2 -I.. xlns16_lpvip32_simd_test.cpp -o xlns16_lpvip32_simd_test -lm && ./xlns16_lpvip32_simd_test
+//         (also try -mavx512f, and no -m flag for the portable code; all three must print the same)
+
+#define xlns32_aicasb
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cmath>
+
+static float relerr(float got, float expected) {
+    if (fabsf(expected) < 1e-10f) return 0.0f;
+    return fabsf(got - expected) / fabsf(expected) * 100.0f;
+}
+
+static unsigned rnd32() {
+    return ((unsigned)rand() << 16) ^ (unsigned)rand();
+}
+
+// -----------------------------------------------------------
+//  xlns32_batch_add_lpvip vs scalar xlns32_add_lpvip
+// -----------------------------------------------------------
+void test_batch_add_lpvip() {
+    printf("--- xlns32_batch_add_lpvip (lane-wise vs scalar) ---\n");
+    printf("  operands              pairs     mismatches  ok\n");
+
+    const size_t N = 100000;
+    static xlns32 a[N], b[N], c[N];
+    const char *labels[] = { "random", "same sign near", "cancellation", "singularity" };
+    for (int kind = 0; kind < 4; kind++) {
+        srand(kind + 1);
+        for (size_t i = 0; i < N; i++) {
+            a[i] = rnd32();
+            switch (kind) {
+            case 0: b[i] = rnd32(); break;
+            case 1: b[i] = a[i] + (rnd32() % (16u<<xlns32_F)) - (8u<<xlns32_F); break;
+            case 2: b[i] = xlns32_neg(a[i]) + (rnd32() % (8u<<xlns32_F)) - (4u<<xlns32_F); break;
+            default: b[i] = xlns32_neg(a[i]) + (rnd32() % (2u<<xlns32_F)) - (1u<<xlns32_F); break;
+            }
+            if (i % 97 == 0) b[i] = xlns32_neg(a[i]);   // exact cancellation
+        }
+        xlns32_batch_add_lpvip(a, b, c, N);
+        size_t bad = 0;
+        for (size_t i = 0; i < N; i++)
+            if (c[i] != xlns32_add_lpvip(a[i], b[i])) bad++;
+        printf("  %-18s  %8zu   %8zu    %s\n", labels[kind], N, bad, bad ? "NO" : "yes");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns16_sum_lpvip32_simd / xlns16_vec_dot_lpvip32_simd vs portable lane order
+// -----------------------------------------------------------
+void test_sum_dot_simd() {
+    printf("--- xlns16_sum/vec_dot_lpvip32_simd (vs portable xlns32_lpvip_acc_push) ---\n");
+    printf("      n   sum: got   ref    ok   dot: got   ref    ok   fp32 sum    lanes sum  err%%\n");
+
+    size_t ns[] = { 0, 1, 5, 31, 32, 33, 64, 100, 257, 1000, 4097, 10000 };
+    static xlns16 a[10000], b[10000], p[10000];
+    static xlns32 w[10000];
+    srand(7);
+    for (size_t n : ns) {
+        float fsum = 0.0f;
+        for (size_t i = 0; i < n; i++) {
+            float af = 4.0f*((float)rand())/RAND_MAX - 1.0f;
+            float bf = 4.0f*((float)rand())/RAND_MAX - 1.0f;
+            a[i] = fp2xlns16(af);
+            b[i] = fp2xlns16(bf);
+            fsum += af;
+        }
+        xlns32_lpvip_acc acc;
+        for (size_t i = 0; i < n; i++) w[i] = ((xlns32)a[i])<<16;
+        xlns32_lpvip_acc_init(&acc);
+        xlns32_lpvip_acc_push(&acc, w, n);
+        xlns16 sref = xlns32_lpvip_acc_result(&acc)>>16;
+        xlns16 sgot = xlns16_sum_lpvip32_simd(a, n);
+
+        for (size_t i = 0; i < n; i++) { p[i] = xlns16_mul(a[i], b[i]); w[i] = ((xlns32)p[i])<<16; }
+        xlns32_lpvip_acc_init(&acc);
+        xlns32_lpvip_acc_push(&acc, w, n);
+        xlns16 dref = xlns32_lpvip_acc_result(&acc)>>16;
+        xlns16 dgot = xlns16_vec_dot_lpvip32_simd(a, b, n);
+
+        float got = xlns162fp(sgot);
+        printf("  %5zu   %04x   %04x   %-3s       %04x   %04x   %-3s  %10.4f  %10.4f  %5.2f%%\n",
+               n, sgot, sref, (sgot == sref) ? "yes" : "NO", dgot, dref, (dgot == dref) ? "yes" : "NO",
+               fsum, got, relerr(got, fsum));
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  layernorm / softmax: _simd vs scalar lpvip32 vs float
+// -----------------------------------------------------------
+void test_layernorm_softmax_simd() {
+    printf("--- xlns16_layernorm_lpvip32_simd / xlns16_softmax_lpvip32_simd ---\n");
+    printf("  i    x[i]      fp32 ln    lpvip32    _simd      fp32 sm    lpvip32    _simd\n");
+
+    const size_t N = 300;
+    static float xf[N], lnf[N], smf[N];
+    static xlns16 x[N], ln1[N], ln2[N], sm1[N], sm2[N];
+    srand(11);
+    float mean = 0.0f, var = 0.0f, mx = -1e30f, tot = 0.0f;
+    for (size_t i = 0; i < N; i++) {
+        xf[i] = 4.0f*((float)rand())/RAND_MAX - 1.0f;
+        x[i] = fp2xlns16(xf[i]);
+        xf[i] = xlns162fp(x[i]);
+        mean += xf[i];
+        if (xf[i] > mx) mx = xf[i];
+    }
+    mean /= N;
+    for (size_t i = 0; i < N; i++) var += (xf[i]-mean)*(xf[i]-mean);
+    var /= N;
+    for (size_t i = 0; i < N; i++) { lnf[i] = (xf[i]-mean)/sqrtf(var+1e-5f); smf[i] = expf(xf[i]-mx); tot += smf[i]; }
+    for (size_t i = 0; i < N; i++) smf[i] /= tot;
+
+    xlns16_layernorm_lpvip32(x, ln1, NULL, NULL, N, 1e-5f);
+    xlns16_layernorm_lpvip32_simd(x, ln2, NULL, NULL, N, 1e-5f);
+    xlns16_softmax_lpvip32(x, sm1, N);
+    xlns16_softmax_lpvip32_simd(x, sm2, N);
+    for (size_t i = 0; i < N; i += 37)
+        printf("  %3zu  %7.4f   %8.4f   %8.4f   %8.4f   %8.6f   %8.6f   %8.6f\n", i, xf[i],
+               lnf[i], xlns162fp(ln1[i]), xlns162fp(ln2[i]), smf[i], xlns162fp(sm1[i]), xlns162fp(sm2[i]));
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns32 lpvip SIMD adder / multi-lane lpvip32 kernels test  \n");
+    #if defined(__AVX512F__)
+    printf("  (AVX-512 build)\n");
+    #elif defined(__AVX2__)
+    printf("  (AVX2 build)\n");
+    #else
+    printf("  (portable build)\n");
+    #endif
+    printf("=============================================================\n\n");
+
+    test_batch_add_lpvip();
+    test_sum_dot_simd();
+    test_layernorm_softmax_simd();
+
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Test file for the packed xlns8 / xlns12 storage
+// Functions: xlns82xlns16, xlns162xlns8, xlns122xlns16, xlns162xlns12, xlns12_get, xlns12_set,
+//            xlns16_batch_to_xlns8, xlns16_batch_from_xlns8, xlns16_batch_to_xlns12,
+//            xlns16_batch_from_xlns12, xlns16_vec_dot_xlns8, xlns16_vec_dot_xlns12,
+//            xlns16_gemv_xlns8, xlns16_gemv_xlns12, xlns8_add, xlns8_mul (xlns8_table)
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns16_narrow_test.cpp -o xlns16_narrow_test -lm && ./xlns16_narrow_test
+//         (also try -mavx2 and -mavx512f; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#define xlns8_table
+#include "../xlns16.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+static const struct { size_t rows, cols; } shapes[] = {
+    { 1, 1 }, { 3, 17 }, { 37, 300 }, { 64, 4097 }, { 513, 701 }
+};
+static const int nshapes = sizeof(shapes)/sizeof(shapes[0]);
+static const int threads[] = { 1, 3 };
+
+// -----------------------------------------------------------
+//  every code round-trips; every xlns16 converts to the nearest
+//  code (within half a step), flushing or saturating out of range
+// -----------------------------------------------------------
+void test_codes() {
+    printf("--- xlns8 / xlns12 codes, exhaustive ---\n");
+    printf("  check                              cases  failures      ok\n");
+    size_t bad = 0;
+    for (unsigned c = 0; c < 256; c++)
+        bad += xlns162xlns8(xlns82xlns16(c)) != ((c & 0x7f) ? c : 0);
+    printf("  %-32s %7d  %8zu      %s\n", "xlns8 -> xlns16 -> xlns8", 256, bad, bad == 0 ? "yes" : "NO");
+    bad = 0;
+    for (unsigned c = 0; c < 4096; c++)
+        bad += xlns162xlns12(xlns122xlns16(c)) != ((c & 0x7ff) ? c : 0);
+    printf("  %-32s %7d  %8zu      %s\n", "xlns12 -> xlns16 -> xlns12", 4096, bad, bad == 0 ? "yes" : "NO");
+    for (int w = 0; w < 2; w++) {
+        int step = w ? 1 : 16, lo = 0x3c00 + step, hi = 0x3c00 + (w ? 0x7ff : 0x7f0);
+        bad = 0;
+        for (unsigned x = 0; x < 65536; x++) {
+            int a = xlns16_abs(x);
+            xlns16 r = w ? xlns122xlns16(xlns162xlns12(x)) : xlns82xlns16(xlns162xlns8(x));
+            int ra = xlns16_abs(r);
+            if (a < lo - step/2)
+                bad += r != xlns16_zero;
+            else if (a > hi)
+                bad += ra != hi || xlns16_sign(r) != xlns16_sign(x);
+            else
+                bad += 2*abs(ra - a) > step || (2*abs(ra - a) == step && ra < a) || xlns16_sign(r) != xlns16_sign(x);
+        }
+        printf("  %-32s %7d  %8zu      %s\n", w ? "xlns16 -> xlns12 nearest" : "xlns16 -> xlns8 nearest", 65536,
+               bad, bad == 0 ? "yes" : "NO");
+    }
+    std::vector<xlns12x2> p(5);
+    memset(p.data(), 0xff, 5*sizeof(xlns12x2));
+    bad = 0;
+    for (size_t i = 0; i < 10; i++) xlns12_set(p.data(), i, 0x123*i);
+    for (size_t i = 0; i < 10; i++) bad += xlns12_get(p.data(), i) != ((0x123*i) & 0xfff);
+    printf("  %-32s %7d  %8zu      %s\n", "xlns12_set / xlns12_get", 10, bad, bad == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  batch conversions (SIMD unpack with -mavx2) against the
+//  scalar ones, odd lengths, 1/3 threads
+// -----------------------------------------------------------
+void test_batch() {
+    printf("--- batch conversions vs scalar ---\n");
+    printf("  function                    n  threads  mismatches      ok\n");
+    const size_t sizes[] = { 0, 1, 31, 32, 33, 1001, 100000 };
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < 7; s++) {
+        size_t n = sizes[s];
+        std::vector<xlns16> x(n + 1), y(n + 1);
+        std::vector<xlns8> c8(n + 1);
+        std::vector<xlns12x2> c12(n/2 + 1);
+        srand(5 + s);
+        for (size_t i = 0; i < n; i++) x[i] = (xlns16)rand();
+        for (int t = 0; t < 2; t++) {
+            xlns_pool_init(threads[t]);
+            size_t bad[4] = { 0, 0, 0, 0 };
+            xlns16_batch_to_xlns8(x.data(), c8.data(), n);
+            for (size_t i = 0; i < n; i++) bad[0] += c8[i] != xlns162xlns8(x[i]);
+            xlns16_batch_from_xlns8(c8.data(), y.data(), n);
+            for (size_t i = 0; i < n; i++) bad[1] += y[i] != xlns82xlns16(c8[i]);
+            xlns16_batch_to_xlns12(x.data(), c12.data(), n);
+            for (size_t i = 0; i < n; i++) bad[2] += xlns12_get(c12.data(), i) != xlns162xlns12(x[i]);
+            if (n & 1) bad[2] += xlns12_get(c12.data(), n) != 0;
+            xlns16_batch_from_xlns12(c12.data(), y.data(), n);
+            for (size_t i = 0; i < n; i++) bad[3] += y[i] != xlns122xlns16(xlns12_get(c12.data(), i));
+            const char *names[] = { "xlns16_batch_to_xlns8", "xlns16_batch_from_xlns8",
+                                    "xlns16_batch_to_xlns12", "xlns16_batch_from_xlns12" };
+            for (int k = 0; k < 4; k++)
+                printf("  %-24s %6zu  %7d  %10zu      %s\n", names[k], n, threads[t], bad[k],
+                       bad[k] == 0 ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  dot products and GEMVs against xlns16_vec_dot on the weights
+//  converted back to xlns16, 1/3 threads
+// -----------------------------------------------------------
+void test_gemv() {
+    printf("--- packed GEMV / dot vs xlns16_vec_dot ---\n");
+    printf("  function                rows  cols  threads  mismatches      ok\n");
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < nshapes; s++) {
+        size_t R = shapes[s].rows, C = shapes[s].cols, ld = C + (C & 1);
+        std::vector<xlns16> W(R*C), W8(R*C), W12(R*C), x(C), y(R), e8(R), e12(R);
+        std::vector<xlns8> P8(R*C);
+        std::vector<xlns12x2> P12(R*ld/2);
+        srand(20 + s);
+        for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns16(rndf());
+        for (size_t i = 0; i < C; i++) x[i] = fp2xlns16(rndf());
+        xlns16_batch_to_xlns8(W.data(), P8.data(), R*C);
+        xlns16_batch_from_xlns8(P8.data(), W8.data(), R*C);
+        for (size_t r = 0; r < R; r++) {
+            xlns16_batch_to_xlns12(&W[r*C], &P12[r*ld/2], C);
+            xlns16_batch_from_xlns12(&P12[r*ld/2], &W12[r*C], C);
+            e8[r] = xlns16_vec_dot(&W8[r*C], x.data(), C);
+            e12[r] = xlns16_vec_dot(&W12[r*C], x.data(), C);
+        }
+        size_t bad = 0;
+        for (size_t r = 0; r < R; r++)
+            bad += xlns16_vec_dot_xlns8(&P8[r*C], x.data(), C) != e8[r] ||
+                   xlns16_vec_dot_xlns12(&P12[r*ld/2], x.data(), C) != e12[r];
+        printf("  %-22s %5zu %5zu  %7s  %10zu      %s\n", "xlns16_vec_dot_xlns8/12", R, C, "-", bad,
+               bad == 0 ? "yes" : "NO");
+        for (int t = 0; t < 2; t++) {
+            xlns_pool_init(threads[t]);
+            xlns16_gemv_xlns8(P8.data(), x.data(), y.data(), R, C);
+            bad = 0;
+            for (size_t r = 0; r < R; r++) bad += y[r] != e8[r];
+            printf("  %-22s %5zu %5zu  %7d  %10zu      %s\n", "xlns16_gemv_xlns8", R, C, threads[t], bad,
+                   bad == 0 ? "yes" : "NO");
+            xlns16_gemv_xlns12(P12.data(), x.data(), y.data(), R, C);
+            bad = 0;
+            for (size_t r = 0; r < R; r++) bad += y[r] != e12[r];
+            printf("  %-22s %5zu %5zu  %7d  %10zu      %s\n", "xlns16_gemv_xlns12", R, C, threads[t], bad,
+                   bad == 0 ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns8_add / xlns8_mul tables: all 65536 operand pairs
+// -----------------------------------------------------------
+void test_tables() {
+    printf("--- xlns8_add / xlns8_mul tables, exhaustive ---\n");
+    printf("  function       pairs  mismatches      ok\n");
+    size_t bada = 0, badm = 0;
+    for (unsigned a = 0; a < 256; a++)
+        for (unsigned b = 0; b < 256; b++) {
+            bada += xlns8_add(a, b) != xlns162xlns8(xlns16_add(xlns82xlns16(a), xlns82xlns16(b)));
+            badm += xlns8_mul(a, b) != xlns162xlns8(xlns16_mul(xlns82xlns16(a), xlns82xlns16(b)));
+        }
+    printf("  %-12s %7d  %10zu      %s\n", "xlns8_add", 65536, bada, bada == 0 ? "yes" : "NO");
+    printf("  %-12s %7d  %10zu      %s\n", "xlns8_mul", 65536, badm, badm == 0 ? "yes" : "NO");
+    float v = xlns162fp(xlns82xlns16(xlns8_add(xlns162xlns8(fp2xlns16(1.5f)), xlns162xlns8(fp2xlns16(2.5f)))));
+    printf("  1.5 + 2.5 in xlns8 = %g (expected about 4)      %s\n", v, fabs(v - 4.0f) < 0.4f ? "yes" : "NO");
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns8 / xlns12 packed storage test                         \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512F__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_codes();
+    test_batch();
+    test_gemv();
+    test_tables();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Test file for the quadratic-interpolation sb and db of xlns32 (xlns32_quad, xlns32_dbquad)
+// Functions: xlns32_sb_quad, xlns32_db_quad (xlns32quadtbl.h), against xlns32_sb_macro and
+//            xlns32_dbtrans3; xlns32_add on top of them
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -I.. xlns32_quad_test.cpp -o xlns32_quad_test -lm && ./xlns32_quad_test
+
+#define xlns32_quad
+#define xlns32_dbquad
+#define xlns32_alt
+#include "../xlns32.cpp"
+
+#include <cstdio>
+#include <cmath>
+
+// exact values, in units of 2^-23
+static long double sb_exact(xlns32 z) {
+    return z + log2l(1.0L + exp2l(-(long double)z/xlns32_scale))*xlns32_scale;
+}
+static long double db_exact(xlns32 z) {
+    return z + log2l(1.0L - exp2l(-(long double)z/xlns32_scale))*xlns32_scale;
+}
+
+// -----------------------------------------------------------
+//  sb: quadratic vs linear interpolation against the exact
+//  value, every 61st z, grouped by octave of z
+// -----------------------------------------------------------
+void test_sb() {
+    printf("--- xlns32_sb_quad and xlns32_sb_macro vs exact sb (every 61st z) ---\n");
+    printf("                       quad                   macro (linear)\n");
+    printf("  octaves      cases   max err  %% rounded     max err  %% rounded      ok\n");
+    const int groups[] = { 0, 1, 5, 10, 15, 20, 26 };
+    for (int g = 0; g < 6; g++) {
+        long cases = 0, qok = 0, mok = 0;
+        double qmax = 0, mmax = 0;
+        for (xlns32 z = groups[g]*xlns32_scale; z < (xlns32)groups[g+1]*xlns32_scale; z += 61) {
+            long double e = sb_exact(z);
+            xlns32 r = (xlns32)(e + .5L), q = xlns32_sb_quad(z), m = xlns32_sb_macro(z);
+            double dq = fabsl(q - e), dm = fabsl(m - e);
+            if (dq > qmax) qmax = dq;
+            if (dm > mmax) mmax = dm;
+            qok += q == r;
+            mok += m == r;
+            cases++;
+        }
+        printf("  %2d .. %2d  %9ld  %8.3f  %8.3f    %8.3f  %8.3f      %s\n", groups[g], groups[g+1]-1, cases,
+               qmax, 100.0*qok/cases, mmax, 100.0*mok/cases, qmax <= 0.51 ? "yes" : "NO");
+    }
+    // past the tables, and the edges of every octave
+    int bad = 0;
+    const xlns32 far[] = { 25*xlns32_scale, xlns32_esszer, 0x10000000, 0x7fffffff };
+    for (xlns32 z : far)
+        bad += xlns32_sb_quad(z) != z;
+    for (int k = 0; k < xlns32_sbqoct; k++)
+        for (int d = -2; d <= 2; d++) {
+            xlns32 z = k*xlns32_scale + d;
+            if ((xlns32_signed)z >= 0 && fabsl(xlns32_sb_quad(z) - sb_exact(z)) > 0.51) bad++;
+        }
+    printf("  octave edges and z past the tables: %d bad      %s\n", bad, bad ? "NO" : "yes");
+    printf("  tables: %d bytes\n\n", (int)(sizeof(xlns32_sbqoctave) +
+                                         sizeof(xlns32_sbqnode) + sizeof(xlns32_sbqc2)));
+}
+
+// as xlns32_db_ideal computes it (in double)
+static xlns32_signed db_ideal(xlns32 z) {
+    return (xlns32_signed)((log(pow(2.0, ((double)z)/xlns32_scale) - 1)/log(2.0))*xlns32_scale + .5);
+}
+
+// -----------------------------------------------------------
+//  db: quadratic interpolation against the exact value and
+//  xlns32_db_ideal, every z near the singularity and every
+//  61st z above, grouped by octave of z
+// -----------------------------------------------------------
+void test_db_quad() {
+    printf("--- xlns32_db_quad vs exact db and xlns32_db_ideal ---\n");
+    printf("                                    xlns32_db_quad        xlns32_db_ideal\n");
+    printf("  region                    cases   max err  %% rounded     max err  %% equal      ok\n");
+    const struct { xlns32 lo, hi, step; const char *name; } regions[] = {
+        { 1, 1 << 16, 1, "z < 2^-7 (all)" },
+        { 1 << 16, xlns32_scale, 61, "2^-7 <= z < 1" },
+        { xlns32_scale, 3*xlns32_scale, 61, "1 <= z < 3" },
+        { 3*xlns32_scale, 10*xlns32_scale, 61, "3 <= z < 10" },
+        { 10*xlns32_scale, 26*xlns32_scale, 61, "10 <= z < 26" },
+    };
+    for (int r = 0; r < 5; r++) {
+        long cases = 0, nok = 0, iok = 0;
+        double emax = 0, imax = 0;
+        for (xlns32 z = regions[r].lo; z < regions[r].hi; z += regions[r].step) {
+            long double e = db_exact(z);
+            xlns32_signed q = (xlns32_signed)xlns32_db_quad(z);
+            xlns32_signed id = db_ideal(z);
+            double d = fabsl(q - e);
+            if (d > emax) emax = d;
+            d = fabsl(id - e);
+            if (d > imax) imax = d;
+            nok += q == (xlns32_signed)floorl(e + .5L);
+            iok += q == id;
+            cases++;
+        }
+        printf("  %-20s %10ld  %8.3f  %8.3f    %8.3f  %8.3f      %s\n", regions[r].name, cases, emax,
+               100.0*nok/cases, imax, 100.0*iok/cases, emax <= 0.51 ? "yes" : "NO");
+    }
+    printf("  (below z = 1, db < 0, and xlns32_db_ideal adds 1/2 and truncates toward zero, so it\n");
+    printf("   can be up to 1.5 units high)\n");
+    int bad = 0;
+    const xlns32 far[] = { 25*xlns32_scale, xlns32_esszer, 0x10000000, 0x7fffffff };
+    for (xlns32 z : far)
+        bad += xlns32_db_quad(z) != z;
+    printf("  z past the tables: %d bad      %s\n", bad, bad ? "NO" : "yes");
+    printf("  tables: %d bytes (dbtrans3: %d bytes, and two sb calls)\n\n",
+           (int)(sizeof(xlns32_dbqoctave) + sizeof(xlns32_dbqnode) + sizeof(xlns32_dbqc2) +
+                 sizeof(xlns32_log2qnode) + sizeof(xlns32_log2qc2)),
+           (int)(sizeof(xlns32_db0table) + sizeof(xlns32_db1table) + sizeof(xlns32_db2table)));
+}
+
+// -----------------------------------------------------------
+//  db by cotransformation, now calling xlns32_sb_quad
+// -----------------------------------------------------------
+void test_db() {
+    printf("--- xlns32_dbtrans3 (through xlns32_sb_quad) vs exact db ---\n");
+    printf("  (with xlns32_sb_macro the errors are about twice as large)\n");
+    printf("  region              cases   max err (units)      ok\n");
+    const struct { xlns32 lo, hi; double tol; const char *name; } regions[] = {
+        { 1, xlns32_scale/256, 2.0, "z < 1/256" },
+        { xlns32_scale/256, xlns32_scale, 2.0, "1/256 <= z < 1" },
+        { xlns32_scale, xlns32_esszer, 2.0, "1 <= z < esszer" },
+    };
+    for (int r = 0; r < 3; r++) {
+        long cases = 0;
+        double emax = 0;
+        xlns32 step = (regions[r].hi - regions[r].lo)/200000 + 1;
+        for (xlns32 z = regions[r].lo; z < regions[r].hi; z += step) {
+            double d = fabsl((xlns32_signed)xlns32_dbtrans3(z) - db_exact(z));
+            if (d > emax) emax = d;
+            cases++;
+        }
+        printf("  %-16s %8ld   %15.3f      %s\n", regions[r].name, cases, emax,
+               emax <= regions[r].tol ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns32_add against the exact sum of the two values
+// -----------------------------------------------------------
+void test_add() {
+    printf("--- xlns32_add (xlns32_quad, xlns32_dbquad) vs exact sum ---\n");
+    printf("  signs             cases   max err (units)      ok\n");
+    srand(7);
+    for (int neg = 0; neg < 2; neg++) {
+        double emax = 0;
+        long cases = 0;
+        for (int i = 0; i < 200000; i++) {
+            xlns32 x = xlns32_logsignmask + (((xlns32)rand() << 8) ^ rand())%(40*xlns32_scale) - 20*xlns32_scale;
+            xlns32 y = xlns32_logsignmask + (((xlns32)rand() << 8) ^ rand())%(40*xlns32_scale) - 20*xlns32_scale;
+            if (neg)
+                y |= xlns32_signmask;
+            xlns32 s = xlns32_add(x, y);
+            long double lx = (long double)((xlns32_signed)(x & xlns32_logmask) - xlns32_logsignmask)/xlns32_scale;
+            long double ly = (long double)((xlns32_signed)(y & xlns32_logmask) - xlns32_logsignmask)/xlns32_scale;
+            long double v = exp2l(lx) + (neg ? -exp2l(ly) : exp2l(ly));
+            long double ls = (long double)((xlns32_signed)(s & xlns32_logmask) - xlns32_logsignmask)/xlns32_scale;
+            double d = fabsl(ls - log2l(fabsl(v)))*xlns32_scale;
+            if (d > emax) emax = d;
+            cases++;
+        }
+        printf("  %-14s %8ld   %15.3f      %s\n", neg ? "x + (-y)" : "x + y", cases, emax,
+               emax <= 0.51 ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns32 quadratic-interpolation sb and db test              \n");
+    printf("=============================================================\n\n");
+
+    test_sb();
+    test_db_quad();
+    test_db();
+    test_add();
+
+    printf("All tests done.\n");
+    return 0;
+}
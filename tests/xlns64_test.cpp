@@ -0,0 +1,234 @@
+// Test file for the 64-bit LNS format and the xlns64 accumulation of xlns32
+// Functions: xlns64_sb, xlns64_db, xlns64_add, xlns64_mul, xlns64_div, fp2xlns64, xlns642fp,
+//            xlns64_sum, xlns64_vec_dot, xlns322xlns64, xlns642xlns32, xlns32_sum_xlns64,
+//            xlns32_vec_dot_xlns64, xlns64_float
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -I.. xlns64_test.cpp -o xlns64_test -lm && ./xlns64_test
+//         (long double log2l/exp2l is the reference)
+
+#define xlns32_alt
+#include "../xlns32.cpp"
+#include "../xlns64.cpp"
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+static const long double sc = 4503599627370496.0L;     // 2^52
+
+static double rndu() {
+    return ((double)rand())/RAND_MAX;
+}
+
+// exact log2|x| of an xlns64 in units of 2^-52
+static long double log64(xlns64 x) {
+    return (long double)(xlns64_signed)(xlns64_abs(x) - xlns64_logsignmask);
+}
+
+// exact log2|x| of an xlns32 in units of 2^-23, and its value
+static long double log32(xlns32 x) {
+    return (long double)(xlns32_signed)(xlns32_abs(x) - xlns32_logsignmask);
+}
+
+static long double val32(xlns32 x) {
+    return (xlns32_sign(x) ? -1 : 1)*exp2l(log32(x)/(1<<23));
+}
+
+// -----------------------------------------------------------
+//  sb and db against log2l, by region of d = negz/2^52
+// -----------------------------------------------------------
+void test_sbdb() {
+    printf("--- xlns64_sb / xlns64_db vs long double ---\n");
+    printf("  function  region                   cases   max err (units)      ok\n");
+    const char *regions[] = { "d < 2^-40", "d < 1/256", "1/256 <= d < 1", "1 <= d < 54" };
+    for (int db = 0; db < 2; db++)
+        for (int g = 0; g < 4; g++) {
+            srand(1 + g + 4*db);
+            long double maxe = 0;
+            const int cases = 200000;
+            for (int k = 0; k < cases; k++) {
+                double u = rndu();
+                xlns64_signed negz;
+                switch (g) {
+                case 0:  negz = 1 + (xlns64_signed)(u*(1<<12)); break;
+                case 1:  negz = (xlns64_signed)(exp2(-8 - 32*u)*(double)sc); break;
+                case 2:  negz = (xlns64_signed)((1/256.0 + u*(1 - 1/256.0))*(double)sc); break;
+                default: negz = (xlns64_signed)((1 + u*53.0)*(double)sc); break;
+                }
+                if (negz < 1) negz = 1;
+                long double d = negz/sc;
+                long double ref = db ? log2l(-expm1l(-d*0.693147180559945309417232121458L)) : log2l(1 + exp2l(-d));
+                long double err = fabsl((long double)(db ? xlns64_db(negz) : xlns64_sb(negz)) - ref*sc);
+                if (err > maxe) maxe = err;
+            }
+            printf("  %-8s  %-20s  %8d   %15.3Lf      %s\n", db ? "xlns64_db" : "xlns64_sb", regions[g], cases, maxe,
+                   maxe < 0.55 ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  add (same and opposite signs, near cancellation, beyond
+//  xlns64_esszer), mul and div, including saturation
+// -----------------------------------------------------------
+void test_arith() {
+    printf("--- xlns64_add / xlns64_mul / xlns64_div ---\n");
+    printf("  check                           cases   max err (units)      ok\n");
+    srand(11);
+    long double maxe = 0;
+    const int cases = 300000;
+    for (int k = 0; k < cases; k++) {
+        xlns64 x = ((xlns64)rand() << 40) ^ ((xlns64)rand() << 20) ^ (xlns64)rand();
+        x = (x & ((1ULL << 58) - 1)) + 0x3e00000000000000ULL;   // logs in [-32, 32)
+        xlns64 y;
+        switch (k % 4) {
+        case 0:  y = x + ((xlns64)rand() << 20); break;                     // close
+        case 1:  y = x - ((xlns64)rand() << 32); break;
+        case 2:  y = x + (xlns64)(rndu()*60*(double)sc); break;             // to 60 octaves apart
+        default: y = x ^ ((xlns64)rand() << 24); break;
+        }
+        if (k & 1) y = xlns64_neg(y);
+        if (xlns64_abs(x) == xlns64_abs(y) && xlns64_sign(x) != xlns64_sign(y)) continue;
+        long double lx = log64(x), ly = log64(y), lmax = (lx > ly ? lx : ly)/sc, d = fabsl(lx - ly)/sc;
+        long double ref = lmax + (xlns64_sign(x) == xlns64_sign(y) ? log2l(1 + exp2l(-d))
+                                  : log2l(-expm1l(-d*0.693147180559945309417232121458L)));
+        long double err = fabsl(log64(xlns64_add(x, y)) - ref*sc);
+        if (err > maxe) maxe = err;
+    }
+    printf("  %-28s  %8d   %15.3Lf      %s\n", "xlns64_add vs long double", cases, maxe, maxe < 0.6 ? "yes" : "NO");
+
+    struct { xlns64 x, y, add, mul, div; } cases2[] = {
+        { xlns64_one,   xlns64_one,     xlns64_two,  xlns64_one,     xlns64_one     },
+        { xlns64_two,   xlns64_neg_one, xlns64_one,  xlns64_neg_two, xlns64_neg_two },
+        { xlns64_half,  xlns64_half,    xlns64_one,  0x3FE0000000000000ULL, xlns64_one },
+        { xlns64_one,   xlns64_neg_one, xlns64_zero, xlns64_neg_one, xlns64_neg_one },
+        { xlns64_pos_inf, xlns64_two,   xlns64_pos_inf, xlns64_pos_inf, 0x7FEFFFFFFFFFFFFFULL },
+        { 0x0010000000000000ULL, xlns64_half, xlns64_half, xlns64_zero, 0x0020000000000000ULL },
+    };
+    int bad = 0;
+    for (auto &c : cases2)
+        bad += xlns64_add(c.x, c.y) != c.add || xlns64_mul(c.x, c.y) != c.mul || xlns64_div(c.x, c.y) != c.div;
+    printf("  %-28s  %8d   %15s      %s\n", "exact cases and saturation", 6, "-", bad == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  fp2xlns64 rounds log2|x| to nearest, xlns642fp is within
+//  an ulp, across the double range with subnormals and specials
+// -----------------------------------------------------------
+void test_convert() {
+    printf("--- fp2xlns64 / xlns642fp ---\n");
+    printf("  check                           cases         max err      ok\n");
+    srand(21);
+    long double maxl = 0, maxr = 0;
+    const int cases = 300000;
+    for (int k = 0; k < cases; k++) {
+        double x = (rndu() + 0.25)*exp2((double)(rand() % 2040) - 1020);
+        if (k & 1) x = -x;
+        xlns64 v = fp2xlns64(x);
+        long double e = fabsl(log64(v) - log2l(fabsl((long double)x))*sc);
+        if (e > maxl) maxl = e;
+        long double r = fabsl(((long double)xlns642fp(v) - exp2l(log64(v)/sc)*(x < 0 ? -1 : 1))/x);
+        if (r > maxr) maxr = r;
+    }
+    printf("  %-28s  %8d   %9.3Lf units      %s\n", "fp2xlns64 log error", cases, maxl, maxl < 0.51 ? "yes" : "NO");
+    printf("  %-28s  %8d   %9.3Lf ulp        %s\n", "xlns642fp error", cases, maxr/exp2l(-52), maxr < exp2l(-52) ? "yes" : "NO");
+    int bad = 0;
+    bad += fp2xlns64(0.0) != xlns64_zero || xlns642fp(xlns64_zero) != 0.0;
+    bad += fp2xlns64(1.0) != xlns64_one || fp2xlns64(-2.0) != xlns64_neg_two || fp2xlns64(0.5) != xlns64_half;
+    bad += xlns642fp(xlns64_one) != 1.0 || xlns642fp(xlns64_neg_two) != -2.0;
+    bad += fp2xlns64(1.0/0.0) != xlns64_pos_inf || fp2xlns64(-1.0/0.0) != xlns64_neg_inf;
+    bad += fp2xlns64(4.9406564584124654e-324) == xlns64_zero ? 0 : 1;                   // 2^-1074: under 2^-1024
+    bad += xlns642fp(fp2xlns64(1e-308)) != 1e-308;                                     // subnormal
+    bad += fabs(xlns642fp(fp2xlns64(3e-308)) - 3e-308) > 1e-323;
+    bad += xlns642fp(xlns64_pos_inf) < 1.79e308;
+    printf("  %-28s  %8d   %15s      %s\n", "exact cases and specials", 10, "-", bad == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns32 <-> xlns64, and xlns32 sums and dot products in
+//  xlns64 against the exact sum rounded to xlns32
+// -----------------------------------------------------------
+void test_xlns32() {
+    printf("--- xlns32 accumulated in xlns64 ---\n");
+    srand(31);
+    int bad = 0;
+    for (int k = 0; k < 100000; k++) {
+        xlns32 x = ((xlns32)rand() << 16) ^ (xlns32)rand();
+        if (xlns32_abs(x) == 0) x = xlns32_zero;
+        bad += xlns642xlns32(xlns322xlns64(x)) != x;
+        bad += x != xlns32_zero && log64(xlns322xlns64(x)) != log32(x)*(1<<29);
+    }
+    bad += xlns642xlns32(fp2xlns64(1e-60)) != xlns32_zero || xlns642xlns32(fp2xlns64(-1e60)) != xlns32_neg_inf;
+    printf("  xlns322xlns64 / xlns642xlns32 round trips: %d bad      %s\n\n", bad, bad == 0 ? "yes" : "NO");
+
+    printf("  function                  n   max err (xlns32 units)  xlns32_vec_dot's      ok\n");
+    const size_t sizes[] = { 1, 10, 1000, 100000 };
+    for (int s = 0; s < 4; s++) {
+        size_t n = sizes[s];
+        std::vector<xlns32> a(n), b(n);
+        std::vector<xlns64> a64(n), b64(n);
+        long double e64 = 0, e32 = 0, es = 0;
+        for (int trial = 0; trial < 20; trial++) {
+            long double dot = 0, sum = 0;
+            for (size_t i = 0; i < n; i++) {
+                a[i] = fp2xlns32(rndu() + 0.1);          // positive terms: well conditioned
+                b[i] = fp2xlns32(4*rndu() - 1);
+                dot += val32(xlns32_mul(a[i], b[i]));
+                sum += val32(a[i]);
+                a64[i] = xlns322xlns64(a[i]);
+                b64[i] = xlns322xlns64(b[i]);
+            }
+            long double l = log2l(fabsl(dot))*(1<<23);
+            long double g64 = log32(xlns32_vec_dot_xlns64(a.data(), b.data(), n));
+            long double g32 = log32(xlns32_vec_dot(a.data(), b.data(), n));
+            long double gs = log32(xlns32_sum_xlns64(a.data(), n));
+            if (fabsl(g64 - l) > e64) e64 = fabsl(g64 - l);
+            if (fabsl(g32 - l) > e32) e32 = fabsl(g32 - l);
+            if (fabsl(gs - log2l(sum)*(1<<23)) > es) es = fabsl(gs - log2l(sum)*(1<<23));
+            // the xlns64 kernels on the widened arrays agree
+            if (xlns642xlns32(xlns64_vec_dot(a64.data(), b64.data(), n)) != xlns32_vec_dot_xlns64(a.data(), b.data(), n))
+                e64 = 99;
+            if (xlns642xlns32(xlns64_sum(a64.data(), n)) != xlns32_sum_xlns64(a.data(), n))
+                es = 99;
+        }
+        printf("  %-20s %7zu   %22.3Lf  %16.3Lf      %s\n", "xlns32_vec_dot_xlns64", n, e64, e32,
+               e64 <= 0.51 ? "yes" : "NO");
+        printf("  %-20s %7zu   %22.3Lf  %16s      %s\n", "xlns32_sum_xlns64", n, es, "-", es <= 0.51 ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns64_float in a short computation against double
+// -----------------------------------------------------------
+void test_float() {
+    printf("--- xlns64_float ---\n");
+    xlns64_float x = 1.0, s = 0.0;
+    double xd = 1.0, sd = 0.0;
+    for (int i = 1; i <= 100; i++) {
+        x = x*1.1 - x/(double)i;
+        xd = xd*1.1 - xd/(double)i;
+        s += x;
+        sd += xd;
+    }
+    double got = xlns64_2double(s);
+    printf("  sum of the recurrence: %.17g (double %.17g)      %s\n\n", got, sd,
+           fabs(got - sd) < 1e-13*fabs(sd) ? "yes" : "NO");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns64 test                                                \n");
+    printf("=============================================================\n\n");
+
+    test_sbdb();
+    test_arith();
+    test_convert();
+    test_xlns32();
+    test_float();
+
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Test file for the optional event counters (cancellation, essential zero, overflow, underflow)
+// Functions: xlns16_counters_snapshot/reset, xlns32_counters_snapshot/reset and the counted
+//            xlns16_add, xlns16_mul, xlns16_div, xlns16_batch_mul, xlns32_add_lpvip, xlns32_batch_add_lpvip
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_counters_test.cpp -o xlns_counters_test -lm && ./xlns_counters_test
+//         (also try -mavx2 and -mavx512f; the SIMD kernels must count the same events)
+
+#define xlns16_counters
+#define xlns32_counters
+#define xlns32_aicasb
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <thread>
+
+static unsigned rnd32() {
+    return ((unsigned)rand() << 16) ^ (unsigned)rand();
+}
+
+static int same(xlns16_counts a, xlns16_counts b) {
+    return a.cancel == b.cancel && a.esszer == b.esszer && a.ovf == b.ovf && a.unf == b.unf;
+}
+
+static int same32(xlns32_counts a, xlns32_counts b) {
+    return a.cancel == b.cancel && a.esszer == b.esszer && a.ovf == b.ovf && a.unf == b.unf;
+}
+
+// -----------------------------------------------------------
+//  single xlns16 operations with a known event
+// -----------------------------------------------------------
+void test_scalar16() {
+    printf("--- xlns16 scalar events ---\n");
+    printf("  operation                 cancel esszer  ovf  unf   expected       ok\n");
+
+    struct { const char *label; int op; float x, y; xlns16_counts expect; } cases[] = {
+        { "add 1.5 + -1.5",          0, 1.5f, -1.5f,            {1, 0, 0, 0} },
+        { "add 1 + 1/4096",          0, 1.0f, 1.0f/4096,        {0, 1, 0, 0} },
+        { "add 1 - 1/4096",          0, 1.0f, -1.0f/4096,       {0, 1, 0, 0} },
+        { "add 1 + 0.75",            0, 1.0f, 0.75f,            {0, 0, 0, 0} },
+        { "mul 1e30 * 1e30",         1, 1e30f, 1e30f,           {0, 0, 1, 0} },
+        { "mul 1e-30 * -1e-30",      1, 1e-30f, -1e-30f,        {0, 0, 0, 1} },
+        { "div 1e30 / 1e-30",        2, 1e30f, 1e-30f,          {0, 0, 1, 0} },
+        { "div 1e-30 / 1e30",        2, 1e-30f, 1e30f,          {0, 0, 0, 1} },
+        { "mul 3 * 5",               1, 3.0f, 5.0f,             {0, 0, 0, 0} },
+    };
+    for (auto &c : cases) {
+        xlns16 x = fp2xlns16(c.x), y = fp2xlns16(c.y);
+        xlns16_counters_reset();
+        if (c.op == 0) xlns16_add(x, y);
+        else if (c.op == 1) xlns16_mul(x, y);
+        else xlns16_div(x, y);
+        xlns16_counts got = xlns16_counters_snapshot();
+        printf("  %-24s  %5llu  %5llu  %3llu  %3llu   %llu %llu %llu %llu   %s\n", c.label,
+               got.cancel, got.esszer, got.ovf, got.unf,
+               c.expect.cancel, c.expect.esszer, c.expect.ovf, c.expect.unf, same(got, c.expect) ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  batch/reduction kernels count the same events as the scalar loop
+// -----------------------------------------------------------
+void test_batch() {
+    printf("--- batch kernels vs scalar loop ---\n");
+    printf("  kernel                    cancel  esszer     ovf     unf   ok\n");
+
+    const size_t N = 10007;
+    static xlns16 a[N], b[N], c[N];
+    static xlns32 a32[N], b32[N], c32[N];
+    srand(5);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = rnd32();
+        b[i] = (i % 7 == 0) ? xlns16_neg(a[i]) : rnd32();
+        a32[i] = rnd32();
+        b32[i] = (i % 7 == 0) ? xlns32_neg(a32[i]) : (i % 3 == 0) ? a32[i] + (rnd32() % (64u<<23)) : rnd32();
+    }
+
+    xlns16_counters_reset();
+    for (size_t i = 0; i < N; i++) c[i] = xlns16_mul(a[i], b[i]);
+    xlns16_counts ref = xlns16_counters_snapshot();
+    xlns16_counters_reset();
+    xlns16_batch_mul(a, b, c, N);
+    xlns16_counts got = xlns16_counters_snapshot();
+    printf("  xlns16_batch_mul          %6llu  %6llu  %6llu  %6llu   %s\n",
+           got.cancel, got.esszer, got.ovf, got.unf, same(got, ref) ? "yes" : "NO");
+
+    xlns16_counters_reset();
+    xlns16_sum(b, N);
+    got = xlns16_counters_snapshot();
+    printf("  xlns16_sum                %6llu  %6llu  %6llu  %6llu   %s\n",
+           got.cancel, got.esszer, got.ovf, got.unf, (got.esszer + got.cancel > 0) ? "yes" : "NO");
+
+    xlns32_counters_reset();
+    for (size_t i = 0; i < N; i++) c32[i] = xlns32_add_lpvip(a32[i], b32[i]);
+    xlns32_counts ref32 = xlns32_counters_snapshot();
+    xlns32_counters_reset();
+    xlns32_batch_add_lpvip(a32, b32, c32, N);
+    xlns32_counts got32 = xlns32_counters_snapshot();
+    printf("  xlns32_batch_add_lpvip    %6llu  %6llu  %6llu  %6llu   %s\n",
+           got32.cancel, got32.esszer, got32.ovf, got32.unf, same32(got32, ref32) ? "yes" : "NO");
+    printf("  (scalar loop)             %6llu  %6llu  %6llu  %6llu\n",
+           ref32.cancel, ref32.esszer, ref32.ovf, ref32.unf);
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  per-thread blocks: live and exited threads are both counted
+// -----------------------------------------------------------
+void test_threads() {
+    printf("--- counts from several threads ---\n");
+    printf("  threads  per thread   cancel total  expected  ok\n");
+
+    const int T = 4, K = 100000;
+    xlns16 x = fp2xlns16(2.5f);
+    xlns16_counters_reset();
+    std::thread th[T];
+    for (int t = 0; t < T; t++)
+        th[t] = std::thread([x, K]() {
+            for (int k = 0; k < K; k++) xlns16_add(x, xlns16_neg(x));
+        });
+    for (int t = 0; t < T; t++) th[t].join();
+    for (int k = 0; k < K; k++) xlns16_add(x, xlns16_neg(x));   // this thread too
+    xlns16_counts got = xlns16_counters_snapshot();
+    unsigned long long expect = (unsigned long long)(T+1)*K;
+    printf("  %7d  %10d   %12llu  %8llu  %s\n", T+1, K, got.cancel, expect, (got.cancel == expect) ? "yes" : "NO");
+
+    xlns16_counters_reset();
+    got = xlns16_counters_snapshot();
+    printf("  after reset              %12llu  %8d  %s\n", got.cancel, 0, (got.cancel == 0) ? "yes" : "NO");
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns16/xlns32 event counters test                          \n");
+    #if defined(__AVX512F__)
+    printf("  (AVX-512 build)\n");
+    #elif defined(__AVX2__)
+    printf("  (AVX2 build)\n");
+    #else
+    printf("  (portable build)\n");
+    #endif
+    printf("=============================================================\n\n");
+
+    test_scalar16();
+    test_batch();
+    test_threads();
+
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Test file for the thread-local set-associative float -> LNS conversion cache
+// Functions: float2xlns16_, float2xlns32_ (xlns16_float/xlns32_float assignment),
+//            xlns16/32_cache_stats, xlns16/32_cache_reset_stats, xlns16/32_cache_flush, xlns16/32_cacheon
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_cvtcache_test.cpp -o xlns_cvtcache_test -lm && ./xlns_cvtcache_test
+
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32.cpp"
+
+#include <cstdio>
+#include <thread>
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// -----------------------------------------------------------
+//  cached conversion gives the same bits as fp2xlns16/fp2xlns32
+// -----------------------------------------------------------
+void test_same_bits() {
+    printf("--- cached conversion vs direct conversion ---\n");
+    printf("  format   values   distinct   mismatches  hits      ok\n");
+
+    const int N = 200000, D = 3000;
+    static float pool[D];
+    srand(1);
+    for (int i = 0; i < D; i++) pool[i] = rndf();
+    pool[0] = 0.0f; pool[1] = -0.0f; pool[2] = 1e-30f; pool[3] = 3e38f;
+
+    int bad16 = 0, bad32 = 0;
+    xlns16_cache_reset_stats();
+    xlns32_cache_reset_stats();
+    for (int i = 0; i < N; i++) {
+        float f = pool[rand() % D];
+        if (xlns16_internal(float2xlns16_(f)) != fp2xlns16(f)) bad16++;
+        if (xlns32_internal(float2xlns32_(f)) != fp2xlns32(f)) bad32++;
+    }
+    xlns16_cachestats s16 = xlns16_cache_stats();
+    xlns32_cachestats s32 = xlns32_cache_stats();
+    printf("  xlns16   %6d   %8d   %10d  %-8llu  %s\n", N, D, bad16, s16.hits,
+           (bad16 == 0 && s16.hits + s16.misses == (unsigned long long)N) ? "yes" : "NO");
+    printf("  xlns32   %6d   %8d   %10d  %-8llu  %s\n", N, D, bad32, s32.hits,
+           (bad32 == 0 && s32.hits + s32.misses == (unsigned long long)N) ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  hit rates for a working set that fits, and one that does not
+// -----------------------------------------------------------
+void test_hit_rates() {
+    printf("--- hit rate by working set (cache %d sets x %d ways) ---\n", xlns32_cachesets, xlns32_cacheways);
+    printf("  distinct  passes   hit%%    expected  ok\n");
+
+    int sizes[] = { 16, 256, 768, 100000 };
+    static float pool[100000];
+    for (int s : sizes) {
+        srand(2);
+        for (int i = 0; i < s; i++) pool[i] = rndf();
+        xlns32_cache_flush();
+        xlns32_cache_reset_stats();
+        for (int pass = 0; pass < 4; pass++)
+            for (int i = 0; i < s; i++) float2xlns32_(pool[i]);
+        xlns32_cachestats st = xlns32_cache_stats();
+        double rate = 100.0*st.hits/(st.hits + st.misses);
+        // a small set must hit on every pass after the first; a huge one hardly ever
+        int ok = (s <= 256) ? (st.misses == (unsigned long long)s) : (s > 4*xlns32_cachesets*xlns32_cacheways) ? rate < 5.0 : rate > 40.0;
+        printf("  %8d  %6d  %6.2f    %-8s  %s\n", s, 4, rate,
+               (s <= 256) ? "75.00" : (s > 4096) ? "<5" : ">40", ok ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  per-thread caches: stats add up across threads, cacheon=0 gives no hits
+// -----------------------------------------------------------
+void test_threads_and_off() {
+    printf("--- threads and run-time switch ---\n");
+    printf("  case                      hits     misses   expected        ok\n");
+
+    const int T = 3, K = 5000;
+    xlns16_cache_reset_stats();
+    std::thread th[T];
+    for (int t = 0; t < T; t++)
+        th[t] = std::thread([K]() {
+            for (int k = 0; k < K; k++) float2xlns16_((float)(k % 100 + 1));
+        });
+    for (int t = 0; t < T; t++) th[t].join();
+    xlns16_cachestats s = xlns16_cache_stats();
+    int ok = (s.misses == (unsigned long long)T*100 && s.hits == (unsigned long long)T*(K-100));
+    printf("  %d threads x %d, 100 vals %8llu  %8llu   %llu/%llu  %s\n", T, K, s.hits, s.misses,
+           (unsigned long long)T*(K-100), (unsigned long long)T*100, ok ? "yes" : "NO");
+
+    xlns16_cacheon = 0;
+    xlns16_cache_reset_stats();
+    int bad = 0;
+    for (int k = 0; k < K; k++)
+        if (xlns16_internal(float2xlns16_((float)(k % 100))) != fp2xlns16((float)(k % 100))) bad++;
+    s = xlns16_cache_stats();
+    printf("  xlns16_cacheon = 0        %8llu  %8llu   0/0         %s\n", s.hits, s.misses,
+           (s.hits == 0 && s.misses == 0 && bad == 0) ? "yes" : "NO");
+    xlns16_cacheon = 1;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  float -> LNS conversion cache test                         \n");
+    printf("=============================================================\n\n");
+
+    test_same_bits();
+    test_hit_rates();
+    test_threads_and_off();
+
+    printf("All tests done.\n");
+    return 0;
+}
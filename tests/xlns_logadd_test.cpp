@@ -0,0 +1,316 @@
+// Test file for log-domain addition over fixed-point logs and log-sum-exp
+// Functions: xlns16_logadd, xlns16_logsub, xlns16_batch_logadd, xlns16_batch_logsub,
+//            xlns16_batch_sb, xlns16_batch_db, xlns16_logsumexp (and _acc), the xlns32
+//            versions, xlns32_logsumexp_lpvip, xlns32_lpvip_acc_push_logs, xlns16_add_avx2,
+//            xlns16_log2xlns16, xlns32_log2xlns32 (saturation and log_zero)
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_logadd_test.cpp -o xlns_logadd_test -lm && ./xlns_logadd_test
+
+#define xlns_parallel
+#define xlns16_alt
+#define xlns16_table
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+static const size_t sizes[] = { 0, 1, 15, 16, 17, 100, 1000, 65537 };
+static const int nsizes = sizeof(sizes)/sizeof(sizes[0]);
+
+// fixed-point logs: mostly within a few octaves of each other, some far apart,
+// some equal, some xlns_log_zero
+static xlns16_signed rnd16() {
+    int r = rand() % 16;
+    if (r == 0) return xlns16_log_zero;
+    if (r == 1) return 0;
+    if (r < 4) return (xlns16_signed)(rand() % 32768 - 16384);
+    return (xlns16_signed)(rand() % 2048 - 1024);
+}
+
+static xlns32_signed rnd32() {
+    return (xlns32_signed)((rand() % 2048 - 1024)*(double)xlns32_scale/128 + rand() % 65536);
+}
+
+// exact log2(2^a + 2^b) and log2|2^a - 2^b| in units of the scale
+static double exadd(double a, double b, double scale, int sub) {
+    double m = (a > b) ? a : b, d = -fabs(a - b)/scale;
+    return m + scale*log2(sub ? fabs(1 - exp2(d)) : 1 + exp2(d));
+}
+
+// -----------------------------------------------------------
+//  scalar log-domain add and subtract against the exact value
+//  (within the adder's error) and against xlns16_add itself
+// -----------------------------------------------------------
+void test_scalar() {
+    printf("--- xlns16_logadd/logsub, xlns32_logadd/logsub vs exact ---\n");
+    printf("  function          cases  max |err| (units)  not as xlns16/32_add   ok\n");
+    const int cases = 200000;
+    for (int k = 0; k < 4; k++) {
+        double emax = 0;
+        long differ = 0;
+        for (int t = 0; t < cases; t++) {
+            if (k < 2) {
+                xlns16_signed a = (xlns16_signed)(rand() % 4096 - 2048), b = (xlns16_signed)(rand() % 4096 - 2048);
+                if (k == 1 && a == b) continue;
+                xlns16_signed r = k ? xlns16_logsub(a, b) : xlns16_logadd(a, b);
+                xlns16 x = xlns16_log2xlns16(a), y = xlns16_log2xlns16(b);
+                differ += r != xlns162log(k ? xlns16_sub(x, y) : xlns16_add(x, y));
+                double e = fabs(r - exadd(a, b, xlns16_scale, k));
+                if (e > emax && (k == 0 || abs(a - b) > 16)) emax = e;
+            } else {
+                xlns32_signed a = rnd32(), b = rnd32();
+                if (k == 3 && a == b) continue;
+                xlns32_signed r = (k == 3) ? xlns32_logsub(a, b) : xlns32_logadd(a, b);
+                xlns32 x = xlns32_log2xlns32(a), y = xlns32_log2xlns32(b);
+                differ += r != xlns322log((k == 3) ? xlns32_sub(x, y) : xlns32_add(x, y));
+                double e = fabs(r - exadd(a, b, xlns32_scale, k == 3))/(xlns32_scale/128.0);
+                if (e > emax && (k == 2 || labs((long)a - b) > 16*(xlns32_scale/128))) emax = e;
+            }
+        }
+        const char *names[] = { "xlns16_logadd", "xlns16_logsub", "xlns32_logadd", "xlns32_logsub" };
+        double tol = (k < 2) ? 1.5 : 0.01;
+        printf("  %-14s  %7d  %17.4f  %20ld   %s\n", names[k], cases, emax, differ,
+               (emax < tol && differ == 0) ? "yes" : "NO");
+    }
+    printf("  (xlns32 errors in units of 2^-7; logsub beyond 16 units of cancellation)\n\n");
+}
+
+// -----------------------------------------------------------
+//  logs out of range saturate (above) or are 0 (at or below
+//  log_zero), and log_zero adds nothing, in the scalar, batch
+//  and log-sum-exp versions alike
+// -----------------------------------------------------------
+void test_range() {
+    printf("--- out-of-range logs and log_zero ---\n");
+    printf("  case                                       result  expected   ok\n");
+    const xlns16_signed lz = xlns16_log_zero, lmax = xlns16_log_max;
+    const xlns32_signed lz32 = xlns32_log_zero, lmax32 = xlns32_log_max;
+    xlns16_signed big[4] = { -20000, -20000, -20000, -20000 }, one[4] = { lz, -20000, 1234, lz };
+    xlns32_signed big32[4] = { lz32 - 5, lz32, lz32 - 100000, lz32 }, one32[4] = { lz32, lz32 - 1, 98765, lz32 };
+    struct { const char *name; long r, e; } rows[] = {
+        { "xlns16_logadd(-20000, -20000)",         xlns16_logadd(-20000, -20000), lz },
+        { "xlns16_logadd(log_zero, log_zero)",     xlns16_logadd(lz, lz), lz },
+        { "xlns16_logadd(log_zero, 1234)",         xlns16_logadd(lz, 1234), 1234 },
+        { "xlns16_logadd(-300, -20000)",           xlns16_logadd(-300, -20000), -300 },
+        { "xlns16_logsub(1234, log_zero)",         xlns16_logsub(1234, lz), 1234 },
+        { "xlns16_logsub(log_zero, log_zero)",     xlns16_logsub(lz, lz), lz },
+        { "xlns16_logadd(20000, log_zero)",        xlns16_logadd(20000, lz), lmax },
+        { "xlns16_logadd(20000, 0)",               xlns16_logadd(20000, 0), xlns16_logadd(lmax, 0) },
+        { "xlns16_logadd(-20000, 0)",              xlns16_logadd(-20000, 0), 0 },
+        { "xlns16_logsumexp(4 x -20000)",          xlns16_logsumexp(big, 4), lz },
+        { "xlns16_logsumexp(lz, -20000, 1234, lz)", xlns16_logsumexp(one, 4), 1234 },
+        { "xlns32_logadd(log_zero - 5, log_zero)", xlns32_logadd(lz32 - 5, lz32), lz32 },
+        { "xlns32_logadd(log_zero, 98765)",        xlns32_logadd(lz32, 98765), 98765 },
+        { "xlns32_logsub(98765, log_zero)",        xlns32_logsub(98765, lz32), 98765 },
+        { "xlns32_logadd(log_max + 9, log_zero)",  xlns32_logadd(lmax32 + 9, lz32), lmax32 },
+        { "xlns32_logsumexp(4 x <= log_zero)",     xlns32_logsumexp(big32, 4), lz32 },
+        { "xlns32_logsumexp(lz, lz-1, 98765, lz)", xlns32_logsumexp(one32, 4), 98765 },
+        { "xlns32_logsumexp_lpvip(4 x <= lz)",     xlns32_logsumexp_lpvip(big32, 4), lz32 },
+        { "xlns32_logsumexp_lpvip(lz,lz-1,98765,lz)", xlns32_logsumexp_lpvip(one32, 4), 98765 },
+    };
+    for (size_t k = 0; k < sizeof(rows)/sizeof(rows[0]); k++)
+        printf("  %-40s  %11ld  %11ld   %s\n", rows[k].name, rows[k].r, rows[k].e,
+               rows[k].r == rows[k].e ? "yes" : "NO");
+
+    // the batch (SIMD) versions on logs spread over twice the range, with
+    // log_zero and the edges mixed in, element by element against the scalar
+    const size_t n = 4099;
+    std::vector<xlns16_signed> a(n), b(n), c(n), d(n);
+    for (size_t i = 0; i < n; i++) {
+        int r = rand() % 8;
+        a[i] = (r == 0) ? lz : (r == 1) ? lmax : (xlns16_signed)(rand() % 65536 - 32768);
+        b[i] = (i % 5 == 0) ? lz : (i % 5 == 1) ? a[i] : (xlns16_signed)(rand() % 65536 - 32768);
+    }
+    for (int k = 0; k < 4; k++) {
+        long differ = 0;
+        if (k == 0) xlns16_batch_logadd(a.data(), b.data(), c.data(), n);
+        if (k == 1) xlns16_batch_logsub(a.data(), b.data(), c.data(), n);
+        if (k == 2) xlns16_batch_sb(a.data(), c.data(), n);
+        if (k == 3) xlns16_batch_db(a.data(), c.data(), n);
+        for (size_t i = 0; i < n; i++) {
+            xlns16_signed y = (k < 2) ? b[i] : 0;
+            differ += c[i] != ((k & 1) ? xlns16_logsub(a[i], y) : xlns16_logadd(a[i], y));
+        }
+        const char *names[] = { "xlns16_batch_logadd", "xlns16_batch_logsub", "xlns16_batch_sb", "xlns16_batch_db" };
+        printf("  %-20s  wide range  n %zu  differ %ld   %s\n", names[k], n, differ, differ ? "NO" : "yes");
+    }
+
+    // log-sum-exp of the wide-range logs against a scalar fold of xlns16_logadd
+    // in the same order (lanes of 16 within blocks of 256), and with the
+    // log_zero elements left out
+    xlns16_signed r = xlns16_logsumexp(a.data(), n);
+    for (size_t i = 0; i < n; i++) d[i] = (a[i] <= lz) ? lz : a[i];
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++)
+        if (a[i] > lz) c[m++] = a[i];
+    int same = xlns16_logsumexp(d.data(), n) == r;
+    long err = labs((long)xlns16_logsumexp(c.data(), m) - r);
+    printf("  xlns16_logsumexp wide range: clamped same %d, without log_zero off by %ld   %s\n\n",
+           same, err, (same && err <= 64) ? "yes" : "NO");
+}
+
+// -----------------------------------------------------------
+//  the batch versions element by element against the scalar
+//  ones (the SIMD adder where there is one)
+// -----------------------------------------------------------
+void test_batch() {
+    #ifdef xlns16_add_simd
+    printf("--- batch log-domain addition vs scalar (xlns16_add_avx2) ---\n");
+    #else
+    printf("--- batch log-domain addition vs scalar (no SIMD adder in this build) ---\n");
+    #endif
+    printf("  function                n  differ   ok\n");
+    const char *names[] = { "xlns16_batch_logadd", "xlns16_batch_logsub", "xlns16_batch_sb", "xlns16_batch_db",
+                            "xlns32_batch_logadd", "xlns32_batch_logsub", "xlns32_batch_sb", "xlns32_batch_db" };
+    for (int s = 0; s < nsizes; s++) {
+        size_t n = sizes[s];
+        std::vector<xlns16_signed> a(n), b(n), c(n);
+        std::vector<xlns32_signed> a32(n), b32(n), c32(n);
+        for (size_t i = 0; i < n; i++) {
+            a[i] = rnd16(); b[i] = (i % 7 == 3) ? a[i] : rnd16();
+            a32[i] = rnd32(); b32[i] = (i % 7 == 3) ? a32[i] : rnd32();
+        }
+        for (int k = 0; k < 8; k++) {
+            long differ = 0;
+            switch (k) {
+            case 0: xlns16_batch_logadd(a.data(), b.data(), c.data(), n); break;
+            case 1: xlns16_batch_logsub(a.data(), b.data(), c.data(), n); break;
+            case 2: xlns16_batch_sb(a.data(), c.data(), n); break;
+            case 3: xlns16_batch_db(a.data(), c.data(), n); break;
+            case 4: xlns32_batch_logadd(a32.data(), b32.data(), c32.data(), n); break;
+            case 5: xlns32_batch_logsub(a32.data(), b32.data(), c32.data(), n); break;
+            case 6: xlns32_batch_sb(a32.data(), c32.data(), n); break;
+            case 7: xlns32_batch_db(a32.data(), c32.data(), n); break;
+            }
+            for (size_t i = 0; i < n; i++) {
+                switch (k) {
+                case 0: differ += c[i] != xlns16_logadd(a[i], b[i]); break;
+                case 1: differ += c[i] != xlns16_logsub(a[i], b[i]); break;
+                case 2: differ += c[i] != xlns16_logadd(a[i], 0); break;
+                case 3: differ += c[i] != xlns16_logsub(a[i], 0); break;
+                case 4: differ += c32[i] != xlns32_logadd(a32[i], b32[i]); break;
+                case 5: differ += c32[i] != xlns32_logsub(a32[i], b32[i]); break;
+                case 6: differ += c32[i] != xlns32_logadd(a32[i], 0); break;
+                case 7: differ += c32[i] != xlns32_logsub(a32[i], 0); break;
+                }
+            }
+            printf("  %-20s  %5zu  %6ld   %s\n", names[k], n, differ, differ ? "NO" : "yes");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns16_add_avx2 against xlns16_add: every 17th x with every y,
+//  and the 16-bit batch add and subtract
+// -----------------------------------------------------------
+void test_add_avx2() {
+    printf("--- xlns16_add_avx2 vs xlns16_add ---\n");
+    #ifdef xlns16_add_simd
+    long differ = 0, pairs = 0;
+    unsigned short ys[16], r[16];
+    for (unsigned x = 0; x < (1 << 16); x += 17)
+        for (unsigned y0 = 0; y0 < (1 << 16); y0 += 16) {
+            for (int k = 0; k < 16; k++) ys[k] = y0 + k;
+            _mm256_storeu_si256((__m256i *)r, xlns16_add_avx2(_mm256_set1_epi16((short)x),
+                                                              _mm256_loadu_si256((const __m256i *)ys)));
+            for (int k = 0; k < 16; k++) differ += r[k] != xlns16_add(x, ys[k]);
+            pairs += 16;
+        }
+    printf("  pairs %ld, differ %ld   %s\n", pairs, differ, differ ? "NO" : "yes");
+    #else
+    printf("  no SIMD adder in this build (needs -mavx2)\n");
+    #endif
+    std::vector<xlns16> a(1003), b(1003), c(1003);
+    for (size_t i = 0; i < a.size(); i++) {
+        a[i] = rand() & 0xffff;
+        b[i] = (i % 5 == 0) ? xlns16_neg(a[i]) : rand() & 0xffff;
+    }
+    long d1 = 0, d2 = 0;
+    xlns16_batch_add(a.data(), b.data(), c.data(), a.size());
+    for (size_t i = 0; i < a.size(); i++) d1 += c[i] != xlns16_add(a[i], b[i]);
+    xlns16_batch_sub(a.data(), b.data(), c.data(), a.size());
+    for (size_t i = 0; i < a.size(); i++) d2 += c[i] != xlns16_sub(a[i], b[i]);
+    printf("  xlns16_batch_add differ %ld   %s\n", d1, d1 ? "NO" : "yes");
+    printf("  xlns16_batch_sub differ %ld   %s\n\n", d2, d2 ? "NO" : "yes");
+}
+
+// -----------------------------------------------------------
+//  log-sum-exp against the exact log2(sum of 2^a), and pushed
+//  in pieces (a stream) against all at once: the same bits
+// -----------------------------------------------------------
+void test_logsumexp() {
+    printf("--- logsumexp vs exact, and streamed in pieces ---\n");
+    printf("  function                    n   |err| (units)  streamed differs   ok\n");
+    for (int s = 0; s < nsizes; s++) {
+        size_t n = sizes[s];
+        std::vector<xlns16_signed> a(n);
+        std::vector<xlns32_signed> a32(n);
+        long double e16 = 0, e32 = 0;
+        for (size_t i = 0; i < n; i++) {
+            a[i] = (xlns16_signed)(rand() % 2048 - 1024);
+            a32[i] = (xlns32_signed)a[i] << 16;
+            e16 += exp2l((long double)a[i]/xlns16_scale);
+        }
+        e32 = e16;
+        double ref16 = n ? (double)(xlns16_scale*log2l(e16)) : xlns16_log_zero;
+        double ref32 = n ? (double)(xlns32_scale*log2l(e32)) : xlns32_log_zero;
+        for (int k = 0; k < 3; k++) {
+            double err;
+            int differ;
+            const size_t piece = 13;
+            if (k == 0) {
+                xlns16_signed r = xlns16_logsumexp(a.data(), n);
+                xlns16_logsumexp_acc acc;
+                xlns16_logsumexp_init(&acc);
+                for (size_t i = 0; i < n; i += piece)
+                    xlns16_logsumexp_push(&acc, a.data() + i, (n - i < piece) ? n - i : piece);
+                differ = xlns16_logsumexp_result(&acc) != r;
+                err = fabs(r - ref16);
+            } else if (k == 1) {
+                xlns32_signed r = xlns32_logsumexp(a32.data(), n);
+                xlns32_logsumexp_acc acc;
+                xlns32_logsumexp_init(&acc);
+                for (size_t i = 0; i < n; i += piece)
+                    xlns32_logsumexp_push(&acc, a32.data() + i, (n - i < piece) ? n - i : piece);
+                differ = xlns32_logsumexp_result(&acc) != r;
+                err = fabs(r - ref32)/(xlns32_scale/128.0);
+            } else {
+                xlns32_signed r = xlns32_logsumexp_lpvip(a32.data(), n);
+                xlns32_lpvip_acc acc;
+                xlns32_lpvip_acc_init(&acc);
+                for (size_t i = 0; i < n; i += piece)
+                    xlns32_lpvip_acc_push_logs(&acc, a32.data() + i, (n - i < piece) ? n - i : piece);
+                differ = n && xlns322log(xlns32_lpvip_acc_result(&acc)) != r;
+                err = fabs(r - ref32)/(xlns32_scale/128.0);
+            }
+            // each xlns16 add is off by up to about a unit and the blocks keep the
+            // error from growing with n; the lpvip adder is good to about a unit
+            // of 2^-7 per add, not to the xlns32 precision
+            const double tols[] = { 2 + 0.25*log2(n + 1.0), 0.05 + 0.02*log2(n + 1.0), 2 + 0.5*log2(n + 1.0) };
+            double tol = tols[k];
+            const char *names[] = { "xlns16_logsumexp", "xlns32_logsumexp", "xlns32_logsumexp_lpvip" };
+            printf("  %-22s  %5zu  %13.4f  %16d   %s\n", names[k], n, err, differ,
+                   (err <= tol && !differ) ? "yes" : "NO");
+        }
+    }
+    printf("  (xlns32 errors in units of 2^-7)\n\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  log-domain addition and log-sum-exp over fixed-point logs  \n");
+    printf("=============================================================\n\n");
+
+    srand(50);
+    test_scalar();
+    test_batch();
+    test_range();
+    test_add_avx2();
+    test_logsumexp();
+
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,221 @@
+// Test file for the mixed-format (float / bfloat16 activation x LNS weight) kernels
+// Functions: xlns16_gemv_f32, xlns16_gemv_bf16, xlns16_vec_dot_f32x, xlns16_vec_dot_bf16x,
+//            xlns32_gemv_f32, xlns32_gemv_bf16, xlns32_vec_dot_f32x, xlns32_vec_dot_bf16x,
+//            xlns32_gemv, xlns32_gemv_t, xlns32_batch_mul, xlns32_batch_scale
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_mixed_test.cpp -o xlns_mixed_test -lm && ./xlns_mixed_test
+//         (also try -mavx2 and -mavx512f; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// float -> bfloat16 bits, round to nearest even (test reference only)
+static xlns_bf16 tobf16(float f) {
+    unsigned int u;
+    memcpy(&u, &f, 4);
+    return (xlns_bf16)((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+}
+
+static const struct { size_t rows, cols; } shapes[] = {
+    { 1, 1 }, { 3, 17 }, { 37, 300 }, { 64, 4097 }, { 513, 700 }
+};
+static const int nshapes = sizeof(shapes)/sizeof(shapes[0]);
+static const int threads[] = { 1, 3 };
+
+// -----------------------------------------------------------
+//  xlns32_batch_mul / xlns32_batch_scale (SIMD with -mavx2)
+//  against xlns32_mul, including overflow and underflow
+// -----------------------------------------------------------
+void test_batch_mul32() {
+    printf("--- xlns32_batch_mul / xlns32_batch_scale vs xlns32_mul ---\n");
+    printf("  function              n     mismatches      ok\n");
+    const xlns32 special[] = { 0x00000000, 0x80000000, 0x7fffffff, 0xffffffff, 0x40000000,
+                               0xc0000000, 0x3fffffff, 0x7f000000, 0x00ffffff, 0x41234567 };
+    const size_t n = 10007;
+    std::vector<xlns32> a(n), b(n), c(n);
+    srand(3);
+    for (size_t i = 0; i < n; i++) {
+        a[i] = ((xlns32)rand() << 16) ^ (xlns32)rand();
+        b[i] = (i % 3) ? special[i % 10] : ((xlns32)rand() << 16) ^ (xlns32)rand();
+    }
+    xlns32_batch_mul(a.data(), b.data(), c.data(), n);
+    size_t bad = 0;
+    for (size_t i = 0; i < n; i++) bad += c[i] != xlns32_mul(a[i], b[i]);
+    printf("  %-18s %6zu  %12zu      %s\n", "xlns32_batch_mul", n, bad, bad == 0 ? "yes" : "NO");
+    bad = 0;
+    for (int k = 0; k < 10; k++) {
+        xlns32_batch_scale(a.data(), special[k], c.data(), n);
+        for (size_t i = 0; i < n; i++) bad += c[i] != xlns32_mul(a[i], special[k]);
+    }
+    printf("  %-18s %6zu  %12zu      %s\n", "xlns32_batch_scale", 10*n, bad, bad == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns32_gemv / xlns32_gemv_t against xlns32_vec_dot, 1/3 threads
+// -----------------------------------------------------------
+void test_gemv32() {
+    printf("--- xlns32_gemv / xlns32_gemv_t vs xlns32_vec_dot ---\n");
+    printf("  function        rows  cols  threads  mismatches      ok\n");
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < nshapes; s++) {
+        size_t R = shapes[s].rows, C = shapes[s].cols;
+        std::vector<xlns32> W(R*C), x(C), xt(R), y(C > R ? C : R), col(R), er(R), et(C);
+        srand(10 + s);
+        for (size_t i = 0; i < R*C; i++) W[i] = fp2xlns32(rndf());
+        for (size_t i = 0; i < C; i++) x[i] = fp2xlns32(rndf());
+        for (size_t i = 0; i < R; i++) xt[i] = fp2xlns32(rndf());
+        for (size_t r = 0; r < R; r++) er[r] = xlns32_vec_dot(&W[r*C], x.data(), C);
+        for (size_t c = 0; c < C; c++) {
+            for (size_t r = 0; r < R; r++) col[r] = W[r*C + c];
+            et[c] = xlns32_vec_dot(col.data(), xt.data(), R);
+        }
+        for (int t = 0; t < 2; t++) {
+            xlns_pool_init(threads[t]);
+            xlns32_gemv(W.data(), x.data(), y.data(), R, C);
+            size_t bad = 0;
+            for (size_t r = 0; r < R; r++) bad += y[r] != er[r];
+            printf("  %-14s %5zu %5zu  %7d  %10zu      %s\n", "xlns32_gemv", R, C, threads[t], bad,
+                   bad == 0 ? "yes" : "NO");
+            xlns32_gemv_t(W.data(), xt.data(), y.data(), R, C);
+            bad = 0;
+            for (size_t c = 0; c < C; c++) bad += y[c] != et[c];
+            printf("  %-14s %5zu %5zu  %7d  %10zu      %s\n", "xlns32_gemv_t", R, C, threads[t], bad,
+                   bad == 0 ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  mixed GEMV: y[r] == xlnsNN2fp(vec_dot(row, converted x)),
+//  with and without caller scratch, 1/3 threads
+// -----------------------------------------------------------
+void test_mixed_gemv() {
+    printf("--- mixed-format GEMV vs converted vec_dot ---\n");
+    printf("  function          rows  cols  threads  mismatches      ok\n");
+    const char *names[] = { "xlns16_gemv_f32", "xlns16_gemv_bf16", "xlns32_gemv_f32", "xlns32_gemv_bf16" };
+    xlns_parallel_min = 1000;
+    for (int s = 0; s < nshapes; s++) {
+        size_t R = shapes[s].rows, C = shapes[s].cols;
+        std::vector<xlns16> W16(R*C), x16(C), xb16(C), sc16(C);
+        std::vector<xlns32> W32(R*C), x32(C), xb32(C), sc32(C);
+        std::vector<float> xf(C), y(R), e(R);
+        std::vector<xlns_bf16> xb(C);
+        srand(30 + s);
+        for (size_t i = 0; i < R*C; i++) {
+            float w = rndf();
+            W16[i] = fp2xlns16(w);
+            W32[i] = fp2xlns32(w);
+        }
+        for (size_t i = 0; i < C; i++) {
+            xf[i] = rndf();
+            xb[i] = tobf16(xf[i]);
+            x16[i] = fp2xlns16(xf[i]);
+            x32[i] = fp2xlns32(xf[i]);
+            xb16[i] = bf162xlns16(xb[i]);
+            xb32[i] = fp2xlns32(xlns32_bf162fp(xb[i]));
+        }
+        for (int k = 0; k < 4; k++) {
+            for (size_t r = 0; r < R; r++)
+                switch (k) {
+                case 0: e[r] = xlns162fp(xlns16_vec_dot(&W16[r*C], x16.data(), C)); break;
+                case 1: e[r] = xlns162fp(xlns16_vec_dot(&W16[r*C], xb16.data(), C)); break;
+                case 2: e[r] = xlns322fp(xlns32_vec_dot(&W32[r*C], x32.data(), C)); break;
+                case 3: e[r] = xlns322fp(xlns32_vec_dot(&W32[r*C], xb32.data(), C)); break;
+                }
+            for (int t = 0; t < 2; t++) {
+                xlns_pool_init(threads[t]);
+                size_t bad = 0;
+                for (int own = 0; own < 2; own++) {
+                    switch (k) {
+                    case 0: xlns16_gemv_f32(W16.data(), xf.data(), y.data(), R, C, own ? sc16.data() : NULL); break;
+                    case 1: xlns16_gemv_bf16(W16.data(), xb.data(), y.data(), R, C, own ? sc16.data() : NULL); break;
+                    case 2: xlns32_gemv_f32(W32.data(), xf.data(), y.data(), R, C, own ? sc32.data() : NULL); break;
+                    case 3: xlns32_gemv_bf16(W32.data(), xb.data(), y.data(), R, C, own ? sc32.data() : NULL); break;
+                    }
+                    for (size_t r = 0; r < R; r++) bad += y[r] != e[r];
+                }
+                printf("  %-16s %5zu %5zu  %7d  %10zu      %s\n", names[k], R, C, threads[t], bad,
+                       bad == 0 ? "yes" : "NO");
+            }
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  mixed dot products, serial and with split sums
+// -----------------------------------------------------------
+void test_mixed_dot() {
+    printf("--- mixed-format dot products ---\n");
+    printf("  function                 n        got     expected      ok\n");
+    const size_t sizes[] = { 0, 1, 255, 256, 257, 5000, 70000 };
+    xlns_pool_init(3);
+    xlns_parallel_min = 1000;
+    for (int red = 0; red < 2; red++) {
+        xlns_parallel_reductions = red;
+        for (int s = 0; s < 7; s++) {
+            size_t n = sizes[s];
+            std::vector<xlns16> w16(n + 1), x16(n + 1), xb16(n + 1);
+            std::vector<xlns32> w32(n + 1), x32(n + 1), xb32(n + 1);
+            std::vector<float> xf(n + 1);
+            std::vector<xlns_bf16> xb(n + 1);
+            srand(50 + s);
+            for (size_t i = 0; i < n; i++) {
+                float w = rndf();
+                w16[i] = fp2xlns16(w); w32[i] = fp2xlns32(w);
+                xf[i] = rndf(); xb[i] = tobf16(xf[i]);
+                x16[i] = fp2xlns16(xf[i]); x32[i] = fp2xlns32(xf[i]);
+                xb16[i] = bf162xlns16(xb[i]); xb32[i] = fp2xlns32(xlns32_bf162fp(xb[i]));
+            }
+            float got[4] = { xlns16_vec_dot_f32x(w16.data(), xf.data(), n),
+                             xlns16_vec_dot_bf16x(w16.data(), xb.data(), n),
+                             xlns32_vec_dot_f32x(w32.data(), xf.data(), n),
+                             xlns32_vec_dot_bf16x(w32.data(), xb.data(), n) };
+            float exp[4] = { xlns162fp(xlns16_vec_dot(w16.data(), x16.data(), n)),
+                             xlns162fp(xlns16_vec_dot(w16.data(), xb16.data(), n)),
+                             xlns322fp(xlns32_vec_dot(w32.data(), x32.data(), n)),
+                             xlns322fp(xlns32_vec_dot(w32.data(), xb32.data(), n)) };
+            const char *names[] = { "xlns16_vec_dot_f32x", "xlns16_vec_dot_bf16x",
+                                    "xlns32_vec_dot_f32x", "xlns32_vec_dot_bf16x" };
+            for (int k = 0; k < 4; k++)
+                printf("  %-22s %6zu%s %10.4f  %10.4f      %s\n", names[k], n, red ? "*" : " ", got[k], exp[k],
+                       got[k] == exp[k] ? "yes" : "NO");
+        }
+    }
+    xlns_parallel_reductions = 0;
+    xlns_parallel_min = 1<<15;
+    printf("  (* xlns_parallel_reductions set)\n\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  mixed-format (float/bf16 x LNS) kernel test                \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512F__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_batch_mul32();
+    test_gemv32();
+    test_mixed_gemv();
+    test_mixed_dot();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
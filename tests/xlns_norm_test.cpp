@@ -0,0 +1,288 @@
+// Test file for RMS normalization and the single-read layer normalization
+// Functions: xlns16_rmsnorm, xlns32_rmsnorm, xlns16_rmsnorm_lpvip32,
+//            xlns16_layernorm_onepass, xlns32_layernorm_onepass,
+//            xlns16_layernorm_onepass_lpvip32, xlns32_lpvip_acc_push_simd,
+//            xlns16_add_rmsnorm, xlns16_add_layernorm, xlns32_add_rmsnorm,
+//            xlns32_add_layernorm, xlns16_add_rmsnorm_lpvip32, xlns16_add_layernorm_lpvip32
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_norm_test.cpp -o xlns_norm_test -lm && ./xlns_norm_test
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+static const size_t sizes[] = { 1, 7, 16, 33, 256, 1000, 4096 };
+static const int nsizes = sizeof(sizes)/sizeof(sizes[0]);
+// the plain xlns16 kernels add in sequence in xlns16, which loses the
+// last bits past a few hundred elements (see summation16bit.MD)
+static const size_t nseq = 64;
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// float references, in double
+static void rms_ref(const std::vector<float> &x, const std::vector<float> &g, std::vector<double> &y, float eps) {
+    double ss = 0;
+    for (float v : x) ss += (double)v*v;
+    double inv = 1.0/sqrt(ss/x.size() + eps);
+    for (size_t i = 0; i < x.size(); i++) y[i] = x[i]*inv*g[i];
+}
+
+static void ln_ref(const std::vector<float> &x, const std::vector<float> &g, const std::vector<float> &b,
+                   std::vector<double> &y, float eps) {
+    double m = 0, v = 0;
+    for (float t : x) m += t;
+    m /= x.size();
+    for (float t : x) v += (t - m)*(t - m);
+    double inv = 1.0/sqrt(v/x.size() + eps);
+    for (size_t i = 0; i < x.size(); i++) y[i] = (x[i] - m)*inv*g[i] + b[i];
+}
+
+// -----------------------------------------------------------
+//  RMS normalization against float, with and without gamma
+// -----------------------------------------------------------
+void test_rmsnorm() {
+    printf("--- rmsnorm vs float ---\n");
+    printf("  kernel                     n      max |err|  ok\n");
+    for (int s = 0; s < nsizes; s++) {
+        size_t n = sizes[s];
+        std::vector<float> xf(n), gf(n), one(n, 1.0f);
+        std::vector<xlns16> x(n), g(n), y(n);
+        std::vector<xlns32> x32(n), g32(n), y32(n);
+        std::vector<double> ref(n), ref1(n);
+        for (size_t i = 0; i < n; i++) {
+            xf[i] = rndf(); gf[i] = rndf();
+            x[i] = fp2xlns16(xf[i]); g[i] = fp2xlns16(gf[i]);
+            xf[i] = xlns162fp(x[i]); gf[i] = xlns162fp(g[i]);
+            x32[i] = fp2xlns32(xf[i]); g32[i] = fp2xlns32(gf[i]);
+        }
+        rms_ref(xf, gf, ref, 1e-5f);
+        rms_ref(xf, one, ref1, 1e-5f);
+        const char *names[] = { "xlns16_rmsnorm", "xlns32_rmsnorm", "xlns16_rmsnorm_lpvip32" };
+        for (int k = 0; k < 3; k++) {
+            if (k == 0 && n > nseq) continue;
+            double emax = 0;
+            for (int withg = 0; withg < 2; withg++) {
+                if (k == 0) xlns16_rmsnorm(x.data(), y.data(), withg ? g.data() : NULL, n, 1e-5f);
+                if (k == 1) xlns32_rmsnorm(x32.data(), y32.data(), withg ? g32.data() : NULL, n, 1e-5f);
+                if (k == 2) xlns16_rmsnorm_lpvip32(x.data(), y.data(), withg ? g.data() : NULL, n, 1e-5f);
+                for (size_t i = 0; i < n; i++) {
+                    double r = withg ? ref[i] : ref1[i];
+                    double v = (k == 1) ? xlns322fp(y32[i]) : xlns162fp(y[i]);
+                    double e = fabs(v - r)/(fabs(r) + 1.0);
+                    if (e > emax) emax = e;
+                }
+            }
+            double tol = (k == 1) ? 1e-5 : 0.06;
+            printf("  %-24s %5zu  %10.6f  %s\n", names[k], n, emax, emax < tol ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  single-read layernorm against float, next to the 3-pass
+//  kernel, with a zero mean and with a mean far above the
+//  spread (E[x^2] - E[x]^2 without the shift would cancel:
+//  for xlns32 at a mean of 10^4 the error of E[x^2] alone is
+//  larger than the variance); at a mean of 20 the xlns16
+//  values are about 0.1 apart, at 10^4 the xlns32 ones 0.001
+// -----------------------------------------------------------
+void test_onepass() {
+    printf("--- layernorm_onepass vs float (and the 3-pass layernorm) ---\n");
+    printf("  kernel                               mean     n   max |err|  3-pass |err|  ok\n");
+    const char *names[] = { "xlns16_layernorm_onepass", "xlns32_layernorm_onepass",
+                            "xlns16_layernorm_onepass_lpvip32" };
+    const float means[3][2] = { { 0, 20 }, { 0, 10000 }, { 0, 20 } };
+    const double tol[3] = { 0.2, 5e-3, 0.2 };
+    for (int k = 0; k < 3; k++)
+        for (int t = 0; t < 2; t++)
+            for (int s = 0; s < nsizes; s++) {
+                size_t n = sizes[s];
+                if (k == 0 && n > nseq) continue;
+                std::vector<float> xf(n), gf(n), bf(n);
+                std::vector<xlns16> x(n), g(n), b(n), y(n), y3(n);
+                std::vector<xlns32> x32(n), g32(n), b32(n), y32(n), y332(n);
+                std::vector<double> ref(n);
+                for (size_t i = 0; i < n; i++) {
+                    xf[i] = means[k][t] + rndf(); gf[i] = rndf(); bf[i] = rndf();
+                    if (k != 1) {
+                        x[i] = fp2xlns16(xf[i]); g[i] = fp2xlns16(gf[i]); b[i] = fp2xlns16(bf[i]);
+                        xf[i] = xlns162fp(x[i]); gf[i] = xlns162fp(g[i]); bf[i] = xlns162fp(b[i]);
+                    }
+                    x32[i] = fp2xlns32(xf[i]); g32[i] = fp2xlns32(gf[i]); b32[i] = fp2xlns32(bf[i]);
+                }
+                ln_ref(xf, gf, bf, ref, 1e-5f);
+                if (k == 0) {
+                    xlns16_layernorm_onepass(x.data(), y.data(), g.data(), b.data(), n, 1e-5f);
+                    xlns16_layernorm(x.data(), y3.data(), g.data(), b.data(), n, 1e-5f);
+                }
+                if (k == 1) {
+                    xlns32_layernorm_onepass(x32.data(), y32.data(), g32.data(), b32.data(), n, 1e-5f);
+                    xlns32_layernorm(x32.data(), y332.data(), g32.data(), b32.data(), n, 1e-5f);
+                }
+                if (k == 2) {
+                    xlns16_layernorm_onepass_lpvip32(x.data(), y.data(), g.data(), b.data(), n, 1e-5f);
+                    xlns16_layernorm_lpvip32_simd(x.data(), y3.data(), g.data(), b.data(), n, 1e-5f);
+                }
+                double emax = 0, e3max = 0;
+                for (size_t i = 0; i < n; i++) {
+                    double v = (k == 1) ? xlns322fp(y32[i]) : xlns162fp(y[i]);
+                    double v3 = (k == 1) ? xlns322fp(y332[i]) : xlns162fp(y3[i]);
+                    double e = fabs(v - ref[i])/(fabs(ref[i]) + 1.0);
+                    double e3 = fabs(v3 - ref[i])/(fabs(ref[i]) + 1.0);
+                    if (e > emax) emax = e;
+                    if (e3 > e3max) e3max = e3;
+                }
+                printf("  %-32s  %7g  %5zu  %9.5f  %12.5f  %s\n", names[k], means[k][t], n, emax, e3max,
+                       emax < tol[k] ? "yes" : "NO");
+            }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  xlns32_lpvip_acc_push_simd: the same bits as
+//  xlns32_lpvip_acc_push, pushed in pieces of odd lengths
+// -----------------------------------------------------------
+void test_push_simd() {
+    printf("--- xlns32_lpvip_acc_push_simd vs xlns32_lpvip_acc_push ---\n");
+    printf("  n       pieces  same bits  ok\n");
+    const size_t pieces[] = { 1, 5, 31, 32, 100, 1000 };
+    for (size_t n : { (size_t)0, (size_t)3, (size_t)32, (size_t)77, (size_t)1000, (size_t)5000 })
+        for (size_t p : pieces) {
+            std::vector<xlns32> a(n);
+            for (size_t i = 0; i < n; i++) a[i] = fp2xlns32(rndf());
+            xlns32_lpvip_acc s, v;
+            xlns32_lpvip_acc_init(&s);
+            xlns32_lpvip_acc_init(&v);
+            xlns32_lpvip_acc_push(&s, a.data(), n);
+            for (size_t i = 0; i < n; i += p)
+                xlns32_lpvip_acc_push_simd(&v, a.data() + i, (n - i < p) ? n - i : p);
+            int same = xlns32_lpvip_acc_result(&s) == xlns32_lpvip_acc_result(&v) && s.count == v.count;
+            printf("  %5zu  %5zu   %-9s  %s\n", n, p, same ? "yes" : "no", same ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  residual add fused with the norm: the same bits as the add
+//  and then the norm, in place and into another array
+// -----------------------------------------------------------
+void test_fused() {
+    printf("--- fused residual add + norm vs xlns16/32_batch_add and the norm ---\n");
+    printf("  kernel                          n  in place  differ  ok\n");
+    const char *names[] = { "xlns16_add_rmsnorm", "xlns16_add_layernorm", "xlns32_add_rmsnorm",
+                            "xlns32_add_layernorm", "xlns16_add_rmsnorm_lpvip32", "xlns16_add_layernorm_lpvip32" };
+    xlns_pool_init(1);
+    for (int s = 0; s < nsizes; s++) {
+        size_t n = sizes[s];
+        std::vector<xlns16> x(n), r(n), g(n), b(n), xr(n), out(n), sum(n), ref(n);
+        std::vector<xlns32> x32(n), r32(n), g32(n), b32(n), xr32(n), out32(n), sum32(n), ref32(n);
+        for (size_t i = 0; i < n; i++) {
+            float v[4] = { 3*rndf(), rndf(), rndf(), rndf() };
+            x[i] = fp2xlns16(v[0]); r[i] = fp2xlns16(v[1]); g[i] = fp2xlns16(v[2]); b[i] = fp2xlns16(v[3]);
+            x32[i] = fp2xlns32(v[0]); r32[i] = fp2xlns32(v[1]); g32[i] = fp2xlns32(v[2]); b32[i] = fp2xlns32(v[3]);
+        }
+        xlns16_batch_add(x.data(), r.data(), sum.data(), n);
+        xlns32_batch_add(x32.data(), r32.data(), sum32.data(), n);
+        for (int k = 0; k < 6; k++)
+            for (int inplace = 0; inplace < 2; inplace++) {
+                std::vector<xlns16> xs(x);
+                std::vector<xlns32> xs32(x32);
+                xlns16 *dst = inplace ? xs.data() : xr.data();
+                xlns32 *dst32 = inplace ? xs32.data() : xr32.data();
+                switch (k) {
+                case 0: xlns16_add_rmsnorm(xs.data(), r.data(), dst, out.data(), g.data(), n, 1e-5f);
+                        xlns16_rmsnorm(sum.data(), ref.data(), g.data(), n, 1e-5f); break;
+                case 1: xlns16_add_layernorm(xs.data(), r.data(), dst, out.data(), g.data(), b.data(), n, 1e-5f);
+                        xlns16_layernorm_onepass(sum.data(), ref.data(), g.data(), b.data(), n, 1e-5f); break;
+                case 2: xlns32_add_rmsnorm(xs32.data(), r32.data(), dst32, out32.data(), g32.data(), n, 1e-5f);
+                        xlns32_rmsnorm(sum32.data(), ref32.data(), g32.data(), n, 1e-5f); break;
+                case 3: xlns32_add_layernorm(xs32.data(), r32.data(), dst32, out32.data(), g32.data(), b32.data(), n, 1e-5f);
+                        xlns32_layernorm_onepass(sum32.data(), ref32.data(), g32.data(), b32.data(), n, 1e-5f); break;
+                case 4: xlns16_add_rmsnorm_lpvip32(xs.data(), r.data(), dst, out.data(), g.data(), n, 1e-5f);
+                        xlns16_rmsnorm_lpvip32(sum.data(), ref.data(), g.data(), n, 1e-5f); break;
+                case 5: xlns16_add_layernorm_lpvip32(xs.data(), r.data(), dst, out.data(), g.data(), b.data(), n, 1e-5f);
+                        xlns16_layernorm_onepass_lpvip32(sum.data(), ref.data(), g.data(), b.data(), n, 1e-5f); break;
+                }
+                long differ = 0;
+                for (size_t i = 0; i < n; i++) {
+                    if (k == 2 || k == 3)
+                        differ += (dst32[i] != sum32[i]) + (out32[i] != ref32[i]);
+                    else
+                        differ += (dst[i] != sum[i]) + (out[i] != ref[i]);
+                }
+                printf("  %-28s %5zu  %-8s  %6ld  %s\n", names[k], n, inplace ? "yes" : "no", differ,
+                       differ ? "NO" : "yes");
+            }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  several chunks of the fixed tree over 1 to 4 threads: the
+//  statistics are split over the pool, with the same bits, and
+//  the fused kernels still match the add and then the norm
+// -----------------------------------------------------------
+void test_threads() {
+    printf("--- norms over several tree chunks, 1 to 4 threads ---\n");
+    printf("  kernel                          n  threads  differ  ok\n");
+    const char *names[] = { "xlns16_rmsnorm", "xlns16_layernorm_onepass",
+                            "xlns32_rmsnorm", "xlns32_layernorm_onepass",
+                            "xlns16_add_rmsnorm", "xlns16_add_layernorm",
+                            "xlns32_add_rmsnorm", "xlns32_add_layernorm" };
+    const size_t n = 3*4096 + 5;
+    std::vector<xlns16> x(n), r(n), g(n), b(n), sum(n), xr(n), out(n), ref[4];
+    std::vector<xlns32> x32(n), r32(n), g32(n), b32(n), sum32(n), xr32(n), out32(n), ref32[4];
+    for (size_t i = 0; i < n; i++) {
+        float v[4] = { rndf() + 2, rndf(), rndf(), rndf() };
+        x[i] = fp2xlns16(v[0]); r[i] = fp2xlns16(v[1]); g[i] = fp2xlns16(v[2]); b[i] = fp2xlns16(v[3]);
+        x32[i] = fp2xlns32(v[0]); r32[i] = fp2xlns32(v[1]); g32[i] = fp2xlns32(v[2]); b32[i] = fp2xlns32(v[3]);
+    }
+    xlns16_batch_add(x.data(), r.data(), sum.data(), n);
+    xlns32_batch_add(x32.data(), r32.data(), sum32.data(), n);
+    size_t savedmin = xlns_parallel_min;
+    xlns_parallel_min = 1024;
+    for (int t = 1; t <= 4; t++) {
+        xlns_pool_init(t);
+        for (int k = 0; k < 8; k++) {
+            switch (k) {
+            case 0: xlns16_rmsnorm(sum.data(), out.data(), g.data(), n, 1e-5f); break;
+            case 1: xlns16_layernorm_onepass(sum.data(), out.data(), g.data(), b.data(), n, 1e-5f); break;
+            case 2: xlns32_rmsnorm(sum32.data(), out32.data(), g32.data(), n, 1e-5f); break;
+            case 3: xlns32_layernorm_onepass(sum32.data(), out32.data(), g32.data(), b32.data(), n, 1e-5f); break;
+            case 4: xlns16_add_rmsnorm(x.data(), r.data(), xr.data(), out.data(), g.data(), n, 1e-5f); break;
+            case 5: xlns16_add_layernorm(x.data(), r.data(), xr.data(), out.data(), g.data(), b.data(), n, 1e-5f); break;
+            case 6: xlns32_add_rmsnorm(x32.data(), r32.data(), xr32.data(), out32.data(), g32.data(), n, 1e-5f); break;
+            case 7: xlns32_add_layernorm(x32.data(), r32.data(), xr32.data(), out32.data(), g32.data(), b32.data(), n, 1e-5f); break;
+            }
+            if (t == 1 && k < 4) { ref[k] = out; ref32[k] = out32; }
+            int f32 = (k % 4) >= 2;
+            long differ = 0;
+            for (size_t i = 0; i < n; i++) {
+                differ += f32 ? out32[i] != ref32[k % 4][i] : out[i] != ref[k % 4][i];
+                if (k >= 4) differ += f32 ? xr32[i] != sum32[i] : xr[i] != sum[i];
+            }
+            printf("  %-28s %5zu  %7d  %6ld  %s\n", names[k], n, t, differ, differ ? "NO" : "yes");
+        }
+    }
+    xlns_parallel_min = savedmin;
+    printf("\n");
+}
+
+int main() {
+    srand(47);
+    test_rmsnorm();
+    test_onepass();
+    test_push_simd();
+    test_fused();
+    test_threads();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,204 @@
+// Test file for the thread pool and the parallel batch kernels (xlnspool.cpp)
+// Functions: xlns_pool_init, xlns_parallel_for, xlns_parallel_reduce and the split
+//            xlns16/xlns32 batch kernels, sum, vec_dot, softmax, layernorm, xlns32_batch_add_lpvip
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_pool_test.cpp -o xlns_pool_test -lm && ./xlns_pool_test
+
+#define xlns_parallel
+#define xlns16_alt
+#define xlns32_aicasb
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static const size_t N = 50000;
+static const int threads[] = { 1, 2, 3, 4, 8 };
+static const int nthreads = sizeof(threads)/sizeof(threads[0]);
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+static void serial() { xlns_parallel_min = (size_t)-1; }
+static void parallel() { xlns_parallel_min = 1000; xlns_parallel_grain = 256; }
+
+// -----------------------------------------------------------
+//  xlns_parallel_for covers [0, n) exactly once, nested loops run
+// -----------------------------------------------------------
+void test_parallel_for() {
+    printf("--- xlns_parallel_for coverage ---\n");
+    printf("  threads        n  grain  missed  twice  nested      ok\n");
+    const size_t ns[] = { 1, 255, 256, 257, 10000, 100003 };
+    for (int t = 0; t < nthreads; t++) {
+        xlns_pool_init(threads[t]);
+        for (size_t k = 0; k < sizeof(ns)/sizeof(ns[0]); k++) {
+            size_t n = ns[k];
+            std::vector<std::atomic<int> > hit(n);
+            for (size_t i = 0; i < n; i++) hit[i] = 0;
+            std::atomic<long> nested(0);
+            xlns_parallel_for(n, [&](size_t i0, size_t i1) {
+                for (size_t i = i0; i < i1; i++) hit[i]++;
+                xlns_parallel_for(4, [&](size_t j0, size_t j1) { nested += (long)(j1 - j0); }, 1);
+            }, 100);
+            size_t missed = 0, twice = 0;
+            for (size_t i = 0; i < n; i++) {
+                if (hit[i] == 0) missed++;
+                if (hit[i] > 1) twice++;
+            }
+            int ok = missed == 0 && twice == 0 && nested % 4 == 0 && nested > 0;
+            printf("  %7d %8zu  %5d  %6zu  %5zu  %6ld      %s\n", threads[t], n, 100,
+                   missed, twice, (long)nested, ok ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  split elementwise kernels give the serial bits
+// -----------------------------------------------------------
+void test_batch() {
+    printf("--- parallel batch kernels vs serial ---\n");
+    printf("  kernel                    threads  mismatches      ok\n");
+    std::vector<float> fa(N), fb(N), ff(N), fg(N);
+    std::vector<xlns16> a(N), b(N), c(N), r(N);
+    std::vector<xlns32> a32(N), b32(N), c32(N), r32(N);
+    srand(2);
+    for (size_t i = 0; i < N; i++) {
+        fa[i] = rndf(); fb[i] = rndf();
+        a[i] = fp2xlns16(fa[i]); b[i] = fp2xlns16(fb[i]);
+        a32[i] = fp2xlns32(fa[i]); b32[i] = fp2xlns32(fb[i]);
+    }
+    const char *names[] = { "xlns16_batch_mul", "xlns16_batch_add", "xlns16_batch_div",
+                            "xlns16_batch_scale", "xlns16_batch_gelu", "xlns16_batch_from_float",
+                            "xlns16_batch_to_float", "xlns32_batch_add", "xlns32_batch_silu",
+                            "xlns32_batch_add_lpvip" };
+    for (int k = 0; k < 10; k++)
+        for (int t = 0; t < nthreads; t++) {
+            xlns_pool_init(threads[t]);
+            size_t bad = 0;
+            for (int pass = 0; pass < 2; pass++) {
+                xlns16 *o = pass ? c.data() : r.data();
+                xlns32 *o32 = pass ? c32.data() : r32.data();
+                float *of = pass ? ff.data() : fg.data();
+                if (pass) parallel(); else serial();
+                switch (k) {
+                case 0: xlns16_batch_mul(a.data(), b.data(), o, N); break;
+                case 1: xlns16_batch_add(a.data(), b.data(), o, N); break;
+                case 2: xlns16_batch_div(a.data(), b.data(), o, N); break;
+                case 3: xlns16_batch_scale(a.data(), b[7], o, N); break;
+                case 4: xlns16_batch_gelu(a.data(), o, N); break;
+                case 5: xlns16_batch_from_float(fa.data(), o, N); break;
+                case 6: xlns16_batch_to_float(a.data(), of, N); break;
+                case 7: xlns32_batch_add(a32.data(), b32.data(), o32, N); break;
+                case 8: xlns32_batch_silu(a32.data(), o32, N); break;
+                case 9: xlns32_batch_add_lpvip(a32.data(), b32.data(), o32, N); break;
+                }
+            }
+            for (size_t i = 0; i < N; i++) {
+                if (k == 6) bad += memcmp(&ff[i], &fg[i], sizeof(float)) != 0;
+                else if (k >= 7) bad += c32[i] != r32[i];
+                else bad += c[i] != r[i];
+            }
+            printf("  %-24s  %7d  %10zu      %s\n", names[k], threads[t], bad, bad == 0 ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  softmax and layernorm: parallel passes, serial sums -> serial bits
+// -----------------------------------------------------------
+void test_rows() {
+    printf("--- softmax / layernorm with serial sums ---\n");
+    printf("  kernel                    threads  mismatches      ok\n");
+    std::vector<xlns16> a(N), g(N), be(N), c(N), r(N);
+    std::vector<xlns32> a32(N), c32(N), r32(N);
+    srand(3);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = fp2xlns16(rndf()); g[i] = fp2xlns16(rndf()); be[i] = fp2xlns16(rndf());
+        a32[i] = fp2xlns32(rndf());
+    }
+    xlns_parallel_reductions = 0;
+    const char *names[] = { "xlns16_softmax", "xlns16_layernorm", "xlns32_softmax",
+                            "xlns16_softmax_lpvip32_simd" };
+    for (int k = 0; k < 4; k++)
+        for (int t = 0; t < nthreads; t++) {
+            xlns_pool_init(threads[t]);
+            size_t bad = 0;
+            for (int pass = 0; pass < 2; pass++) {
+                xlns16 *o = pass ? c.data() : r.data();
+                xlns32 *o32 = pass ? c32.data() : r32.data();
+                if (pass) parallel(); else serial();
+                switch (k) {
+                case 0: xlns16_softmax(a.data(), o, N); break;
+                case 1: xlns16_layernorm(a.data(), o, g.data(), be.data(), N, 1e-5f); break;
+                case 2: xlns32_softmax(a32.data(), o32, N); break;
+                case 3: xlns16_softmax_lpvip32_simd(a.data(), o, N); break;
+                }
+            }
+            for (size_t i = 0; i < N; i++)
+                bad += (k == 2) ? c32[i] != r32[i] : c[i] != r[i];
+            printf("  %-26s %7d  %10zu      %s\n", names[k], threads[t], bad, bad == 0 ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  split sums: with xlns_parallel_reductions the kernels use the fixed
+//  tree (xlns16_sum_tree etc.); xlns_parallel_reduce folds in chunk order
+// -----------------------------------------------------------
+void test_reductions() {
+    printf("--- xlns_parallel_reductions ---\n");
+    printf("  kernel                    threads        got   expected      ok\n");
+    std::vector<xlns16> a(N), b(N);
+    std::vector<xlns32> a32(N);
+    srand(4);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = fp2xlns16(rndf()); b[i] = fp2xlns16(rndf()); a32[i] = fp2xlns32(rndf());
+    }
+    xlns_pool_init(1);
+    serial();
+    xlns16 e16 = xlns16_sum_tree(a.data(), N), d16 = xlns16_vec_dot_tree(a.data(), b.data(), N);
+    xlns32 e32 = xlns32_sum_tree(a32.data(), N);
+    parallel();
+    xlns_parallel_reductions = 1;
+    for (int t = 0; t < nthreads; t++) {
+        xlns_pool_init(threads[t]);
+        xlns16 s = xlns16_sum(a.data(), N), d = xlns16_vec_dot(a.data(), b.data(), N);
+        xlns32 s32 = xlns32_sum(a32.data(), N);
+        printf("  %-24s  %7d  %9x  %9x      %s\n", "xlns16_sum", threads[t], s, e16, s == e16 ? "yes" : "NO");
+        printf("  %-24s  %7d  %9x  %9x      %s\n", "xlns16_vec_dot", threads[t], d, d16, d == d16 ? "yes" : "NO");
+        printf("  %-24s  %7d  %9x  %9x      %s\n", "xlns32_sum", threads[t], s32, e32, s32 == e32 ? "yes" : "NO");
+    }
+    xlns_pool_deterministic = 1;
+    long want = (long)N*(N-1)/2;
+    long got = xlns_parallel_reduce<long>(N, 1000,
+        [](size_t i0, size_t i1) { long s = 0; for (size_t i = i0; i < i1; i++) s += (long)i; return s; },
+        [](long x, long y) { return x + y; });
+    printf("  %-24s  %7d  %9ld  %9ld      %s\n", "xlns_parallel_reduce", xlns_pool_threads(), got, want,
+           got == want ? "yes" : "NO");
+    long empty = xlns_parallel_reduce<long>(0, 1000,
+        [](size_t i0, size_t i1) { return (long)(i1 - i0); },
+        [](long x, long y) { return x + y; });
+    printf("  %-24s  %7d  %9ld  %9ld      %s\n", "xlns_parallel_reduce n=0", xlns_pool_threads(), empty, 0L,
+           empty == 0 ? "yes" : "NO");
+    xlns_parallel_reductions = 0;
+    xlns_pool_deterministic = 0;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  thread pool / parallel batch kernel test                   \n");
+    printf("=============================================================\n\n");
+
+    test_parallel_for();
+    test_batch();
+    test_rows();
+    test_reductions();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,212 @@
+// Test file for the fp16 and blockwise int8/int4 conversions
+// Functions: fp162xlns16, fp162xlns32, xlns16_fp162fp, q82xlns16, q82xlns32,
+//            xlns16_batch_from_fp16, xlns32_batch_from_fp16, xlns16_batch_from_q8,
+//            xlns32_batch_from_q8, xlns16_batch_from_q4, xlns32_batch_from_q4
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_quant_test.cpp -o xlns_quant_test -lm && ./xlns_quant_test
+//         (also try -mavx2 -mf16c; the results must not change)
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32.cpp"
+
+#include <cstdio>
+#include <vector>
+
+// fp16 value decoded without F16C
+static double fp16val(unsigned h) {
+    int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+    double v = e ? ldexp(1024 + m, e - 25) : ldexp(m, -24);
+    return (h & 0x8000) ? -v : v;
+}
+
+// round-to-nearest references
+static xlns16 ref16(double v) {
+    if (v == 0.0) return xlns16_zero;
+    long l = (long)floor(128.0*log2(fabs(v)) + 0.5) + 0x4000;
+    return (v < 0 ? 0x8000 : 0) | l;
+}
+
+static xlns32 ref32(double v) {
+    if (v == 0.0) return xlns32_zero;
+    long l = (long)floor(8388608.0*log2(fabs(v)) + 0.5) + 0x40000000L;
+    return (v < 0 ? 0x80000000u : 0) | (xlns32)l;
+}
+
+// the definition of the blockwise conversions: q*scale, and zero for q == 0
+static xlns16 qref16(int q, xlns_fp16 scale) {
+    return q ? xlns16_mul(q82xlns16((signed char)q), fp162xlns16(scale)) : xlns16_zero;
+}
+
+static xlns32 qref32(int q, xlns_fp16 scale) {
+    return q ? xlns32_mul(q82xlns32((signed char)q), fp162xlns32(scale)) : xlns32_zero;
+}
+
+// -----------------------------------------------------------
+//  all 65536 fp16 inputs and all 256 int8 values
+// -----------------------------------------------------------
+void test_exhaustive() {
+    printf("--- exhaustive scalar conversions vs round-to-nearest reference ---\n");
+    printf("  function            inputs  mismatches      ok\n");
+    size_t bad16 = 0, bad32 = 0, badf = 0;
+    for (unsigned h = 0; h < 65536; h++) {
+        xlns16 e16;
+        xlns32 e32;
+        if ((h & 0x7c00) == 0x7c00) {
+            e16 = (h & 0x8000) | xlns16_pos_inf;
+            e32 = ((xlns32)(h & 0x8000) << 16) | xlns32_pos_inf;
+        } else {
+            e16 = ref16(fp16val(h));
+            e32 = ref32(fp16val(h));
+            badf += xlns16_fp162fp((xlns_fp16)h) != (float)fp16val(h);
+        }
+        bad16 += fp162xlns16((xlns_fp16)h) != e16;
+        bad32 += fp162xlns32((xlns_fp16)h) != e32;
+    }
+    printf("  %-18s %7d  %10zu      %s\n", "xlns16_fp162fp", 63488, badf, badf == 0 ? "yes" : "NO");
+    printf("  %-18s %7d  %10zu      %s\n", "fp162xlns16", 65536, bad16, bad16 == 0 ? "yes" : "NO");
+    printf("  %-18s %7d  %10zu      %s\n", "fp162xlns32", 65536, bad32, bad32 == 0 ? "yes" : "NO");
+    size_t badq = 0;
+    for (int q = -128; q < 128; q++)
+        badq += (q82xlns16((signed char)q) != ref16(q)) + (q82xlns32((signed char)q) != ref32(q));
+    printf("  %-18s %7d  %10zu      %s\n", "q82xlns16/32", 256, badq, badq == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  batch fp16 (SIMD) against scalar at several offsets
+// -----------------------------------------------------------
+void test_batch_fp16() {
+    printf("--- batch fp16 conversions vs scalar ---\n");
+    printf("  function                 n  offsets  mismatches      ok\n");
+    const size_t n = 65536 + 40;
+    std::vector<xlns_fp16> h(n);
+    std::vector<xlns16> o16(n);
+    std::vector<xlns32> o32(n);
+    for (size_t i = 0; i < n; i++)
+        h[i] = (xlns_fp16)(i*40503u);
+    size_t bad16 = 0, bad32 = 0;
+    for (size_t off = 0; off < 17; off++) {
+        xlns16_batch_from_fp16(h.data() + off, o16.data(), n - off);
+        xlns32_batch_from_fp16(h.data() + off, o32.data(), n - off);
+        for (size_t i = 0; i < n - off; i++) {
+            bad16 += o16[i] != fp162xlns16(h[i+off]);
+            bad32 += o32[i] != fp162xlns32(h[i+off]);
+        }
+    }
+    printf("  %-22s %6zu  %7d  %10zu      %s\n", "xlns16_batch_from_fp16", n, 17, bad16, bad16 == 0 ? "yes" : "NO");
+    printf("  %-22s %6zu  %7d  %10zu      %s\n", "xlns32_batch_from_fp16", n, 17, bad32, bad32 == 0 ? "yes" : "NO");
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  blockwise int8/int4: dst[i] == mul(table value, block scale),
+//  odd block sizes and lengths, 1 and 3 threads
+// -----------------------------------------------------------
+void test_blocks() {
+    printf("--- blockwise int8 / int4 vs scalar definition ---\n");
+    printf("  function                  n  block  threads  mismatches      ok\n");
+    const size_t sizes[] = { 1, 31, 33, 1000, 100001 };
+    const size_t blocks[] = { 1, 7, 32, 256 };
+    xlns_parallel_min = 1000;
+    for (int t = 1; t <= 3; t += 2) {
+        xlns_pool_init(t);
+        for (int si = 0; si < 5; si++)
+            for (int bi = 0; bi < 4; bi++) {
+                size_t n = sizes[si], blk = blocks[bi], nb = (n + blk - 1)/blk;
+                std::vector<signed char> q8(n);
+                std::vector<unsigned char> q4((n + 1)/2);
+                std::vector<xlns_fp16> sc(nb);
+                std::vector<xlns16> o16(n);
+                std::vector<xlns32> o32(n);
+                srand((unsigned)(n + blk));
+                for (size_t i = 0; i < n; i++) q8[i] = (signed char)(rand() & 0xff);
+                for (size_t i = 0; i < q4.size(); i++) q4[i] = (unsigned char)(rand() & 0xff);
+                for (size_t b = 0; b < nb; b++)
+                    sc[b] = (b % 5 == 4) ? 0 : (xlns_fp16)((rand() & 0x7ff) + 0x1c00 + ((b & 1) << 15));
+                size_t bad[4] = { 0, 0, 0, 0 };
+                xlns16_batch_from_q8(q8.data(), sc.data(), blk, o16.data(), n);
+                xlns32_batch_from_q8(q8.data(), sc.data(), blk, o32.data(), n);
+                for (size_t i = 0; i < n; i++) {
+                    bad[0] += o16[i] != qref16(q8[i], sc[i/blk]);
+                    bad[1] += o32[i] != qref32(q8[i], sc[i/blk]);
+                }
+                xlns16_batch_from_q4(q4.data(), sc.data(), blk, o16.data(), n);
+                xlns32_batch_from_q4(q4.data(), sc.data(), blk, o32.data(), n);
+                for (size_t i = 0; i < n; i++) {
+                    int v = ((q4[i/2] >> (4*(i&1))) & 0xf) - 8;
+                    bad[2] += o16[i] != qref16(v, sc[i/blk]);
+                    bad[3] += o32[i] != qref32(v, sc[i/blk]);
+                }
+                const char *names[] = { "xlns16_batch_from_q8", "xlns32_batch_from_q8",
+                                        "xlns16_batch_from_q4", "xlns32_batch_from_q4" };
+                for (int k = 0; k < 4; k++)
+                    if (si == 4 || bad[k])
+                        printf("  %-22s %6zu  %5zu  %7d  %10zu      %s\n", names[k], n, blk, t, bad[k],
+                               bad[k] == 0 ? "yes" : "NO");
+            }
+    }
+    xlns_parallel_min = 1<<15;
+
+    // the dequantized value is close to q*scale
+    xlns_fp16 sc[1] = { 0x28c0 };      // 0.0371
+    signed char q8[4] = { -128, -3, 1, 127 };
+    xlns16 o16[4];
+    xlns16_batch_from_q8(q8, sc, 32, o16, 4);
+    printf("\n  q*scale     xlns16 value   rel.err     ok\n");
+    for (int i = 0; i < 4; i++) {
+        float v = xlns162fp(o16[i]), e = q8[i]*xlns16_fp162fp(sc[0]);
+        printf("  %-10g  %-12g   %8.5f    %s\n", e, v, fabs(v/e - 1), fabs(v/e - 1) < 0.01 ? "yes" : "NO");
+    }
+
+    // q == 0 is zero whatever the scale (a scale > 1 would lift xlns16_zero's tiny log)
+    printf("\n  scale      format  batch   zeros  expected  ok\n");
+    const xlns_fp16 scales[] = { 0x28c0, 0x3c00, 0x4800, 0xd400 };   // 0.0371, 1, 8, -64
+    const size_t nz = 40;
+    signed char z8[nz];
+    unsigned char z4[nz/2];
+    for (size_t i = 0; i < nz; i++) z8[i] = 0;
+    for (size_t i = 0; i < nz/2; i++) z4[i] = 0x88;
+    for (int k = 0; k < 4; k++) {
+        xlns_fp16 s[2] = { scales[k], scales[k] };
+        xlns16 y16[nz];
+        xlns32 y32[nz];
+        for (int f = 0; f < 4; f++) {
+            size_t zeros = 0;
+            if (f == 0) xlns16_batch_from_q8(z8, s, 32, y16, nz);
+            if (f == 1) xlns16_batch_from_q4(z4, s, 32, y16, nz);
+            if (f == 2) xlns32_batch_from_q8(z8, s, 32, y32, nz);
+            if (f == 3) xlns32_batch_from_q4(z4, s, 32, y32, nz);
+            for (size_t i = 0; i < nz; i++)
+                zeros += (f < 2) ? y16[i] == xlns16_zero : y32[i] == xlns32_zero;
+            zeros += (f < 2) ? (xlns16_qmul(q82xlns16(0), fp162xlns16(s[0])) == xlns16_zero)
+                             : (xlns32_qmul(q82xlns32(0), fp162xlns32(s[0])) == xlns32_zero);
+            const char *fmt = (f < 2) ? "xlns16" : "xlns32";
+            printf("  %-9g  %s  %s    %6zu  %8zu  %s\n", xlns16_fp162fp(s[0]), fmt, (f & 1) ? "q4" : "q8",
+                   zeros, nz + 1, zeros == nz + 1 ? "yes" : "NO");
+        }
+    }
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  fp16 and int8/int4 dequantization test                     \n");
+    printf("=============================================================\n\n");
+    #if defined(__AVX512F__)
+    printf("build: AVX-512\n\n");
+    #elif defined(__AVX2__)
+    printf("build: AVX2\n\n");
+    #else
+    printf("build: portable\n\n");
+    #endif
+
+    test_exhaustive();
+    test_batch_fp16();
+    test_blocks();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Test file for the rotary position embedding with LNS cos/sin caches
+// Functions: xlns16_rope_cache_init, xlns16_rope, xlns32_rope_cache_init, xlns32_rope,
+//            both layouts, against a float RoPE and the scalar formula
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_rope_test.cpp -o xlns_rope_test -lm && ./xlns_rope_test
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32.cpp"
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+static const size_t TOKENS = 5, HEADS = 6, POS0 = 100, NPOS = 64, POS = 130;
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// partner of element j of the rotated part and the float rotation of a row
+static size_t partner(size_t j, size_t dims, int interleaved) {
+    return interleaved ? j^1 : (j < dims/2) ? j + dims/2 : j - dims/2;
+}
+
+static void rope_ref(const float *x, double *o, size_t hd, size_t dims, size_t pos, int interleaved) {
+    for (size_t j = 0; j < hd; j++) {
+        if (j >= dims) { o[j] = x[j]; continue; }
+        size_t i = interleaved ? j/2 : j % (dims/2);
+        double a = pos*pow(10000.0, -2.0*i/dims);
+        int first = interleaved ? !(j & 1) : j < dims/2;
+        o[j] = x[j]*cos(a) + x[partner(j, dims, interleaved)]*(first ? -sin(a) : sin(a));
+    }
+}
+
+// the head sizes: full rotation (SIMD blocks and none), a short tail, partial rotary
+static const struct { size_t hd, dims; } shapes[] = {
+    { 64, 64 }, { 128, 128 }, { 6, 6 }, { 40, 40 }, { 80, 32 }, { 96, 64 },
+};
+static const int nshapes = sizeof(shapes)/sizeof(shapes[0]);
+
+// -----------------------------------------------------------
+//  against float RoPE, and bit for bit against the scalar
+//  formula x[j]*cs[j] + x[partner]*sn[j] with the cache entries
+// -----------------------------------------------------------
+void test_rope() {
+    printf("--- rope (%zu tokens from position %zu, %zu heads) vs float and the scalar formula ---\n",
+           TOKENS, POS, HEADS);
+    printf("  kernel        layout       hd  dims   max |err|  differ   ok\n");
+    for (int s = 0; s < nshapes; s++)
+        for (int il = 0; il < 2; il++) {
+            size_t hd = shapes[s].hd, dims = shapes[s].dims, n = TOKENS*HEADS*hd;
+            std::vector<float> xf(n);
+            std::vector<double> ref(hd);
+            std::vector<xlns16> x(n), y(n);
+            std::vector<xlns32> x32(n), y32(n);
+            for (size_t i = 0; i < n; i++) {
+                x[i] = fp2xlns16(rndf());
+                xf[i] = xlns162fp(x[i]);
+                x32[i] = fp2xlns32(xf[i]);
+            }
+            xlns16_rope_cache c;
+            xlns32_rope_cache c32;
+            xlns16_rope_cache_init(&c, POS0, NPOS, dims, il);
+            xlns32_rope_cache_init(&c32, POS0, NPOS, dims, il);
+            xlns16_rope(x.data(), y.data(), TOKENS, HEADS, hd, POS, &c);
+            xlns32_rope(x32.data(), y32.data(), TOKENS, HEADS, hd, POS, &c32);
+            double e16 = 0, e32 = 0;
+            long d16 = 0, d32 = 0;
+            for (size_t r = 0; r < TOKENS*HEADS; r++) {
+                size_t pos = POS + r/HEADS, row = (pos - POS0)*dims;
+                rope_ref(&xf[r*hd], ref.data(), hd, dims, pos, il);
+                for (size_t j = 0; j < hd; j++) {
+                    size_t k = r*hd + j, m = r*hd + ((j < dims) ? partner(j, dims, il) : j);
+                    double a16 = fabs(xlns162fp(y[k]) - ref[j]), a32 = fabs(xlns322fp(y32[k]) - ref[j]);
+                    if (a16 > e16) e16 = a16;
+                    if (a32 > e32) e32 = a32;
+                    if (j < dims) {
+                        d16 += y[k] != xlns16_add(xlns16_mul(x[k], c.cs[row + j]), xlns16_mul(x[m], c.sn[row + j]));
+                        d32 += y32[k] != xlns32_add(xlns32_mul(x32[k], c32.cs[row + j]),
+                                                    xlns32_mul(x32[m], c32.sn[row + j]));
+                    } else {
+                        d16 += y[k] != x[k];
+                        d32 += y32[k] != x32[k];
+                    }
+                }
+            }
+            const char *lay = il ? "interleaved" : "half-split";
+            printf("  %-12s  %-11s  %3zu  %4zu  %10.6f  %6ld   %s\n", "xlns16_rope", lay, hd, dims, e16, d16,
+                   (e16 < 0.12 && d16 == 0) ? "yes" : "NO");
+            printf("  %-12s  %-11s  %3zu  %4zu  %10.6f  %6ld   %s\n", "xlns32_rope", lay, hd, dims, e32, d32,
+                   (e32 < 1e-5 && d32 == 0) ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  in place, and on 1 to 4 threads: the same bits
+// -----------------------------------------------------------
+void test_inplace_threads() {
+    printf("--- rope in place and over 1 to 4 threads ---\n");
+    printf("  kernel        layout       threads  differ   ok\n");
+    size_t hd = 64, n = TOKENS*HEADS*hd;
+    std::vector<xlns16> x(n), y(n), y1(n), z(n);
+    std::vector<xlns32> x32(n), y32(n), y132(n), z32(n);
+    for (size_t i = 0; i < n; i++) {
+        float v = rndf();
+        x[i] = fp2xlns16(v);
+        x32[i] = fp2xlns32(v);
+    }
+    size_t savedmin = xlns_parallel_min;
+    xlns_parallel_min = 256;
+    for (int il = 0; il < 2; il++) {
+        xlns16_rope_cache c;
+        xlns32_rope_cache c32;
+        xlns16_rope_cache_init(&c, POS0, NPOS, hd, il);
+        xlns32_rope_cache_init(&c32, POS0, NPOS, hd, il);
+        for (int t = 1; t <= 4; t++) {
+            xlns_pool_init(t);
+            xlns16_rope(x.data(), y.data(), TOKENS, HEADS, hd, POS, &c);
+            xlns32_rope(x32.data(), y32.data(), TOKENS, HEADS, hd, POS, &c32);
+            if (t == 1) { y1 = y; y132 = y32; }
+            z = x; z32 = x32;
+            xlns16_rope(z.data(), z.data(), TOKENS, HEADS, hd, POS, &c);
+            xlns32_rope(z32.data(), z32.data(), TOKENS, HEADS, hd, POS, &c32);
+            long d16 = 0, d32 = 0;
+            for (size_t i = 0; i < n; i++) {
+                d16 += (y[i] != y1[i]) + (z[i] != y1[i]);
+                d32 += (y32[i] != y132[i]) + (z32[i] != y132[i]);
+            }
+            const char *lay = il ? "interleaved" : "half-split";
+            printf("  %-12s  %-11s  %7d  %6ld   %s\n", "xlns16_rope", lay, t, d16, d16 ? "NO" : "yes");
+            printf("  %-12s  %-11s  %7d  %6ld   %s\n", "xlns32_rope", lay, t, d32, d32 ? "NO" : "yes");
+        }
+    }
+    xlns_parallel_min = savedmin;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  rotary position embedding with LNS cos/sin caches          \n");
+    printf("=============================================================\n\n");
+
+    srand(49);
+    test_rope();
+    test_inplace_threads();
+
+    printf("All tests done.\n");
+    return 0;
+}
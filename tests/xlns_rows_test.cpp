@@ -0,0 +1,245 @@
+// Test file for the row-wise kernels over 2-D tensors and their implicit masks
+// Functions: xlns16_softmax_rows, xlns16_layernorm_rows, xlns32_softmax_rows,
+//            xlns32_layernorm_rows, xlns16_softmax_rows_lpvip32, xlns16_layernorm_rows_lpvip32,
+//            xlns16_alibi_slope, xlns32_alibi_slope, against the 1-D kernels row by row
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_rows_test.cpp -o xlns_rows_test -lm && ./xlns_rows_test
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+static const size_t HEADS = 4, QUERIES = 24, OFFSET = 40, N = OFFSET + QUERIES, LD = N + 3;
+static const size_t ROWS = HEADS*QUERIES;
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+// the masks under test: none, causal, a sliding window, and causal with ALiBi
+static const struct { const char *name; int causal; size_t window, heads; } masks[] = {
+    { "no mask", 0, 0, 0 },
+    { "causal", 1, 0, 0 },
+    { "window 16", 1, 16, 0 },
+    { "causal, ALiBi", 1, 0, HEADS },
+    { "window 9, ALiBi", 1, 9, HEADS },
+};
+static const int nmasks = sizeof(masks)/sizeof(masks[0]);
+
+// the mask of one row as the array xlns16_softmax_masked takes
+static void mask16(const xlns_mask &m, size_t r, xlns16 *mk) {
+    size_t lo = 0, hi = N, pos = 0, head = 0;
+    xlns_mask_row(&m, r, N, lo, hi, pos, head);
+    for (size_t j = 0; j < N; j++) {
+        size_t d = (j < pos) ? pos - j : j - pos;
+        if (j < lo || j >= hi) mk[j] = xlns16_neg_inf;
+        else if (m.heads && d) mk[j] = xlns16_neg(xlns16_mul(xlns16_alibi_slope(head, m.heads), fp2xlns16((float)d)));
+        else mk[j] = xlns16_zero;
+    }
+}
+
+static void mask32(const xlns_mask &m, size_t r, xlns32 *mk) {
+    size_t lo = 0, hi = N, pos = 0, head = 0;
+    xlns_mask_row(&m, r, N, lo, hi, pos, head);
+    for (size_t j = 0; j < N; j++) {
+        size_t d = (j < pos) ? pos - j : j - pos;
+        if (j < lo || j >= hi) mk[j] = xlns32_neg_inf;
+        else if (m.heads && d) mk[j] = xlns32_neg(xlns32_mul(xlns32_alibi_slope(head, m.heads), fp2xlns32((float)d)));
+        else mk[j] = xlns32_zero;
+    }
+}
+
+std::vector<xlns16> a(ROWS*LD), c(ROWS*LD), mk(N), ref(N);
+std::vector<xlns32> a32(ROWS*LD), c32(ROWS*LD), mk32(N), ref32(N);
+
+// -----------------------------------------------------------
+//  softmax rows against the masked 1-D kernel with the mask
+//  as an array, from the first kept column (where the lanes
+//  of the lpvip32 accumulator start): the kept columns must
+//  have the same bits, the masked ones must be zero
+// -----------------------------------------------------------
+void test_softmax_rows() {
+    printf("--- softmax rows (%zu heads x %zu queries, %zu keys, stride %zu) vs 1-D masked kernels ---\n",
+           HEADS, QUERIES, N, LD);
+    printf("  kernel                          mask               rows  kept differ  masked not 0   ok\n");
+    xlns16 scale = fp2xlns16(0.35f);
+    xlns32 scale32 = fp2xlns32(0.35f);
+    for (int k = 0; k < 3; k++)
+        for (int t = 0; t < nmasks; t++) {
+            xlns_mask m = { masks[t].causal, masks[t].window, OFFSET, QUERIES, masks[t].heads };
+            long differ = 0, notzero = 0;
+            if (k == 0) xlns16_softmax_rows(a.data(), LD, c.data(), LD, ROWS, N, scale, &m);
+            if (k == 1) xlns32_softmax_rows(a32.data(), LD, c32.data(), LD, ROWS, N, scale32, &m);
+            if (k == 2) xlns16_softmax_rows_lpvip32(a.data(), LD, c.data(), LD, ROWS, N, scale, &m);
+            for (size_t r = 0; r < ROWS; r++) {
+                size_t lo, hi, pos, head;
+                xlns_mask_row(&m, r, N, lo, hi, pos, head);
+                if (k == 1) {
+                    mask32(m, r, mk32.data());
+                    xlns32_softmax_masked(&a32[r*LD + lo], &mk32[lo], &ref32[lo], N - lo, scale32);
+                } else {
+                    mask16(m, r, mk.data());
+                    if (k == 0) xlns16_softmax_masked(&a[r*LD + lo], &mk[lo], &ref[lo], N - lo, scale);
+                    else xlns16_softmax_masked_lpvip32_simd(&a[r*LD + lo], &mk[lo], &ref[lo], N - lo, scale);
+                }
+                for (size_t j = 0; j < N; j++) {
+                    int masked = (k == 1) ? mk32[j] == xlns32_neg_inf : mk[j] == xlns16_neg_inf;
+                    if (masked)
+                        notzero += (k == 1) ? c32[r*LD + j] != xlns32_zero : c[r*LD + j] != xlns16_zero;
+                    else
+                        differ += (k == 1) ? c32[r*LD + j] != ref32[j] : c[r*LD + j] != ref[j];
+                }
+            }
+            const char *names[] = { "xlns16_softmax_rows", "xlns32_softmax_rows", "xlns16_softmax_rows_lpvip32" };
+            printf("  %-30s  %-16s  %5zu  %11ld  %12ld   %s\n", names[k], masks[t].name, ROWS, differ, notzero,
+                   (differ == 0 && notzero == 0) ? "yes" : "NO");
+        }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  in place, with each mask, against a float softmax of the
+//  same rows with the exact ALiBi slopes
+// -----------------------------------------------------------
+void test_softmax_float() {
+    printf("--- xlns16_softmax_rows in place vs float softmax ---\n");
+    printf("  mask               max |err|     ok\n");
+    for (int t = 0; t < nmasks; t++) {
+        xlns_mask m = { masks[t].causal, masks[t].window, OFFSET, QUERIES, masks[t].heads };
+        std::vector<xlns16> x(a);
+        xlns16_softmax_rows(x.data(), LD, x.data(), LD, ROWS, N, xlns16_one, &m);
+        double emax = 0;
+        for (size_t r = 0; r < ROWS; r++) {
+            size_t lo, hi, pos, head;
+            xlns_mask_row(&m, r, N, lo, hi, pos, head);
+            double slope = m.heads ? pow(2.0, -8.0*(head+1)/m.heads) : 0, mx = -1e30, sum = 0;
+            std::vector<double> p(N, 0.0);
+            for (size_t j = lo; j < hi; j++) {
+                p[j] = xlns162fp(a[r*LD + j]) - slope*((j < pos) ? pos - j : j - pos);
+                if (p[j] > mx) mx = p[j];
+            }
+            for (size_t j = lo; j < hi; j++) sum += p[j] = exp(p[j] - mx);
+            for (size_t j = 0; j < N; j++) {
+                double e = fabs(xlns162fp(x[r*LD + j]) - ((j >= lo && j < hi) ? p[j]/sum : 0.0));
+                if (e > emax) emax = e;
+            }
+        }
+        printf("  %-16s  %9.5f     %s\n", masks[t].name, emax, emax < 0.03 ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  ALiBi slopes against 2^(-8(h+1)/heads)
+// -----------------------------------------------------------
+void test_alibi() {
+    printf("--- xlns16_alibi_slope, xlns32_alibi_slope ---\n");
+    printf("  heads  worst error (units of the last place)   ok\n");
+    const size_t hs[] = { 1, 4, 8, 12, 16, 32, 64 };
+    for (size_t heads : hs) {
+        double e16 = 0, e32 = 0;
+        for (size_t h = 0; h < heads; h++) {
+            double l = -8.0*(h+1)/heads;
+            double d16 = fabs(((xlns16_signed)xlns16_alibi_slope(h, heads) - xlns16_logsignmask) - l*xlns16_scale);
+            double d32 = fabs(((xlns32_signed)xlns32_alibi_slope(h, heads) - xlns32_logsignmask) - l*xlns32_scale);
+            if (d16 > e16) e16 = d16;
+            if (d32 > e32) e32 = d32;
+        }
+        printf("  %5zu  xlns16 %.3f, xlns32 %.3f                   %s\n", heads, e16, e32,
+               (e16 <= 0.5 && e32 <= 0.5) ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  layernorm rows against the 1-D kernels, row by row
+// -----------------------------------------------------------
+void test_layernorm_rows() {
+    printf("--- layernorm rows vs 1-D layernorm ---\n");
+    printf("  kernel                          rows  differ   ok\n");
+    std::vector<xlns16> g(N), b(N);
+    std::vector<xlns32> g32(N), b32(N);
+    for (size_t j = 0; j < N; j++) {
+        float x = rndf(), y = rndf();
+        g[j] = fp2xlns16(x); b[j] = fp2xlns16(y);
+        g32[j] = fp2xlns32(x); b32[j] = fp2xlns32(y);
+    }
+    for (int k = 0; k < 3; k++) {
+        long differ = 0;
+        if (k == 0) xlns16_layernorm_rows(a.data(), LD, c.data(), LD, ROWS, N, g.data(), b.data(), 1e-5f);
+        if (k == 1) xlns32_layernorm_rows(a32.data(), LD, c32.data(), LD, ROWS, N, g32.data(), b32.data(), 1e-5f);
+        if (k == 2) xlns16_layernorm_rows_lpvip32(a.data(), LD, c.data(), LD, ROWS, N, g.data(), b.data(), 1e-5f);
+        for (size_t r = 0; r < ROWS; r++) {
+            if (k == 0) xlns16_layernorm(&a[r*LD], ref.data(), g.data(), b.data(), N, 1e-5f);
+            if (k == 1) xlns32_layernorm(&a32[r*LD], ref32.data(), g32.data(), b32.data(), N, 1e-5f);
+            if (k == 2) xlns16_layernorm_lpvip32_simd(&a[r*LD], ref.data(), g.data(), b.data(), N, 1e-5f);
+            for (size_t j = 0; j < N; j++)
+                differ += (k == 1) ? c32[r*LD + j] != ref32[j] : c[r*LD + j] != ref[j];
+        }
+        const char *names[] = { "xlns16_layernorm_rows", "xlns32_layernorm_rows", "xlns16_layernorm_rows_lpvip32" };
+        printf("  %-30s  %4zu  %6ld   %s\n", names[k], ROWS, differ, differ ? "NO" : "yes");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  the same bits on 1 to 4 threads (rows split over the pool)
+// -----------------------------------------------------------
+void test_threads() {
+    printf("--- rows over 1 to 4 threads ---\n");
+    printf("  kernel                          threads  differ from 1 thread   ok\n");
+    xlns_mask m = { 1, 20, OFFSET, QUERIES, HEADS };
+    std::vector<xlns16> s1(ROWS*LD), l1(ROWS*LD);
+    std::vector<xlns32> s32(ROWS*LD);
+    size_t savedmin = xlns_parallel_min;
+    xlns_parallel_min = 256;
+    for (int t = 1; t <= 4; t++) {
+        xlns_pool_init(t);
+        xlns16_softmax_rows(a.data(), LD, c.data(), LD, ROWS, N, xlns16_one, &m);
+        xlns32_softmax_rows(a32.data(), LD, c32.data(), LD, ROWS, N, xlns32_one, &m);
+        if (t == 1) { s1 = c; s32 = c32; }
+        long d16 = 0, d32 = 0;
+        for (size_t i = 0; i < ROWS*LD; i++) {
+            d16 += c[i] != s1[i];
+            d32 += c32[i] != s32[i];
+        }
+        xlns16_layernorm_rows_lpvip32(a.data(), LD, c.data(), LD, ROWS, N, NULL, NULL, 1e-5f);
+        if (t == 1) l1 = c;
+        long dl = 0;
+        for (size_t i = 0; i < ROWS*LD; i++)
+            dl += c[i] != l1[i];
+        printf("  %-30s  %7d  %20ld   %s\n", "xlns16_softmax_rows", t, d16, d16 ? "NO" : "yes");
+        printf("  %-30s  %7d  %20ld   %s\n", "xlns32_softmax_rows", t, d32, d32 ? "NO" : "yes");
+        printf("  %-30s  %7d  %20ld   %s\n", "xlns16_layernorm_rows_lpvip32", t, dl, dl ? "NO" : "yes");
+    }
+    xlns_parallel_min = savedmin;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  row-wise softmax and layernorm with implicit masks         \n");
+    printf("=============================================================\n\n");
+
+    srand(11);
+    for (size_t i = 0; i < ROWS*LD; i++) {
+        float x = rndf();
+        a[i] = fp2xlns16(x);
+        a32[i] = fp2xlns32(x);
+    }
+
+    test_softmax_rows();
+    test_softmax_float();
+    test_alibi();
+    test_layernorm_rows();
+    test_threads();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
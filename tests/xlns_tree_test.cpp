@@ -0,0 +1,168 @@
+// Test file for the fixed-tree (thread-count independent) sums and dot products
+// Functions: xlns16_sum_tree, xlns16_vec_dot_tree, xlns32_sum_tree, xlns32_vec_dot_tree,
+//            xlns16_sum_lpvip32_tree, xlns16_vec_dot_lpvip32_tree,
+//            xlns16_sum_monte_tree, xlns16_vec_dot_monte_tree, and xlns16/32 softmax/layernorm
+//            with xlns_parallel_reductions
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_tree_test.cpp -o xlns_tree_test -lm && ./xlns_tree_test
+
+#define xlns_parallel
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+#include "../xlns16monte_bylpvip.cpp"
+
+#include <cstdio>
+#include <vector>
+
+static const size_t sizes[] = { 1, 2, 4095, 4096, 4097, 20000, 65536, 100001 };
+static const int nsizes = sizeof(sizes)/sizeof(sizes[0]);
+static const size_t NMAX = 100001;
+static const int maxthreads = 8;
+
+static float rndf() {
+    return 8.0f*((float)rand())/RAND_MAX - 4.0f;
+}
+
+std::vector<xlns16> a(NMAX), b(NMAX), g(NMAX), be(NMAX), o(NMAX), r(NMAX);
+std::vector<xlns32> a32(NMAX), b32(NMAX), o32(NMAX), r32(NMAX);
+
+// one reduction (k) on the first n elements; returns the result bits
+static unsigned run(int k, size_t n) {
+    switch (k) {
+    case 0: return xlns16_sum_tree(a.data(), n);
+    case 1: return xlns16_vec_dot_tree(a.data(), b.data(), n);
+    case 2: return xlns32_sum_tree(a32.data(), n);
+    case 3: return xlns32_vec_dot_tree(a32.data(), b32.data(), n);
+    case 4: return xlns16_sum_lpvip32_tree(a.data(), n);
+    case 5: return xlns16_vec_dot_lpvip32_tree(a.data(), b.data(), n);
+    case 6: xlns16_randombits = 7; return xlns16_sum_monte_tree(a.data(), n) | (xlns16_randombits << 16);
+    case 7: xlns16_randombits = 7; return xlns16_vec_dot_monte_tree(a.data(), b.data(), n) | (xlns16_randombits << 16);
+    }
+    return 0;
+}
+
+// -----------------------------------------------------------
+//  the tree matches a plain serial reference: chunk sums in order,
+//  then pairwise ((p0+p1)+(p2+p3))+...
+// -----------------------------------------------------------
+void test_reference() {
+    printf("--- xlns16_sum_tree / xlns32_sum_tree vs serial reference ---\n");
+    printf("  n         xlns16 got   expected   xlns32 got   expected      ok\n");
+    xlns_pool_init(4);
+    for (int s = 0; s < nsizes; s++) {
+        size_t n = sizes[s];
+        size_t nc = (n + 4095)/4096;
+        std::vector<xlns16> p(nc);
+        std::vector<xlns32> p32(nc);
+        for (size_t c = 0; c < nc; c++) {
+            size_t i1 = (c == nc-1) ? n : (c+1)*4096;
+            p[c] = a[c*4096]; p32[c] = a32[c*4096];
+            for (size_t i = c*4096+1; i < i1; i++) {
+                p[c] = xlns16_add(p[c], a[i]);
+                p32[c] = xlns32_add(p32[c], a32[i]);
+            }
+        }
+        for (size_t w = 1; w < nc; w *= 2)
+            for (size_t c = 0; c + w < nc; c += 2*w) {
+                p[c] = xlns16_add(p[c], p[c+w]);
+                p32[c] = xlns32_add(p32[c], p32[c+w]);
+            }
+        xlns16 got = xlns16_sum_tree(a.data(), n);
+        xlns32 got32 = xlns32_sum_tree(a32.data(), n);
+        printf("  %-7zu  %9x  %9x    %9x  %9x      %s\n", n, got, p[0], got32, p32[0],
+               (got == p[0] && got32 == p32[0]) ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  same bits for 1 to maxthreads threads, for every size
+// -----------------------------------------------------------
+void test_thread_sweep() {
+    printf("--- thread sweep 1..%d (small parallel threshold) ---\n", maxthreads);
+    printf("  function                        sizes  differing      ok\n");
+    const char *names[] = { "xlns16_sum_tree", "xlns16_vec_dot_tree", "xlns32_sum_tree",
+                            "xlns32_vec_dot_tree", "xlns16_sum_lpvip32_tree",
+                            "xlns16_vec_dot_lpvip32_tree", "xlns16_sum_monte_tree",
+                            "xlns16_vec_dot_monte_tree" };
+    unsigned ref[8][nsizes];
+    int bad[8] = { 0 };
+    xlns_parallel_min = 1;
+    for (int t = 1; t <= maxthreads; t++) {
+        xlns_pool_init(t);
+        for (int k = 0; k < 8; k++)
+            for (int s = 0; s < nsizes; s++) {
+                unsigned v = run(k, sizes[s]);
+                if (t == 1) ref[k][s] = v;
+                else if (v != ref[k][s]) bad[k]++;
+            }
+    }
+    for (int k = 0; k < 8; k++)
+        printf("  %-30s  %5d  %9d      %s\n", names[k], nsizes, bad[k], bad[k] == 0 ? "yes" : "NO");
+
+    // the pool off entirely (xlns_parallel_min too big) gives the same bits too
+    xlns_parallel_min = (size_t)-1;
+    int off = 0;
+    for (int k = 0; k < 8; k++)
+        for (int s = 0; s < nsizes; s++)
+            if (run(k, sizes[s]) != ref[k][s]) off++;
+    printf("  %-30s  %5d  %9d      %s\n", "(serial, pool unused)", 8*nsizes, off, off == 0 ? "yes" : "NO");
+    xlns_parallel_min = 1<<15;
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  softmax / layernorm with xlns_parallel_reductions: same bits
+//  for any thread count
+// -----------------------------------------------------------
+void test_kernels_sweep() {
+    printf("--- softmax / layernorm with split sums, thread sweep ---\n");
+    printf("  kernel                    threads  differing      ok\n");
+    const size_t n = 50000;
+    xlns_parallel_reductions = 1;
+    xlns_parallel_min = 1000;
+    const char *names[] = { "xlns16_softmax", "xlns16_layernorm", "xlns32_softmax", "xlns32_layernorm" };
+    for (int k = 0; k < 4; k++)
+        for (int t = 1; t <= maxthreads; t++) {
+            xlns_pool_init(t);
+            xlns16 *out = (t == 1) ? r.data() : o.data();
+            xlns32 *out32 = (t == 1) ? r32.data() : o32.data();
+            switch (k) {
+            case 0: xlns16_softmax(a.data(), out, n); break;
+            case 1: xlns16_layernorm(a.data(), out, g.data(), be.data(), n, 1e-5f); break;
+            case 2: xlns32_softmax(a32.data(), out32, n); break;
+            case 3: xlns32_layernorm(a32.data(), out32, NULL, NULL, n, 1e-5f); break;
+            }
+            if (t == 1) continue;
+            size_t diff = 0;
+            for (size_t i = 0; i < n; i++)
+                diff += (k < 2) ? o[i] != r[i] : o32[i] != r32[i];
+            printf("  %-24s  %7d  %9zu      %s\n", names[k], t, diff, diff == 0 ? "yes" : "NO");
+        }
+    xlns_parallel_reductions = 0;
+    xlns_parallel_min = 1<<15;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  fixed-tree sums: same bits for any thread count            \n");
+    printf("=============================================================\n\n");
+
+    srand(5);
+    for (size_t i = 0; i < NMAX; i++) {
+        float x = rndf(), y = rndf();
+        a[i] = fp2xlns16(x); b[i] = fp2xlns16(y);
+        g[i] = fp2xlns16(rndf()); be[i] = fp2xlns16(rndf());
+        a32[i] = fp2xlns32(x); b32[i] = fp2xlns32(y);
+    }
+
+    test_reference();
+    test_thread_sweep();
+    test_kernels_sweep();
+
+    xlns_pool_shutdown();
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+// Test file for the optional z profile (histogram of -z per kernel, sb vs db)
+// Functions: xlns16_zprof_dump/reset, xlns32_zprof_dump/reset, xlns16_zprof_kernel, xlns32_zprof_kernel,
+//            kernels split over the pool (xlns_parallel)
+// Style: data arrays + loops (matching explog_test pattern)
+// Usage:  g++ -std=c++11 -O2 -pthread -I.. xlns_zprofile_test.cpp -o xlns_zprofile_test -lm && ./xlns_zprofile_test
+//         (also try -mavx2 and -mavx512f; the SIMD lpvip adder must record the same bins)
+
+#define xlns_parallel
+#define xlns16_zprofile
+#define xlns32_zprofile
+#define xlns32_aicasb
+#define xlns16_alt
+#include "../xlns16.cpp"
+#include "../xlns32lpvip.cpp"
+
+#include <cstdio>
+#include <cstring>
+
+// count from the dump: sum of <count> over lines matching format/kernel/op (bin < 0: any bin)
+static unsigned long long fromdump(const char *text, const char *fmt, const char *kern, const char *op, int bin) {
+    unsigned long long tot = 0;
+    char line[512], f[64], k[256], o[8];
+    int b;
+    unsigned long long c;
+    const char *p = text;
+    while (*p) {
+        const char *e = strchr(p, '\n');
+        size_t len = e ? (size_t)(e - p) : strlen(p);
+        if (len >= sizeof(line)) len = sizeof(line) - 1;
+        memcpy(line, p, len); line[len] = 0;
+        if (sscanf(line, "%63s %255s %7s %d %llu", f, k, o, &b, &c) == 5 &&
+            !strcmp(f, fmt) && !strcmp(k, kern) && !strcmp(o, op) && (bin < 0 || b == bin))
+            tot += c;
+        p = e ? e + 1 : p + len;
+    }
+    return tot;
+}
+
+static char dumpbuf[1<<20];
+
+static const char *dump16() {
+    FILE *f = tmpfile();
+    xlns16_zprof_dump(f);
+    rewind(f);
+    size_t n = fread(dumpbuf, 1, sizeof(dumpbuf)-1, f);
+    dumpbuf[n] = 0;
+    fclose(f);
+    return dumpbuf;
+}
+
+static const char *dump32() {
+    FILE *f = tmpfile();
+    xlns32_zprof_dump(f);
+    rewind(f);
+    size_t n = fread(dumpbuf, 1, sizeof(dumpbuf)-1, f);
+    dumpbuf[n] = 0;
+    fclose(f);
+    return dumpbuf;
+}
+
+// -----------------------------------------------------------
+//  single xlns16 adds land in the expected bin
+// -----------------------------------------------------------
+void test_bins16() {
+    printf("--- xlns16_add: bin = -z ---\n");
+    printf("  x        y          op  bin    count  expected  ok\n");
+
+    struct { float x, y; const char *op; int bin; } cases[] = {
+        { 1.0f, 1.0f,        "sb", 0 },
+        { 1.0f, 0.5f,        "sb", 128 },
+        { 4.0f, 1.0f,        "sb", 256 },
+        { 1.0f, -0.5f,       "db", 128 },
+        { 3.0f, -3.0f,       "db", 0 },
+        { 1.0f, 1.0f/8192,   "sb", xlns16_zprof_nbins-1 },
+    };
+    for (auto &c : cases) {
+        xlns16_zprof_reset();
+        xlns16_add(fp2xlns16(c.x), fp2xlns16(c.y));
+        const char *d = dump16();
+        unsigned long long got = fromdump(d, "xlns16", "other", c.op, c.bin);
+        unsigned long long all = fromdump(d, "xlns16", "other", "sb", -1) + fromdump(d, "xlns16", "other", "db", -1);
+        printf("  %-8g %-10g %s  %4d   %6llu  %8d  %s\n", c.x, c.y, c.op, c.bin, got, 1,
+               (got == 1 && all == 1) ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  kernels get their own histograms; totals match the number of adds
+// -----------------------------------------------------------
+void test_kernels() {
+    printf("--- per-kernel histograms ---\n");
+    printf("  kernel                       adds  expected  ok\n");
+
+    const size_t N = 1000;
+    static xlns16 a[N], b[N], c[N];
+    static xlns32 a32[N], b32[N], c32[N];
+    srand(3);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = fp2xlns16(4.0f*((float)rand())/RAND_MAX - 1.0f);
+        b[i] = fp2xlns16(4.0f*((float)rand())/RAND_MAX - 1.0f);
+        a32[i] = ((xlns32)a[i])<<16;
+        b32[i] = ((xlns32)b[i])<<16;
+    }
+    xlns16_zprof_reset();
+    xlns32_zprof_reset();
+    xlns16_sum(a, N);
+    xlns16_vec_dot(a, b, N);
+    xlns16_batch_add(a, b, c, N);
+    xlns32_batch_add_lpvip(a32, b32, c32, N);
+    xlns16_sum_lpvip32(a, N);
+
+    struct { const char *fmt, *kern; unsigned long long expect; } cases[] = {
+        { "xlns16", "xlns16_sum",             N-1 },
+        { "xlns16", "xlns16_vec_dot",         N-1 },
+        { "xlns16", "xlns16_batch_add",       N },
+        { "xlns32", "xlns32_batch_add_lpvip", N },
+        { "xlns32", "xlns16_sum_lpvip32",     N-1 },
+    };
+    for (auto &t : cases) {
+        const char *d = !strcmp(t.fmt, "xlns16") ? dump16() : dump32();
+        unsigned long long got = fromdump(d, t.fmt, t.kern, "sb", -1) + fromdump(d, t.fmt, t.kern, "db", -1);
+        printf("  %-26s %6llu  %8llu  %s\n", t.kern, got, t.expect, (got == t.expect) ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// -----------------------------------------------------------
+//  SIMD lpvip adder records the same bins as the scalar adder
+// -----------------------------------------------------------
+void test_simd_bins() {
+    printf("--- xlns32_batch_add_lpvip vs scalar xlns32_add_lpvip bins ---\n");
+    printf("  bins compared   mismatches  ok\n");
+
+    const size_t N = 4099;
+    static xlns32 a[N], b[N], c[N];
+    static char d1[1<<20];
+    srand(9);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = ((unsigned)rand() << 16) ^ (unsigned)rand();
+        b[i] = a[i] + ((unsigned)rand() % (64u<<23)) - (32u<<23);
+        if (i % 3 == 0) b[i] ^= xlns32_signmask;
+    }
+    xlns32_zprof_reset();
+    xlns32_batch_add_lpvip(a, b, c, N);
+    strcpy(d1, dump32());
+    xlns32_zprof_reset();
+    {
+        xlns32_zprof_kernel("xlns32_batch_add_lpvip");
+        for (size_t i = 0; i < N; i++) c[i] = xlns32_add_lpvip(a[i], b[i]);
+    }
+    const char *d2 = dump32();
+    static unsigned long long h1[2][xlns32_zprof_nbins], h2[2][xlns32_zprof_nbins];
+    const char *ops[] = { "sb", "db" };
+    for (int o = 0; o < 2; o++)
+        for (int bin = 0; bin < xlns32_zprof_nbins; bin++)
+            h1[o][bin] = h2[o][bin] = 0;
+    int bad = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        const char *p = pass ? d2 : d1;
+        char f[64], k[256], o[8];
+        int b, used;
+        unsigned long long c;
+        while (sscanf(p, "%63s %255s %7s %d %llu%n", f, k, o, &b, &c, &used) == 5) {
+            if (!strcmp(f, "xlns32") && !strcmp(k, "xlns32_batch_add_lpvip") && b >= 0 && b < xlns32_zprof_nbins)
+                (pass ? h2 : h1)[strcmp(o, ops[0]) ? 1 : 0][b] += c;
+            p += used;
+        }
+    }
+    for (int o = 0; o < 2; o++)
+        for (int bin = 0; bin < xlns32_zprof_nbins; bin++)
+            if (h1[o][bin] != h2[o][bin])
+                bad++;
+    printf("  %13d   %10d  %s\n\n", xlns32_zprof_nbins, bad, bad ? "NO" : "yes");
+}
+
+// -----------------------------------------------------------
+//  kernels split over the pool: the chunks on the other threads
+//  still count under the kernel, none under "other"
+// -----------------------------------------------------------
+void test_pool() {
+    printf("--- kernels split over the pool ---\n");
+    printf("  kernel        threads    adds  expected  other  ok\n");
+
+    const size_t R = 4096, C = 256;
+    static xlns16 W[R*C], x[C], y[R];
+    static xlns32 W32[R*C], x32[C], y32[R];
+    srand(5);
+    for (size_t i = 0; i < R*C; i++) {
+        W[i] = fp2xlns16(4.0f*((float)rand())/RAND_MAX - 2.0f);
+        W32[i] = ((xlns32)W[i])<<16;
+    }
+    for (size_t i = 0; i < C; i++) {
+        x[i] = fp2xlns16(4.0f*((float)rand())/RAND_MAX - 2.0f);
+        x32[i] = ((xlns32)x[i])<<16;
+    }
+    size_t savedmin = xlns_parallel_min;
+    xlns_parallel_min = 1024;
+    for (int t = 1; t <= 4; t += 3) {
+        xlns_pool_init(t);
+        xlns16_zprof_reset();
+        xlns32_zprof_reset();
+        xlns16_gemv(W, x, y, R, C);
+        xlns32_gemv(W32, x32, y32, R, C);
+        unsigned long long expect = R*(C-1);
+        for (int f = 0; f < 2; f++) {
+            const char *d = f ? dump32() : dump16();
+            const char *fmt = f ? "xlns32" : "xlns16", *kern = f ? "xlns32_gemv" : "xlns16_gemv";
+            unsigned long long got = fromdump(d, fmt, kern, "sb", -1) + fromdump(d, fmt, kern, "db", -1);
+            unsigned long long other = fromdump(d, fmt, "other", "sb", -1) + fromdump(d, fmt, "other", "db", -1);
+            printf("  %-12s  %7d  %6llu  %8llu  %5llu  %s\n", kern, t, got, expect, other,
+                   (got == expect && other == 0) ? "yes" : "NO");
+        }
+    }
+    xlns_parallel_min = savedmin;
+    printf("\n");
+}
+
+int main() {
+    printf("=============================================================\n");
+    printf("  xlns16/xlns32 z profile test                               \n");
+    #if defined(__AVX512F__)
+    printf("  (AVX-512 build)\n");
+    #elif defined(__AVX2__)
+    printf("  (AVX2 build)\n");
+    #else
+    printf("  (portable build)\n");
+    #endif
+    printf("=============================================================\n\n");
+
+    test_bins16();
+    test_kernels();
+    test_simd_bins();
+    test_pool();
+
+    printf("All tests done.\n");
+    return 0;
+}
@@ -0,0 +1,91 @@
+//timing of plain xlns16 sums vs lpvip32-accumulated sums (scalar and multi-lane SIMD)
+//compile with -O2 -mavx2 (or -mavx512f) to get the SIMD xlns32_add_lpvip; without
+//a -m flag the _simd kernels run the same lane order in portable code
+//   g++ -O2 -mavx2 time16lpvip32test.cpp -o time16lpvip32test
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#ifdef xlns16case
+ #include "xlns16testcase.h"
+#else
+ #define xlns16_alt
+ #define xlns16_table
+#endif
+#include "xlns16.cpp"
+
+#define xlns32_aicasb
+#include "xlns32lpvip.cpp"   //must be after xlns16.cpp for the xlns16 kernels
+
+#include <time.h>
+
+#define N 4096
+#define REPS 20000
+
+xlns16 a[N], b[N];
+
+double nsper(clock_t t1, clock_t t2)
+{
+	return 1e9*((double)(t2-t1))/CLOCKS_PER_SEC/((double)N*REPS);
+}
+
+int main()
+{
+	clock_t t1,t2;
+	int i,cnt;
+	xlns16 s, s1 = 0, s2 = 0;
+
+        #ifdef xlns16case
+         printf(xlns16_whatcase);
+        #endif
+	#if defined(__AVX512F__)
+	printf("AVX-512 build\n");
+	#elif defined(__AVX2__)
+	printf("AVX2 build\n");
+	#else
+	printf("portable build\n");
+	#endif
+	for (i=0; i<N; i++)
+	{
+		a[i] = fp2xlns16(4.0*((float) rand())/RAND_MAX - 1.0);
+		b[i] = fp2xlns16(4.0*((float) rand())/RAND_MAX - 1.0);
+	}
+	printf("                        ns/elem  result\n");
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s = xlns16_sum(a+(cnt&1), N-1);
+	t2 = clock();
+	printf("xlns16_sum              %6.2f   %f\n", nsper(t1,t2), xlns162fp(s));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s = xlns16_sum_lpvip32(a+(cnt&1), N-1);
+	t2 = clock();
+	printf("xlns16_sum_lpvip32      %6.2f   %f\n", nsper(t1,t2), xlns162fp(s));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s1 = xlns16_sum_lpvip32_simd(a+(cnt&1), N-1);
+	t2 = clock();
+	printf("xlns16_sum_lpvip32_simd %6.2f   %f\n", nsper(t1,t2), xlns162fp(s1));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s = xlns16_vec_dot(a+(cnt&1), b, N-1);
+	t2 = clock();
+	printf("xlns16_vec_dot          %6.2f   %f\n", nsper(t1,t2), xlns162fp(s));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s = xlns16_vec_dot_lpvip32(a+(cnt&1), b, N-1);
+	t2 = clock();
+	printf("xlns16_vec_dot_lpvip32  %6.2f   %f\n", nsper(t1,t2), xlns162fp(s));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		s2 = xlns16_vec_dot_lpvip32_simd(a+(cnt&1), b, N-1);
+	t2 = clock();
+	printf("xlns16_vec_dot_lpvip32_simd %6.2f %f\n", nsper(t1,t2), xlns162fp(s2));
+	return 0;
+}
@@ -0,0 +1,81 @@
+//timing of the xlns64 operations against double and xlns32, and of the xlns32
+//dot product accumulated in xlns32 and in xlns64 (with its error against the
+//exact sum, in units of 2^-23 in the log)
+//   g++ -std=c++11 -O2 -march=native time64test.cpp -o time64test
+//   ./time64test [n]      (default 1M elements)
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define xlns32_alt
+#include "xlns32.cpp"
+#include "xlns64.cpp"
+
+#include <chrono>
+
+#define REPS 3
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = (argc > 1) ? atol(argv[1]) : 1 << 20;
+	const char *names[] = { "double +", "xlns32_add", "xlns64_add", "xlns64_mul", "fp2xlns64", "xlns642fp",
+	                        "xlns32_vec_dot", "xlns32_vec_dot_xlns64" };
+	const int nk = 8;
+	size_t i;
+	int k, cnt;
+	unsigned long long s = 0;
+
+	double *d = new double[n];
+	xlns32 *a = new xlns32[n];
+	xlns32 *b = new xlns32[n];
+	xlns64 *a64 = new xlns64[n];
+	srand(1);
+	long double exact = 0;
+	for (i=0; i<n; i++)
+	{
+		d[i] = ((double) rand())/RAND_MAX + 0.1;
+		a[i] = fp2xlns32(d[i]);
+		b[i] = fp2xlns32(4.0*((double) rand())/RAND_MAX - 1.0);
+		a64[i] = fp2xlns64(d[i]);
+		xlns32 p = xlns32_mul(a[i], b[i]);
+		exact += (xlns32_sign(p) ? -1 : 1)*exp2l((long double)(xlns32_signed)(xlns32_abs(p) - xlns32_logsignmask)/(1<<23));
+	}
+	printf("n=%zu\n", n);
+	printf("%-24s %9s %9s %12s\n", "", "ms", "ns/elem", "err (units)");
+	for (k = 0; k < nk; k++)
+	{
+		double ds = 0, t1 = now();
+		xlns32 r32 = 0;
+		xlns64 r64 = 0;
+		for (cnt=0; cnt<REPS; cnt++)
+			switch (k)
+			{
+			case 0: ds = 0; for (i=0; i<n; i++) ds += d[i]; break;
+			case 1: r32 = a[0]; for (i=1; i<n; i++) r32 = xlns32_add(r32, a[i]); break;
+			case 2: r64 = a64[0]; for (i=1; i<n; i++) r64 = xlns64_add(r64, a64[i]); break;
+			case 3: r64 = xlns64_one; for (i=0; i<n; i++) r64 = xlns64_mul(r64, a64[i]); break;
+			case 4: r64 = 0; for (i=0; i<n; i++) r64 ^= fp2xlns64(d[i]); break;
+			case 5: ds = 0; for (i=0; i<n; i++) ds += xlns642fp(a64[i]); break;
+			case 6: r32 = xlns32_vec_dot(a, b, n); break;
+			case 7: r32 = xlns32_vec_dot_xlns64(a, b, n); break;
+			}
+		double sec = (now() - t1)/REPS;
+		s += r32 + r64 + (unsigned long long)ds;
+		printf("%-24s %9.2f %9.2f", names[k], 1e3*sec, 1e9*sec/n);
+		if (k >= 6)
+			printf(" %12.3Lf", fabsl((long double)(xlns32_signed)(xlns32_abs(r32) - xlns32_logsignmask)
+			                         - log2l(fabsl(exact))*(1<<23)));
+		printf("\n");
+	}
+	printf("(checksum %016llx)\n", s);
+	delete [] d;
+	delete [] a;
+	delete [] b;
+	delete [] a64;
+	return 0;
+}
@@ -0,0 +1,78 @@
+//timing of the direct bfloat16 <-> xlns16 batch conversions against memcpy of the
+//same bytes (the streaming limit) and against widening to float and calling fp2xlns16
+//   g++ -std=c++11 -O2 -march=native -pthread timebf16test.cpp -o timebf16test
+//   ./timebf16test [n [threads]]      (default 64M elements, all cores)
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns_parallel
+#define xlns16_alt
+#define xlns16_table
+#include "xlns16.cpp"
+
+#include <chrono>
+
+#define REPS 3
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = (argc > 1) ? atol(argv[1]) : (size_t)64 << 20;
+	int threads = (argc > 2) ? atoi(argv[2]) : 0;
+	const char *names[] = { "memcpy", "bf16->float->fp2xlns16", "xlns16_batch_from_bf16",
+	                        "xlns16_batch_to_bf16" };
+	const int nk = 4;
+	size_t i;
+	int k, cnt;
+	unsigned s = 0;
+
+	xlns_pool_init(threads);
+	xlns_bf16 *b = new xlns_bf16[n];
+	xlns16 *x = new xlns16[n];
+	srand(1);
+	for (i=0; i<n; i++)
+	{
+		b[i] = (xlns_bf16)((rand() & 0x3ff) + 0x3b00) ^ ((rand() & 1) << 15);
+		x[i] = 0;
+	}
+	double bytes = 4.0*n;          // read 2, write 2 per element
+	#if defined(__AVX512BW__)
+	printf("AVX-512 build, ");
+	#elif defined(__AVX2__)
+	printf("AVX2 build, ");
+	#else
+	printf("portable build, ");
+	#endif
+	printf("n=%zu (%.1f Mbyte each way), %d threads\n", n, 2.0*n/1e6, xlns_pool_threads());
+	printf("%-26s %9s %8s %7s\n", "", "ms", "GB/s", "%memcpy");
+	double base = 0;
+	for (k = 0; k < nk; k++)
+	{
+		double t1 = now();
+		for (cnt=0; cnt<REPS; cnt++)
+			switch (k)
+			{
+			case 0: xlns_parallel_for(n, [&](size_t i0, size_t i1) {
+						memcpy(x+i0, b+i0, 2*(i1-i0)); }, 1<<16); break;
+			case 1: xlns_parallel_for(n, [&](size_t i0, size_t i1) {
+						for (size_t j = i0; j < i1; j++) x[j] = fp2xlns16(xlns16_bf162fp(b[j])); });
+					break;
+			case 2: xlns16_batch_from_bf16(b, x, n); break;
+			case 3: xlns16_batch_to_bf16(x, b, n); break;
+			}
+		double sec = (now() - t1)/REPS;
+		if (k == 0)
+			base = sec;
+		s += x[n/2] + b[n/3];
+		printf("%-26s %9.2f %8.2f %7.1f\n", names[k], 1e3*sec, bytes/sec/1e9, 100.0*base/sec);
+	}
+	printf("(checksum %08x)\n", s);
+	delete [] b;
+	delete [] x;
+	return 0;
+}
@@ -0,0 +1,381 @@
+//timing and error of one transformer decoder block run entirely in xlns16, next to
+//the same block in float: norm, Q/K/V projections, causal attention (dot products
+//with the cached keys, masked softmax, weighted sum of the cached values), output
+//projection, residual, norm, MLP and residual, token by token with a growing KV cache
+//(as in decode, or a prefill of the given number of tokens).  two blocks: gpt
+//(layernorm, GELU MLP) and llama (RMS norm, SiLU-gated MLP).  the xlns16 block runs
+//with each accumulation mode:
+//   x   xlns16_gemv, xlns16_vec_dot, xlns16_softmax_masked, xlns16_layernorm
+//   m   the _monte versions (xlns16monte.cpp)
+//   l   xlns16_gemv_lpvip32 and the _lpvip32_simd versions (xlns32lpvip.cpp)
+//the weights are random (scaled by 1/sqrt(fan in)) and the same values in both
+//formats, so the error is that of the arithmetic alone: the relative rms error of the
+//block output and of what the block adds to its input, against the float block.
+//the table gives the time per op summed over the tokens (the RMS norm is xlns16_rmsnorm
+//or xlns16_rmsnorm_lpvip32; for m it is composed of xlns16_vec_dot_monte and a scale)
+//   g++ -std=c++11 -O2 -march=native -pthread timeblocktest.cpp -o timeblocktest
+//   ./timeblocktest [modes [tokens [dmodel heads ffn [threads]]]]   (default xml 128 512 8 1536)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define xlns_parallel
+#define xlns16_alt
+#define xlns16_table
+#include "xlns16.cpp"
+#include "xlns32lpvip.cpp"
+#include "xlns16monte.cpp"
+
+#include <chrono>
+#include <vector>
+
+#define NOPS 12
+#define MAXMODES 4
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char *opname[NOPS] = { "norm 1", "q, k, v", "scores q.k", "softmax", "scores.v", "out proj",
+                             "residual 1", "norm 2", "mlp up", "activation", "mlp down", "residual 2" };
+
+//the accumulating kernels of one mode
+struct xlns16_mode
+{
+	char key;
+	const char *name;
+	void (*gemv)(const xlns16 *, const xlns16 *, xlns16 *, size_t, size_t);
+	void (*gemv_t)(const xlns16 *, const xlns16 *, xlns16 *, size_t, size_t);
+	xlns16 (*vec_dot)(const xlns16 *, const xlns16 *, size_t);
+	void (*softmax_masked)(const xlns16 *, const xlns16 *, xlns16 *, size_t, xlns16);
+	void (*layernorm)(const xlns16 *, xlns16 *, const xlns16 *, const xlns16 *, size_t, float);
+	void (*rmsnorm)(const xlns16 *, xlns16 *, const xlns16 *, size_t, float);
+};
+
+const xlns16_mode modes[] = {
+	{ 'x', "xlns16", xlns16_gemv, xlns16_gemv_t, xlns16_vec_dot, xlns16_softmax_masked, xlns16_layernorm,
+	  xlns16_rmsnorm },
+	{ 'm', "monte", xlns16_gemv_monte, xlns16_gemv_t_monte, xlns16_vec_dot_monte, xlns16_softmax_masked_monte,
+	  xlns16_layernorm_monte, NULL },
+	{ 'l', "lpvip32", xlns16_gemv_lpvip32, xlns16_gemv_t_lpvip32, xlns16_vec_dot_lpvip32_simd,
+	  xlns16_softmax_masked_lpvip32_simd, xlns16_layernorm_lpvip32_simd,
+	  xlns16_rmsnorm_lpvip32 } };
+
+struct shape
+{
+	size_t d, heads, hd, ffn, tokens;
+	int llama;              //RMS norm and SiLU-gated MLP, else layernorm and GELU
+};
+
+//the weights of one block, as float and as xlns16 (the same values)
+struct weights
+{
+	std::vector<float> wq, wk, wv, wo, wup, wgate, wdown, g1, b1, g2, b2;
+	std::vector<xlns16> xq, xk, xv, xo, xup, xgate, xdown, xg1, xb1, xg2, xb2;
+};
+
+void randw(std::vector<float> &w, std::vector<xlns16> &x, size_t n, float scale, float offset)
+{
+	w.resize(n);
+	x.resize(n);
+	for (size_t i=0; i<n; i++)
+	{
+		x[i] = fp2xlns16(offset + scale*(2.0*rand()/RAND_MAX - 1));
+		w[i] = xlns162fp(x[i]);
+	}
+}
+
+void makeweights(const shape &s, weights &w)
+{
+	float sd = 1/sqrt((float)s.d), sf = 1/sqrt((float)s.ffn);
+	randw(w.wq, w.xq, s.d*s.d, sd, 0);
+	randw(w.wk, w.xk, s.d*s.d, sd, 0);
+	randw(w.wv, w.xv, s.d*s.d, sd, 0);
+	randw(w.wo, w.xo, s.d*s.d, sd, 0);
+	randw(w.wup, w.xup, s.ffn*s.d, sd, 0);
+	randw(w.wgate, w.xgate, s.llama ? s.ffn*s.d : 0, sd, 0);
+	randw(w.wdown, w.xdown, s.d*s.ffn, sf, 0);
+	randw(w.g1, w.xg1, s.d, 0.2, 1);
+	randw(w.g2, w.xg2, s.d, 0.2, 1);
+	randw(w.b1, w.xb1, s.d, 0.1, 0);
+	randw(w.b2, w.xb2, s.d, 0.1, 0);
+}
+
+//time since t0 into tm[k]
+#define lap(k) (t1 = now(), tm[k] += t1 - t0, t0 = t1)
+
+//float block
+
+void fgemv(const float *W, const float *x, float *y, size_t rows, size_t cols)
+{
+	for (size_t r=0; r<rows; r++)
+	{
+		float s = 0;
+		for (size_t c=0; c<cols; c++)
+			s += W[r*cols + c]*x[c];
+		y[r] = s;
+	}
+}
+
+void fnorm(const shape &s, const float *x, float *out, const float *g, const float *b)
+{
+	size_t i, n = s.d;
+	float mean = 0, var = 0;
+	if (!s.llama)
+	{
+		for (i=0; i<n; i++)
+			mean += x[i];
+		mean /= n;
+	}
+	for (i=0; i<n; i++)
+		var += (x[i] - mean)*(x[i] - mean);
+	float inv = 1/sqrt(var/n + 1e-5f);
+	for (i=0; i<n; i++)
+		out[i] = s.llama ? (x[i]*inv)*g[i] : (x[i] - mean)*inv*g[i] + b[i];
+}
+
+float fgelu(float x)
+{
+	return 0.5f*x*(1 + tanh(0.7978845608f*(x + 0.044715f*x*x*x)));
+}
+
+float fsilu(float x)
+{
+	return x/(1 + exp(-x));
+}
+
+//one token through the float block: x (d values) is updated in place, t is the position
+void fblock(const shape &s, const weights &w, float *x, size_t t, float *kc, float *vc, double *tm)
+{
+	std::vector<float> h(s.d), q(s.d), a(s.d), o(s.d), p(t+1), u(s.ffn), g(s.ffn);
+	size_t i, j, hh, hd = s.hd;
+	double t0 = now(), t1;
+	fnorm(s, x, h.data(), w.g1.data(), w.b1.data());
+	lap(0);
+	fgemv(w.wq.data(), h.data(), q.data(), s.d, s.d);
+	fgemv(w.wk.data(), h.data(), kc + t*s.d, s.d, s.d);
+	fgemv(w.wv.data(), h.data(), vc + t*s.d, s.d, s.d);
+	lap(1);
+	for (hh=0; hh<s.heads; hh++)
+	{
+		const float *qh = q.data() + hh*hd;
+		double t2 = now();
+		for (j=0; j<=t; j++)
+		{
+			float d = 0;
+			for (i=0; i<hd; i++)
+				d += qh[i]*kc[j*s.d + hh*hd + i];
+			p[j] = d/sqrt((float)hd);
+		}
+		double t3 = now();
+		float m = p[0], sum = 0;
+		for (j=1; j<=t; j++)
+			m = (p[j] > m) ? p[j] : m;
+		for (j=0; j<=t; j++)
+			sum += p[j] = exp(p[j] - m);
+		for (j=0; j<=t; j++)
+			p[j] /= sum;
+		double t4 = now();
+		for (i=0; i<hd; i++)
+		{
+			float d = 0;
+			for (j=0; j<=t; j++)
+				d += p[j]*vc[j*s.d + hh*hd + i];
+			a[hh*hd + i] = d;
+		}
+		t0 = now();
+		tm[2] += t3 - t2;
+		tm[3] += t4 - t3;
+		tm[4] += t0 - t4;
+	}
+	fgemv(w.wo.data(), a.data(), o.data(), s.d, s.d);
+	lap(5);
+	for (i=0; i<s.d; i++)
+		x[i] += o[i];
+	lap(6);
+	fnorm(s, x, h.data(), w.g2.data(), w.b2.data());
+	lap(7);
+	fgemv(w.wup.data(), h.data(), u.data(), s.ffn, s.d);
+	if (s.llama)
+		fgemv(w.wgate.data(), h.data(), g.data(), s.ffn, s.d);
+	lap(8);
+	for (i=0; i<s.ffn; i++)
+		u[i] = s.llama ? fsilu(g[i])*u[i] : fgelu(u[i]);
+	lap(9);
+	fgemv(w.wdown.data(), u.data(), o.data(), s.d, s.ffn);
+	lap(10);
+	for (i=0; i<s.d; i++)
+		x[i] += o[i];
+	lap(11);
+}
+
+//xlns16 block
+
+void xnorm(const shape &s, const xlns16_mode &m, const xlns16 *x, xlns16 *out, const xlns16 *g, const xlns16 *b)
+{
+	if (!s.llama)
+	{
+		m.layernorm(x, out, g, b, s.d, 1e-5f);
+		return;
+	}
+	if (m.rmsnorm)
+	{
+		m.rmsnorm(x, out, g, s.d, 1e-5f);
+		return;
+	}
+	xlns16 ms = xlns16_div(m.vec_dot(x, x, s.d), fp2xlns16((float)s.d));
+	xlns16_batch_scale(x, fp2xlns16(1.0f / sqrt(xlns162fp(ms) + 1e-5f)), out, s.d);
+	xlns16_batch_mul(out, g, out, s.d);
+}
+
+//one token through the xlns16 block with the kernels of mode m; the caches are kept
+//by head (head hh at kc + hh*tokens*hd), so the values of a head are the rows of a
+//matrix, and the mask row holds xlns16_neg_inf past position t
+void xblock(const shape &s, const xlns16_mode &m, const weights &w, xlns16 *x, size_t t,
+            xlns16 *kc, xlns16 *vc, xlns16 *mask, double *tm)
+{
+	std::vector<xlns16> h(s.d), q(s.d), k(s.d), v(s.d), a(s.d), o(s.d), p(s.tokens), u(s.ffn), g(s.ffn);
+	size_t j, hh, hd = s.hd;
+	xlns16 scale = fp2xlns16(1/sqrt((float)hd));
+	double t0 = now(), t1;
+	mask[t] = xlns16_zero;
+	xnorm(s, m, x, h.data(), w.xg1.data(), w.xb1.data());
+	lap(0);
+	m.gemv(w.xq.data(), h.data(), q.data(), s.d, s.d);
+	m.gemv(w.xk.data(), h.data(), k.data(), s.d, s.d);
+	m.gemv(w.xv.data(), h.data(), v.data(), s.d, s.d);
+	for (hh=0; hh<s.heads; hh++)
+	{
+		memcpy(kc + (hh*s.tokens + t)*hd, &k[hh*hd], hd*sizeof(xlns16));
+		memcpy(vc + (hh*s.tokens + t)*hd, &v[hh*hd], hd*sizeof(xlns16));
+	}
+	lap(1);
+	for (hh=0; hh<s.heads; hh++)
+	{
+		const xlns16 *kh = kc + hh*s.tokens*hd;
+		double t2 = now();
+		for (j=0; j<=t; j++)
+			p[j] = m.vec_dot(q.data() + hh*hd, kh + j*hd, hd);
+		double t3 = now();
+		m.softmax_masked(p.data(), mask, p.data(), s.tokens, scale);
+		double t4 = now();
+		m.gemv_t(vc + hh*s.tokens*hd, p.data(), a.data() + hh*hd, t+1, hd);
+		t0 = now();
+		tm[2] += t3 - t2;
+		tm[3] += t4 - t3;
+		tm[4] += t0 - t4;
+	}
+	m.gemv(w.xo.data(), a.data(), o.data(), s.d, s.d);
+	lap(5);
+	xlns16_batch_add(x, o.data(), x, s.d);
+	lap(6);
+	xnorm(s, m, x, h.data(), w.xg2.data(), w.xb2.data());
+	lap(7);
+	m.gemv(w.xup.data(), h.data(), u.data(), s.ffn, s.d);
+	if (s.llama)
+		m.gemv(w.xgate.data(), h.data(), g.data(), s.ffn, s.d);
+	lap(8);
+	if (s.llama)
+	{
+		xlns16_batch_silu(g.data(), g.data(), s.ffn);
+		xlns16_batch_mul(g.data(), u.data(), u.data(), s.ffn);
+	}
+	else
+		xlns16_batch_gelu(u.data(), u.data(), s.ffn);
+	lap(9);
+	m.gemv(w.xdown.data(), u.data(), o.data(), s.d, s.ffn);
+	lap(10);
+	xlns16_batch_add(x, o.data(), x, s.d);
+	lap(11);
+}
+
+int main(int argc, char **argv)
+{
+	const char *keys = (argc > 1) ? argv[1] : "xml";
+	shape s;
+	s.tokens = (argc > 2) ? atol(argv[2]) : 128;
+	s.d = (argc > 5) ? atol(argv[3]) : 512;
+	s.heads = (argc > 5) ? atol(argv[4]) : 8;
+	s.ffn = (argc > 5) ? atol(argv[5]) : 1536;
+	int threads = (argc > 6) ? atoi(argv[6]) : 0;
+	int nm, k, mi, op;
+	size_t i, t;
+	unsigned chk = 0;
+	if (s.heads == 0 || s.d % s.heads)
+	{
+		printf("dmodel must be a multiple of heads\n");
+		return 1;
+	}
+	s.hd = s.d/s.heads;
+	xlns_pool_init(threads);
+	const xlns16_mode *run[MAXMODES];
+	for (nm=0; *keys && nm < MAXMODES; keys++)
+		for (k=0; k<3; k++)
+			if (modes[k].key == *keys)
+				run[nm++] = &modes[k];
+	for (s.llama=0; s.llama<2; s.llama++)
+	{
+		weights w;
+		srand(1);
+		makeweights(s, w);
+		std::vector<float> in(s.tokens*s.d), fx(in), fk(s.tokens*s.d), fv(s.tokens*s.d);
+		std::vector<xlns16> xin(s.tokens*s.d);
+		for (i=0; i<s.tokens*s.d; i++)
+		{
+			xin[i] = fp2xlns16(2.0*rand()/RAND_MAX - 1);
+			in[i] = fx[i] = xlns162fp(xin[i]);
+		}
+		double tm[MAXMODES+1][NOPS], tot[MAXMODES+1], err[MAXMODES], derr[MAXMODES];
+		memset(tm, 0, sizeof(tm));
+		for (t=0; t<s.tokens; t++)
+			fblock(s, w, &fx[t*s.d], t, fk.data(), fv.data(), tm[0]);
+		for (mi=0; mi<nm; mi++)
+		{
+			std::vector<xlns16> x(xin), kc(s.tokens*s.d), vc(s.tokens*s.d), mask(s.tokens, xlns16_neg_inf);
+			for (t=0; t<s.tokens; t++)
+				xblock(s, *run[mi], w, &x[t*s.d], t, kc.data(), vc.data(), mask.data(), tm[mi+1]);
+			double e2 = 0, r2 = 0, rd2 = 0;
+			for (i=0; i<s.tokens*s.d; i++)
+			{
+				double y = xlns162fp(x[i]), e = y - fx[i];
+				e2 += e*e;
+				r2 += (double)fx[i]*fx[i];
+				rd2 += (double)(fx[i] - in[i])*(fx[i] - in[i]);
+				chk += x[i];
+			}
+			err[mi] = sqrt(e2/r2);
+			derr[mi] = sqrt(e2/rd2);
+		}
+		for (mi=0; mi<=nm; mi++)
+			for (tot[mi]=0, op=0; op<NOPS; op++)
+				tot[mi] += tm[mi][op];
+		printf("%s block (%s): dmodel %zu, %zu heads of %zu, ffn %zu, %zu tokens, %d threads\n",
+		       s.llama ? "llama" : "gpt", s.llama ? "RMS norm, SiLU-gated MLP" : "layernorm, GELU MLP",
+		       s.d, s.heads, s.hd, s.ffn, s.tokens, xlns_pool_threads());
+		printf("%-12s %18s", "ms (%)", "float");
+		for (mi=0; mi<nm; mi++)
+			printf(" %18s", run[mi]->name);
+		printf("\n");
+		for (op=0; op<NOPS; op++)
+		{
+			printf("%-12s", opname[op]);
+			for (mi=0; mi<=nm; mi++)
+				printf(" %10.2f (%4.1f%%)", 1e3*tm[mi][op], 100*tm[mi][op]/tot[mi]);
+			printf("\n");
+		}
+		printf("%-12s", "total");
+		for (mi=0; mi<=nm; mi++)
+			printf(" %10.2f        ", 1e3*tot[mi]);
+		printf("\n%-12s", "tokens/s");
+		for (mi=0; mi<=nm; mi++)
+			printf(" %10.1f        ", s.tokens/tot[mi]);
+		printf("\nrelative rms error of the output, and of what the block adds to its input:\n%-12s %18s", "", "");
+		for (mi=0; mi<nm; mi++)
+			printf("  %7.1e/%7.1e  ", err[mi], derr[mi]);
+		printf("\n\n");
+	}
+	printf("(checksum %08x)\n", chk);
+	return 0;
+}
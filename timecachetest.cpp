@@ -0,0 +1,82 @@
+//timing of float -> LNS conversion with and without the xlns16/xlns32 conversion cache
+//(float2xlns16_/float2xlns32_, used by xlns16_float/xlns32_float) on working sets of
+//different sizes: the cache pays off only when values repeat and fp2xlns is not a table
+//   g++ -O2 timecachetest.cpp -o timecachetest
+//   g++ -O2 -Dxlns16_table timecachetest.cpp -o timecachetest   (xlns16 conversion by table)
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns16_alt
+#include "xlns16.cpp"
+#include "xlns32.cpp"
+
+#include <time.h>
+
+#define N 1000000
+#define REPS 10
+
+float in[N];
+
+double nsper(clock_t t1, clock_t t2)
+{
+	return 1e9*((double)(t2-t1))/CLOCKS_PER_SEC/((double)N*REPS);
+}
+
+int main()
+{
+	clock_t t1,t2;
+	int i,cnt,w;
+	unsigned s = 0;
+	int sets[] = { 64, 1024, 16384, N };
+
+	#ifdef xlns16_table
+	printf("xlns16_table build\n");
+	#endif
+	printf("distinct   format  fp2xlns ns   cached ns   hit%%\n");
+	for (w = 0; w < 4; w++)
+	{
+		srand(1);
+		for (i=0; i<sets[w]; i++)
+			in[i] = 8.0*((float) rand())/RAND_MAX - 4.0;
+		for (; i<N; i++)
+			in[i] = in[rand() % sets[w]];
+
+		t1 = clock();
+		for (cnt=0; cnt<REPS; cnt++)
+			for (i=0; i<N; i++)
+				s += fp2xlns16(in[i]);
+		t2 = clock();
+		double plain16 = nsper(t1,t2);
+		xlns16_cacheon = 1;
+		xlns16_cache_flush();
+		xlns16_cache_reset_stats();
+		t1 = clock();
+		for (cnt=0; cnt<REPS; cnt++)
+			for (i=0; i<N; i++)
+				s += xlns16_internal(float2xlns16_(in[i]));
+		t2 = clock();
+		xlns16_cachestats st16 = xlns16_cache_stats();
+		printf("%8d   xlns16   %8.2f    %8.2f    %6.2f\n", sets[w], plain16, nsper(t1,t2),
+		       100.0*st16.hits/(st16.hits+st16.misses));
+
+		t1 = clock();
+		for (cnt=0; cnt<REPS; cnt++)
+			for (i=0; i<N; i++)
+				s += fp2xlns32(in[i]);
+		t2 = clock();
+		double plain32 = nsper(t1,t2);
+		xlns32_cache_flush();
+		xlns32_cache_reset_stats();
+		t1 = clock();
+		for (cnt=0; cnt<REPS; cnt++)
+			for (i=0; i<N; i++)
+				s += xlns32_internal(float2xlns32_(in[i]));
+		t2 = clock();
+		xlns32_cachestats st32 = xlns32_cache_stats();
+		printf("%8d   xlns32   %8.2f    %8.2f    %6.2f\n", sets[w], plain32, nsper(t1,t2),
+		       100.0*st32.hits/(st32.hits+st32.misses));
+	}
+	printf("(checksum %08x)\n", s);
+	return 0;
+}
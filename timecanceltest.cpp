@@ -0,0 +1,100 @@
+//timing of the near-singularity (cancellation) path: libm xlns32_db_ideal vs the
+//table-based xlns32_db_sing, and end-to-end cancellation-heavy adds in xlns16 and xlns32lpvip
+//   g++ -O2 -mavx2 timecanceltest.cpp -o timecanceltest
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns16_alt
+#define xlns16_table
+#include "xlns16.cpp"
+
+#define xlns32_aicasb
+#include "xlns32lpvip.cpp"
+
+#include <time.h>
+
+#define N 4096
+#define REPS 2000
+
+xlns32_signed d[N];
+xlns32 a32[N], b32[N], c32[N];
+xlns16 a16[N], b16[N], c16[N];
+
+double nsper(clock_t t1, clock_t t2)
+{
+	return 1e9*((double)(t2-t1))/CLOCKS_PER_SEC/((double)N*REPS);
+}
+
+int main()
+{
+	clock_t t1,t2;
+	int i,cnt;
+	xlns32 s = 0;
+	xlns16 s16 = 0;
+
+	#if defined(__AVX512F__)
+	printf("AVX-512 build\n");
+	#elif defined(__AVX2__)
+	printf("AVX2 build\n");
+	#else
+	printf("portable build\n");
+	#endif
+	for (i=0; i<N; i++)
+	{
+		d[i] = 1 + rand() % ((1<<xlns32_F)-1);
+		a32[i] = xlns32_logsignmask + (rand() % (64<<xlns32_F));
+		b32[i] = (a32[i]^xlns32_signmask) - d[i];               //|b| just below |a|
+		a16[i] = xlns16_logsignmask + (rand() % (8<<xlns16_F));
+		b16[i] = (a16[i]^xlns16_signmask) - 1 - rand() % ((1<<xlns16_F)-1);
+	}
+	printf("                          ns/elem\n");
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		for (i=0; i<N; i++)
+			s += xlns32_db_ideal(d[i]);
+	t2 = clock();
+	printf("xlns32_db_ideal           %6.2f\n", nsper(t1,t2));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		for (i=0; i<N; i++)
+			s += xlns32_db_sing(d[i]);
+	t2 = clock();
+	printf("xlns32_db_sing            %6.2f\n", nsper(t1,t2));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		for (i=0; i<N; i++)
+			s += xlns32_add_lpvip(a32[i], b32[i]);
+	t2 = clock();
+	printf("xlns32_add_lpvip          %6.2f\n", nsper(t1,t2));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+	{
+		xlns32_batch_add_lpvip(a32, b32, c32, N);
+		s += c32[cnt&(N-1)];
+	}
+	t2 = clock();
+	printf("xlns32_batch_add_lpvip    %6.2f\n", nsper(t1,t2));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+		for (i=0; i<N; i++)
+			s16 += xlns16_add(a16[i], b16[i]);
+	t2 = clock();
+	printf("xlns16_add                %6.2f\n", nsper(t1,t2));
+
+	t1 = clock();
+	for (cnt=0; cnt<REPS; cnt++)
+	{
+		xlns16_batch_add(a16, b16, c16, N);
+		s16 += c16[cnt&(N-1)];
+	}
+	t2 = clock();
+	printf("xlns16_batch_add          %6.2f\n", nsper(t1,t2));
+	printf("(checksum %08x %04x)\n", s, s16);
+	return 0;
+}
@@ -0,0 +1,148 @@
+//timing of the xlns16 matrix-vector products (batch-1 decode) against the memory
+//bandwidth limit: the weight bytes read per second by a plain streaming read of W
+//is the ceiling, and each GEMV is reported as GB/s of weights and % of that
+//(xlns16_gemv_f32 includes converting its float x and y; the block-coded
+//xlns16_gemv_b8/_b6 and packed xlns8/xlns12 rows count their own, smaller,
+//weight bytes)
+//   g++ -std=c++11 -O2 -march=native -pthread timegemvtest.cpp -o timegemvtest
+//   ./timegemvtest [rows cols [maxthreads]]      (default 4096 x 11008, all cores)
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns_parallel
+#define xlns16_alt
+#include "xlns16.cpp"
+#include "xlns32lpvip.cpp"
+#include "xlns16monte_bylpvip.cpp"
+
+#include <chrono>
+
+#define REPS 3
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+	size_t rows = (argc > 2) ? atol(argv[1]) : 4096;
+	size_t cols = (argc > 2) ? atol(argv[2]) : 11008;
+	int maxthreads = (argc > 3) ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+	const char *names[] = { "vec_dot per row", "xlns16_gemv", "xlns16_gemv_t", "xlns16_gemv_lpvip32",
+	                        "xlns16_gemv_t_lpvip32", "xlns16_gemv_monte", "xlns16_gemv_t_monte",
+	                        "xlns16_gemv_f32", "xlns16_gemv_b8", "xlns16_gemv_b6",
+	                        "xlns16_gemv_xlns8", "xlns16_gemv_xlns12" };
+	const int nk = 12;
+	size_t i;
+	int t, k, cnt;
+	unsigned s = 0;
+
+	if (maxthreads < 1)
+		maxthreads = 1;
+	xlns16 *W = new xlns16[rows*cols];
+	xlns16 *x = new xlns16[rows > cols ? rows : cols];
+	xlns16 *y = new xlns16[rows > cols ? rows : cols];
+	float *xf = new float[cols];
+	float *yf = new float[rows];
+	srand(1);
+	for (i=0; i<rows*cols; i++)
+		W[i] = fp2xlns16(8.0*((float) rand())/RAND_MAX - 4.0);
+	for (i=0; i<(rows > cols ? rows : cols); i++)
+		x[i] = fp2xlns16(8.0*((float) rand())/RAND_MAX - 4.0);
+	for (i=0; i<cols; i++)
+		xf[i] = xlns162fp(x[i]);
+	size_t nb = (cols + xlns16_qk - 1)/xlns16_qk;
+	xlns16_b8 *W8 = new xlns16_b8[rows*nb];
+	xlns16_b6 *W6 = new xlns16_b6[rows*nb];
+	size_t ld = cols + (cols & 1);
+	xlns8 *P8 = new xlns8[rows*cols];
+	xlns12x2 *P12 = new xlns12x2[rows*ld/2];
+	xlns16_batch_to_xlns8(W, P8, rows*cols);
+	for (i=0; i<rows; i++)
+	{
+		xlns16_quantize_b8(W + i*cols, W8 + i*nb, cols);
+		xlns16_quantize_b6(W + i*cols, W6 + i*nb, cols);
+		xlns16_batch_to_xlns12(W + i*cols, P12 + i*ld/2, cols);
+	}
+	double bytes = 2.0*rows*cols;
+	#if defined(__AVX512F__)
+	printf("AVX-512 build, ");
+	#elif defined(__AVX2__)
+	printf("AVX2 build, ");
+	#else
+	printf("portable build, ");
+	#endif
+	printf("W %zu x %zu (%.1f Mbyte)\n", rows, cols, bytes/1e6);
+
+	printf("%-24s", "threads");
+	for (t = 1; t <= maxthreads; t++)
+		printf("     %3d: ms  GB/s   %%bw", t);
+	printf("\n");
+	double bw[64];
+	printf("%-24s", "read W (limit)");
+	for (t = 1; t <= maxthreads && t < 64; t++)
+	{
+		xlns_pool_init(t);
+		std::atomic<unsigned long long> tot(0);
+		double t1 = now();
+		for (cnt=0; cnt<REPS; cnt++)
+			xlns_parallel_for(rows*cols/4, [&](size_t i0, size_t i1) {
+				const unsigned long long *w = (const unsigned long long *)W;
+				unsigned long long acc = 0;
+				for (size_t j = i0; j < i1; j++)
+					acc += w[j];
+				tot += acc;
+			}, 1<<16);
+		double sec = (now() - t1)/REPS;
+		bw[t] = bytes/sec/1e9;
+		s += (unsigned)tot;
+		printf("     %7.2f %6.2f %5.1f", 1e3*sec, bw[t], 100.0);
+	}
+	printf("\n");
+	for (k = 0; k < nk; k++)
+	{
+		printf("%-24s", names[k]);
+		for (t = 1; t <= maxthreads && t < 64; t++)
+		{
+			xlns_pool_init(t);
+			double t1 = now();
+			for (cnt=0; cnt<REPS; cnt++)
+				switch (k)
+				{
+				case 0: for (i=0; i<rows; i++) y[i] = xlns16_vec_dot(W + i*cols, x, cols); break;
+				case 1: xlns16_gemv(W, x, y, rows, cols); break;
+				case 2: xlns16_gemv_t(W, x, y, rows, cols); break;
+				case 3: xlns16_gemv_lpvip32(W, x, y, rows, cols); break;
+				case 4: xlns16_gemv_t_lpvip32(W, x, y, rows, cols); break;
+				case 5: xlns16_gemv_monte(W, x, y, rows, cols); break;
+				case 6: xlns16_gemv_t_monte(W, x, y, rows, cols); break;
+				case 7: xlns16_gemv_f32(W, xf, yf, rows, cols); y[0] = fp2xlns16(yf[0]); break;
+				case 8: xlns16_gemv_b8(W8, x, y, rows, cols); break;
+				case 9: xlns16_gemv_b6(W6, x, y, rows, cols); break;
+				case 10: xlns16_gemv_xlns8(P8, x, y, rows, cols); break;
+				case 11: xlns16_gemv_xlns12(P12, x, y, rows, cols); break;
+				}
+			double sec = (now() - t1)/REPS;
+			double kb = (k == 8) ? (double)sizeof(xlns16_b8)*rows*nb :
+			            (k == 9) ? (double)sizeof(xlns16_b6)*rows*nb :
+			            (k == 10) ? (double)rows*cols :
+			            (k == 11) ? (double)sizeof(xlns12x2)*rows*ld/2 : bytes;
+			s += y[0];
+			printf("     %7.2f %6.2f %5.1f", 1e3*sec, kb/sec/1e9, 100.0*kb/sec/1e9/bw[t]);
+		}
+		printf("\n");
+	}
+	printf("(checksum %08x)\n", s);
+	delete [] W;
+	delete [] x;
+	delete [] y;
+	delete [] xf;
+	delete [] W8;
+	delete [] W6;
+	delete [] P8;
+	delete [] P12;
+	delete [] yf;
+	return 0;
+}
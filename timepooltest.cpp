@@ -0,0 +1,83 @@
+//scaling of the parallel batch kernels (xlnspool.cpp) from 1 to N threads
+//wall-clock ns per element and speedup over 1 thread for some elementwise kernels,
+//softmax (parallel passes, serial sum) and xlns16_sum with xlns_parallel_reductions
+//   g++ -std=c++11 -O2 -pthread timepooltest.cpp -o timepooltest
+//   ./timepooltest [maxthreads [pin]]      (default: all cores, not pinned)
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns_parallel
+#define xlns16_alt
+#include "xlns16.cpp"
+#include "xlns32.cpp"
+
+#include <chrono>
+
+#define N 4000000
+#define REPS 5
+
+xlns16 a[N], b[N], c[N];
+xlns32 a32[N], b32[N], c32[N];
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+	int maxthreads = (argc > 1) ? atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+	int pin = (argc > 2) ? atoi(argv[2]) : 0;
+	const char *names[] = { "xlns16_batch_add", "xlns16_batch_gelu", "xlns32_batch_add",
+	                        "xlns32_batch_sigmoid", "xlns16_softmax", "xlns16_sum (split)" };
+	const int nk = 6;
+	double base[nk];
+	unsigned s = 0;
+	int i, t, k, cnt;
+
+	if (maxthreads < 1)
+		maxthreads = 1;
+	srand(1);
+	for (i=0; i<N; i++)
+	{
+		float x = 8.0*((float) rand())/RAND_MAX - 4.0, y = 8.0*((float) rand())/RAND_MAX - 4.0;
+		a[i] = fp2xlns16(x); b[i] = fp2xlns16(y);
+		a32[i] = fp2xlns32(x); b32[i] = fp2xlns32(y);
+	}
+	printf("n=%d, xlns_parallel_min=%zu, grain=%zu, %s\n", N, xlns_parallel_min, xlns_parallel_grain,
+	       pin ? "pinned" : "not pinned");
+	printf("%-22s", "kernel / threads");
+	for (t = 1; t <= maxthreads; t++)
+		printf("   %3d ns/el (x)", t);
+	printf("\n");
+	for (k = 0; k < nk; k++)
+	{
+		printf("%-22s", names[k]);
+		for (t = 1; t <= maxthreads; t++)
+		{
+			xlns_pool_init(t, pin);
+			xlns_parallel_reductions = (k == 5);
+			double t1 = now();
+			for (cnt=0; cnt<REPS; cnt++)
+				switch (k)
+				{
+				case 0: xlns16_batch_add(a, b, c, N); break;
+				case 1: xlns16_batch_gelu(a, c, N); break;
+				case 2: xlns32_batch_add(a32, b32, c32, N); break;
+				case 3: xlns32_batch_sigmoid(a32, c32, N); break;
+				case 4: xlns16_softmax(a, c, N); break;
+				case 5: s += xlns16_sum(a, N); break;
+				}
+			double ns = 1e9*(now() - t1)/((double)N*REPS);
+			if (t == 1)
+				base[k] = ns;
+			printf("   %7.2f (%4.2f)", ns, base[k]/ns);
+			s += c[cnt] + c32[cnt];
+		}
+		printf("\n");
+	}
+	xlns_parallel_reductions = 0;
+	printf("(checksum %08x)\n", s);
+	return 0;
+}
@@ -0,0 +1,94 @@
+//throughput of the fp16 and blockwise int8/int4 conversions into xlns16 and xlns32,
+//as GB/s of input read, next to memcpy of the output size (the streaming limit)
+//   g++ -std=c++11 -O2 -march=native -pthread timequanttest.cpp -o timequanttest
+//   ./timequanttest [n [threads]]      (default 32M elements, all cores, blocks of 32)
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+
+#define xlns_parallel
+#define xlns16_alt
+#include "xlns16.cpp"
+#include "xlns32.cpp"
+
+#include <chrono>
+
+#define REPS 3
+#define BLOCK 32
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = (argc > 1) ? atol(argv[1]) : (size_t)32 << 20;
+	int threads = (argc > 2) ? atoi(argv[2]) : 0;
+	const char *names[] = { "memcpy xlns16 size", "memcpy xlns32 size", "xlns16_batch_from_fp16",
+	                        "xlns32_batch_from_fp16", "xlns16_batch_from_q8", "xlns32_batch_from_q8",
+	                        "xlns16_batch_from_q4", "xlns32_batch_from_q4" };
+	const double inbytes[] = { 2, 4, 2, 2, 1 + 2.0/BLOCK, 1 + 2.0/BLOCK, 0.5 + 2.0/BLOCK, 0.5 + 2.0/BLOCK };
+	const int nk = 8;
+	size_t i;
+	int k, cnt;
+	unsigned s = 0;
+
+	xlns_pool_init(threads);
+	xlns_fp16 *h = new xlns_fp16[n];
+	signed char *q8 = new signed char[n];
+	unsigned char *q4 = new unsigned char[n/2];
+	xlns_fp16 *sc = new xlns_fp16[n/BLOCK + 1];
+	xlns16 *o16 = new xlns16[n];
+	xlns32 *o32 = new xlns32[n];
+	xlns32 *src = new xlns32[n];
+	srand(1);
+	for (i=0; i<n; i++)
+	{
+		h[i] = (xlns_fp16)(((rand() & 0xfff) + 0x3000) ^ ((rand() & 1) << 15));
+		q8[i] = (signed char)rand();
+		if (i < n/2) q4[i] = (unsigned char)rand();
+		if (i <= n/BLOCK) sc[i] = (xlns_fp16)((rand() & 0x7ff) + 0x1c00);
+		o16[i] = 0; o32[i] = 0; src[i] = i;
+	}
+	#if defined(__AVX512F__)
+	printf("AVX-512 build, ");
+	#elif defined(__AVX2__)
+	printf("AVX2 build, ");
+	#else
+	printf("portable build, ");
+	#endif
+	printf("n=%zu, blocks of %d, %d threads\n", n, BLOCK, xlns_pool_threads());
+	printf("%-24s %9s %10s %10s\n", "", "ms", "GB/s in", "GB/s out");
+	for (k = 0; k < nk; k++)
+	{
+		double t1 = now();
+		for (cnt=0; cnt<REPS; cnt++)
+			switch (k)
+			{
+			case 0: xlns_parallel_for(n, [&](size_t i0, size_t i1) {
+						memcpy(o16+i0, src+i0/2, 2*(i1-i0)); }, 1<<16); break;
+			case 1: xlns_parallel_for(n, [&](size_t i0, size_t i1) {
+						memcpy(o32+i0, src+i0, 4*(i1-i0)); }, 1<<16); break;
+			case 2: xlns16_batch_from_fp16(h, o16, n); break;
+			case 3: xlns32_batch_from_fp16(h, o32, n); break;
+			case 4: xlns16_batch_from_q8(q8, sc, BLOCK, o16, n); break;
+			case 5: xlns32_batch_from_q8(q8, sc, BLOCK, o32, n); break;
+			case 6: xlns16_batch_from_q4(q4, sc, BLOCK, o16, n); break;
+			case 7: xlns32_batch_from_q4(q4, sc, BLOCK, o32, n); break;
+			}
+		double sec = (now() - t1)/REPS;
+		s += o16[n/2] + o32[n/3];
+		double outbytes = (k & 1) ? 4.0 : 2.0;
+		printf("%-24s %9.2f %10.2f %10.2f\n", names[k], 1e3*sec, inbytes[k]*n/sec/1e9, outbytes*n/sec/1e9);
+	}
+	printf("(checksum %08x)\n", s);
+	delete [] h;
+	delete [] q8;
+	delete [] q4;
+	delete [] sc;
+	delete [] o16;
+	delete [] o32;
+	delete [] src;
+	return 0;
+}
@@ -0,0 +1,97 @@
+//timing of the xlns32 sb and db engines: the linear interpolation of
+//xlns32_sb_macro (about 66 Kbytes of tables) and the cotransformation of
+//xlns32_dbtrans3 against the quadratic interpolation of xlns32_sb_quad and
+//xlns32_db_quad (about 15 Kbytes, defined xlns32_quad and xlns32_dbquad), as
+//latency (each z depends on the previous result) and as throughput (independent
+//random z), with z spread over all the octaves where sb and db differ from z.
+//xlns32_dbtrans3 calls xlns32_sb_quad here; xlns32_add and xlns32_sub run on the
+//quadratic engines
+//   g++ -std=c++11 -O2 -march=native timesbtest.cpp -o timesbtest
+//   ./timesbtest [n]      (default 1M calls)
+#include <stdio.h>
+#include <stdlib.h>
+
+#define xlns32_quad
+#define xlns32_dbquad
+#define xlns32_alt
+#include "xlns32.cpp"
+
+#include <chrono>
+
+#define REPS 3
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//next z of the latency chain: a cheap hash of the result, back into [0, esszer)
+#define xlns32_nextz(r, z) ((((r) + (z))*2654435761u >> 4) % xlns32_esszer)
+
+int main(int argc, char **argv)
+{
+	size_t n = (argc > 1) ? atol(argv[1]) : 1 << 20;
+	const char *names[] = { "(chain only)", "xlns32_sb_macro", "xlns32_sb_quad", "xlns32_dbtrans3",
+	                        "xlns32_db_quad", "xlns32_add", "xlns32_sub" };
+	const int nk = 7;
+	size_t i;
+	int k, cnt;
+	xlns32 s = 0;
+
+	xlns32 *z = new xlns32[n];
+	xlns32 *x = new xlns32[n];
+	xlns32 *r = new xlns32[n];
+	srand(1);
+	for (i=0; i<n; i++)
+	{
+		z[i] = ((((xlns32)rand()) << 16) ^ rand()) % xlns32_esszer + 1;
+		x[i] = fp2xlns32(4.0*((float) rand())/RAND_MAX + 0.5);          //positive: add is all sb, sub all db
+	}
+	printf("n=%zu, tables: macro %d bytes, dbtrans3 %d bytes, quad sb %d bytes, quad db %d bytes\n", n,
+	       (int)(sizeof(xlns32_sbltable) + sizeof(xlns32_sbhtable)),
+	       (int)(sizeof(xlns32_db0table) + sizeof(xlns32_db1table) + sizeof(xlns32_db2table)),
+	       (int)(sizeof(xlns32_sbqoctave) + sizeof(xlns32_sbqnode) + sizeof(xlns32_sbqc2)),
+	       (int)(sizeof(xlns32_dbqoctave) + sizeof(xlns32_dbqnode) + sizeof(xlns32_dbqc2) +
+	             sizeof(xlns32_log2qnode) + sizeof(xlns32_log2qc2)));
+	printf("%-22s %14s %14s\n", "", "latency ns", "throughput ns");
+	for (k = 0; k < nk; k++)
+	{
+		double lat = 1e30, thr = 1e30;
+		for (cnt=0; cnt<REPS; cnt++)
+		{
+			xlns32 c = 12345;
+			double t1 = now();
+			switch (k)
+			{
+			case 0: for (i=0; i<n; i++) c = xlns32_nextz(c, c); break;
+			case 1: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_sb_macro(c), c); break;
+			case 2: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_sb_quad(c), c); break;
+			case 3: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_dbtrans3(c + 1), c); break;
+			case 4: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_db_quad(c + 1), c); break;
+			case 5: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_add(x[i], c + 0x38000000), c); break;
+			case 6: for (i=0; i<n; i++) c = xlns32_nextz(xlns32_sub(x[i], c + 0x38000000), c); break;
+			}
+			double t2 = now();
+			switch (k)
+			{
+			case 0: for (i=0; i<n; i++) r[i] = z[i]; break;
+			case 1: for (i=0; i<n; i++) r[i] = xlns32_sb_macro(z[i]); break;
+			case 2: for (i=0; i<n; i++) r[i] = xlns32_sb_quad(z[i]); break;
+			case 3: for (i=0; i<n; i++) r[i] = xlns32_dbtrans3(z[i]); break;
+			case 4: for (i=0; i<n; i++) r[i] = xlns32_db_quad(z[i]); break;
+			case 5: for (i=0; i<n; i++) r[i] = xlns32_add(x[i], z[i] + 0x38000000); break;
+			case 6: for (i=0; i<n; i++) r[i] = xlns32_sub(x[i], z[i] + 0x38000000); break;
+			}
+			double t3 = now();
+			if (t2 - t1 < lat) lat = t2 - t1;
+			if (t3 - t2 < thr) thr = t3 - t2;
+			s += c + r[n/2];
+		}
+		printf("%-22s %14.2f %14.2f\n", names[k], 1e9*lat/n, 1e9*thr/n);
+	}
+	printf("(checksum %08x)\n", s);
+	delete [] z;
+	delete [] x;
+	delete [] r;
+	return 0;
+}
@@ -0,0 +1,294 @@
+//accuracy and speed of the ways to sum n values here, for n = 10^2 .. 10^8 and four
+//kinds of input: uniform in (-1, 1), uniform in (0, 1), heavy-tailed (Cauchy) and
+//near-zero-sum (uniform with the mean taken out).  the error is against the sum of the
+//float inputs in long double: relative to that sum, or for near-zero-sum relative to
+//the sum of |x|.  below 10^6 each cell averages 10^6/n different inputs, and the time
+//is the best of REPS runs up to 10^7 elements.  the _tree sums and the pairwise ones
+//split over the threads of xlnspool.cpp (the others add in sequence); the xlns32 and
+//xlns64 accumulations get the xlns16 values as xlns16<<16.  with a file name, the
+//tables between the timesumtest markers in that file (summation16bit.MD) are replaced
+//by the new ones.
+//   g++ -std=c++11 -O2 -march=native -pthread timesumtest.cpp -o timesumtest
+//   ./timesumtest [maxexp [threads [summation16bit.MD]]]     (default 8, all cores)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define xlns_parallel
+#ifdef xlns16case
+ #include "xlns16testcase.h"
+#else
+ #define xlns16_alt
+ #define xlns16_table
+#endif
+#include "xlns16.cpp"
+#define xlns32_alt
+#include "xlns32.cpp"
+#define xlns32_aicasb
+#include "xlns32lpvip.cpp"
+#include "xlns16monte.cpp"
+#include "xlns64.cpp"
+
+#include <chrono>
+#include <string>
+
+#define MINELEMS 1000000        //elements per cell at least (more inputs for small n)
+#define NDIST 4
+#define NSTRAT 15
+#define MAXEXP 8
+#define REPS 3                  //best time of REPS runs for cells up to 10^7 elements
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//pairwise: halves down to blocks of 8 added in sequence
+template <class T, class A> T pairwise(const T *a, size_t n, const A &add)
+{
+	if (n <= 8)
+	{
+		T s = a[0];
+		for (size_t i=1; i<n; i++)
+			s = add(s, a[i]);
+		return s;
+	}
+	return add(pairwise(a, n/2, add), pairwise(a + n/2, n - n/2, add));
+}
+
+//the same tree, with the 64 subtrees under the top 6 levels in parallel
+void pairsplit(size_t lo, size_t n, int depth, size_t *&off)
+{
+	if (depth == 0)
+		*off++ = lo;
+	else
+	{
+		pairsplit(lo, n/2, depth-1, off);
+		pairsplit(lo + n/2, n - n/2, depth-1, off);
+	}
+}
+
+template <class T, class A> T pairwise_par(const T *a, size_t n, const A &add)
+{
+	size_t off[65], *p = off;
+	T part[64];
+	if (n < (1 << 16))
+		return pairwise(a, n, add);
+	pairsplit(0, n, 6, p);
+	off[64] = n;
+	xlns_parallel_for(64, [&](size_t k0, size_t k1) {
+		for (size_t k=k0; k<k1; k++)
+			part[k] = pairwise(a + off[k], off[k+1] - off[k], add);
+	}, 1);
+	for (int w=1; w<64; w*=2)
+		for (int c=0; c+w<64; c+=2*w)
+			part[c] = add(part[c], part[c+w]);
+	return part[0];
+}
+
+float fpadd(float x, float y) { return x + y; }
+
+float bf16(float x)
+{
+	unsigned u;
+	memcpy(&u, &x, 4);
+	u &= 0xffff0000;
+	memcpy(&x, &u, 4);
+	return x;
+}
+
+const char *stratname[NSTRAT] = {
+	"fp32", "fp32 pairwise", "fp32 in fp64", "bf16 in fp32",
+	"xlns16_sum", "xlns16 pairwise", "xlns16_sum_tree",
+	"xlns16_sum_monte", "xlns16_sum_monte_tree",
+	"xlns16_sum_lpvip32", "xlns16_sum_lpvip32_simd", "xlns16_sum_lpvip32_tree",
+	"xlns32_sum", "xlns32_sum_tree", "xlns32_sum_xlns64" };
+
+const char *distname[NDIST] = {
+	"uniform in (-1, 1)", "uniform in (0, 1)", "heavy-tailed (Cauchy)", "near-zero-sum (relative to the sum of |x|)" };
+
+//one sum of a[0..n) (the float, xlns16 and xlns32 copies of the same values), as double
+double sum(int s, const float *f, const xlns16 *a, const xlns32 *a32, size_t n)
+{
+	size_t i;
+	switch (s)
+	{
+	case 0: { float t = 0; for (i=0; i<n; i++) t += f[i]; return t; }
+	case 1: return pairwise_par(f, n, fpadd);
+	case 2: { double t = 0; for (i=0; i<n; i++) t += f[i]; return t; }
+	case 3: { float t = 0; for (i=0; i<n; i++) t += bf16(f[i]); return t; }
+	case 4: return xlns162fp(xlns16_sum(a, n));
+	case 5: return xlns162fp(pairwise_par(a, n, xlns16_add_fn));
+	case 6: return xlns162fp(xlns16_sum_tree(a, n));
+	case 7: return xlns162fp(xlns16_sum_monte(a, n));
+	case 8: return xlns162fp(xlns16_sum_monte_tree(a, n));
+	case 9: return xlns162fp(xlns16_sum_lpvip32(a, n));
+	case 10: return xlns162fp(xlns16_sum_lpvip32_simd(a, n));
+	case 11: return xlns162fp(xlns16_sum_lpvip32_tree(a, n));
+	case 12: return xlns322fp(xlns32_sum(a32, n));
+	case 13: return xlns322fp(xlns32_sum_tree(a32, n));
+	case 14: return xlns322fp(xlns32_sum_xlns64(a32, n));
+	}
+	return 0;
+}
+
+float draw(int dist)
+{
+	double u = (rand() + 0.5)/((double)RAND_MAX + 1);
+	switch (dist)
+	{
+	case 1: return u;
+	case 2: return tan(M_PI*(u - 0.5));
+	default: return 2*u - 1;
+	}
+}
+
+double err[NDIST][NSTRAT][MAXEXP+1], ns[NDIST][NSTRAT][MAXEXP+1];
+
+//the tables as markdown
+std::string mdtables(int maxexp)
+{
+	std::string s;
+	char cell[64];
+	int d, k, e;
+	snprintf(cell, sizeof(cell), "%d", xlns_pool_threads());
+	s += "Generated by `timesumtest.cpp` on " + std::string(cell) + " thread(s): relative error / ns per element.\n";
+	for (d=0; d<NDIST; d++)
+	{
+		s += "\n" + std::string(distname[d]) + ":\n\n| |";
+		for (e=2; e<=maxexp; e++)
+		{
+			snprintf(cell, sizeof(cell), " n=10^%d |", e);
+			s += cell;
+		}
+		s += "\n|---|";
+		for (e=2; e<=maxexp; e++)
+			s += "---|";
+		s += "\n";
+		for (k=0; k<NSTRAT; k++)
+		{
+			s += "| `" + std::string(stratname[k]) + "` |";
+			for (e=2; e<=maxexp; e++)
+			{
+				snprintf(cell, sizeof(cell), " %.1e / %.2f |", err[d][k][e], ns[d][k][e]);
+				s += cell;
+			}
+			s += "\n";
+		}
+	}
+	return s;
+}
+
+//replace the text between the markers in the file (or append it with the markers)
+int writemd(const char *name, const std::string &tables)
+{
+	const std::string begin = "<!-- timesumtest begin -->\n", end = "<!-- timesumtest end -->\n";
+	std::string text;
+	char buf[4096];
+	size_t m, b, e;
+	FILE *f = fopen(name, "rb");
+	if (f)
+	{
+		while ((m = fread(buf, 1, sizeof(buf), f)) > 0)
+			text.append(buf, m);
+		fclose(f);
+	}
+	b = text.find(begin);
+	e = text.find(end);
+	if (b == std::string::npos || e == std::string::npos || e < b)
+		text += "\n" + begin + tables + end;
+	else
+		text = text.substr(0, b + begin.size()) + tables + text.substr(e);
+	f = fopen(name, "wb");
+	if (f == NULL)
+		return 0;
+	fwrite(text.data(), 1, text.size(), f);
+	fclose(f);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	int maxexp = (argc > 1) ? atoi(argv[1]) : MAXEXP;
+	int threads = (argc > 2) ? atoi(argv[2]) : 0;
+	int d, k, e;
+	size_t n, i, t, trials, cap;
+	double chk = 0;
+	maxexp = (maxexp < 2) ? 2 : (maxexp > MAXEXP) ? MAXEXP : maxexp;
+	xlns_pool_init(threads);
+	cap = (size_t)pow(10.0, maxexp);
+	cap = (cap < MINELEMS) ? MINELEMS : cap;
+	float *f = new float[cap];
+	xlns16 *a = new xlns16[cap];
+	xlns32 *a32 = new xlns32[cap];
+	std::vector<long double> ref;
+	std::vector<double> abssum;
+	srand(1);
+	for (d=0; d<NDIST; d++)
+	{
+		printf("%s: relative error / ns per element, %d threads\n%-24s", distname[d], xlns_pool_threads(), "");
+		for (e=2; e<=maxexp; e++)
+			printf("       n=10^%d  ", e);
+		printf("\n");
+		for (e=2; e<=maxexp; e++)
+		{
+			n = (size_t)pow(10.0, e);
+			trials = (n < MINELEMS) ? MINELEMS/n : 1;
+			ref.assign(trials, 0);
+			abssum.assign(trials, 0);
+			for (t=0; t<trials; t++)
+			{
+				float *x = f + t*n;
+				long double mean = 0;
+				for (i=0; i<n; i++)
+					mean += x[i] = draw(d);
+				mean /= n;
+				for (i=0; i<n; i++)
+				{
+					if (d == 3)
+						x[i] = x[i] - mean;
+					ref[t] += x[i];
+					abssum[t] += fabs(x[i]);
+				}
+			}
+			xlns16_batch_from_float(f, a, trials*n);
+			for (i=0; i<trials*n; i++)
+				a32[i] = ((xlns32)a[i]) << 16;
+			for (k=0; k<NSTRAT; k++)
+			{
+				int r, reps = (trials*n <= 10*MINELEMS) ? REPS : 1;
+				ns[d][k][e] = 1e30;
+				for (r=0; r<reps; r++)
+				{
+					double s, rel = 0, t1 = now();
+					for (t=0; t<trials; t++)
+					{
+						s = sum(k, f + t*n, a + t*n, a32 + t*n, n);
+						rel += fabs(s - ref[t])/((d == 3) ? abssum[t] : fabsl(ref[t]));
+						chk += s;
+					}
+					t1 = 1e9*(now() - t1)/(trials*n);
+					ns[d][k][e] = (t1 < ns[d][k][e]) ? t1 : ns[d][k][e];
+					if (r == 0)
+						err[d][k][e] = rel/trials;
+				}
+			}
+		}
+		for (k=0; k<NSTRAT; k++)
+		{
+			printf("%-24s", stratname[k]);
+			for (e=2; e<=maxexp; e++)
+				printf(" %7.1e/%6.2f", err[d][k][e], ns[d][k][e]);
+			printf("\n");
+		}
+		printf("\n");
+	}
+	printf("(checksum %g)\n", chk);
+	if (argc > 3 && !writemd(argv[3], mdtables(maxexp)))
+		printf("cannot write %s\n", argv[3]);
+	delete [] f;
+	delete [] a;
+	delete [] a32;
+	return 0;
+}
@@ -72,14 +72,205 @@
 // Square: x^2 (efficient in LNS: double the log)
 #define xlns16_square(x) xlns16_mul((x), (x))
 
+// optional event counters: define xlns16_counters before including this file (C++11)
+//   cancel  x + -x gave exact zero (z==0 with opposite signs)
+//   esszer  the smaller term was below xlns16_esszer and was dropped
+//   ovf     a result saturated to the largest magnitude (xlns16_overflow)
+//   unf     a result flushed to zero (xlns16_overflow)
+// each thread counts into its own thread_local block with plain relaxed
+// stores (no lock, no read-modify-write on the hot path); the lock is only
+// taken when a thread starts or exits and by snapshot/reset.
+// xlns16_counters_snapshot() sums all threads since the last xlns16_counters_reset().
+// without xlns16_counters the xlns16_count macros are empty and the snapshot is all 0
+
+struct xlns16_counts {
+    unsigned long long cancel, esszer, ovf, unf;
+};
+
+#ifdef xlns16_counters
+#include <atomic>
+#include <mutex>
+
+struct xlns16_counter_block {
+    std::atomic<unsigned long long> cancel, esszer, ovf, unf;
+    xlns16_counter_block *next;
+    xlns16_counter_block();
+    ~xlns16_counter_block();
+};
+
+std::mutex xlns16_counter_lock;
+xlns16_counter_block *xlns16_counter_list = NULL;
+xlns16_counts xlns16_counter_retired = {0, 0, 0, 0};   // from threads that have exited
+xlns16_counts xlns16_counter_base = {0, 0, 0, 0};      // totals at the last reset
+thread_local xlns16_counter_block xlns16_counter_mine;
+
+xlns16_counter_block::xlns16_counter_block() : cancel(0), esszer(0), ovf(0), unf(0)
+{
+    std::lock_guard<std::mutex> g(xlns16_counter_lock);
+    next = xlns16_counter_list;
+    xlns16_counter_list = this;
+}
+
+xlns16_counter_block::~xlns16_counter_block()
+{
+    std::lock_guard<std::mutex> g(xlns16_counter_lock);
+    xlns16_counter_retired.cancel += cancel.load(std::memory_order_relaxed);
+    xlns16_counter_retired.esszer += esszer.load(std::memory_order_relaxed);
+    xlns16_counter_retired.ovf += ovf.load(std::memory_order_relaxed);
+    xlns16_counter_retired.unf += unf.load(std::memory_order_relaxed);
+    xlns16_counter_block **p = &xlns16_counter_list;
+    while (*p != this)
+        p = &(*p)->next;
+    *p = next;
+}
+
+// only the owning thread writes its block, so load+store is enough
+inline void xlns16_counter_bump(std::atomic<unsigned long long> &c, unsigned long long k)
+{
+    c.store(c.load(std::memory_order_relaxed) + k, std::memory_order_relaxed);
+}
+
+#define xlns16_count(ev)          xlns16_counter_bump(xlns16_counter_mine.ev, 1)
+#define xlns16_count_n(ev,k)      xlns16_counter_bump(xlns16_counter_mine.ev, (k))
+#define xlns16_count_if(cond,ev)  do { if (cond) xlns16_count(ev); } while (0)
+
+inline xlns16_counts xlns16_counters_total()   //caller holds xlns16_counter_lock
+{
+    xlns16_counts t = xlns16_counter_retired;
+    for (xlns16_counter_block *b = xlns16_counter_list; b != NULL; b = b->next)
+    {
+        t.cancel += b->cancel.load(std::memory_order_relaxed);
+        t.esszer += b->esszer.load(std::memory_order_relaxed);
+        t.ovf += b->ovf.load(std::memory_order_relaxed);
+        t.unf += b->unf.load(std::memory_order_relaxed);
+    }
+    return t;
+}
+
+inline xlns16_counts xlns16_counters_snapshot()
+{
+    std::lock_guard<std::mutex> g(xlns16_counter_lock);
+    xlns16_counts t = xlns16_counters_total();
+    t.cancel -= xlns16_counter_base.cancel;
+    t.esszer -= xlns16_counter_base.esszer;
+    t.ovf -= xlns16_counter_base.ovf;
+    t.unf -= xlns16_counter_base.unf;
+    return t;
+}
+
+inline void xlns16_counters_reset()
+{
+    std::lock_guard<std::mutex> g(xlns16_counter_lock);
+    xlns16_counter_base = xlns16_counters_total();
+}
+#else
+#define xlns16_count(ev)
+#define xlns16_count_n(ev,k)
+#define xlns16_count_if(cond,ev)
+inline xlns16_counts xlns16_counters_snapshot() { xlns16_counts t = {0, 0, 0, 0}; return t; }
+inline void xlns16_counters_reset() {}
+#endif
+
+// optional z profile: define xlns16_zprofile before including this file (C++11)
+//   every addition records -z (the log distance between the operands) in a
+//   histogram per kernel, separately for sb (same signs) and db (opposite signs).
+//   bin = -z >> xlns16_zprof_shift (one bin per sb/db table entry); the last bin holds all
+//   -z beyond xlns16_esszer.  kernels name themselves with xlns16_zprof_kernel;
+//   the outermost named kernel on a thread gets the adds ("other" if none).
+//   xlns16_zprof_dump(f) writes the nonzero bins as text lines
+//      xlns16 <kernel> sb|db <bin> <count>
+//   for zprofreport.cpp, which estimates table footprints and hit rates.
+
+#define xlns16_zprof_shift    0
+#define xlns16_zprof_nbins    ((xlns16_esszer>>xlns16_zprof_shift)+1)
+
+#ifdef xlns16_zprofile
+#include <atomic>
+#include <mutex>
+#include <string.h>
+
+#define xlns16_zprof_maxkern  16
+
+struct xlns16_zprof_hist {
+    const char *name;
+    std::atomic<unsigned long long> sb[xlns16_zprof_nbins], db[xlns16_zprof_nbins];
+};
+
+xlns16_zprof_hist xlns16_zprof_tab[xlns16_zprof_maxkern];   // static, so all counts start at 0
+int xlns16_zprof_nkern = 1;                            // slot 0 is "other"
+std::mutex xlns16_zprof_lock;
+thread_local int xlns16_zprof_cur = 0;
+
+inline int xlns16_zprof_register(const char *name)
+{
+    std::lock_guard<std::mutex> g(xlns16_zprof_lock);
+    for (int k = 1; k < xlns16_zprof_nkern; k++)
+        if (strcmp(xlns16_zprof_tab[k].name, name) == 0)
+            return k;
+    if (xlns16_zprof_nkern == xlns16_zprof_maxkern)
+        return 0;
+    xlns16_zprof_tab[xlns16_zprof_nkern].name = name;
+    return xlns16_zprof_nkern++;
+}
+
+struct xlns16_zprof_scope {
+    int saved;
+    xlns16_zprof_scope(int k) : saved(xlns16_zprof_cur) { if (saved == 0) xlns16_zprof_cur = k; }
+    ~xlns16_zprof_scope() { xlns16_zprof_cur = saved; }
+};
+
+inline void xlns16_zprof_record(xlns16_signed negz, int usedb)   //negz >= 0
+{
+    int b = (negz >= xlns16_esszer) ? xlns16_zprof_nbins-1 : (negz >> xlns16_zprof_shift);
+    (usedb ? xlns16_zprof_tab[xlns16_zprof_cur].db[b] : xlns16_zprof_tab[xlns16_zprof_cur].sb[b])
+        .fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void xlns16_zprof_dump(FILE *f)
+{
+    std::lock_guard<std::mutex> g(xlns16_zprof_lock);
+    fprintf(f, "#zprofile xlns16 shift %d nbins %d esszer %d\n", xlns16_zprof_shift, xlns16_zprof_nbins, (int)xlns16_esszer);
+    for (int k = 0; k < xlns16_zprof_nkern; k++)
+        for (int b = 0; b < xlns16_zprof_nbins; b++)
+        {
+            unsigned long long s = xlns16_zprof_tab[k].sb[b].load(std::memory_order_relaxed);
+            unsigned long long d = xlns16_zprof_tab[k].db[b].load(std::memory_order_relaxed);
+            if (s) fprintf(f, "xlns16 %s sb %d %llu\n", k ? xlns16_zprof_tab[k].name : "other", b, s);
+            if (d) fprintf(f, "xlns16 %s db %d %llu\n", k ? xlns16_zprof_tab[k].name : "other", b, d);
+        }
+}
+
+inline void xlns16_zprof_reset()
+{
+    std::lock_guard<std::mutex> g(xlns16_zprof_lock);
+    for (int k = 0; k < xlns16_zprof_nkern; k++)
+        for (int b = 0; b < xlns16_zprof_nbins; b++)
+        {
+            xlns16_zprof_tab[k].sb[b].store(0, std::memory_order_relaxed);
+            xlns16_zprof_tab[k].db[b].store(0, std::memory_order_relaxed);
+        }
+}
+
+#define xlns16_zprof(negz,usedb)    xlns16_zprof_record((negz), (usedb) != 0)
+#define xlns16_zprof_kernel(name)   static int xlns16_zprof_id = xlns16_zprof_register(name); \
+                                    xlns16_zprof_scope xlns16_zprof_here(xlns16_zprof_id)
+#else
+#define xlns16_zprof(negz,usedb)
+#define xlns16_zprof_kernel(name)
+inline void xlns16_zprof_dump(FILE *) {}
+inline void xlns16_zprof_reset() {}
+#endif
+
 inline xlns16 xlns16_overflow(xlns16 xlns16_x, xlns16 xlns16_y, xlns16 xlns16_temp)
 {       //printf("%d %d %d\n",xlns16_temp,xlns16_x,xlns16_y);
 	if (xlns16_logsignmask&xlns16_temp)
 	{
+		xlns16_count(unf);
 		return (xlns16_signmask&(xlns16_x^xlns16_y));
 	}
 	else
 	{
+		xlns16_count(ovf);
 		return (xlns16_signmask&(xlns16_x^xlns16_y))| xlns16_logmask;
 	}
 }
@@ -122,10 +313,14 @@ inline xlns16 xlns16_div(xlns16 x, xlns16 y)
   #define xlns16_F 7
 
   #include <math.h>
-  inline xlns16 xlns16_db_ideal(xlns16_signed z)  //only for singularity
+  inline xlns16 xlns16_db_ideal(xlns16_signed z)  //no longer used for singularity
   {
 	return ((xlns16_signed) ((log( pow(2.0, ((double) z) / xlns16_scale) - 1 )/log(2.0))*xlns16_scale+.5));
   }
+  // db near the singularity (0 <= z < 1<<F) by table (see xlns16gendbsing.cpp):
+  //   same values as xlns16_db_ideal(z), without pow and log on the hot path
+  #include "xlns16dbsingtbl.h"
+  #define xlns16_db_sing(z) ((xlns16)xlns16dbsingtbl[z])
   inline xlns16 xlns16_mitch(xlns16 z)
   {
      return (((1<<xlns16_F)+(z&((1<<xlns16_F)-1)))>>(-(z>>xlns16_F)));
@@ -147,7 +342,7 @@ inline xlns16 xlns16_div(xlns16 x, xlns16 y)
     precond = (z < -(2<<xlns16_F))?
                     5<<(xlns16_F-3):                //  0.625
                     (z >> 2) + (9 << (xlns16_F-3));//  .25*zr + 9/8
-    return (-z >= 1<<xlns16_F)?-xlns16_mitch(z+precond): xlns16_db_ideal(-z)+z; // use ideal for singularity
+    return (-z >= 1<<xlns16_F)?-xlns16_mitch(z+precond): xlns16_db_sing(-z)+z; // use table for singularity
   }
   inline xlns16 xlns16_sb_premit(xlns16_signed zi)   //assumes zi>=0
   {
@@ -175,15 +370,18 @@ inline xlns16 xlns16_add(xlns16 x, xlns16 y)
     maxxy  = (xl>yl) ? x  : y;
     z = minxyl - (maxxy&xlns16_logmask);
     usedb = xlns16_signmask&(x^y); 
+    xlns16_zprof(-z, usedb);
     #ifdef xlns16_ideal
      float pm1 = usedb ? -1.0 : 1.0;
      adjust = z+((xlns16_signed)(log(pm1+pow(2.0,-((double)z)/xlns16_scale))/log(2.0)*xlns16_scale+.5));
      adjustez = (z < -xlns16_esszer) ? 0 : adjust; 
+     xlns16_count_if(z < -xlns16_esszer, esszer);
     #else
      #ifdef xlns16_table
        xlns16_signed non_ez_z = (z <= -xlns16_esszer) ? xlns16_esszer-1 : -z; 
        adjustez = usedb ? xlns16dbtbl[non_ez_z] : 
                           xlns16sbtbl[non_ez_z]; 
+       xlns16_count_if(z <= -xlns16_esszer, esszer);
      #else
       #ifdef xlns16_altopt
        //xlns16_signed precond = (usedb==0) ? ((-z)>>3) :          // -.125*z 
@@ -200,15 +398,17 @@ inline xlns16 xlns16_add(xlns16 x, xlns16 y)
                             z >= -(3<<(xlns16_F-2)) ? -(1<<(xlns16_F-6)) : 
                                                       +(1<<(xlns16_F-6));
        xlns16_signed mitch = (-z >= 1<<xlns16_F)||(usedb==0) ? xlns16_mitch(z+precond) : 
-                                          -xlns16_db_ideal(-z)-z; // use ideal for singularity
+                                          -xlns16_db_sing(-z)-z; // use table for singularity
        adjust = usedb ? -mitch : (z==0) ? 1<<xlns16_F : mitch + postcond;
       #else
        adjust = usedb ? xlns16_db_premit_neg(z) : 
                         xlns16_sb_premit_neg(z); 
       #endif
       adjustez = (z < -xlns16_esszer) ? 0 : adjust; 
+      xlns16_count_if(z < -xlns16_esszer, esszer);
      #endif
     #endif
+    xlns16_count_if((z==0) && usedb, cancel);
     return ((z==0) && usedb) ? 
                      xlns16_zero :
                      xlns16_mul(maxxy, xlns16_logsignmask + adjustez);
@@ -231,17 +431,25 @@ xlns16 xlns16_add(xlns16 x, xlns16 y)
 		x = y;
 		y = t;
 	}
+	xlns16_zprof(z, xlns16_signmask&(x^y));
 	if (xlns16_signmask&(x^y))
 	{
 		if (z == 0)
+		{
+			xlns16_count(cancel);
 			return xlns16_zero;
+		}
 		if (z < xlns16_esszer)
 			return xlns16_neg(y + xlns16_db(z));
 		else
+		{
+			xlns16_count(esszer);
 			return xlns16_neg(y+z);
+		}
 	}
 	else
 	{
+		xlns16_count_if(z >= xlns16_esszer, esszer);
 		return y + xlns16_sb(z);
 	}
 }
@@ -368,10 +576,28 @@ inline xlns16 xlns16_fma(xlns16 a, xlns16 b, xlns16 c) {
     return xlns16_add(xlns16_mul(a, b), c);
 }
 
+// optional parallel batch kernels: define xlns_parallel before including this
+// file (C++11, link with -pthread); see xlnspool.cpp for the pool and its settings
+#ifdef xlns_parallel
+#include "xlnspool.cpp"
+#ifdef xlns16_zprofile
+// chunks of a parallel kernel count their adds under the kernel that split them
+inline int *xlns16_zprof_curvar() { return &xlns16_zprof_cur; }
+int xlns16_zprof_inherited = xlns_pool_inherits(xlns16_zprof_curvar);
+#endif
+#endif
+#ifndef xlns_parallel_split
+#define xlns_parallel_split(n, ...)
+#define xlns_parallel_sum(n, ...)
+#define xlns_parallel_loop(n, ...) { size_t i0 = 0, i1 = (n); __VA_ARGS__; }
+#define xlns_parallel_chunks(n, nchunks, ...) { size_t i0 = 0, i1 = (nchunks); __VA_ARGS__; }
+#endif
+
 // Batch conversion functions (for ggml tensor operations)
 
 // Batch convert float array to xlns16 array
 inline void xlns16_batch_from_float(const float *src, xlns16 *dst, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_from_float(src+i0, dst+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         dst[i] = fp2xlns16(src[i]);
     }
@@ -379,6 +605,7 @@ inline void xlns16_batch_from_float(const float *src, xlns16 *dst, size_t n) {
 
 // Batch convert xlns16 array to float array
 inline void xlns16_batch_to_float(const xlns16 *src, float *dst, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_to_float(src+i0, dst+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         dst[i] = xlns162fp(src[i]);
     }
@@ -387,29 +614,454 @@ inline void xlns16_batch_to_float(const xlns16 *src, float *dst, size_t n) {
 
 // Batch element-wise operations
 
+// SIMD element-wise operations (used when compiled with -mavx2 or better)
+// these give bit-identical results to the scalar macros/functions above
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+// 16 lanes of xlns16_mul, including the xlns16_overflow saturation
+inline __m256i xlns16_mul_avx2(__m256i x, __m256i y)
+{
+    const __m256i logmask = _mm256_set1_epi16(xlns16_logmask);
+    __m256i temp = _mm256_sub_epi16(_mm256_add_epi16(_mm256_and_si256(x, logmask),
+                                                     _mm256_and_si256(y, logmask)),
+                                    _mm256_set1_epi16(xlns16_logsignmask));
+    __m256i sign = _mm256_and_si256(_mm256_xor_si256(x, y), _mm256_set1_epi16((short)xlns16_signmask));
+    __m256i ovf = _mm256_srai_epi16(temp, 15);                         // signmask&temp
+    __m256i unf = _mm256_srai_epi16(_mm256_slli_epi16(temp, 1), 15);   // logsignmask&temp
+    __m256i sat = _mm256_or_si256(sign, _mm256_andnot_si256(unf, logmask));
+    #ifdef xlns16_counters
+    xlns16_count_n(ovf, __builtin_popcount(_mm256_movemask_epi8(_mm256_andnot_si256(unf, ovf)))/2);
+    xlns16_count_n(unf, __builtin_popcount(_mm256_movemask_epi8(_mm256_and_si256(unf, ovf)))/2);
+    #endif
+    return _mm256_blendv_epi8(_mm256_or_si256(sign, temp), sat, ovf);
+}
+
+// 16 lanes of xlns16_add, with the sb and db tables of xlns16_alt with
+// xlns16_table (for the other adders, and with the counters or the z
+// profile, which count in the scalar adder, there is none)
+#if defined(xlns16_alt) && defined(xlns16_table) && !defined(xlns16_ideal) && \
+    !defined(xlns16_counters) && !defined(xlns16_zprofile)
+#define xlns16_add_simd
+
+// sb in the low half and db in the high half of one int, for one gather
+inline const int *xlns16_sbdbtbl32() {
+    static int tbl[xlns16_esszer];
+    static int done = [] {
+        for (int i = 0; i < xlns16_esszer; i++)
+            tbl[i] = (unsigned short)xlns16sbtbl[i] | ((int)xlns16dbtbl[i] << 16);
+        return 1;
+    }();
+    (void)done;
+    return tbl;
+}
+
+inline __m256i xlns16_add_avx2(__m256i x, __m256i y)
+{
+    static const int *tbl = xlns16_sbdbtbl32();
+    const __m256i logmask = _mm256_set1_epi16(xlns16_logmask);
+    __m256i xl = _mm256_and_si256(x, logmask), yl = _mm256_and_si256(y, logmask);
+    __m256i maxxy = _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi16(xl, yl));
+    __m256i z = _mm256_sub_epi16(_mm256_min_epi16(xl, yl), _mm256_max_epi16(xl, yl));   // <= 0
+    __m256i usedb = _mm256_srai_epi16(_mm256_xor_si256(x, y), 15);
+    __m256i i = _mm256_min_epi16(_mm256_sub_epi16(_mm256_setzero_si256(), z),
+                                 _mm256_set1_epi16(xlns16_esszer-1));
+    __m256i t0 = _mm256_i32gather_epi32(tbl, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(i)), 4);
+    __m256i t1 = _mm256_i32gather_epi32(tbl, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(i, 1)), 4);
+    __m256i sb = _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(t0, _mm256_set1_epi32(0xffff)),
+                                                              _mm256_and_si256(t1, _mm256_set1_epi32(0xffff))), 0xd8);
+    __m256i db = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_srai_epi32(t0, 16),
+                                                             _mm256_srai_epi32(t1, 16)), 0xd8);
+    __m256i adjustez = _mm256_blendv_epi8(sb, db, usedb);
+    __m256i r = xlns16_mul_avx2(maxxy, _mm256_add_epi16(adjustez, _mm256_set1_epi16(xlns16_logsignmask)));
+    __m256i cancel = _mm256_and_si256(usedb, _mm256_cmpeq_epi16(z, _mm256_setzero_si256()));
+    return _mm256_blendv_epi8(r, _mm256_set1_epi16(xlns16_zero), cancel);
+}
+#endif
+#endif
+
+// bfloat16 conversion
+// bfloat16 (1 sign, 8 exponent, 7 fraction bits) converts directly, without
+// going through float and fp2xlns16: the biased xlns16 log of a normal bf16 is
+// its exponent field times 128 plus a 128-entry table of 128*log2(1+m/128), and
+// the other way the xlns16 log fraction indexes a table of bf16 mantissas (the
+// tables come from xlns16genbf16tbl.cpp).  Both directions round to nearest
+// (the log going to xlns16, the value going to bf16), unlike fp2xlns16, which
+// truncates the log.  Infinities and NaNs saturate to xlns16_pos_inf/neg_inf,
+// bf16 values that round below the smallest xlns16 become xlns16_zero, and the
+// largest xlns16 becomes the largest finite bf16.  The batch versions use AVX2
+// gathers or AVX-512BW permutes and give the same bits as the scalar ones.
+
+#include <string.h>
+#include "xlns16bf16tbl.h"
+
+#ifndef xlns_bf16_included
+#define xlns_bf16_included
+typedef unsigned short xlns_bf16;     // bfloat16 bits: the top half of a float
+#endif
+
+inline float xlns16_bf162fp(xlns_bf16 x) {
+    unsigned int u = (unsigned int)x << 16;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+inline xlns16 bf162xlns16(xlns_bf16 x) {
+    xlns16 s = x & xlns16_signmask;
+    xlns16 e = x & 0x7f80;
+    if ((xlns16)(e - 0x80) >= 0x7f00) {                // exponent field 0 or 255
+        if (e)
+            return s | xlns16_pos_inf;
+        return xlns16bf16subtbl[x & 0x7f] ? s | xlns16bf16subtbl[x & 0x7f] : xlns16_zero;
+    }
+    return s | (e + 128 + xlns16bf16logtbl[x & 0x7f]);
+}
+
+inline xlns_bf16 xlns162bf16(xlns16 x) {
+    xlns16 a = x & xlns16_logmask;
+    xlns_bf16 s = x & xlns16_signmask;
+    if (a < 256)
+        return a ? s | xlns16bf16tinytbl[a] : 0;
+    return s | ((a & 0x7f80) - 128 + xlns16bf16exptbl[a & 0x7f]);
+}
+
+#if defined(__AVX512BW__)
+// 32 lanes of tbl[i&127] for a 128-entry 16-bit table
+inline __m512i xlns16_lookup128_avx512(const unsigned short *tbl, __m512i i) {
+    __m512i lo = _mm512_permutex2var_epi16(_mm512_loadu_si512(tbl), i, _mm512_loadu_si512(tbl+32));
+    __m512i hi = _mm512_permutex2var_epi16(_mm512_loadu_si512(tbl+64), i, _mm512_loadu_si512(tbl+96));
+    return _mm512_mask_blend_epi16(_mm512_test_epi16_mask(i, _mm512_set1_epi16(64)), lo, hi);
+}
+#elif defined(__AVX2__)
+// 16 lanes of tbl[i&127] for a 16-bit table with one entry of padding
+inline __m256i xlns16_lookup128_avx2(const unsigned short *tbl, __m256i i) {
+    const __m256i low = _mm256_set1_epi32(0xffff);
+    i = _mm256_and_si256(i, _mm256_set1_epi16(0x7f));
+    __m256i a = _mm256_i32gather_epi32((const int *)tbl, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(i)), 2);
+    __m256i b = _mm256_i32gather_epi32((const int *)tbl, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(i, 1)), 2);
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(a, low), _mm256_and_si256(b, low)), 0xd8);
+}
+#endif
+
+// Batch convert bfloat16 array to xlns16 array
+inline void xlns16_batch_from_bf16(const xlns_bf16 *src, xlns16 *dst, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_from_bf16(src+i0, dst+i0, i1-i0));
+    size_t i = 0;
+    #if defined(__AVX512BW__)
+    const __m512i expmask = _mm512_set1_epi16(0x7f80);
+    for (; i + 32 <= n; i += 32) {
+        __m512i x = _mm512_loadu_si512(src+i);
+        __m512i e = _mm512_and_si512(x, expmask);
+        __mmask32 zero = _mm512_cmpeq_epi16_mask(e, _mm512_setzero_si512());
+        if (_mm512_mask_test_epi16_mask(zero, x, _mm512_set1_epi16(0x7f))) {
+            for (size_t k = i; k < i + 32; k++) dst[k] = bf162xlns16(src[k]);   // subnormals
+            continue;
+        }
+        __m512i s = _mm512_and_si512(x, _mm512_set1_epi16((short)xlns16_signmask));
+        __m512i r = _mm512_add_epi16(_mm512_add_epi16(e, _mm512_set1_epi16(128)),
+                                     xlns16_lookup128_avx512(xlns16bf16logtbl, x));
+        r = _mm512_mask_mov_epi16(r, _mm512_cmpeq_epi16_mask(e, expmask), _mm512_set1_epi16(xlns16_pos_inf));
+        r = _mm512_or_si512(r, s);
+        _mm512_storeu_si512(dst+i, _mm512_mask_mov_epi16(r, zero, _mm512_setzero_si512()));
+    }
+    #elif defined(__AVX2__)
+    const __m256i expmask = _mm256_set1_epi16(0x7f80);
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src+i));
+        __m256i e = _mm256_and_si256(x, expmask);
+        __m256i zero = _mm256_cmpeq_epi16(e, _mm256_setzero_si256());
+        if (!_mm256_testz_si256(zero, _mm256_and_si256(x, _mm256_set1_epi16(0x7f)))) {
+            for (size_t k = i; k < i + 16; k++) dst[k] = bf162xlns16(src[k]);   // subnormals
+            continue;
+        }
+        __m256i s = _mm256_and_si256(x, _mm256_set1_epi16((short)xlns16_signmask));
+        __m256i r = _mm256_add_epi16(_mm256_add_epi16(e, _mm256_set1_epi16(128)),
+                                     xlns16_lookup128_avx2(xlns16bf16logtbl, x));
+        r = _mm256_blendv_epi8(r, _mm256_set1_epi16(xlns16_pos_inf), _mm256_cmpeq_epi16(e, expmask));
+        r = _mm256_andnot_si256(zero, _mm256_or_si256(r, s));
+        _mm256_storeu_si256((__m256i *)(dst+i), r);
+    }
+    #endif
+    for (; i < n; i++) {
+        dst[i] = bf162xlns16(src[i]);
+    }
+}
+
+// Batch convert xlns16 array to bfloat16 array
+inline void xlns16_batch_to_bf16(const xlns16 *src, xlns_bf16 *dst, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_to_bf16(src+i0, dst+i0, i1-i0));
+    size_t i = 0;
+    #if defined(__AVX512BW__)
+    for (; i + 32 <= n; i += 32) {
+        __m512i x = _mm512_loadu_si512(src+i);
+        __m512i a = _mm512_and_si512(x, _mm512_set1_epi16(xlns16_logmask));
+        __mmask32 zero = _mm512_cmpeq_epi16_mask(a, _mm512_setzero_si512());
+        if (_mm512_mask_cmplt_epu16_mask(~zero, a, _mm512_set1_epi16(256))) {
+            for (size_t k = i; k < i + 32; k++) dst[k] = xlns162bf16(src[k]);   // bf16 subnormals
+            continue;
+        }
+        __m512i r = _mm512_add_epi16(_mm512_sub_epi16(_mm512_and_si512(a, _mm512_set1_epi16(0x7f80)),
+                                                      _mm512_set1_epi16(128)),
+                                     xlns16_lookup128_avx512(xlns16bf16exptbl, a));
+        r = _mm512_or_si512(r, _mm512_and_si512(x, _mm512_set1_epi16((short)xlns16_signmask)));
+        _mm512_storeu_si512(dst+i, _mm512_mask_mov_epi16(r, zero, _mm512_setzero_si512()));
+    }
+    #elif defined(__AVX2__)
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src+i));
+        __m256i a = _mm256_and_si256(x, _mm256_set1_epi16(xlns16_logmask));
+        __m256i zero = _mm256_cmpeq_epi16(a, _mm256_setzero_si256());
+        __m256i tiny = _mm256_cmpgt_epi16(_mm256_set1_epi16(256), a);
+        if (!_mm256_testc_si256(zero, tiny)) {
+            for (size_t k = i; k < i + 16; k++) dst[k] = xlns162bf16(src[k]);   // bf16 subnormals
+            continue;
+        }
+        __m256i r = _mm256_add_epi16(_mm256_sub_epi16(_mm256_and_si256(a, _mm256_set1_epi16(0x7f80)),
+                                                      _mm256_set1_epi16(128)),
+                                     xlns16_lookup128_avx2(xlns16bf16exptbl, a));
+        r = _mm256_or_si256(r, _mm256_and_si256(x, _mm256_set1_epi16((short)xlns16_signmask)));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_andnot_si256(zero, r));
+    }
+    #endif
+    for (; i < n; i++) {
+        dst[i] = xlns162bf16(src[i]);
+    }
+}
+
+// fp16 and blockwise int8/int4 conversion
+// IEEE half precision (1 sign, 5 exponent, 10 fraction bits) converts like
+// bfloat16 above: the exponent field becomes the integer part of the log and a
+// 1024-entry table (from xlns16genquanttbl.cpp) gives 128*log2(1+m/1024),
+// rounded to nearest; subnormals are normalized first.  Quantized weights come
+// in blocks of block elements sharing one fp16 scale, as in ggml's Q8_0/Q4_0:
+// q8 holds signed bytes, q4 two values per byte (low nibble first) stored as
+// v+8.  Each value is looked up (xlns16q8tbl/xlns16q4tbl, rounded to nearest)
+// and the block scale, converted once per block, is added to the log with
+// xlns16_mul, so dst[i] == xlns16_mul(q82xlns16(q[i]), fp162xlns16(scale[i/block])),
+// except that q == 0 stays xlns16_zero (xlns16_qmul).
+// The batch versions use AVX2 (gathers, or pshufb for the 16-entry q4 table)
+// and are split over the pool.
+
+#include "xlns16quanttbl.h"
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+typedef unsigned short xlns_fp16;     // IEEE binary16 bits
+
+inline float xlns16_fp162fp(xlns_fp16 x) {
+    #ifdef __F16C__
+    return _cvtsh_ss(x);
+    #else
+    unsigned int e = (x >> 10) & 0x1f, m = x & 0x3ff;
+    unsigned int u = (unsigned int)(x & 0x8000) << 16;
+    if (e == 0x1f)
+        u |= 0x7f800000 | (m << 13);
+    else if (e)
+        u |= ((e + 112) << 23) | (m << 13);
+    else if (m) {
+        int p = 31 - __builtin_clz(m);
+        u |= ((unsigned)(p + 103) << 23) | (((m << (10 - p)) & 0x3ff) << 13);
+    }
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+    #endif
+}
+
+inline xlns16 fp162xlns16(xlns_fp16 x) {
+    xlns16 s = x & xlns16_signmask;
+    xlns16 e = x & 0x7c00;
+    xlns16 m = x & 0x3ff;
+    if ((xlns16)(e - 0x400) >= 0x7800) {               // exponent field 0 or 31
+        if (e)
+            return s | xlns16_pos_inf;
+        if (m == 0)
+            return xlns16_zero;
+        int p = 31 - __builtin_clz(m);                  // subnormal m*2^-24
+        return s | ((p << 7) + 0x4000 - (24 << 7) + xlns16fp16logtbl[(m << (10 - p)) & 0x3ff]);
+    }
+    return s | ((e >> 3) + 0x4000 - (15 << 7) + xlns16fp16logtbl[m]);
+}
+
+inline xlns16 q82xlns16(signed char q) {
+    return xlns16q8tbl[(unsigned char)q];
+}
+
+// table value times the block scale: zero is the smallest log, which
+// xlns16_mul would scale like any other value
+inline xlns16 xlns16_qmul(xlns16 t, xlns16 s) {
+    return (t == xlns16_zero) ? xlns16_zero : xlns16_mul(t, s);
+}
+
+#ifdef __AVX2__
+// 8 lanes of the 16-bit table entries tbl[i] (tbl padded by one entry)
+inline __m256i xlns16_gather16_avx2(const unsigned short *tbl, __m256i i) {
+    return _mm256_and_si256(_mm256_i32gather_epi32((const int *)tbl, i, 2), _mm256_set1_epi32(0xffff));
+}
+
+// 16 32-bit lanes in two registers back to 16 16-bit lanes
+inline __m256i xlns16_pack32_avx2(__m256i a, __m256i b) {
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xd8);
+}
+
+// 16 lanes of xlns16_qmul
+inline __m256i xlns16_qmul_avx2(__m256i t, __m256i s) {
+    return _mm256_andnot_si256(_mm256_cmpeq_epi16(t, _mm256_set1_epi16(xlns16_zero)), xlns16_mul_avx2(t, s));
+}
+#endif
+
+// Batch convert fp16 array to xlns16 array
+inline void xlns16_batch_from_fp16(const xlns_fp16 *src, xlns16 *dst, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_from_fp16(src+i0, dst+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    const __m256i expmask = _mm256_set1_epi16(0x7c00);
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src+i));
+        __m256i e = _mm256_and_si256(x, expmask);
+        __m256i zero = _mm256_cmpeq_epi16(e, _mm256_setzero_si256());
+        __m256i m = _mm256_and_si256(x, _mm256_set1_epi16(0x3ff));
+        if (!_mm256_testz_si256(zero, m) || !_mm256_testz_si256(_mm256_cmpeq_epi16(e, expmask), expmask)) {
+            for (size_t k = i; k < i + 16; k++) dst[k] = fp162xlns16(src[k]);   // subnormal, inf, NaN
+            continue;
+        }
+        __m256i t = xlns16_pack32_avx2(
+            xlns16_gather16_avx2(xlns16fp16logtbl, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(m))),
+            xlns16_gather16_avx2(xlns16fp16logtbl, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(m, 1))));
+        __m256i r = _mm256_add_epi16(_mm256_add_epi16(_mm256_srli_epi16(e, 3), _mm256_set1_epi16(0x4000 - (15 << 7))), t);
+        r = _mm256_or_si256(r, _mm256_and_si256(x, _mm256_set1_epi16((short)xlns16_signmask)));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_andnot_si256(zero, r));
+    }
+    #endif
+    for (; i < n; i++) {
+        dst[i] = fp162xlns16(src[i]);
+    }
+}
+
+// Blockwise int8 to xlns16 over the elements [i0, i1)
+inline void xlns16_q8_range(const signed char *q, const xlns_fp16 *scale, size_t block, xlns16 *dst,
+                            size_t i0, size_t i1) {
+    while (i0 < i1) {
+        size_t b = i0/block;
+        size_t e = ((b+1)*block < i1) ? (b+1)*block : i1;
+        xlns16 s = fp162xlns16(scale[b]);
+        size_t i = i0;
+        #ifdef __AVX2__
+        const __m256i vs = _mm256_set1_epi16((short)s);
+        for (; i + 16 <= e; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(q+i));
+            __m256i t = xlns16_pack32_avx2(xlns16_gather16_avx2(xlns16q8tbl, _mm256_cvtepu8_epi32(v)),
+                                           xlns16_gather16_avx2(xlns16q8tbl, _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))));
+            _mm256_storeu_si256((__m256i *)(dst+i), xlns16_qmul_avx2(t, vs));
+        }
+        #endif
+        for (; i < e; i++)
+            dst[i] = xlns16_qmul(xlns16q8tbl[(unsigned char)q[i]], s);
+        i0 = e;
+    }
+}
+
+// Blockwise int4 (two per byte, low nibble first, stored as v+8) to xlns16 over [i0, i1)
+inline void xlns16_q4_range(const unsigned char *q, const xlns_fp16 *scale, size_t block, xlns16 *dst,
+                            size_t i0, size_t i1) {
+    #ifdef __AVX2__
+    const __m128i t0 = _mm_loadu_si128((const __m128i *)xlns16q4tbl);
+    const __m128i t1 = _mm_loadu_si128((const __m128i *)(xlns16q4tbl+8));
+    const __m128i byte = _mm_set1_epi16(0xff);
+    const __m128i lot = _mm_packus_epi16(_mm_and_si128(t0, byte), _mm_and_si128(t1, byte));
+    const __m128i hit = _mm_packus_epi16(_mm_srli_epi16(t0, 8), _mm_srli_epi16(t1, 8));
+    #endif
+    while (i0 < i1) {
+        size_t b = i0/block;
+        size_t e = ((b+1)*block < i1) ? (b+1)*block : i1;
+        xlns16 s = fp162xlns16(scale[b]);
+        size_t i = i0;
+        #ifdef __AVX2__
+        if (i & 1) {
+            dst[i] = xlns16_qmul(xlns16q4tbl[q[i/2] >> 4], s);
+            i++;
+        }
+        const __m256i vs = _mm256_set1_epi16((short)s);
+        for (; i + 32 <= e; i += 32) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(q+i/2));
+            __m128i lo = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+            __m128i ia = _mm_unpacklo_epi8(lo, hi), ib = _mm_unpackhi_epi8(lo, hi);
+            __m128i la = _mm_shuffle_epi8(lot, ia), ha = _mm_shuffle_epi8(hit, ia);
+            __m128i lb = _mm_shuffle_epi8(lot, ib), hb = _mm_shuffle_epi8(hit, ib);
+            __m256i ta = _mm256_set_m128i(_mm_unpackhi_epi8(la, ha), _mm_unpacklo_epi8(la, ha));
+            __m256i tb = _mm256_set_m128i(_mm_unpackhi_epi8(lb, hb), _mm_unpacklo_epi8(lb, hb));
+            _mm256_storeu_si256((__m256i *)(dst+i), xlns16_qmul_avx2(ta, vs));
+            _mm256_storeu_si256((__m256i *)(dst+i+16), xlns16_qmul_avx2(tb, vs));
+        }
+        #endif
+        for (; i < e; i++)
+            dst[i] = xlns16_qmul(xlns16q4tbl[(q[i/2] >> (4*(i&1))) & 0xf], s);
+        i0 = e;
+    }
+}
+
+// Batch convert n int8 values with one fp16 scale per block of block values
+inline void xlns16_batch_from_q8(const signed char *q, const xlns_fp16 *scale, size_t block, xlns16 *dst, size_t n) {
+    xlns_parallel_loop(n, xlns16_q8_range(q, scale, block, dst, i0, i1));
+}
+
+// Batch convert n int4 values (n/2 bytes) with one fp16 scale per block of block values
+inline void xlns16_batch_from_q4(const unsigned char *q, const xlns_fp16 *scale, size_t block, xlns16 *dst, size_t n) {
+    xlns_parallel_loop(n, xlns16_q4_range(q, scale, block, dst, i0, i1));
+}
+
 // Batch multiplication: c[i] = a[i] * b[i]
 inline void xlns16_batch_mul(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns16_batch_mul(a+i0, b+i0, c+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns16_mul_avx2(_mm256_loadu_si256((const __m256i *)(a+i)),
+                                                              _mm256_loadu_si256((const __m256i *)(b+i))));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns16_mul(a[i], b[i]);
     }
 }
 
 // Batch addition: c[i] = a[i] + b[i]
 inline void xlns16_batch_add(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns16_batch_add(a+i0, b+i0, c+i0, i1-i0));
+    xlns16_zprof_kernel("xlns16_batch_add");
+    size_t i = 0;
+    #ifdef xlns16_add_simd
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns16_add_avx2(_mm256_loadu_si256((const __m256i *)(a+i)),
+                                                              _mm256_loadu_si256((const __m256i *)(b+i))));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns16_add(a[i], b[i]);
     }
 }
 
 // Batch subtraction: c[i] = a[i] - b[i]
 inline void xlns16_batch_sub(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns16_batch_sub(a+i0, b+i0, c+i0, i1-i0));
+    xlns16_zprof_kernel("xlns16_batch_sub");
+    size_t i = 0;
+    #ifdef xlns16_add_simd
+    const __m256i sign = _mm256_set1_epi16((short)xlns16_signmask);
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns16_add_avx2(_mm256_loadu_si256((const __m256i *)(a+i)),
+                            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(b+i)), sign)));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns16_sub(a[i], b[i]);
     }
 }
 
 // Batch division: c[i] = a[i] / b[i]
 inline void xlns16_batch_div(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_div(a+i0, b+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_div(a[i], b[i]);
     }
@@ -417,13 +1069,21 @@ inline void xlns16_batch_div(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t
 
 // Batch scale: c[i] = a[i] * scalar
 inline void xlns16_batch_scale(const xlns16 *a, xlns16 scalar, xlns16 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns16_batch_scale(a+i0, scalar, c+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    const __m256i s = _mm256_set1_epi16((short)scalar);
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns16_mul_avx2(_mm256_loadu_si256((const __m256i *)(a+i)), s));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns16_mul(a[i], scalar);
     }
 }
 
 // Batch negation: c[i] = -a[i]
 inline void xlns16_batch_neg(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_neg(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_neg(a[i]);
     }
@@ -431,16 +1091,261 @@ inline void xlns16_batch_neg(const xlns16 *a, xlns16 *c, size_t n) {
 
 // Batch absolute value: c[i] = |a[i]|
 inline void xlns16_batch_abs(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_abs(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_abs(a[i]);
     }
 }
 
+// Log-domain addition
+// A fixed-point log a (an xlns16_signed) stands for 2^(a/xlns16_scale): for a
+// probability p, a = log2(p)*xlns16_scale (or ln(p)*xlns16_scale/ln(2)), and
+// xlns16_log_zero stands for 0.  It is the log part of a positive xlns16 less
+// xlns16_logsignmask, so the Gaussian logs sb(z) = log2(1 + 2^z) and
+// db(z) = log2|1 - 2^z| that xlns16_add applies work on arrays of them directly:
+// xlns16_logadd(a, b) = log2(2^a + 2^b) and xlns16_logsub(a, b) = log2|2^a - 2^b|
+// have the same bits as xlns16_add.  Logs above xlns16_log_max saturate to it,
+// and those at or below xlns16_log_zero are 0, which these additions absorb
+// exactly (xlns16_add takes xlns16_zero as the smallest value, 2^-128, so that
+// xlns16_zero + xlns16_zero would be 2^-127).  The batch versions go 16 at a
+// time through xlns16_add_avx2 where there is one.
+#define xlns16_log_zero      (-xlns16_logsignmask)
+#define xlns16_log_max       (xlns16_logsignmask - 1)
+#define xlns162log(x)        ((xlns16_signed)(((x) & xlns16_logmask) - xlns16_logsignmask))
+
+inline xlns16 xlns16_log2xlns16(xlns16_signed a) {
+    if (a <= xlns16_log_zero) return xlns16_zero;
+    if (a >= xlns16_log_max) return xlns16_logmask;
+    return (xlns16)(a + xlns16_logsignmask);
+}
+
+// xlns16_add of the xlns16 forms of two logs, with zero (of either sign) as 0
+inline xlns16 xlns16_add_log0(xlns16 x, xlns16 y) {
+    if (!(x & xlns16_logmask)) return y;
+    if (!(y & xlns16_logmask)) return x;
+    return xlns16_add(x, y);
+}
+
+inline xlns16_signed xlns16_logadd(xlns16_signed a, xlns16_signed b) {
+    return xlns162log(xlns16_add_log0(xlns16_log2xlns16(a), xlns16_log2xlns16(b)));
+}
+
+inline xlns16_signed xlns16_logsub(xlns16_signed a, xlns16_signed b) {
+    return xlns162log(xlns16_add_log0(xlns16_log2xlns16(a), xlns16_neg(xlns16_log2xlns16(b))));
+}
+
+#ifdef xlns16_add_simd
+// 16 lanes of xlns16_log2xlns16 and of xlns16_add_log0
+inline __m256i xlns16_log2xlns16_avx2(__m256i a) {
+    a = _mm256_min_epi16(_mm256_max_epi16(a, _mm256_set1_epi16(xlns16_log_zero)),
+                         _mm256_set1_epi16(xlns16_log_max));
+    return _mm256_add_epi16(a, _mm256_set1_epi16(xlns16_logsignmask));
+}
+
+inline __m256i xlns16_add_log0_avx2(__m256i x, __m256i y) {
+    const __m256i lm = _mm256_set1_epi16(xlns16_logmask), zero = _mm256_setzero_si256();
+    __m256i r = xlns16_add_avx2(x, y);
+    r = _mm256_blendv_epi8(r, x, _mm256_cmpeq_epi16(_mm256_and_si256(y, lm), zero));
+    return _mm256_blendv_epi8(r, y, _mm256_cmpeq_epi16(_mm256_and_si256(x, lm), zero));
+}
+#endif
+
+// c[i] = xlns16_logadd(a[i], b[i]) (xlns16_logsub if sub), b NULL for all 0
+inline void xlns16_logadd_range(const xlns16_signed *a, const xlns16_signed *b, xlns16_signed *c,
+                                size_t n, int sub) {
+    size_t i = 0;
+    #ifdef xlns16_add_simd
+    const __m256i lsm = _mm256_set1_epi16(xlns16_logsignmask), lm = _mm256_set1_epi16(xlns16_logmask);
+    const __m256i sign = _mm256_set1_epi16(sub ? (short)xlns16_signmask : 0);
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = xlns16_log2xlns16_avx2(_mm256_loadu_si256((const __m256i *)(a+i)));
+        __m256i y = b ? xlns16_log2xlns16_avx2(_mm256_loadu_si256((const __m256i *)(b+i))) : lsm;
+        __m256i r = xlns16_add_log0_avx2(x, _mm256_xor_si256(y, sign));
+        _mm256_storeu_si256((__m256i *)(c+i), _mm256_sub_epi16(_mm256_and_si256(r, lm), lsm));
+    }
+    #endif
+    for (; i < n; i++)
+        c[i] = sub ? xlns16_logsub(a[i], b ? b[i] : 0) : xlns16_logadd(a[i], b ? b[i] : 0);
+}
+
+// c[i] = log2(2^a[i] + 2^b[i])
+inline void xlns16_batch_logadd(const xlns16_signed *a, const xlns16_signed *b, xlns16_signed *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_logadd(a+i0, b+i0, c+i0, i1-i0));
+    xlns16_zprof_kernel("xlns16_batch_logadd");
+    xlns16_logadd_range(a, b, c, n, 0);
+}
+
+// c[i] = log2|2^a[i] - 2^b[i]| (xlns16_log_zero where a[i] == b[i])
+inline void xlns16_batch_logsub(const xlns16_signed *a, const xlns16_signed *b, xlns16_signed *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_logsub(a+i0, b+i0, c+i0, i1-i0));
+    xlns16_zprof_kernel("xlns16_batch_logsub");
+    xlns16_logadd_range(a, b, c, n, 1);
+}
+
+// r[i] = sb(z[i]) = log2(1 + 2^z[i]), as xlns16_logadd(z[i], 0)
+inline void xlns16_batch_sb(const xlns16_signed *z, xlns16_signed *r, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_sb(z+i0, r+i0, i1-i0));
+    xlns16_logadd_range(z, NULL, r, n, 0);
+}
+
+// r[i] = db(z[i]) = log2|1 - 2^z[i]|, as xlns16_logsub(z[i], 0)
+inline void xlns16_batch_db(const xlns16_signed *z, xlns16_signed *r, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_db(z+i0, r+i0, i1-i0));
+    xlns16_logadd_range(z, NULL, r, n, 1);
+}
+
+// Log-sum-exp over fixed-point logs: log2(sum of 2^a[i]) with one xlns16_add
+// (a table lookup) per element, no exp and no pass for the max, as a sum in the
+// log domain cannot overflow (it saturates at xlns16_log_max, and elements at
+// or below xlns16_log_zero add nothing).  Within each block of xlns16_logsumexp_block
+// elements, element k goes to lane k%xlns16_logsumexp_lanes and the lanes are
+// added in order; the block sums are added pairwise as the blocks complete
+// (level l holds the sum of 2^l blocks), so that no running sum grows far above
+// what is added to it, which the 7-bit sb table would round away.  Whole rows of
+// lanes go through xlns16_add_avx2 where there is one, with the same bits, and a
+// long or streamed sequence can be pushed piece by piece.
+#define xlns16_logsumexp_lanes 16
+#define xlns16_logsumexp_block 256
+
+struct xlns16_logsumexp_acc {
+    xlns16 lane[xlns16_logsumexp_lanes];     // as positive xlns16
+    xlns16 level[8*sizeof(size_t)];
+    size_t count;
+};
+
+inline void xlns16_logsumexp_init(xlns16_logsumexp_acc *acc) {
+    acc->count = 0;
+}
+
+// fold the lanes of a full block into the levels
+inline void xlns16_logsumexp_carry(xlns16_logsumexp_acc *acc) {
+    xlns16 s = acc->lane[0];
+    for (size_t j = 1; j < xlns16_logsumexp_lanes; j++)
+        s = xlns16_add_log0(s, acc->lane[j]);
+    size_t l = 0, blocks = acc->count/xlns16_logsumexp_block - 1;  // full blocks before this one
+    for (; blocks & 1; blocks >>= 1, l++)
+        s = xlns16_add_log0(acc->level[l], s);
+    acc->level[l] = s;
+}
+
+inline void xlns16_logsumexp_push1(xlns16_logsumexp_acc *acc, xlns16_signed a) {
+    size_t k = acc->count % xlns16_logsumexp_block, j = k % xlns16_logsumexp_lanes;
+    xlns16 v = xlns16_log2xlns16(a);
+    acc->lane[j] = (k < xlns16_logsumexp_lanes) ? v : xlns16_add_log0(acc->lane[j], v);
+    if (++acc->count % xlns16_logsumexp_block == 0)
+        xlns16_logsumexp_carry(acc);
+}
+
+inline void xlns16_logsumexp_push(xlns16_logsumexp_acc *acc, const xlns16_signed *a, size_t n) {
+    size_t i = 0;
+    #ifdef xlns16_add_simd
+    while (i + xlns16_logsumexp_lanes <= n) {
+        size_t k = acc->count % xlns16_logsumexp_block;
+        if (k < xlns16_logsumexp_lanes || k % xlns16_logsumexp_lanes) {
+            xlns16_logsumexp_push1(acc, a[i++]);
+            continue;
+        }
+        __m256i l = _mm256_loadu_si256((const __m256i *)acc->lane);
+        for (; k < xlns16_logsumexp_block && i + xlns16_logsumexp_lanes <= n; k += xlns16_logsumexp_lanes) {
+            l = xlns16_add_log0_avx2(l, xlns16_log2xlns16_avx2(_mm256_loadu_si256((const __m256i *)(a+i))));
+            i += xlns16_logsumexp_lanes;
+            acc->count += xlns16_logsumexp_lanes;
+        }
+        _mm256_storeu_si256((__m256i *)acc->lane, l);
+        if (k == xlns16_logsumexp_block)
+            xlns16_logsumexp_carry(acc);
+    }
+    #endif
+    for (; i < n; i++)
+        xlns16_logsumexp_push1(acc, a[i]);
+}
+
+// the levels from the lowest, then the lanes of the last, partial block
+inline xlns16_signed xlns16_logsumexp_result(const xlns16_logsumexp_acc *acc) {
+    if (acc->count == 0) return xlns16_log_zero;
+    size_t blocks = acc->count/xlns16_logsumexp_block, k = acc->count % xlns16_logsumexp_block;
+    size_t lanes = (k < xlns16_logsumexp_lanes) ? k : xlns16_logsumexp_lanes;
+    xlns16 sum = xlns16_zero;
+    for (size_t l = 0; blocks; blocks >>= 1, l++)
+        if (blocks & 1)
+            sum = xlns16_add_log0(acc->level[l], sum);
+    for (size_t j = 0; j < lanes; j++)
+        sum = xlns16_add_log0(sum, acc->lane[j]);
+    return xlns162log(sum);
+}
+
+inline xlns16_signed xlns16_logsumexp(const xlns16_signed *a, size_t n) {
+    xlns16_zprof_kernel("xlns16_logsumexp");
+    xlns16_logsumexp_acc acc;
+    xlns16_logsumexp_init(&acc);
+    xlns16_logsumexp_push(&acc, a, n);
+    return xlns16_logsumexp_result(&acc);
+}
+
 // Vector operations (critical for ggml MUL_MAT)
 
+// Fixed-tree sums
+// the array is cut into xlns16_treechunk-element chunks, each chunk is summed in
+// order (by any thread), and the chunk sums are added pairwise, ((p0+p1)+(p2+p3))+...
+// the tree depends only on n, so the result has the same bits for any number of
+// threads, with or without xlns_parallel (it differs from the sequential xlns16_sum,
+// usually for the better, as the partial sums are of similar size)
+
+#include <vector>
+
+#ifndef xlns16_treechunk
+#define xlns16_treechunk 4096
+#endif
+
+inline xlns16 xlns16_add_fn(xlns16 x, xlns16 y) { return xlns16_add(x, y); }
+
+// partial(i0, i1) reduces elements [i0, i1) of a chunk to a T (n > 0); add
+// combines two partials
+template <class T, class P, class A>
+inline T xlns16_tree_reduce_of(size_t n, const P &partial, const A &add) {
+    size_t nc = (n + xlns16_treechunk - 1)/xlns16_treechunk;
+    std::vector<T> part(nc);
+    xlns_parallel_chunks(n, nc, for (size_t c = i0; c < i1; c++)
+        part[c] = partial(c*xlns16_treechunk, (c == nc-1) ? n : (c+1)*xlns16_treechunk));
+    for (size_t w = 1; w < nc; w *= 2)
+        for (size_t c = 0; c + w < nc; c += 2*w)
+            part[c] = add(part[c], part[c+w]);
+    return part[0];
+}
+
+template <class P, class A>
+inline xlns16 xlns16_tree_reduce(size_t n, const P &partial, const A &add) {
+    if (n == 0) return xlns16_zero;
+    return xlns16_tree_reduce_of<xlns16>(n, partial, add);
+}
+
+// Sum of array elements with the fixed tree
+inline xlns16 xlns16_sum_tree(const xlns16 *a, size_t n) {
+    xlns16_zprof_kernel("xlns16_sum_tree");
+    return xlns16_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns16 sum = a[i0];
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns16_add(sum, a[i]);
+        return sum;
+    }, xlns16_add_fn);
+}
+
+// Dot product with the fixed tree
+inline xlns16 xlns16_vec_dot_tree(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_tree");
+    return xlns16_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns16 sum = xlns16_mul(a[i0], b[i0]);
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns16_add(sum, xlns16_mul(a[i], b[i]));
+        return sum;
+    }, xlns16_add_fn);
+}
+
 // Sum of array elements: result = Σ a[i]
 inline xlns16 xlns16_sum(const xlns16 *a, size_t n) {
+    xlns16_zprof_kernel("xlns16_sum");
     if (n == 0) return xlns16_zero;
+    xlns_parallel_sum(n, xlns16_sum_tree(a, n));
     xlns16 sum = a[0];
     for (size_t i = 1; i < n; i++) {
         sum = xlns16_add(sum, a[i]);
@@ -450,7 +1355,9 @@ inline xlns16 xlns16_sum(const xlns16 *a, size_t n) {
 
 // Vector dot product: result = Σ(a[i] * b[i])
 inline xlns16 xlns16_vec_dot(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot");
     if (n == 0) return xlns16_zero;
+    xlns_parallel_sum(n, xlns16_vec_dot_tree(a, b, n));
     xlns16 sum = xlns16_mul(a[0], b[0]);
     for (size_t i = 1; i < n; i++) {
         sum = xlns16_add(sum, xlns16_mul(a[i], b[i]));
@@ -469,6 +1376,608 @@ inline float xlns16_vec_dot_f32(const float *a, const float *b, size_t n) {
     return xlns162fp(sum);
 }
 
+// Matrix-vector products (batch-1 decode)
+// W is row-major, rows x cols.  Rows (or, for the transposed product, blocks of
+// columns) are split over the pool when xlns_parallel is defined; the weights
+// stream through with software prefetch xlns16_prefetchdist elements ahead, the
+// products use xlns16_batch_mul/xlns16_batch_scale (SIMD with -mavx2), and the
+// additions keep the order of xlns16_vec_dot, so the bits do not depend on the
+// number of threads.  xlns16_gemv_lpvip32 and xlns16_gemv_monte (and the _t
+// versions) in xlns32lpvip.cpp and the monte files accumulate the other ways.
+
+#if defined(__GNUC__)
+#define xlns16_prefetch(p) __builtin_prefetch((p), 0, 0)
+#else
+#define xlns16_prefetch(p)
+#endif
+#ifndef xlns16_prefetchdist
+#define xlns16_prefetchdist 1024
+#endif
+#define xlns16_gemv_chunk 256
+
+// Prefetch the m elements at w+xlns16_prefetchdist (one per 64-byte line)
+inline void xlns16_prefetch_ahead(const xlns16 *w, size_t m) {
+    for (size_t k = 0; k < m; k += 32)
+        xlns16_prefetch(w + xlns16_prefetchdist + k);
+}
+
+// One row: the same bits as xlns16_vec_dot(w, x, cols)
+inline xlns16 xlns16_gemv_row(const xlns16 *w, const xlns16 *x, size_t cols) {
+    if (cols == 0) return xlns16_zero;
+    xlns16 prod[xlns16_gemv_chunk];
+    xlns16 sum = xlns16_zero;
+    for (size_t i = 0; i < cols; i += xlns16_gemv_chunk) {
+        size_t m = (cols - i < xlns16_gemv_chunk) ? cols - i : xlns16_gemv_chunk;
+        xlns16_prefetch_ahead(w+i, m);
+        xlns16_batch_mul(w+i, x+i, prod, m);
+        size_t k = 0;
+        if (i == 0) sum = prod[k++];
+        for (; k < m; k++)
+            sum = xlns16_add(sum, prod[k]);
+    }
+    return sum;
+}
+
+// y = W x: y[r] = xlns16_vec_dot(W + r*cols, x, cols), x has cols elements
+inline void xlns16_gemv(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv");
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns16_gemv_row(W + r*cols, x, cols));
+}
+
+// y = W^T x: y[c] = dot product of column c of W with x (x has rows elements,
+// y has cols); each block of xlns16_gemv_chunk columns keeps its sums in y
+// and streams the rows of W
+inline void xlns16_gemv_t(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_t");
+    size_t nb = (cols + xlns16_gemv_chunk - 1)/xlns16_gemv_chunk;
+    xlns_parallel_chunks(rows*cols, nb, for (size_t b = i0; b < i1; b++) {
+        size_t c0 = b*xlns16_gemv_chunk;
+        size_t m = (cols - c0 < xlns16_gemv_chunk) ? cols - c0 : xlns16_gemv_chunk;
+        xlns16 prod[xlns16_gemv_chunk];
+        if (rows == 0) {
+            for (size_t k = 0; k < m; k++) y[c0+k] = xlns16_zero;
+            continue;
+        }
+        xlns16_batch_scale(W + c0, x[0], y + c0, m);
+        for (size_t r = 1; r < rows; r++) {
+            const xlns16 *w = W + r*cols + c0;
+            for (size_t k = 0; k < m; k += 32)
+                xlns16_prefetch(w + cols + k);   // same columns, next row
+            xlns16_batch_scale(w, x[r], prod, m);
+            for (size_t k = 0; k < m; k++)
+                y[c0+k] = xlns16_add(y[c0+k], prod[k]);
+        }
+    });
+}
+
+// Mixed-format products: float or bfloat16 activations, xlns16 weights, float outputs
+// The weights are converted to LNS once, ahead of time; each call converts the
+// activation vector once (xlns16_batch_from_float / xlns16_batch_from_bf16) into
+// scratch, then runs the rows as xlns16_gemv does.  scratch (at least cols
+// elements) can be passed in to be reused between calls; when it is NULL a
+// per-thread buffer, grown on demand, is used.  Every output is
+// xlns162fp(xlns16_vec_dot(W + r*cols, converted x, cols)).
+
+// Per-thread scratch of at least n elements (kept between calls)
+inline xlns16 *xlns16_scratch(size_t n) {
+    static thread_local std::vector<xlns16> buf;
+    if (buf.size() < n) buf.resize(n);
+    return buf.data();
+}
+
+// y[r] = xlns162fp(xlns16_vec_dot(W + r*cols, x, cols)), x already converted
+inline void xlns16_gemv_tofloat(const xlns16 *W, const xlns16 *x, float *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_tofloat");
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns162fp(xlns16_gemv_row(W + r*cols, x, cols)));
+}
+
+// y = W x with float x (cols elements) and float y (rows elements)
+inline void xlns16_gemv_f32(const xlns16 *W, const float *x, float *y, size_t rows, size_t cols,
+                            xlns16 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns16_scratch(cols);
+    xlns16_batch_from_float(x, scratch, cols);
+    xlns16_gemv_tofloat(W, scratch, y, rows, cols);
+}
+
+// y = W x with bfloat16 x (cols elements) and float y (rows elements)
+inline void xlns16_gemv_bf16(const xlns16 *W, const xlns_bf16 *x, float *y, size_t rows, size_t cols,
+                             xlns16 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns16_scratch(cols);
+    xlns16_batch_from_bf16(x, scratch, cols);
+    xlns16_gemv_tofloat(W, scratch, y, rows, cols);
+}
+
+// Dot product of LNS weights w with float activations x, float result
+inline float xlns16_vec_dot_f32x(const xlns16 *w, const float *x, size_t n, xlns16 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns16_scratch(n);
+    xlns16_batch_from_float(x, scratch, n);
+    xlns_parallel_sum(n, xlns162fp(xlns16_vec_dot_tree(w, scratch, n)));
+    return xlns162fp(xlns16_gemv_row(w, scratch, n));
+}
+
+// Dot product of LNS weights w with bfloat16 activations x, float result
+inline float xlns16_vec_dot_bf16x(const xlns16 *w, const xlns_bf16 *x, size_t n, xlns16 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns16_scratch(n);
+    xlns16_batch_from_bf16(x, scratch, n);
+    xlns_parallel_sum(n, xlns162fp(xlns16_vec_dot_tree(w, scratch, n)));
+    return xlns162fp(xlns16_gemv_row(w, scratch, n));
+}
+
+// Block-scaled LNS weights (compact storage for batch-1 decode)
+// A block of xlns16_qk values keeps the largest magnitude's log as a 16-bit
+// base and, per value, a short code: a sign bit and an unsigned offset c (0
+// means zero), the value's log being base - ((cmax - c) << shift), rounded to
+// nearest when encoding.  Values more than cmax steps under the base become
+// zero.  Two layouts, in the manner of ggml's Q-types:
+//   xlns16_b8  7-bit offsets in steps of 1/16 octave (8 octaves), 34 bytes per
+//              32 values (1.9x smaller than xlns16)
+//   xlns16_b6  5-bit offsets in steps of 1/8 octave (4 octaves), the low four
+//              bits two per byte (value j and j+16) and the high two four per
+//              byte (values j, j+8, j+16, j+24), 26 bytes per 32 (2.5x smaller)
+// The dot products and GEMVs unpack each block to xlns16 (SIMD with -mavx2)
+// and then multiply and add as xlns16_vec_dot does, so their results are those
+// of xlns16_vec_dot on xlns16_dequantize_b8/_b6 of the weights.  A row of a
+// matrix is (cols + xlns16_qk - 1)/xlns16_qk blocks.
+
+#define xlns16_qk 32
+
+typedef struct {
+    xlns16 base;
+    unsigned char c[xlns16_qk];                 // sign<<7 | offset
+} xlns16_b8;
+
+typedef struct {
+    xlns16 base;
+    unsigned char lo[xlns16_qk/2];              // offset bits 0-3
+    unsigned char hi[xlns16_qk/4];              // sign<<1 | offset bit 4
+} xlns16_b6;
+
+// code (sign<<cbits | offset) of the xlns16 x in a block with the given base
+inline unsigned xlns16_blk_code(xlns16 base, xlns16 x, int cbits, int shift) {
+    xlns16 a = xlns16_abs(x);
+    unsigned cmax = (1u << cbits) - 1;
+    if (a == xlns16_zero)
+        return 0;
+    unsigned d = (unsigned)(base - a + (1 << (shift - 1))) >> shift;
+    if (d >= cmax || (int)base - (int)(d << shift) <= 0)
+        return 0;
+    return ((xlns16_sign(x) != 0) << cbits) | (cmax - d);
+}
+
+// xlns16 value of a code in a block with the given base
+inline xlns16 xlns16_blk_value(xlns16 base, unsigned code, int cbits, int shift) {
+    unsigned c = code & ((1u << cbits) - 1);
+    if (c == 0)
+        return xlns16_zero;
+    int a = (int)base - (int)((((1u << cbits) - 1) - c) << shift);
+    return (xlns16)(((code >> cbits) << 15) | (a > 0 ? a : 0));
+}
+
+// base of the block of m values at x: the largest log (0 if all are zero)
+inline xlns16 xlns16_blk_base(const xlns16 *x, size_t m) {
+    xlns16 base = 0;
+    for (size_t k = 0; k < m; k++)
+        if (xlns16_abs(x[k]) > base) base = xlns16_abs(x[k]);
+    return base;
+}
+
+#ifdef __AVX2__
+// 16 lanes of xlns16_blk_value for the codes in the low bytes of v
+inline __m256i xlns16_blk_value_avx2(__m256i v, __m256i base, int cbits, int shift) {
+    __m256i c = _mm256_and_si256(v, _mm256_set1_epi16((1 << cbits) - 1));
+    __m256i a = _mm256_sub_epi16(base, _mm256_sll_epi16(_mm256_sub_epi16(_mm256_set1_epi16((1 << cbits) - 1), c),
+                                                        _mm_cvtsi32_si128(shift)));
+    a = _mm256_max_epi16(a, _mm256_setzero_si256());
+    __m256i s = _mm256_sll_epi16(_mm256_srl_epi16(v, _mm_cvtsi32_si128(cbits)), _mm_cvtsi32_si128(15));
+    return _mm256_andnot_si256(_mm256_cmpeq_epi16(c, _mm256_setzero_si256()), _mm256_or_si256(a, s));
+}
+
+// 32 codes in bytes to 32 xlns16 values
+inline void xlns16_blk_unpack_avx2(__m256i codes, xlns16 base, int cbits, int shift, xlns16 *out) {
+    __m256i b = _mm256_set1_epi16((short)base);
+    _mm256_storeu_si256((__m256i *)out, xlns16_blk_value_avx2(
+        _mm256_cvtepu8_epi16(_mm256_castsi256_si128(codes)), b, cbits, shift));
+    _mm256_storeu_si256((__m256i *)(out+16), xlns16_blk_value_avx2(
+        _mm256_cvtepu8_epi16(_mm256_extracti128_si256(codes, 1)), b, cbits, shift));
+}
+#endif
+
+// one block to xlns16_qk xlns16 values
+inline void xlns16_unpack_block(const xlns16_b8 *b, xlns16 *out) {
+    #ifdef __AVX2__
+    xlns16_blk_unpack_avx2(_mm256_loadu_si256((const __m256i *)b->c), b->base, 7, 3, out);
+    #else
+    for (int k = 0; k < xlns16_qk; k++)
+        out[k] = xlns16_blk_value(b->base, b->c[k], 7, 3);
+    #endif
+}
+
+inline void xlns16_unpack_block(const xlns16_b6 *b, xlns16 *out) {
+    #ifdef __AVX2__
+    __m128i l = _mm_loadu_si128((const __m128i *)b->lo);
+    __m256i lo = _mm256_set_m128i(_mm_and_si128(_mm_srli_epi16(l, 4), _mm_set1_epi8(0x0f)),
+                                  _mm_and_si128(l, _mm_set1_epi8(0x0f)));
+    long long h;
+    memcpy(&h, b->hi, sizeof(h));
+    __m256i hi = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(h), _mm256_setr_epi64x(0, 2, 4, 6)),
+                                  _mm256_set1_epi8(0x03));
+    xlns16_blk_unpack_avx2(_mm256_or_si256(lo, _mm256_slli_epi16(hi, 4)), b->base, 5, 4, out);
+    #else
+    for (int k = 0; k < xlns16_qk; k++) {
+        unsigned code = ((b->lo[k & 15] >> (4*(k >> 4))) & 0xf) | (((b->hi[k & 7] >> (2*(k >> 3))) & 3) << 4);
+        out[k] = xlns16_blk_value(b->base, code, 5, 4);
+    }
+    #endif
+}
+
+// one block from m <= xlns16_qk xlns16 values (the rest are zero)
+inline void xlns16_pack_block(const xlns16 *x, size_t m, xlns16_b8 *b) {
+    b->base = xlns16_blk_base(x, m);
+    for (size_t k = 0; k < xlns16_qk; k++)
+        b->c[k] = (k < m) ? (unsigned char)xlns16_blk_code(b->base, x[k], 7, 3) : 0;
+}
+
+inline void xlns16_pack_block(const xlns16 *x, size_t m, xlns16_b6 *b) {
+    b->base = xlns16_blk_base(x, m);
+    memset(b->lo, 0, sizeof(b->lo));
+    memset(b->hi, 0, sizeof(b->hi));
+    for (size_t k = 0; k < m; k++) {
+        unsigned code = xlns16_blk_code(b->base, x[k], 5, 4);
+        b->lo[k & 15] |= (code & 0xf) << (4*(k >> 4));
+        b->hi[k & 7] |= (code >> 4) << (2*(k >> 3));
+    }
+}
+
+template<class B>
+inline void xlns16_quantize_blocks(const xlns16 *src, B *dst, size_t n) {
+    size_t nb = (n + xlns16_qk - 1)/xlns16_qk;
+    xlns_parallel_chunks(n, nb, for (size_t b = i0; b < i1; b++)
+        xlns16_pack_block(src + b*xlns16_qk, (n - b*xlns16_qk < xlns16_qk) ? n - b*xlns16_qk : xlns16_qk, dst + b));
+}
+
+template<class B>
+inline void xlns16_dequantize_blocks(const B *src, xlns16 *dst, size_t n) {
+    size_t nb = (n + xlns16_qk - 1)/xlns16_qk;
+    xlns_parallel_chunks(n, nb, for (size_t b = i0; b < i1; b++) {
+        xlns16 v[xlns16_qk];
+        size_t m = (n - b*xlns16_qk < xlns16_qk) ? n - b*xlns16_qk : xlns16_qk;
+        xlns16_unpack_block(src + b, v);
+        memcpy(dst + b*xlns16_qk, v, m*sizeof(xlns16));
+    });
+}
+
+// dot product of n block-coded weights with x, as xlns16_vec_dot
+template<class B>
+inline xlns16 xlns16_vec_dot_blocks(const B *w, const xlns16 *x, size_t n) {
+    if (n == 0) return xlns16_zero;
+    xlns16 v[xlns16_qk], prod[xlns16_qk];
+    xlns16 sum = xlns16_zero;
+    for (size_t i = 0; i < n; i += xlns16_qk) {
+        size_t m = (n - i < xlns16_qk) ? n - i : xlns16_qk;
+        xlns16_prefetch(w + i/xlns16_qk + 16);
+        xlns16_unpack_block(w + i/xlns16_qk, v);
+        xlns16_batch_mul(v, x+i, prod, m);
+        size_t k = 0;
+        if (i == 0) sum = prod[k++];
+        for (; k < m; k++)
+            sum = xlns16_add(sum, prod[k]);
+    }
+    return sum;
+}
+
+template<class B>
+inline void xlns16_gemv_blocks(const B *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    size_t nb = (cols + xlns16_qk - 1)/xlns16_qk;
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns16_vec_dot_blocks(W + r*nb, x, cols));
+}
+
+// Convert n xlns16 values to (n + xlns16_qk - 1)/xlns16_qk blocks and back
+inline void xlns16_quantize_b8(const xlns16 *src, xlns16_b8 *dst, size_t n) {
+    xlns16_quantize_blocks(src, dst, n);
+}
+
+inline void xlns16_quantize_b6(const xlns16 *src, xlns16_b6 *dst, size_t n) {
+    xlns16_quantize_blocks(src, dst, n);
+}
+
+inline void xlns16_dequantize_b8(const xlns16_b8 *src, xlns16 *dst, size_t n) {
+    xlns16_dequantize_blocks(src, dst, n);
+}
+
+inline void xlns16_dequantize_b6(const xlns16_b6 *src, xlns16 *dst, size_t n) {
+    xlns16_dequantize_blocks(src, dst, n);
+}
+
+// result = Σ(w[i] * x[i]) with block-coded w
+inline xlns16 xlns16_vec_dot_b8(const xlns16_b8 *w, const xlns16 *x, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_b8");
+    return xlns16_vec_dot_blocks(w, x, n);
+}
+
+inline xlns16 xlns16_vec_dot_b6(const xlns16_b6 *w, const xlns16 *x, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_b6");
+    return xlns16_vec_dot_blocks(w, x, n);
+}
+
+// y = W x with each row of W in block-coded form
+inline void xlns16_gemv_b8(const xlns16_b8 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_b8");
+    xlns16_gemv_blocks(W, x, y, rows, cols);
+}
+
+inline void xlns16_gemv_b6(const xlns16_b6 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_b6");
+    xlns16_gemv_blocks(W, x, y, rows, cols);
+}
+
+// Narrow LNS storage: xlns8 and xlns12
+// Per-value LNS codes narrower than xlns16, on the xlns16 scale, so that
+// unpacking is a shift (xlns8) or an add (xlns12) into the xlns16 word:
+//   xlns8   sign<<7 | 7-bit log with 3 fraction bits (steps of 1/8 octave),
+//           biased by 0x40: magnitudes 2^-7.875 to 2^7.875 (2x smaller)
+//   xlns12  sign<<11 | 11-bit log with 7 fraction bits (the xlns16 steps),
+//           biased by 0x400: magnitudes 2^-7.99 to 2^7.99, two values per
+//           3-byte xlns12x2, the even-indexed one in the low 12 bits (1.33x)
+// A zero log field is zero.  Converting from xlns16 rounds the log to nearest,
+// flushes magnitudes below the range to zero and saturates those above it.
+// The dot products and GEMVs unpack and multiply xlns16_qk values at a time
+// (SIMD with -mavx2) and add as xlns16_vec_dot does, so their results are those
+// of xlns16_vec_dot on the weights converted back to xlns16.  A row of a matrix
+// is cols xlns8 values or (cols + 1)/2 xlns12x2 pairs.
+// With xlns8_table defined, xlns8_add and xlns8_mul look up full 256x256 tables
+// (64 Kbyte each) built at startup from xlns16_add and xlns16_mul.
+
+typedef unsigned char xlns8;
+
+typedef struct {
+    unsigned char b[3];                         // two 12-bit codes, little-endian
+} xlns12x2;
+
+inline xlns16 xlns82xlns16(xlns8 c) {
+    if ((c & 0x7f) == 0)
+        return xlns16_zero;
+    return (xlns16)(((c & 0x80) << 8) | (((c & 0x7f) << 4) + 0x3c00));
+}
+
+inline xlns8 xlns162xlns8(xlns16 x) {
+    int a = (int)xlns16_abs(x) + 8 - 0x3c00;
+    if (a < 16)
+        return 0;
+    return (xlns8)((xlns16_sign(x) >> 8) | ((a >> 4) < 0x7f ? (a >> 4) : 0x7f));
+}
+
+inline xlns16 xlns122xlns16(unsigned c) {
+    if ((c & 0x7ff) == 0)
+        return xlns16_zero;
+    return (xlns16)(((c & 0x800) << 4) | ((c & 0x7ff) + 0x3c00));
+}
+
+inline unsigned xlns162xlns12(xlns16 x) {
+    int a = (int)xlns16_abs(x) - 0x3c00;
+    if (a <= 0)
+        return 0;
+    return ((xlns16_sign(x) != 0) << 11) | (a < 0x7ff ? a : 0x7ff);
+}
+
+// 12-bit code i of a packed array
+inline unsigned xlns12_get(const xlns12x2 *p, size_t i) {
+    const unsigned char *b = p[i >> 1].b;
+    unsigned v = b[0] | (b[1] << 8) | (b[2] << 16);
+    return (v >> (12*(i & 1))) & 0xfff;
+}
+
+inline void xlns12_set(xlns12x2 *p, size_t i, unsigned c) {
+    unsigned char *b = p[i >> 1].b;
+    unsigned v = (b[0] | (b[1] << 8) | (b[2] << 16)) & ~(0xfffu << (12*(i & 1)));
+    v |= (c & 0xfff) << (12*(i & 1));
+    b[0] = (unsigned char)v;
+    b[1] = (unsigned char)(v >> 8);
+    b[2] = (unsigned char)(v >> 16);
+}
+
+// element i of packed storage as xlns16, and the storage holding it
+inline xlns16 xlns16_narrow_get(const xlns8 *w, size_t i) {
+    return xlns82xlns16(w[i]);
+}
+
+inline xlns16 xlns16_narrow_get(const xlns12x2 *w, size_t i) {
+    return xlns122xlns16(xlns12_get(w, i));
+}
+
+inline const xlns8 *xlns16_narrow_at(const xlns8 *w, size_t i) {
+    return w + i;
+}
+
+inline const xlns12x2 *xlns16_narrow_at(const xlns12x2 *w, size_t i) {
+    return w + i/2;
+}
+
+// elements from one matrix row to the next (rows of xlns12 start on a pair)
+inline size_t xlns16_narrow_stride(const xlns8 *, size_t cols) {
+    return cols;
+}
+
+inline size_t xlns16_narrow_stride(const xlns12x2 *, size_t cols) {
+    return cols + (cols & 1);
+}
+
+#ifdef __AVX2__
+// 16 lanes of xlns82xlns16 for the codes in the low bytes of v
+inline __m256i xlns8_unpack_avx2(__m256i v) {
+    __m256i c = _mm256_and_si256(v, _mm256_set1_epi16(0x7f));
+    __m256i a = _mm256_add_epi16(_mm256_slli_epi16(c, 4), _mm256_set1_epi16(0x3c00));
+    __m256i s = _mm256_slli_epi16(_mm256_srli_epi16(v, 7), 15);
+    return _mm256_andnot_si256(_mm256_cmpeq_epi16(c, _mm256_setzero_si256()), _mm256_or_si256(a, s));
+}
+
+// 16 lanes of xlns122xlns16 for the 16 codes in the 24 bytes at p (reads no further)
+inline __m256i xlns12_unpack_avx2(const unsigned char *p) {
+    __m256i v = _mm256_set_m128i(_mm_loadu_si128((const __m128i *)(p + 8)), _mm_loadu_si128((const __m128i *)p));
+    v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+                                                4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15));
+    v = _mm256_blend_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0xfff)), _mm256_srli_epi16(v, 4), 0xaa);
+    __m256i c = _mm256_and_si256(v, _mm256_set1_epi16(0x7ff));
+    __m256i a = _mm256_add_epi16(c, _mm256_set1_epi16(0x3c00));
+    __m256i s = _mm256_slli_epi16(_mm256_srli_epi16(v, 11), 15);
+    return _mm256_andnot_si256(_mm256_cmpeq_epi16(c, _mm256_setzero_si256()), _mm256_or_si256(a, s));
+}
+
+// xlns16_qk values from i (a multiple of xlns16_qk) as two vectors of xlns16
+inline void xlns16_narrow_load_avx2(const xlns8 *w, size_t i, __m256i &lo, __m256i &hi) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(w + i));
+    lo = xlns8_unpack_avx2(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+    hi = xlns8_unpack_avx2(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+}
+
+inline void xlns16_narrow_load_avx2(const xlns12x2 *w, size_t i, __m256i &lo, __m256i &hi) {
+    lo = xlns12_unpack_avx2(w[i/2].b);
+    hi = xlns12_unpack_avx2(w[i/2 + 8].b);
+}
+#endif
+
+// m <= xlns16_qk values from i (a multiple of xlns16_qk) to xlns16
+template<class T>
+inline void xlns16_narrow_unpack(const T *w, size_t i, size_t m, xlns16 *out) {
+    #ifdef __AVX2__
+    if (m == xlns16_qk) {
+        __m256i lo, hi;
+        xlns16_narrow_load_avx2(w, i, lo, hi);
+        _mm256_storeu_si256((__m256i *)out, lo);
+        _mm256_storeu_si256((__m256i *)(out+16), hi);
+        return;
+    }
+    #endif
+    for (size_t k = 0; k < m; k++)
+        out[k] = xlns16_narrow_get(w, i + k);
+}
+
+// prod[k] = xlns16_mul(value i+k, x[k]) for m <= xlns16_qk values from i
+template<class T>
+inline void xlns16_narrow_mul(const T *w, size_t i, size_t m, const xlns16 *x, xlns16 *prod) {
+    #ifdef __AVX2__
+    if (m == xlns16_qk) {
+        __m256i lo, hi;
+        xlns16_narrow_load_avx2(w, i, lo, hi);
+        _mm256_storeu_si256((__m256i *)prod, xlns16_mul_avx2(lo, _mm256_loadu_si256((const __m256i *)x)));
+        _mm256_storeu_si256((__m256i *)(prod+16), xlns16_mul_avx2(hi, _mm256_loadu_si256((const __m256i *)(x+16))));
+        return;
+    }
+    #endif
+    for (size_t k = 0; k < m; k++)
+        prod[k] = xlns16_mul(xlns16_narrow_get(w, i + k), x[k]);
+}
+
+// dot product of n packed weights with x, as xlns16_vec_dot
+template<class T>
+inline xlns16 xlns16_vec_dot_narrow(const T *w, const xlns16 *x, size_t n) {
+    if (n == 0) return xlns16_zero;
+    xlns16 prod[xlns16_qk];
+    xlns16 sum = xlns16_zero;
+    for (size_t i = 0; i < n; i += xlns16_qk) {
+        size_t m = (n - i < xlns16_qk) ? n - i : xlns16_qk;
+        xlns16_prefetch(xlns16_narrow_at(w, i + xlns16_prefetchdist));
+        xlns16_narrow_mul(w, i, m, x+i, prod);
+        size_t k = 0;
+        if (i == 0) sum = prod[k++];
+        for (; k < m; k++)
+            sum = xlns16_add(sum, prod[k]);
+    }
+    return sum;
+}
+
+template<class T>
+inline void xlns16_gemv_narrow(const T *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    size_t ld = xlns16_narrow_stride(W, cols);
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns16_vec_dot_narrow(xlns16_narrow_at(W, r*ld), x, cols));
+}
+
+// Convert n xlns16 values to packed storage and back
+inline void xlns16_batch_to_xlns8(const xlns16 *src, xlns8 *dst, size_t n) {
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        dst[i] = xlns162xlns8(src[i]));
+}
+
+inline void xlns16_batch_to_xlns12(const xlns16 *src, xlns12x2 *dst, size_t n) {
+    xlns_parallel_chunks(n, (n + 1)/2, for (size_t j = i0; j < i1; j++) {
+        unsigned v = xlns162xlns12(src[2*j]) | ((2*j + 1 < n) ? xlns162xlns12(src[2*j + 1]) << 12 : 0);
+        dst[j].b[0] = (unsigned char)v;
+        dst[j].b[1] = (unsigned char)(v >> 8);
+        dst[j].b[2] = (unsigned char)(v >> 16);
+    });
+}
+
+template<class T>
+inline void xlns16_batch_from_narrow(const T *src, xlns16 *dst, size_t n) {
+    xlns_parallel_chunks(n, (n + xlns16_qk - 1)/xlns16_qk, for (size_t b = i0; b < i1; b++)
+        xlns16_narrow_unpack(src, b*xlns16_qk, (n - b*xlns16_qk < xlns16_qk) ? n - b*xlns16_qk : xlns16_qk,
+                             dst + b*xlns16_qk));
+}
+
+inline void xlns16_batch_from_xlns8(const xlns8 *src, xlns16 *dst, size_t n) {
+    xlns16_batch_from_narrow(src, dst, n);
+}
+
+inline void xlns16_batch_from_xlns12(const xlns12x2 *src, xlns16 *dst, size_t n) {
+    xlns16_batch_from_narrow(src, dst, n);
+}
+
+// result = Σ(w[i] * x[i]) with packed w
+inline xlns16 xlns16_vec_dot_xlns8(const xlns8 *w, const xlns16 *x, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_xlns8");
+    return xlns16_vec_dot_narrow(w, x, n);
+}
+
+inline xlns16 xlns16_vec_dot_xlns12(const xlns12x2 *w, const xlns16 *x, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_xlns12");
+    return xlns16_vec_dot_narrow(w, x, n);
+}
+
+// y = W x with W packed row by row
+inline void xlns16_gemv_xlns8(const xlns8 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_xlns8");
+    xlns16_gemv_narrow(W, x, y, rows, cols);
+}
+
+inline void xlns16_gemv_xlns12(const xlns12x2 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_xlns12");
+    xlns16_gemv_narrow(W, x, y, rows, cols);
+}
+
+// xlns8 arithmetic: the xlns16 result rounded back to xlns8
+#ifdef xlns8_table
+static xlns8 xlns8_addtbl[256*256], xlns8_multbl[256*256];
+
+static struct xlns8_tables {
+    xlns8_tables() {
+        for (unsigned a = 0; a < 256; a++)
+            for (unsigned b = 0; b < 256; b++) {
+                xlns8_addtbl[a << 8 | b] = xlns162xlns8(xlns16_add(xlns82xlns16(a), xlns82xlns16(b)));
+                xlns8_multbl[a << 8 | b] = xlns162xlns8(xlns16_mul(xlns82xlns16(a), xlns82xlns16(b)));
+            }
+    }
+} xlns8_tables_init;
+#endif
+
+inline xlns8 xlns8_add(xlns8 a, xlns8 b) {
+    #ifdef xlns8_table
+    return xlns8_addtbl[a << 8 | b];
+    #else
+    return xlns162xlns8(xlns16_add(xlns82xlns16(a), xlns82xlns16(b)));
+    #endif
+}
+
+inline xlns8 xlns8_mul(xlns8 a, xlns8 b) {
+    #ifdef xlns8_table
+    return xlns8_multbl[a << 8 | b];
+    #else
+    return xlns162xlns8(xlns16_mul(xlns82xlns16(a), xlns82xlns16(b)));
+    #endif
+}
+
 // Maximum element in array
 inline xlns16 xlns16_max_array(const xlns16 *a, size_t n) {
     if (n == 0) return xlns16_zero;
@@ -502,6 +2011,7 @@ inline xlns16 xlns16_relu(xlns16 x) {
 
 // Batch ReLU
 inline void xlns16_batch_relu(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_relu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_relu(a[i]);
     }
@@ -523,6 +2033,7 @@ inline xlns16 xlns16_sigmoid(xlns16 x) {
 
 // Batch sigmoid
 inline void xlns16_batch_sigmoid(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_sigmoid(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_sigmoid(a[i]);
     }
@@ -535,6 +2046,7 @@ inline xlns16 xlns16_silu(xlns16 x) {
 
 // Batch SiLU
 inline void xlns16_batch_silu(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_silu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_silu(a[i]);
     }
@@ -582,6 +2094,7 @@ inline xlns16 xlns16_tanh(xlns16 x) {
 
 // Batch tanh
 inline void xlns16_batch_tanh(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_tanh(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_tanh(a[i]);
     }
@@ -600,6 +2113,7 @@ inline xlns16 xlns16_gelu(xlns16 x) {
 
 // Batch GELU
 inline void xlns16_batch_gelu(const xlns16 *a, xlns16 *c, size_t n) {
+    xlns_parallel_split(n, xlns16_batch_gelu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns16_gelu(a[i]);
     }
@@ -633,6 +2147,7 @@ inline xlns16 xlns16_pow(xlns16 base, xlns16 exponent) {
 // c may alias a (in-place): every pass only reads index i before writing
 // index i, and the sum pass runs after all per-element writes complete.
 inline void xlns16_softmax(const xlns16 *a, xlns16 *c, size_t n, xlns16 scale = xlns16_one) {
+    xlns16_zprof_kernel("xlns16_softmax");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -641,11 +2156,11 @@ inline void xlns16_softmax(const xlns16 *a, xlns16 *c, size_t n, xlns16 scale =
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
 }
 
 // Masked variant of xlns16_softmax. mask[i] is a pre-converted xlns16 value:
@@ -654,6 +2169,7 @@ inline void xlns16_softmax(const xlns16 *a, xlns16 *c, size_t n, xlns16 scale =
 // that position, anything else is treated as an additive bias (e.g. ALiBi).
 inline void xlns16_softmax_masked(const xlns16 *a, const xlns16 *mask, xlns16 *c,
                                    size_t n, xlns16 scale = xlns16_one) {
+    xlns16_zprof_kernel("xlns16_softmax_masked");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -666,35 +2182,365 @@ inline void xlns16_softmax_masked(const xlns16 *a, const xlns16 *mask, xlns16 *c
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
 }
 
 
+// Sum of squared differences from mean (starting from zero), for layernorm
+inline xlns16 xlns16_sum_sqdiff(const xlns16 *x, xlns16 mean, size_t n) {
+    auto partial = [=](size_t i0, size_t i1) {
+        xlns16 var = xlns16_zero;
+        for (size_t i = i0; i < i1; i++) {
+            xlns16 diff = xlns16_sub(x[i], mean);
+            var = xlns16_add(var, xlns16_mul(diff, diff));
+        }
+        return var;
+    };
+    xlns_parallel_sum(n, xlns16_tree_reduce(n, partial, xlns16_add_fn));
+    return partial(0, n);
+}
+
 // Layer normalization: (x - mean) / sqrt(var + eps) * gamma + beta
 inline void xlns16_layernorm(const xlns16 *x, xlns16 *out,
                        const xlns16 *gamma, const xlns16 *beta,
                        size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_layernorm");
+    xlns16 nn = fp2xlns16((float)n);
     // compute mean
     xlns16 mean = xlns16_sum(x, n);
-    mean = xlns16_div(mean, fp2xlns16((float)n));
+    mean = xlns16_div(mean, nn);
     // compute variance
-    xlns16 var = xlns16_zero;
-    for (size_t i = 0; i < n; i++) {
-        xlns16 diff = xlns16_sub(x[i], mean);
-        var = xlns16_add(var, xlns16_mul(diff, diff));
-    }
-    var = xlns16_div(var, fp2xlns16((float)n));
+    xlns16 var = xlns16_sum_sqdiff(x, mean, n);
+    var = xlns16_div(var, nn);
     // normalize
     xlns16 inv_std = fp2xlns16(1.0f / sqrt(xlns162fp(var) + eps));
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
         out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
         if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
         if (beta)  out[i] = xlns16_add(out[i], beta[i]);
+    });
+}
+
+// RMS normalization (as in LLaMA): x / sqrt(mean(x^2) + eps) * gamma (gamma may
+// be NULL).  The sum of squares is xlns16_vec_dot_tree(x, x, n), as squaring is
+// a shift of the log (the fixed tree, split over the pool for large n with the
+// same bits on any number of threads), and the reciprocal square root is taken
+// in LNS.
+inline void xlns16_rmsnorm(const xlns16 *x, xlns16 *out, const xlns16 *gamma,
+                           size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_rmsnorm");
+    if (n == 0) return;
+    xlns16 ms = xlns16_div(xlns16_vec_dot_tree(x, x, n), fp2xlns16((float)n));
+    xlns16 inv_rms = xlns16_div(xlns16_one, xlns16_sqrt(xlns16_add(ms, fp2xlns16(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(x[i], inv_rms);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+    });
+}
+
+// Shifted sums for the one-pass layernorms: s1 = sum of d = x - k, s2 = sum of d^2
+struct xlns16_moments {
+    xlns16 s1, s2;
+};
+
+inline xlns16_moments xlns16_moments_add(xlns16_moments a, xlns16_moments b) {
+    xlns16_moments m = { xlns16_add(a.s1, b.s1), xlns16_add(a.s2, b.s2) };
+    return m;
+}
+
+// the shifted sums over [i0, i1), in order (one chunk of the fixed tree)
+inline xlns16_moments xlns16_moments_range(const xlns16 *x, xlns16 k, size_t i0, size_t i1) {
+    xlns16_moments m = { xlns16_zero, xlns16_zero };
+    for (size_t i = i0; i < i1; i++) {
+        xlns16 d = xlns16_sub(x[i], k);
+        m.s1 = xlns16_add(m.s1, d);
+        m.s2 = xlns16_add(m.s2, xlns16_mul(d, d));
     }
+    return m;
+}
+
+// mean and variance from the shifted sums, then the normalizing pass over x
+inline void xlns16_layernorm_moments(const xlns16 *x, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps, xlns16 k, xlns16_moments s) {
+    xlns16 nn = fp2xlns16((float)n);
+    xlns16 dm = xlns16_div(s.s1, nn);                   // mean - k
+    xlns16 mean = xlns16_add(k, dm);
+    xlns16 var = xlns16_sub(xlns16_div(s.s2, nn), xlns16_mul(dm, dm));
+    if (xlns16_is_negative(var)) var = xlns16_zero;     // rounding
+    xlns16 inv_std = xlns16_div(xlns16_one, xlns16_sqrt(xlns16_add(var, fp2xlns16(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+        if (beta)  out[i] = xlns16_add(out[i], beta[i]);
+    });
+}
+
+// Layer normalization as xlns16_layernorm, with the mean and variance from a
+// single read of x: the sums of d = x - k and d^2 for a shift k near the mean
+// (that of the first 16 elements), so that var = sum(d^2)/n - (sum(d)/n)^2
+// does not cancel away when the mean is large against the spread (as Welford's
+// update would, without its division per element); then the normalizing pass.
+// The sums are taken over the fixed tree of xlns16_sum_tree (split over the
+// pool for large n, with the same bits on any number of threads).
+inline void xlns16_layernorm_onepass(const xlns16 *x, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_layernorm_onepass");
+    if (n == 0) return;
+    size_t m = (n < 16) ? n : 16;
+    xlns16 k = xlns16_div(xlns16_sum(x, m), fp2xlns16((float)m));
+    xlns16_moments s = xlns16_tree_reduce_of<xlns16_moments>(n, [=](size_t i0, size_t i1) {
+        return xlns16_moments_range(x, k, i0, i1);
+    }, xlns16_moments_add);
+    xlns16_layernorm_moments(x, out, gamma, beta, n, eps, k, s);
+}
+
+// Residual add fused with the norm that follows it in a transformer block:
+// xr = x + r (the updated residual stream; xr may be x) and out = the norm
+// of xr.  Each chunk of the fixed tree is added with xlns16_batch_add and its
+// statistics taken while it is still in cache, so that xr is read back only by
+// the normalizing pass (instead of xlns16_batch_add and three more reads).
+// These give the same bits as xlns16_batch_add and then xlns16_rmsnorm or
+// xlns16_layernorm_onepass, on any number of threads.
+inline void xlns16_add_rmsnorm(const xlns16 *x, const xlns16 *r, xlns16 *xr, xlns16 *out,
+                               const xlns16 *gamma, size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_add_rmsnorm");
+    if (n == 0) return;
+    xlns16 ss = xlns16_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns16_batch_add(x+i0, r+i0, xr+i0, i1-i0);
+        xlns16 sum = xlns16_mul(xr[i0], xr[i0]);
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns16_add(sum, xlns16_mul(xr[i], xr[i]));
+        return sum;
+    }, xlns16_add_fn);
+    xlns16 ms = xlns16_div(ss, fp2xlns16((float)n));
+    xlns16 inv_rms = xlns16_div(xlns16_one, xlns16_sqrt(xlns16_add(ms, fp2xlns16(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xr[i], inv_rms);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+    });
+}
+
+inline void xlns16_add_layernorm(const xlns16 *x, const xlns16 *r, xlns16 *xr, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_add_layernorm");
+    if (n == 0) return;
+    size_t m = (n < 16) ? n : 16;                       // the shift comes first
+    xlns16_batch_add(x, r, xr, m);
+    xlns16 k = xlns16_div(xlns16_sum(xr, m), fp2xlns16((float)m));
+    xlns16_moments s = xlns16_tree_reduce_of<xlns16_moments>(n, [=](size_t i0, size_t i1) {
+        size_t j = (i0 < m) ? m : i0;
+        if (j < i1) xlns16_batch_add(x+j, r+j, xr+j, i1-j);
+        return xlns16_moments_range(xr, k, i0, i1);
+    }, xlns16_moments_add);
+    xlns16_layernorm_moments(xr, out, gamma, beta, n, eps, k, s);
+}
+
+// Row-wise kernels over 2-D tensors: rows rows of n elements, row r at a + r*lda
+// (lda >= n), split over the pool by rows (each row as the 1-D kernel would do it
+// alone, so the bits do not depend on the thread count).
+//
+// Implicit masks for the row-wise softmax, so that no mask array is ever built:
+// row r holds the scores of the query at position pos = offset + r % rows_per_head
+// of head r / rows_per_head (rows_per_head 0: all rows are one head), and column j
+// is the key at position j.  causal keeps j <= pos, a window of w also keeps only
+// j > pos - w (sliding-window attention), and heads != 0 adds the ALiBi bias
+// -slope*|pos - j|, with slope 2^(-8(h+1)/heads) for head h (the slopes of ALiBi
+// for a power-of-two number of heads), from the distances 0..n-1 converted once
+// per call into a per-thread scratch.
+#ifndef xlns_mask_included
+#define xlns_mask_included
+struct xlns_mask {
+    int causal;              // keep only j <= pos
+    size_t window;           // if not 0, keep only j > pos - window
+    size_t offset;           // position of the query of row 0 (keys already cached)
+    size_t rows_per_head;    // rows of each head; 0 if all rows are one head
+    size_t heads;            // if not 0, add the ALiBi bias for this many heads
+};
+
+// The kept columns [lo, hi) of row r (of n), with its query position and head
+inline void xlns_mask_row(const xlns_mask *m, size_t r, size_t n,
+                          size_t &lo, size_t &hi, size_t &pos, size_t &head) {
+    pos = m->offset + (m->rows_per_head ? r % m->rows_per_head : r);
+    head = m->rows_per_head ? r / m->rows_per_head : 0;
+    hi = (m->causal && pos + 1 < n) ? pos + 1 : n;
+    lo = (m->window && pos + 1 > m->window) ? pos + 1 - m->window : 0;
+    if (lo > hi) lo = hi;
+}
+#endif
+
+// ALiBi slope 2^(-8(head+1)/heads), rounded to the nearest xlns16
+inline xlns16 xlns16_alibi_slope(size_t head, size_t heads) {
+    return xlns16_logsignmask - (xlns16)((8*(head+1)*xlns16_scale + heads/2)/heads);
+}
+
+// Softmax of columns [lo, hi) of one row, as xlns16_softmax_masked with the
+// ALiBi bias of slope (xlns16_zero: none) for the query at pos; the other
+// columns get xlns16_zero.  dist[d] is fp2xlns16(d) for the distances d < n.
+// sum(p, m) adds the m exponentials.
+template <class S>
+inline void xlns16_softmax_span(const xlns16 *a, xlns16 *c, size_t n, size_t lo, size_t hi,
+                                xlns16 scale, xlns16 slope, size_t pos, const xlns16 *dist,
+                                const S &sum) {
+    xlns16 maxval = xlns16_neg_inf;
+    for (size_t i = lo; i < hi; i++) {
+        xlns16 v = a[i];
+        if (v != xlns16_neg_inf) {
+            v = xlns16_mul(v, scale);
+            if (slope != xlns16_zero && i != pos) {
+                size_t d = i < pos ? pos - i : i - pos;    // past n only if pos is
+                v = xlns16_sub(v, xlns16_mul(slope, d < n ? dist[d] : fp2xlns16((float)d)));
+            }
+        }
+        c[i] = v;
+        if (xlns16_gt(c[i], maxval)) maxval = c[i];
+    }
+    if (lo < hi) {
+        xlns_parallel_loop(hi - lo, for (size_t i = lo + i0; i < lo + i1; i++)
+            c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
+        xlns16 total = sum(c + lo, hi - lo);
+        xlns_parallel_loop(hi - lo, for (size_t i = lo + i0; i < lo + i1; i++)
+            c[i] = xlns16_div(c[i], total));
+    }
+    for (size_t i = 0; i < lo; i++) c[i] = xlns16_zero;
+    for (size_t i = hi; i < n; i++) c[i] = xlns16_zero;
+}
+
+// The rows of xlns16_softmax_rows, with the sum of the exponentials by sum
+template <class S>
+inline void xlns16_softmax_rows_sum(const xlns16 *a, size_t lda, xlns16 *c, size_t ldc,
+                                    size_t rows, size_t n, xlns16 scale,
+                                    const xlns_mask *mask, const S &sum) {
+    xlns16 *dist = NULL;
+    if (mask && mask->heads) {
+        dist = xlns16_scratch(n);
+        for (size_t d = 0; d < n; d++) dist[d] = fp2xlns16((float)d);
+    }
+    xlns_parallel_chunks(rows*n, rows, for (size_t r = i0; r < i1; r++) {
+        size_t lo = 0, hi = n, pos = 0, head = 0;
+        xlns16 slope = xlns16_zero;
+        if (mask) {
+            xlns_mask_row(mask, r, n, lo, hi, pos, head);
+            if (mask->heads) slope = xlns16_alibi_slope(head, mask->heads);
+        }
+        xlns16_softmax_span(a + r*lda, c + r*ldc, n, lo, hi, scale, slope, pos, dist, sum);
+    });
+}
+
+// Softmax of each row: c + r*ldc = softmax(scale * (a + r*lda)) over the columns
+// mask keeps (all when it is NULL), with the same bits as xlns16_softmax_masked
+// given the mask as an array from the first kept column on; masked-out columns
+// are xlns16_zero.  c may be a (ldc == lda).
+inline void xlns16_softmax_rows(const xlns16 *a, size_t lda, xlns16 *c, size_t ldc,
+                                size_t rows, size_t n, xlns16 scale = xlns16_one,
+                                const xlns_mask *mask = NULL) {
+    xlns16_zprof_kernel("xlns16_softmax_rows");
+    xlns16_softmax_rows_sum(a, lda, c, ldc, rows, n, scale, mask, xlns16_sum);
+}
+
+// Layer normalization of each row (x + r*ldx to out + r*ldo) as xlns16_layernorm,
+// with the same gamma and beta for every row
+inline void xlns16_layernorm_rows(const xlns16 *x, size_t ldx, xlns16 *out, size_t ldo,
+                                  size_t rows, size_t n, const xlns16 *gamma,
+                                  const xlns16 *beta, float eps) {
+    xlns16_zprof_kernel("xlns16_layernorm_rows");
+    xlns_parallel_chunks(rows*n, rows, for (size_t r = i0; r < i1; r++)
+        xlns16_layernorm(x + r*ldx, out + r*ldo, gamma, beta, n, eps));
+}
+
+// Rotary position embedding (RoPE)
+// Pair i of the first dims elements of a head is rotated by the angle
+// pos*theta_i, theta_i = base^(-2i/dims): (a, b) -> (a cos - b sin, a sin + b cos).
+// The pairs are (2i, 2i+1) in the interleaved layout (GPT-J, llama.cpp's
+// default) or (i, i + dims/2) in the half-split one (GPT-NeoX, HF llama).  The
+// cos and sin are computed once in double for the positions [pos0, pos0+npos)
+// and kept in LNS laid out for the layout: for each position, cs[j] is the cos of
+// the pair of element j, and sn[j] its sin with the sign of the term, so that
+// out[j] = x[j]*cs[j] + x[partner of j]*sn[j].
+
+struct xlns16_rope_cache {
+    size_t pos0, npos, dims;
+    int interleaved;
+    std::vector<xlns16> cs, sn;     // npos rows of dims
+};
+
+inline void xlns16_rope_cache_init(xlns16_rope_cache *c, size_t pos0, size_t npos, size_t dims,
+                                   int interleaved = 1, float base = 10000.0f) {
+    size_t h = dims/2;
+    c->pos0 = pos0; c->npos = npos; c->dims = 2*h; c->interleaved = interleaved;
+    c->cs.resize(npos*2*h);
+    c->sn.resize(npos*2*h);
+    for (size_t p = 0; p < npos; p++)
+        for (size_t i = 0; i < h; i++) {
+            double a = (double)(pos0 + p)*pow((double)base, -2.0*i/(2*h));
+            xlns16 co = fp2xlns16((float)cos(a)), si = fp2xlns16((float)sin(a));
+            size_t j0 = interleaved ? 2*i : i, j1 = interleaved ? 2*i+1 : i+h;
+            c->cs[p*2*h + j0] = co;
+            c->cs[p*2*h + j1] = co;
+            c->sn[p*2*h + j0] = xlns16_neg(si);
+            c->sn[p*2*h + j1] = si;
+        }
+}
+
+// c[j] = a[j^swap]*b[j] for j < n (n even): the products of one rotation
+inline void xlns16_rope_mul(const xlns16 *a, const xlns16 *b, xlns16 *c, size_t n, size_t swap) {
+    size_t j = 0;
+    #ifdef __AVX2__
+    const __m256i pairs = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                           2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    for (; j + 16 <= n; j += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a+j));
+        if (swap) x = _mm256_shuffle_epi8(x, pairs);
+        _mm256_storeu_si256((__m256i *)(c+j), xlns16_mul_avx2(x, _mm256_loadu_si256((const __m256i *)(b+j))));
+    }
+    #endif
+    for (; j < n; j++)
+        c[j] = xlns16_mul(a[j^swap], b[j]);
+}
+
+// RoPE over tokens rows of heads heads of hd elements (x + (t*heads + h)*hd),
+// token t at position pos + t, which the cache must hold; elements dims..hd-1
+// of each head are copied.  out may be x.  The products are in SIMD, the sums
+// too where there is xlns16_add_avx2, and the (token, head) rows are split over
+// the pool.
+inline void xlns16_rope(const xlns16 *x, xlns16 *out, size_t tokens, size_t heads, size_t hd,
+                        size_t pos, const xlns16_rope_cache *c) {
+    xlns16_zprof_kernel("xlns16_rope");
+    size_t dims = c->dims, h = dims/2;
+    xlns_parallel_chunks(tokens*heads*hd, tokens*heads, {
+        std::vector<xlns16> p(dims), q(dims);
+        for (size_t r = i0; r < i1; r++) {
+            const xlns16 *xr = x + r*hd;
+            const xlns16 *cs = c->cs.data() + (pos + r/heads - c->pos0)*dims;
+            const xlns16 *sn = c->sn.data() + (pos + r/heads - c->pos0)*dims;
+            xlns16 *o = out + r*hd;
+            xlns16_rope_mul(xr, cs, p.data(), dims, 0);
+            if (c->interleaved)
+                xlns16_rope_mul(xr, sn, q.data(), dims, 1);
+            else {
+                xlns16_rope_mul(xr + h, sn, q.data(), h, 0);
+                xlns16_rope_mul(xr, sn + h, q.data() + h, h, 0);
+            }
+            size_t j = 0;
+            #ifdef xlns16_add_simd
+            for (; j + 16 <= dims; j += 16)
+                _mm256_storeu_si256((__m256i *)(o+j),
+                                    xlns16_add_avx2(_mm256_loadu_si256((const __m256i *)(p.data()+j)),
+                                                    _mm256_loadu_si256((const __m256i *)(q.data()+j))));
+            #endif
+            for (; j < dims; j++)
+                o[j] = xlns16_add(p[j], q[j]);
+            if (o != xr)
+                for (size_t j = dims; j < hd; j++)
+                    o[j] = xr[j];
+        }
+    });
 }
 
 /*END OF PORTABLE CODE THAT DEPENDS ON <math.h>*/
@@ -787,34 +2633,144 @@ float xlns16_2float(xlns16_float y) {
 	return xlns162fp(y.x);
 }
 
-#define xlns16_cachesize 1024
-xlns16 xlns16_cachecontent[xlns16_cachesize];
-float xlns16_cachetag[xlns16_cachesize];
-long xlns16_misses=0;
-long xlns16_hits=0;
-#define xlns16_cacheon 0// off for table
+// float -> xlns16 conversion cache used by xlns16_float (float2xlns16_)
+//   each thread has its own 2^xlns16_cachesetbits x xlns16_cacheways set-associative cache,
+//   so there is no sharing between threads; the set comes from a multiplicative
+//   hash of all 32 bits of the float, and a miss goes in front of its set,
+//   pushing out the oldest way.  the zero-filled cache is valid (bits 0 = 0.0).
+//   xlns16_cacheon turns it on or off at run time (set it before starting threads);
+//   define xlns16_nocache to compile it out.  hits/misses are kept per thread and
+//   summed by xlns16_cache_stats() since the last xlns16_cache_reset_stats().
+
+#ifndef xlns16_cachesetbits
+#define xlns16_cachesetbits  8
+#endif
+#define xlns16_cachesets     (1<<xlns16_cachesetbits)
+#ifndef xlns16_cacheways
+#define xlns16_cacheways   4
+#endif
+
+#ifdef xlns16_table
+int xlns16_cacheon = 0;        // off for table: fp2xlns16 is already one lookup
+#elif !defined(xlns16_nocache)
+int xlns16_cacheon = 1;
+#else
+int xlns16_cacheon = 0;
+#endif
+
+struct xlns16_cachestats {
+    unsigned long long hits, misses;
+};
+
+#ifndef xlns16_nocache
+#include <atomic>
+#include <mutex>
+#include <string.h>
+
+struct xlns16_cacheblock {
+    unsigned int tag[xlns16_cachesets][xlns16_cacheways];     // float bits
+    xlns16 content[xlns16_cachesets][xlns16_cacheways];
+    std::atomic<unsigned long long> hits, misses;
+    xlns16_cacheblock *next;
+    xlns16_cacheblock();
+    ~xlns16_cacheblock();
+};
+
+std::mutex xlns16_cache_lock;
+xlns16_cacheblock *xlns16_cache_list = NULL;
+xlns16_cachestats xlns16_cache_retired = {0, 0};   // from threads that have exited
+xlns16_cachestats xlns16_cache_base = {0, 0};      // totals at the last reset
+thread_local xlns16_cacheblock xlns16_cache_mine;
+
+xlns16_cacheblock::xlns16_cacheblock() : hits(0), misses(0)
+{
+    memset(tag, 0, sizeof(tag));
+    memset(content, 0, sizeof(content));      // fp2xlns16(0.0) == xlns16_zero == 0
+    std::lock_guard<std::mutex> g(xlns16_cache_lock);
+    next = xlns16_cache_list;
+    xlns16_cache_list = this;
+}
+
+xlns16_cacheblock::~xlns16_cacheblock()
+{
+    std::lock_guard<std::mutex> g(xlns16_cache_lock);
+    xlns16_cache_retired.hits += hits.load(std::memory_order_relaxed);
+    xlns16_cache_retired.misses += misses.load(std::memory_order_relaxed);
+    xlns16_cacheblock **p = &xlns16_cache_list;
+    while (*p != this)
+        p = &(*p)->next;
+    *p = next;
+}
+
+inline xlns16_cachestats xlns16_cache_total()   //caller holds xlns16_cache_lock
+{
+    xlns16_cachestats t = xlns16_cache_retired;
+    for (xlns16_cacheblock *b = xlns16_cache_list; b != NULL; b = b->next)
+    {
+        t.hits += b->hits.load(std::memory_order_relaxed);
+        t.misses += b->misses.load(std::memory_order_relaxed);
+    }
+    return t;
+}
+
+inline xlns16_cachestats xlns16_cache_stats()
+{
+    std::lock_guard<std::mutex> g(xlns16_cache_lock);
+    xlns16_cachestats t = xlns16_cache_total();
+    t.hits -= xlns16_cache_base.hits;
+    t.misses -= xlns16_cache_base.misses;
+    return t;
+}
+
+inline void xlns16_cache_reset_stats()
+{
+    std::lock_guard<std::mutex> g(xlns16_cache_lock);
+    xlns16_cache_base = xlns16_cache_total();
+}
+
+inline void xlns16_cache_flush()   //this thread's cache only
+{
+    memset(xlns16_cache_mine.tag, 0, sizeof(xlns16_cache_mine.tag));
+    memset(xlns16_cache_mine.content, 0, sizeof(xlns16_cache_mine.content));
+}
+
+inline xlns16 xlns16_cached_cvt(float y)
+{
+    unsigned int bits;
+    memcpy(&bits, &y, sizeof(bits));
+    if (!xlns16_cacheon)
+        return fp2xlns16(y);
+    xlns16_cacheblock &c = xlns16_cache_mine;
+    unsigned int set = (bits * 0x9e3779b1u) >> (32-xlns16_cachesetbits);
+    int hit = -1;
+    for (int w = 0; w < xlns16_cacheways; w++)   // no early exit: which way hits is unpredictable
+        hit = (c.tag[set][w] == bits) ? w : hit;
+    if (hit >= 0)
+    {
+        c.hits.store(c.hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return c.content[set][hit];
+    }
+    xlns16 r = fp2xlns16(y);
+    for (int w = xlns16_cacheways-1; w > 0; w--)
+    {
+        c.tag[set][w] = c.tag[set][w-1];
+        c.content[set][w] = c.content[set][w-1];
+    }
+    c.tag[set][0] = bits;
+    c.content[set][0] = r;
+    c.misses.store(c.misses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return r;
+}
+#else
+inline xlns16_cachestats xlns16_cache_stats() { xlns16_cachestats t = {0, 0}; return t; }
+inline void xlns16_cache_reset_stats() {}
+inline void xlns16_cache_flush() {}
+inline xlns16 xlns16_cached_cvt(float y) { return fp2xlns16(y); }
+#endif
 
 xlns16_float float2xlns16_(float y) {
 	xlns16_float z;
-	unsigned char * fpbyte;
-	int addr;
-	fpbyte=(unsigned char *)(&y);
-	addr = (fpbyte[2])^(fpbyte[3]<<2);
-	if ((xlns16_cachetag[addr] ==  y)&&xlns16_cacheon)
-	{
-//	  printf("hit  %f  %02x %02x %02x %02x addr=%d\n",y, fpbyte[0],fpbyte[1],fpbyte[2],fpbyte[3],addr);
-	  z.x = xlns16_cachecontent[addr];
-	  xlns16_hits++;
-	}
-	else
-	{
-//	  printf("miss %f  %02x %02x %02x %02x addr=%d\n",y, fpbyte[0],fpbyte[1],fpbyte[2],fpbyte[3],addr);
-	  z.x = fp2xlns16(y);
-	  xlns16_cachecontent[addr] = z.x;
-	  xlns16_cachetag[addr] = y;
-	  xlns16_misses++;
-	}
-//	getchar();
+	z.x = xlns16_cached_cvt(y);
 	return z;
 }
 
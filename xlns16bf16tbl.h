@@ -0,0 +1,650 @@
+const unsigned short xlns16bf16logtbl[129] = {
+0, //0
+1, //1
+3, //2
+4, //3
+6, //4
+7, //5
+8, //6
+10, //7
+11, //8
+13, //9
+14, //10
+15, //11
+17, //12
+18, //13
+19, //14
+20, //15
+22, //16
+23, //17
+24, //18
+26, //19
+27, //20
+28, //21
+29, //22
+31, //23
+32, //24
+33, //25
+34, //26
+35, //27
+37, //28
+38, //29
+39, //30
+40, //31
+41, //32
+42, //33
+44, //34
+45, //35
+46, //36
+47, //37
+48, //38
+49, //39
+50, //40
+51, //41
+52, //42
+53, //43
+55, //44
+56, //45
+57, //46
+58, //47
+59, //48
+60, //49
+61, //50
+62, //51
+63, //52
+64, //53
+65, //54
+66, //55
+67, //56
+68, //57
+69, //58
+70, //59
+71, //60
+72, //61
+73, //62
+74, //63
+75, //64
+76, //65
+77, //66
+78, //67
+79, //68
+80, //69
+81, //70
+81, //71
+82, //72
+83, //73
+84, //74
+85, //75
+86, //76
+87, //77
+88, //78
+89, //79
+90, //80
+91, //81
+91, //82
+92, //83
+93, //84
+94, //85
+95, //86
+96, //87
+97, //88
+97, //89
+98, //90
+99, //91
+100, //92
+101, //93
+102, //94
+103, //95
+103, //96
+104, //97
+105, //98
+106, //99
+107, //100
+107, //101
+108, //102
+109, //103
+110, //104
+111, //105
+111, //106
+112, //107
+113, //108
+114, //109
+115, //110
+115, //111
+116, //112
+117, //113
+118, //114
+118, //115
+119, //116
+120, //117
+121, //118
+121, //119
+122, //120
+123, //121
+124, //122
+124, //123
+125, //124
+126, //125
+127, //126
+127, //127
+128  //pad
+};
+const unsigned short xlns16bf16subtbl[128] = {
+0, //0
+0, //1
+0, //2
+0, //3
+0, //4
+0, //5
+0, //6
+0, //7
+0, //8
+0, //9
+0, //10
+0, //11
+0, //12
+0, //13
+0, //14
+0, //15
+0, //16
+0, //17
+0, //18
+0, //19
+0, //20
+0, //21
+0, //22
+0, //23
+0, //24
+0, //25
+0, //26
+0, //27
+0, //28
+0, //29
+0, //30
+0, //31
+0, //32
+6, //33
+11, //34
+17, //35
+22, //36
+27, //37
+32, //38
+37, //39
+41, //40
+46, //41
+50, //42
+55, //43
+59, //44
+63, //45
+67, //46
+71, //47
+75, //48
+79, //49
+82, //50
+86, //51
+90, //52
+93, //53
+97, //54
+100, //55
+103, //56
+107, //57
+110, //58
+113, //59
+116, //60
+119, //61
+122, //62
+125, //63
+128, //64
+131, //65
+134, //66
+136, //67
+139, //68
+142, //69
+145, //70
+147, //71
+150, //72
+152, //73
+155, //74
+157, //75
+160, //76
+162, //77
+165, //78
+167, //79
+169, //80
+172, //81
+174, //82
+176, //83
+178, //84
+180, //85
+183, //86
+185, //87
+187, //88
+189, //89
+191, //90
+193, //91
+195, //92
+197, //93
+199, //94
+201, //95
+203, //96
+205, //97
+207, //98
+209, //99
+210, //100
+212, //101
+214, //102
+216, //103
+218, //104
+219, //105
+221, //106
+223, //107
+225, //108
+226, //109
+228, //110
+230, //111
+231, //112
+233, //113
+235, //114
+236, //115
+238, //116
+239, //117
+241, //118
+243, //119
+244, //120
+246, //121
+247, //122
+249, //123
+250, //124
+252, //125
+253, //126
+255 //127
+};
+const unsigned short xlns16bf16exptbl[129] = {
+0, //0
+1, //1
+1, //2
+2, //3
+3, //4
+4, //5
+4, //6
+5, //7
+6, //8
+6, //9
+7, //10
+8, //11
+9, //12
+9, //13
+10, //14
+11, //15
+12, //16
+12, //17
+13, //18
+14, //19
+15, //20
+15, //21
+16, //22
+17, //23
+18, //24
+19, //25
+19, //26
+20, //27
+21, //28
+22, //29
+23, //30
+23, //31
+24, //32
+25, //33
+26, //34
+27, //35
+28, //36
+28, //37
+29, //38
+30, //39
+31, //40
+32, //41
+33, //42
+34, //43
+34, //44
+35, //45
+36, //46
+37, //47
+38, //48
+39, //49
+40, //50
+41, //51
+42, //52
+43, //53
+43, //54
+44, //55
+45, //56
+46, //57
+47, //58
+48, //59
+49, //60
+50, //61
+51, //62
+52, //63
+53, //64
+54, //65
+55, //66
+56, //67
+57, //68
+58, //69
+59, //70
+60, //71
+61, //72
+62, //73
+63, //74
+64, //75
+65, //76
+66, //77
+67, //78
+68, //79
+69, //80
+70, //81
+72, //82
+73, //83
+74, //84
+75, //85
+76, //86
+77, //87
+78, //88
+79, //89
+80, //90
+82, //91
+83, //92
+84, //93
+85, //94
+86, //95
+87, //96
+88, //97
+90, //98
+91, //99
+92, //100
+93, //101
+94, //102
+96, //103
+97, //104
+98, //105
+99, //106
+100, //107
+102, //108
+103, //109
+104, //110
+105, //111
+107, //112
+108, //113
+109, //114
+111, //115
+112, //116
+113, //117
+115, //118
+116, //119
+117, //120
+118, //121
+120, //122
+121, //123
+123, //124
+124, //125
+125, //126
+127, //127
+128  //pad
+};
+const unsigned short xlns16bf16tinytbl[256] = {
+0, //0
+32, //1
+32, //2
+33, //3
+33, //4
+33, //5
+33, //6
+33, //7
+33, //8
+34, //9
+34, //10
+34, //11
+34, //12
+34, //13
+35, //14
+35, //15
+35, //16
+35, //17
+35, //18
+35, //19
+36, //20
+36, //21
+36, //22
+36, //23
+36, //24
+37, //25
+37, //26
+37, //27
+37, //28
+37, //29
+38, //30
+38, //31
+38, //32
+38, //33
+38, //34
+39, //35
+39, //36
+39, //37
+39, //38
+40, //39
+40, //40
+40, //41
+40, //42
+40, //43
+41, //44
+41, //45
+41, //46
+41, //47
+41, //48
+42, //49
+42, //50
+42, //51
+42, //52
+43, //53
+43, //54
+43, //55
+43, //56
+44, //57
+44, //58
+44, //59
+44, //60
+45, //61
+45, //62
+45, //63
+45, //64
+46, //65
+46, //66
+46, //67
+46, //68
+46, //69
+47, //70
+47, //71
+47, //72
+48, //73
+48, //74
+48, //75
+48, //76
+49, //77
+49, //78
+49, //79
+49, //80
+50, //81
+50, //82
+50, //83
+50, //84
+51, //85
+51, //86
+51, //87
+52, //88
+52, //89
+52, //90
+52, //91
+53, //92
+53, //93
+53, //94
+54, //95
+54, //96
+54, //97
+54, //98
+55, //99
+55, //100
+55, //101
+56, //102
+56, //103
+56, //104
+57, //105
+57, //106
+57, //107
+57, //108
+58, //109
+58, //110
+58, //111
+59, //112
+59, //113
+59, //114
+60, //115
+60, //116
+60, //117
+61, //118
+61, //119
+61, //120
+62, //121
+62, //122
+62, //123
+63, //124
+63, //125
+63, //126
+64, //127
+64, //128
+64, //129
+65, //130
+65, //131
+65, //132
+66, //133
+66, //134
+66, //135
+67, //136
+67, //137
+68, //138
+68, //139
+68, //140
+69, //141
+69, //142
+69, //143
+70, //144
+70, //145
+71, //146
+71, //147
+71, //148
+72, //149
+72, //150
+72, //151
+73, //152
+73, //153
+74, //154
+74, //155
+74, //156
+75, //157
+75, //158
+76, //159
+76, //160
+77, //161
+77, //162
+77, //163
+78, //164
+78, //165
+79, //166
+79, //167
+79, //168
+80, //169
+80, //170
+81, //171
+81, //172
+82, //173
+82, //174
+83, //175
+83, //176
+83, //177
+84, //178
+84, //179
+85, //180
+85, //181
+86, //182
+86, //183
+87, //184
+87, //185
+88, //186
+88, //187
+89, //188
+89, //189
+90, //190
+90, //191
+91, //192
+91, //193
+91, //194
+92, //195
+92, //196
+93, //197
+93, //198
+94, //199
+95, //200
+95, //201
+96, //202
+96, //203
+97, //204
+97, //205
+98, //206
+98, //207
+99, //208
+99, //209
+100, //210
+100, //211
+101, //212
+101, //213
+102, //214
+103, //215
+103, //216
+104, //217
+104, //218
+105, //219
+105, //220
+106, //221
+106, //222
+107, //223
+108, //224
+108, //225
+109, //226
+109, //227
+110, //228
+111, //229
+111, //230
+112, //231
+112, //232
+113, //233
+114, //234
+114, //235
+115, //236
+115, //237
+116, //238
+117, //239
+117, //240
+118, //241
+119, //242
+119, //243
+120, //244
+121, //245
+121, //246
+122, //247
+123, //248
+123, //249
+124, //250
+125, //251
+125, //252
+126, //253
+127, //254
+127 //255
+};
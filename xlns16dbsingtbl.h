@@ -0,0 +1,130 @@
+xlns16_signed xlns16dbsingtbl[128] = {
+0, //0 unused
+-962, //1
+-834, //2
+-758, //3
+-705, //4
+-663, //5
+-629, //6
+-600, //7
+-575, //8
+-552, //9
+-532, //10
+-514, //11
+-498, //12
+-482, //13
+-468, //14
+-455, //15
+-443, //16
+-431, //17
+-420, //18
+-409, //19
+-399, //20
+-390, //21
+-381, //22
+-372, //23
+-364, //24
+-356, //25
+-348, //26
+-340, //27
+-333, //28
+-326, //29
+-319, //30
+-313, //31
+-306, //32
+-300, //33
+-294, //34
+-288, //35
+-283, //36
+-277, //37
+-272, //38
+-266, //39
+-261, //40
+-256, //41
+-251, //42
+-246, //43
+-241, //44
+-237, //45
+-232, //46
+-228, //47
+-223, //48
+-219, //49
+-215, //50
+-211, //51
+-206, //52
+-202, //53
+-198, //54
+-194, //55
+-191, //56
+-187, //57
+-183, //58
+-179, //59
+-176, //60
+-172, //61
+-169, //62
+-165, //63
+-162, //64
+-158, //65
+-155, //66
+-152, //67
+-148, //68
+-145, //69
+-142, //70
+-139, //71
+-136, //72
+-133, //73
+-130, //74
+-127, //75
+-124, //76
+-121, //77
+-118, //78
+-115, //79
+-112, //80
+-109, //81
+-106, //82
+-104, //83
+-101, //84
+-98, //85
+-95, //86
+-93, //87
+-90, //88
+-88, //89
+-85, //90
+-82, //91
+-80, //92
+-77, //93
+-75, //94
+-72, //95
+-70, //96
+-67, //97
+-65, //98
+-62, //99
+-60, //100
+-58, //101
+-55, //102
+-53, //103
+-51, //104
+-48, //105
+-46, //106
+-44, //107
+-41, //108
+-39, //109
+-37, //110
+-35, //111
+-33, //112
+-30, //113
+-28, //114
+-26, //115
+-24, //116
+-22, //117
+-20, //118
+-17, //119
+-15, //120
+-13, //121
+-11, //122
+-9, //123
+-7, //124
+-5, //125
+-3, //126
+-1, //127
+};
@@ -0,0 +1,42 @@
+//generates xlns16bf16tbl.h, the tables for direct bfloat16 <-> xlns16 conversion
+//(bf162xlns16, xlns162bf16 and the batch versions in xlns16.cpp); both directions
+//round to nearest: the log for bf16->xlns16, the bf16 value for xlns16->bf16
+//   g++ xlns16genbf16tbl.cpp -o xlns16genbf16tbl -lm && ./xlns16genbf16tbl
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+int main()
+{
+	FILE * f;
+	int i;
+	f = fopen("xlns16bf16tbl.h","w");
+	// normal bf16 mantissa m: 128*log2(1+m/128), one pad entry for 32-bit gathers
+	fprintf(f,"const unsigned short xlns16bf16logtbl[129] = {\n");
+	for (i=0; i<128; i++)
+		fprintf(f,"%d, //%d\n",(int)floor(128.0*log2(1.0+i/128.0)+0.5),i);
+	fprintf(f,"128  //pad\n};\n");
+	// subnormal bf16 mantissa m (value m*2^-133): biased xlns16 log, 0 if it rounds to xlns16_zero
+	fprintf(f,"const unsigned short xlns16bf16subtbl[128] = {\n");
+	for (i=0; i<128; i++)
+	{
+		int l = (i == 0) ? 0 : (int)floor(128.0*(log2((double)i)-133.0)+0.5) + 16384;
+		fprintf(f,"%d%s //%d\n",(l < 0) ? 0 : l,(i < 127) ? "," : "",i);
+	}
+	fprintf(f,"};\n");
+	// fraction f of the xlns16 log: bf16 mantissa 128*(2^(f/128)-1), 128 carries into the exponent
+	fprintf(f,"const unsigned short xlns16bf16exptbl[129] = {\n");
+	for (i=0; i<128; i++)
+		fprintf(f,"%d, //%d\n",(int)floor(128.0*(pow(2.0,i/128.0)-1.0)+0.5),i);
+	fprintf(f,"128  //pad\n};\n");
+	// biased xlns16 logs below 256 (under 2^-126): subnormal bf16 bits 2^133*value
+	fprintf(f,"const unsigned short xlns16bf16tinytbl[256] = {\n");
+	for (i=0; i<256; i++)
+	{
+		int b = (i == 0) ? 0 : (int)floor(pow(2.0,(i-16384)/128.0+133.0)+0.5);
+		fprintf(f,"%d%s //%d\n",b,(i < 255) ? "," : "",i);
+	}
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
@@ -0,0 +1,21 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#define xlns16_ideal
+#include "xlns16.cpp"
+
+//db near the singularity (0 < z < 1.0) for the non-ideal (Mitchell/lpvip) paths;
+//entry 0 is never used since z==0 cancels exactly
+int main()
+{
+	FILE * f;
+	xlns16_signed z;
+	f = fopen("xlns16dbsingtbl.h","w");
+	fprintf(f,"xlns16_signed xlns16dbsingtbl[%d] = {\n",xlns16_scale);
+	fprintf(f,"0, //0 unused\n");
+	for (z=1; z<xlns16_scale; z++)
+		fprintf(f,"%d, //%d\n",(xlns16_signed) xlns16_db_ideal(z),z);
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
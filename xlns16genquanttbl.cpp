@@ -0,0 +1,39 @@
+//generates xlns16quanttbl.h, the tables for converting IEEE fp16 and int8/int4
+//quantized weights to xlns16 (fp162xlns16 and xlns16_batch_from_fp16/_q8/_q4 in
+//xlns16.cpp); all round the log to nearest
+//   g++ xlns16genquanttbl.cpp -o xlns16genquanttbl -lm && ./xlns16genquanttbl
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// biased xlns16 of the integer q, rounded to nearest
+int q2xlns16(int q)
+{
+	if (q == 0)
+		return 0;
+	return ((q < 0) ? 0x8000 : 0) | ((int)floor(128.0*log2(fabs((double)q))+0.5) + 0x4000);
+}
+
+int main()
+{
+	FILE * f;
+	int i;
+	f = fopen("xlns16quanttbl.h","w");
+	// fp16 mantissa m: 128*log2(1+m/1024), 128 carries into the exponent; one pad entry for 32-bit gathers
+	fprintf(f,"const unsigned short xlns16fp16logtbl[1025] = {\n");
+	for (i=0; i<1024; i++)
+		fprintf(f,"%d, //%d\n",(int)floor(128.0*log2(1.0+i/1024.0)+0.5),i);
+	fprintf(f,"128  //pad\n};\n");
+	// int8 q (indexed by its byte): xlns16 of q; one pad entry
+	fprintf(f,"const unsigned short xlns16q8tbl[257] = {\n");
+	for (i=0; i<256; i++)
+		fprintf(f,"0x%04x, //%d\n",q2xlns16((signed char)i),(signed char)i);
+	fprintf(f,"0  //pad\n};\n");
+	// int4 nibble v (the value v-8): xlns16 of v-8
+	fprintf(f,"const unsigned short xlns16q4tbl[16] = {\n");
+	for (i=0; i<16; i++)
+		fprintf(f,"0x%04x%s //%d\n",q2xlns16(i-8),(i < 15) ? "," : "",i-8);
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
@@ -11,7 +11,7 @@
 #ifdef xlns16_num_rand
         // if so, use that # bits from rand() 
 #else   // otherwise need global for lin feedback shift reg 
-  xlns16 xlns16_randombits= 7;  //any seed in 1 <= seed <= 65535;
+  thread_local xlns16 xlns16_randombits= 7;  //any seed in 1 <= seed <= 65535; one per thread
 #endif
 
 inline xlns16 xlns16_monte_modifier(xlns16 x, xlns16 y)
@@ -67,6 +67,7 @@ inline xlns16 xlns16_add_monte(xlns16 x, xlns16 y)
 
 // Sum of array elements: result = Σ a[i]
 inline xlns16 xlns16_sum_monte(const xlns16 *a, size_t n) {
+    xlns16_zprof_kernel("xlns16_sum_monte");
     if (n == 0) return xlns16_zero;
     xlns16 sum = a[0];
     for (size_t i = 1; i < n; i++) {
@@ -77,6 +78,7 @@ inline xlns16 xlns16_sum_monte(const xlns16 *a, size_t n) {
 
 // Vector dot product: result = Σ(a[i] * b[i])
 inline xlns16 xlns16_vec_dot_monte(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_monte");
     if (n == 0) return xlns16_zero;
     xlns16 sum = xlns16_mul(a[0], b[0]);
     for (size_t i = 1; i < n; i++) {
@@ -86,6 +88,126 @@ inline xlns16 xlns16_vec_dot_monte(const xlns16 *a, const xlns16 *b, size_t n) {
 }
 
 
+// Shift register streams for the pieces of parallel kernels: while an
+// xlns16_monte_stream(base, k) object lives, this thread draws from a stream
+// seeded from base (the caller's xlns16_randombits, see xlns16_monte_base)
+// and the piece number k, so a piece gives the same bits on any thread.
+// xlns16_monte_base steps the caller's register once, so the next parallel
+// call draws different noise, and a run is still repeatable from the seed.
+// (With xlns16_num_rand the noise comes from rand() and is only repeatable
+// in one thread.)
+#ifndef xlns16_num_rand
+inline xlns16 xlns16_monte_base() {
+    xlns16 base = xlns16_randombits;
+    xlns16 bit = xlns16_randombits & 1;
+    xlns16_randombits >>= 1;
+    if (bit) {
+        xlns16_randombits ^= 0xB400u; // Mask for taps 16, 15, 13, 4
+    }
+    return base;
+}
+struct xlns16_monte_stream {
+    xlns16 saved;
+    xlns16_monte_stream(xlns16 base, size_t k) {
+        saved = xlns16_randombits;
+        xlns16_randombits = base + 0x9e37*(xlns16)(k + 1);
+        if (xlns16_randombits == 0) xlns16_randombits = 7;
+    }
+    ~xlns16_monte_stream() { xlns16_randombits = saved; }
+};
+#else
+inline xlns16 xlns16_monte_base() { return 0; }
+struct xlns16_monte_stream {
+    xlns16_monte_stream(xlns16 base, size_t k) {}
+};
+#endif
+
+// Fixed-tree versions (see xlns16_sum_tree): chunk c uses stream c, and the
+// chunk sums are added pairwise with xlns16_add_monte on the caller's stream,
+// so the result is the same for any number of threads
+template <class P>
+inline xlns16 xlns16_monte_tree(size_t n, const P &chunksum) {
+    xlns16 base = xlns16_monte_base();
+    return xlns16_tree_reduce(n, [&](size_t i0, size_t i1) {
+        xlns16_monte_stream stream(base, i0/xlns16_treechunk);
+        return chunksum(i0, i1);
+    }, xlns16_add_monte);
+}
+
+// Sum of array elements: result = Σ a[i]
+inline xlns16 xlns16_sum_monte_tree(const xlns16 *a, size_t n) {
+    xlns16_zprof_kernel("xlns16_sum_monte_tree");
+    return xlns16_monte_tree(n, [=](size_t i0, size_t i1) {
+        xlns16 sum = a[i0];
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns16_add_monte(sum, a[i]);
+        return sum;
+    });
+}
+
+// Vector dot product: result = Σ(a[i] * b[i])
+inline xlns16 xlns16_vec_dot_monte_tree(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns16_zprof_kernel("xlns16_vec_dot_monte_tree");
+    return xlns16_monte_tree(n, [=](size_t i0, size_t i1) {
+        xlns16 sum = xlns16_mul(a[i0], b[i0]);
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns16_add_monte(sum, xlns16_mul(a[i], b[i]));
+        return sum;
+    });
+}
+
+// Matrix-vector products with MCLNS accumulation (see xlns16_gemv): row r (or
+// block b of columns for the transposed product) uses stream r (b), so the
+// result is the same for any number of threads
+
+// y = W x: y[r] = sum over c of W[r*cols+c]*x[c], added in order with xlns16_add_monte
+inline void xlns16_gemv_monte(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_monte");
+    xlns16 base = xlns16_monte_base();
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++) {
+        xlns16_monte_stream stream(base, r);
+        const xlns16 *w = W + r*cols;
+        xlns16 prod[xlns16_gemv_chunk];
+        xlns16 sum = xlns16_zero;
+        for (size_t i = 0; i < cols; i += xlns16_gemv_chunk) {
+            size_t m = (cols - i < xlns16_gemv_chunk) ? cols - i : xlns16_gemv_chunk;
+            xlns16_prefetch_ahead(w+i, m);
+            xlns16_batch_mul(w+i, x+i, prod, m);
+            size_t k = 0;
+            if (i == 0) sum = prod[k++];
+            for (; k < m; k++)
+                sum = xlns16_add_monte(sum, prod[k]);
+        }
+        y[r] = sum;
+    });
+}
+
+// y = W^T x: y[c] = sum over r of W[r*cols+c]*x[r], added in order of r
+inline void xlns16_gemv_t_monte(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns16_zprof_kernel("xlns16_gemv_t_monte");
+    xlns16 base = xlns16_monte_base();
+    size_t nb = (cols + xlns16_gemv_chunk - 1)/xlns16_gemv_chunk;
+    xlns_parallel_chunks(rows*cols, nb, for (size_t b = i0; b < i1; b++) {
+        xlns16_monte_stream stream(base, b);
+        size_t c0 = b*xlns16_gemv_chunk;
+        size_t m = (cols - c0 < xlns16_gemv_chunk) ? cols - c0 : xlns16_gemv_chunk;
+        xlns16 prod[xlns16_gemv_chunk];
+        if (rows == 0) {
+            for (size_t k = 0; k < m; k++) y[c0+k] = xlns16_zero;
+            continue;
+        }
+        xlns16_batch_scale(W + c0, x[0], y + c0, m);
+        for (size_t r = 1; r < rows; r++) {
+            const xlns16 *w = W + r*cols + c0;
+            for (size_t k = 0; k < m; k += 32)
+                xlns16_prefetch(w + cols + k);   // same columns, next row
+            xlns16_batch_scale(w, x[r], prod, m);
+            for (size_t k = 0; k < m; k++)
+                y[c0+k] = xlns16_add_monte(y[c0+k], prod[k]);
+        }
+    });
+}
+
 // Softmax: exp(scale*a[i] - max) / sum(exp(scale*a[j] - max)).
 // Same control flow as xlns16_softmax; only the normalization sum uses MCLNS
 // (xlns16_sum_monte).
@@ -95,6 +217,7 @@ inline xlns16 xlns16_vec_dot_monte(const xlns16 *a, const xlns16 *b, size_t n) {
 // index i, and the sum pass runs after all per-element writes complete.
 inline void xlns16_softmax_monte(const xlns16 *a, xlns16 *c, size_t n,
                                   xlns16 scale = xlns16_one) {
+    xlns16_zprof_kernel("xlns16_softmax_monte");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -103,11 +226,11 @@ inline void xlns16_softmax_monte(const xlns16 *a, xlns16 *c, size_t n,
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum_monte(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
 }
 
 // Masked variant of xlns16_softmax_monte (same as xlns16_softmax_masked, with
@@ -117,6 +240,7 @@ inline void xlns16_softmax_monte(const xlns16 *a, xlns16 *c, size_t n,
 // that position, anything else is treated as an additive bias (e.g. ALiBi).
 inline void xlns16_softmax_masked_monte(const xlns16 *a, const xlns16 *mask, xlns16 *c,
                                          size_t n, xlns16 scale = xlns16_one) {
+    xlns16_zprof_kernel("xlns16_softmax_masked_monte");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -129,11 +253,11 @@ inline void xlns16_softmax_masked_monte(const xlns16 *a, const xlns16 *mask, xln
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum_monte(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
 }
 
 
@@ -141,23 +265,25 @@ inline void xlns16_softmax_masked_monte(const xlns16 *a, const xlns16 *mask, xln
 inline void xlns16_layernorm_monte(const xlns16 *x, xlns16 *out,
                        const xlns16 *gamma, const xlns16 *beta,
                        size_t n, float eps) {
+    xlns16_zprof_kernel("xlns16_layernorm_monte");
+    xlns16 nn = fp2xlns16((float)n);
     // compute mean
     xlns16 mean = xlns16_sum_monte(x, n);
-    mean = xlns16_div(mean, fp2xlns16((float)n));
+    mean = xlns16_div(mean, nn);
     // compute variance
     xlns16 var = xlns16_zero;
     for (size_t i = 0; i < n; i++) {
         xlns16 diff = xlns16_sub(x[i], mean);
         var = xlns16_add_monte(var, xlns16_mul(diff, diff));
     }
-    var = xlns16_div(var, fp2xlns16((float)n));
+    var = xlns16_div(var, nn);
     // normalize
     xlns16 inv_std = fp2xlns16(1.0f / sqrt(xlns162fp(var) + eps));
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
         out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
         if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
         if (beta)  out[i] = xlns16_add(out[i], beta[i]);
-    }
+    });
 }
 
 
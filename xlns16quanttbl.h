@@ -0,0 +1,1304 @@
+const unsigned short xlns16fp16logtbl[1025] = {
+0, //0
+0, //1
+0, //2
+1, //3
+1, //4
+1, //5
+1, //6
+1, //7
+1, //8
+2, //9
+2, //10
+2, //11
+2, //12
+2, //13
+3, //14
+3, //15
+3, //16
+3, //17
+3, //18
+3, //19
+4, //20
+4, //21
+4, //22
+4, //23
+4, //24
+4, //25
+5, //26
+5, //27
+5, //28
+5, //29
+5, //30
+6, //31
+6, //32
+6, //33
+6, //34
+6, //35
+6, //36
+7, //37
+7, //38
+7, //39
+7, //40
+7, //41
+7, //42
+8, //43
+8, //44
+8, //45
+8, //46
+8, //47
+8, //48
+9, //49
+9, //50
+9, //51
+9, //52
+9, //53
+9, //54
+10, //55
+10, //56
+10, //57
+10, //58
+10, //59
+11, //60
+11, //61
+11, //62
+11, //63
+11, //64
+11, //65
+12, //66
+12, //67
+12, //68
+12, //69
+12, //70
+12, //71
+13, //72
+13, //73
+13, //74
+13, //75
+13, //76
+13, //77
+14, //78
+14, //79
+14, //80
+14, //81
+14, //82
+14, //83
+15, //84
+15, //85
+15, //86
+15, //87
+15, //88
+15, //89
+16, //90
+16, //91
+16, //92
+16, //93
+16, //94
+16, //95
+17, //96
+17, //97
+17, //98
+17, //99
+17, //100
+17, //101
+18, //102
+18, //103
+18, //104
+18, //105
+18, //106
+18, //107
+19, //108
+19, //109
+19, //110
+19, //111
+19, //112
+19, //113
+19, //114
+20, //115
+20, //116
+20, //117
+20, //118
+20, //119
+20, //120
+21, //121
+21, //122
+21, //123
+21, //124
+21, //125
+21, //126
+22, //127
+22, //128
+22, //129
+22, //130
+22, //131
+22, //132
+23, //133
+23, //134
+23, //135
+23, //136
+23, //137
+23, //138
+24, //139
+24, //140
+24, //141
+24, //142
+24, //143
+24, //144
+24, //145
+25, //146
+25, //147
+25, //148
+25, //149
+25, //150
+25, //151
+26, //152
+26, //153
+26, //154
+26, //155
+26, //156
+26, //157
+26, //158
+27, //159
+27, //160
+27, //161
+27, //162
+27, //163
+27, //164
+28, //165
+28, //166
+28, //167
+28, //168
+28, //169
+28, //170
+29, //171
+29, //172
+29, //173
+29, //174
+29, //175
+29, //176
+29, //177
+30, //178
+30, //179
+30, //180
+30, //181
+30, //182
+30, //183
+31, //184
+31, //185
+31, //186
+31, //187
+31, //188
+31, //189
+31, //190
+32, //191
+32, //192
+32, //193
+32, //194
+32, //195
+32, //196
+32, //197
+33, //198
+33, //199
+33, //200
+33, //201
+33, //202
+33, //203
+34, //204
+34, //205
+34, //206
+34, //207
+34, //208
+34, //209
+34, //210
+35, //211
+35, //212
+35, //213
+35, //214
+35, //215
+35, //216
+35, //217
+36, //218
+36, //219
+36, //220
+36, //221
+36, //222
+36, //223
+37, //224
+37, //225
+37, //226
+37, //227
+37, //228
+37, //229
+37, //230
+38, //231
+38, //232
+38, //233
+38, //234
+38, //235
+38, //236
+38, //237
+39, //238
+39, //239
+39, //240
+39, //241
+39, //242
+39, //243
+39, //244
+40, //245
+40, //246
+40, //247
+40, //248
+40, //249
+40, //250
+40, //251
+41, //252
+41, //253
+41, //254
+41, //255
+41, //256
+41, //257
+41, //258
+42, //259
+42, //260
+42, //261
+42, //262
+42, //263
+42, //264
+43, //265
+43, //266
+43, //267
+43, //268
+43, //269
+43, //270
+43, //271
+44, //272
+44, //273
+44, //274
+44, //275
+44, //276
+44, //277
+44, //278
+44, //279
+45, //280
+45, //281
+45, //282
+45, //283
+45, //284
+45, //285
+45, //286
+46, //287
+46, //288
+46, //289
+46, //290
+46, //291
+46, //292
+46, //293
+47, //294
+47, //295
+47, //296
+47, //297
+47, //298
+47, //299
+47, //300
+48, //301
+48, //302
+48, //303
+48, //304
+48, //305
+48, //306
+48, //307
+49, //308
+49, //309
+49, //310
+49, //311
+49, //312
+49, //313
+49, //314
+50, //315
+50, //316
+50, //317
+50, //318
+50, //319
+50, //320
+50, //321
+50, //322
+51, //323
+51, //324
+51, //325
+51, //326
+51, //327
+51, //328
+51, //329
+52, //330
+52, //331
+52, //332
+52, //333
+52, //334
+52, //335
+52, //336
+53, //337
+53, //338
+53, //339
+53, //340
+53, //341
+53, //342
+53, //343
+53, //344
+54, //345
+54, //346
+54, //347
+54, //348
+54, //349
+54, //350
+54, //351
+55, //352
+55, //353
+55, //354
+55, //355
+55, //356
+55, //357
+55, //358
+55, //359
+56, //360
+56, //361
+56, //362
+56, //363
+56, //364
+56, //365
+56, //366
+57, //367
+57, //368
+57, //369
+57, //370
+57, //371
+57, //372
+57, //373
+57, //374
+58, //375
+58, //376
+58, //377
+58, //378
+58, //379
+58, //380
+58, //381
+59, //382
+59, //383
+59, //384
+59, //385
+59, //386
+59, //387
+59, //388
+59, //389
+60, //390
+60, //391
+60, //392
+60, //393
+60, //394
+60, //395
+60, //396
+61, //397
+61, //398
+61, //399
+61, //400
+61, //401
+61, //402
+61, //403
+61, //404
+62, //405
+62, //406
+62, //407
+62, //408
+62, //409
+62, //410
+62, //411
+62, //412
+63, //413
+63, //414
+63, //415
+63, //416
+63, //417
+63, //418
+63, //419
+63, //420
+64, //421
+64, //422
+64, //423
+64, //424
+64, //425
+64, //426
+64, //427
+64, //428
+65, //429
+65, //430
+65, //431
+65, //432
+65, //433
+65, //434
+65, //435
+66, //436
+66, //437
+66, //438
+66, //439
+66, //440
+66, //441
+66, //442
+66, //443
+67, //444
+67, //445
+67, //446
+67, //447
+67, //448
+67, //449
+67, //450
+67, //451
+68, //452
+68, //453
+68, //454
+68, //455
+68, //456
+68, //457
+68, //458
+68, //459
+69, //460
+69, //461
+69, //462
+69, //463
+69, //464
+69, //465
+69, //466
+69, //467
+70, //468
+70, //469
+70, //470
+70, //471
+70, //472
+70, //473
+70, //474
+70, //475
+70, //476
+71, //477
+71, //478
+71, //479
+71, //480
+71, //481
+71, //482
+71, //483
+71, //484
+72, //485
+72, //486
+72, //487
+72, //488
+72, //489
+72, //490
+72, //491
+72, //492
+73, //493
+73, //494
+73, //495
+73, //496
+73, //497
+73, //498
+73, //499
+73, //500
+74, //501
+74, //502
+74, //503
+74, //504
+74, //505
+74, //506
+74, //507
+74, //508
+75, //509
+75, //510
+75, //511
+75, //512
+75, //513
+75, //514
+75, //515
+75, //516
+75, //517
+76, //518
+76, //519
+76, //520
+76, //521
+76, //522
+76, //523
+76, //524
+76, //525
+77, //526
+77, //527
+77, //528
+77, //529
+77, //530
+77, //531
+77, //532
+77, //533
+78, //534
+78, //535
+78, //536
+78, //537
+78, //538
+78, //539
+78, //540
+78, //541
+78, //542
+79, //543
+79, //544
+79, //545
+79, //546
+79, //547
+79, //548
+79, //549
+79, //550
+80, //551
+80, //552
+80, //553
+80, //554
+80, //555
+80, //556
+80, //557
+80, //558
+80, //559
+81, //560
+81, //561
+81, //562
+81, //563
+81, //564
+81, //565
+81, //566
+81, //567
+81, //568
+82, //569
+82, //570
+82, //571
+82, //572
+82, //573
+82, //574
+82, //575
+82, //576
+83, //577
+83, //578
+83, //579
+83, //580
+83, //581
+83, //582
+83, //583
+83, //584
+83, //585
+84, //586
+84, //587
+84, //588
+84, //589
+84, //590
+84, //591
+84, //592
+84, //593
+84, //594
+85, //595
+85, //596
+85, //597
+85, //598
+85, //599
+85, //600
+85, //601
+85, //602
+86, //603
+86, //604
+86, //605
+86, //606
+86, //607
+86, //608
+86, //609
+86, //610
+86, //611
+87, //612
+87, //613
+87, //614
+87, //615
+87, //616
+87, //617
+87, //618
+87, //619
+87, //620
+88, //621
+88, //622
+88, //623
+88, //624
+88, //625
+88, //626
+88, //627
+88, //628
+88, //629
+89, //630
+89, //631
+89, //632
+89, //633
+89, //634
+89, //635
+89, //636
+89, //637
+89, //638
+90, //639
+90, //640
+90, //641
+90, //642
+90, //643
+90, //644
+90, //645
+90, //646
+90, //647
+91, //648
+91, //649
+91, //650
+91, //651
+91, //652
+91, //653
+91, //654
+91, //655
+91, //656
+92, //657
+92, //658
+92, //659
+92, //660
+92, //661
+92, //662
+92, //663
+92, //664
+92, //665
+93, //666
+93, //667
+93, //668
+93, //669
+93, //670
+93, //671
+93, //672
+93, //673
+93, //674
+94, //675
+94, //676
+94, //677
+94, //678
+94, //679
+94, //680
+94, //681
+94, //682
+94, //683
+94, //684
+95, //685
+95, //686
+95, //687
+95, //688
+95, //689
+95, //690
+95, //691
+95, //692
+95, //693
+96, //694
+96, //695
+96, //696
+96, //697
+96, //698
+96, //699
+96, //700
+96, //701
+96, //702
+97, //703
+97, //704
+97, //705
+97, //706
+97, //707
+97, //708
+97, //709
+97, //710
+97, //711
+97, //712
+98, //713
+98, //714
+98, //715
+98, //716
+98, //717
+98, //718
+98, //719
+98, //720
+98, //721
+99, //722
+99, //723
+99, //724
+99, //725
+99, //726
+99, //727
+99, //728
+99, //729
+99, //730
+99, //731
+100, //732
+100, //733
+100, //734
+100, //735
+100, //736
+100, //737
+100, //738
+100, //739
+100, //740
+101, //741
+101, //742
+101, //743
+101, //744
+101, //745
+101, //746
+101, //747
+101, //748
+101, //749
+101, //750
+102, //751
+102, //752
+102, //753
+102, //754
+102, //755
+102, //756
+102, //757
+102, //758
+102, //759
+103, //760
+103, //761
+103, //762
+103, //763
+103, //764
+103, //765
+103, //766
+103, //767
+103, //768
+103, //769
+104, //770
+104, //771
+104, //772
+104, //773
+104, //774
+104, //775
+104, //776
+104, //777
+104, //778
+104, //779
+105, //780
+105, //781
+105, //782
+105, //783
+105, //784
+105, //785
+105, //786
+105, //787
+105, //788
+105, //789
+106, //790
+106, //791
+106, //792
+106, //793
+106, //794
+106, //795
+106, //796
+106, //797
+106, //798
+107, //799
+107, //800
+107, //801
+107, //802
+107, //803
+107, //804
+107, //805
+107, //806
+107, //807
+107, //808
+108, //809
+108, //810
+108, //811
+108, //812
+108, //813
+108, //814
+108, //815
+108, //816
+108, //817
+108, //818
+109, //819
+109, //820
+109, //821
+109, //822
+109, //823
+109, //824
+109, //825
+109, //826
+109, //827
+109, //828
+110, //829
+110, //830
+110, //831
+110, //832
+110, //833
+110, //834
+110, //835
+110, //836
+110, //837
+110, //838
+111, //839
+111, //840
+111, //841
+111, //842
+111, //843
+111, //844
+111, //845
+111, //846
+111, //847
+111, //848
+112, //849
+112, //850
+112, //851
+112, //852
+112, //853
+112, //854
+112, //855
+112, //856
+112, //857
+112, //858
+112, //859
+113, //860
+113, //861
+113, //862
+113, //863
+113, //864
+113, //865
+113, //866
+113, //867
+113, //868
+113, //869
+114, //870
+114, //871
+114, //872
+114, //873
+114, //874
+114, //875
+114, //876
+114, //877
+114, //878
+114, //879
+115, //880
+115, //881
+115, //882
+115, //883
+115, //884
+115, //885
+115, //886
+115, //887
+115, //888
+115, //889
+116, //890
+116, //891
+116, //892
+116, //893
+116, //894
+116, //895
+116, //896
+116, //897
+116, //898
+116, //899
+116, //900
+117, //901
+117, //902
+117, //903
+117, //904
+117, //905
+117, //906
+117, //907
+117, //908
+117, //909
+117, //910
+118, //911
+118, //912
+118, //913
+118, //914
+118, //915
+118, //916
+118, //917
+118, //918
+118, //919
+118, //920
+118, //921
+119, //922
+119, //923
+119, //924
+119, //925
+119, //926
+119, //927
+119, //928
+119, //929
+119, //930
+119, //931
+120, //932
+120, //933
+120, //934
+120, //935
+120, //936
+120, //937
+120, //938
+120, //939
+120, //940
+120, //941
+120, //942
+121, //943
+121, //944
+121, //945
+121, //946
+121, //947
+121, //948
+121, //949
+121, //950
+121, //951
+121, //952
+121, //953
+122, //954
+122, //955
+122, //956
+122, //957
+122, //958
+122, //959
+122, //960
+122, //961
+122, //962
+122, //963
+123, //964
+123, //965
+123, //966
+123, //967
+123, //968
+123, //969
+123, //970
+123, //971
+123, //972
+123, //973
+123, //974
+124, //975
+124, //976
+124, //977
+124, //978
+124, //979
+124, //980
+124, //981
+124, //982
+124, //983
+124, //984
+124, //985
+125, //986
+125, //987
+125, //988
+125, //989
+125, //990
+125, //991
+125, //992
+125, //993
+125, //994
+125, //995
+125, //996
+126, //997
+126, //998
+126, //999
+126, //1000
+126, //1001
+126, //1002
+126, //1003
+126, //1004
+126, //1005
+126, //1006
+126, //1007
+127, //1008
+127, //1009
+127, //1010
+127, //1011
+127, //1012
+127, //1013
+127, //1014
+127, //1015
+127, //1016
+127, //1017
+127, //1018
+128, //1019
+128, //1020
+128, //1021
+128, //1022
+128, //1023
+128  //pad
+};
+const unsigned short xlns16q8tbl[257] = {
+0x0000, //0
+0x4000, //1
+0x4080, //2
+0x40cb, //3
+0x4100, //4
+0x4129, //5
+0x414b, //6
+0x4167, //7
+0x4180, //8
+0x4196, //9
+0x41a9, //10
+0x41bb, //11
+0x41cb, //12
+0x41da, //13
+0x41e7, //14
+0x41f4, //15
+0x4200, //16
+0x420b, //17
+0x4216, //18
+0x4220, //19
+0x4229, //20
+0x4232, //21
+0x423b, //22
+0x4243, //23
+0x424b, //24
+0x4252, //25
+0x425a, //26
+0x4261, //27
+0x4267, //28
+0x426e, //29
+0x4274, //30
+0x427a, //31
+0x4280, //32
+0x4286, //33
+0x428b, //34
+0x4291, //35
+0x4296, //36
+0x429b, //37
+0x42a0, //38
+0x42a5, //39
+0x42a9, //40
+0x42ae, //41
+0x42b2, //42
+0x42b7, //43
+0x42bb, //44
+0x42bf, //45
+0x42c3, //46
+0x42c7, //47
+0x42cb, //48
+0x42cf, //49
+0x42d2, //50
+0x42d6, //51
+0x42da, //52
+0x42dd, //53
+0x42e1, //54
+0x42e4, //55
+0x42e7, //56
+0x42eb, //57
+0x42ee, //58
+0x42f1, //59
+0x42f4, //60
+0x42f7, //61
+0x42fa, //62
+0x42fd, //63
+0x4300, //64
+0x4303, //65
+0x4306, //66
+0x4308, //67
+0x430b, //68
+0x430e, //69
+0x4311, //70
+0x4313, //71
+0x4316, //72
+0x4318, //73
+0x431b, //74
+0x431d, //75
+0x4320, //76
+0x4322, //77
+0x4325, //78
+0x4327, //79
+0x4329, //80
+0x432c, //81
+0x432e, //82
+0x4330, //83
+0x4332, //84
+0x4334, //85
+0x4337, //86
+0x4339, //87
+0x433b, //88
+0x433d, //89
+0x433f, //90
+0x4341, //91
+0x4343, //92
+0x4345, //93
+0x4347, //94
+0x4349, //95
+0x434b, //96
+0x434d, //97
+0x434f, //98
+0x4351, //99
+0x4352, //100
+0x4354, //101
+0x4356, //102
+0x4358, //103
+0x435a, //104
+0x435b, //105
+0x435d, //106
+0x435f, //107
+0x4361, //108
+0x4362, //109
+0x4364, //110
+0x4366, //111
+0x4367, //112
+0x4369, //113
+0x436b, //114
+0x436c, //115
+0x436e, //116
+0x436f, //117
+0x4371, //118
+0x4373, //119
+0x4374, //120
+0x4376, //121
+0x4377, //122
+0x4379, //123
+0x437a, //124
+0x437c, //125
+0x437d, //126
+0x437f, //127
+0xc380, //-128
+0xc37f, //-127
+0xc37d, //-126
+0xc37c, //-125
+0xc37a, //-124
+0xc379, //-123
+0xc377, //-122
+0xc376, //-121
+0xc374, //-120
+0xc373, //-119
+0xc371, //-118
+0xc36f, //-117
+0xc36e, //-116
+0xc36c, //-115
+0xc36b, //-114
+0xc369, //-113
+0xc367, //-112
+0xc366, //-111
+0xc364, //-110
+0xc362, //-109
+0xc361, //-108
+0xc35f, //-107
+0xc35d, //-106
+0xc35b, //-105
+0xc35a, //-104
+0xc358, //-103
+0xc356, //-102
+0xc354, //-101
+0xc352, //-100
+0xc351, //-99
+0xc34f, //-98
+0xc34d, //-97
+0xc34b, //-96
+0xc349, //-95
+0xc347, //-94
+0xc345, //-93
+0xc343, //-92
+0xc341, //-91
+0xc33f, //-90
+0xc33d, //-89
+0xc33b, //-88
+0xc339, //-87
+0xc337, //-86
+0xc334, //-85
+0xc332, //-84
+0xc330, //-83
+0xc32e, //-82
+0xc32c, //-81
+0xc329, //-80
+0xc327, //-79
+0xc325, //-78
+0xc322, //-77
+0xc320, //-76
+0xc31d, //-75
+0xc31b, //-74
+0xc318, //-73
+0xc316, //-72
+0xc313, //-71
+0xc311, //-70
+0xc30e, //-69
+0xc30b, //-68
+0xc308, //-67
+0xc306, //-66
+0xc303, //-65
+0xc300, //-64
+0xc2fd, //-63
+0xc2fa, //-62
+0xc2f7, //-61
+0xc2f4, //-60
+0xc2f1, //-59
+0xc2ee, //-58
+0xc2eb, //-57
+0xc2e7, //-56
+0xc2e4, //-55
+0xc2e1, //-54
+0xc2dd, //-53
+0xc2da, //-52
+0xc2d6, //-51
+0xc2d2, //-50
+0xc2cf, //-49
+0xc2cb, //-48
+0xc2c7, //-47
+0xc2c3, //-46
+0xc2bf, //-45
+0xc2bb, //-44
+0xc2b7, //-43
+0xc2b2, //-42
+0xc2ae, //-41
+0xc2a9, //-40
+0xc2a5, //-39
+0xc2a0, //-38
+0xc29b, //-37
+0xc296, //-36
+0xc291, //-35
+0xc28b, //-34
+0xc286, //-33
+0xc280, //-32
+0xc27a, //-31
+0xc274, //-30
+0xc26e, //-29
+0xc267, //-28
+0xc261, //-27
+0xc25a, //-26
+0xc252, //-25
+0xc24b, //-24
+0xc243, //-23
+0xc23b, //-22
+0xc232, //-21
+0xc229, //-20
+0xc220, //-19
+0xc216, //-18
+0xc20b, //-17
+0xc200, //-16
+0xc1f4, //-15
+0xc1e7, //-14
+0xc1da, //-13
+0xc1cb, //-12
+0xc1bb, //-11
+0xc1a9, //-10
+0xc196, //-9
+0xc180, //-8
+0xc167, //-7
+0xc14b, //-6
+0xc129, //-5
+0xc100, //-4
+0xc0cb, //-3
+0xc080, //-2
+0xc000, //-1
+0  //pad
+};
+const unsigned short xlns16q4tbl[16] = {
+0xc180, //-8
+0xc167, //-7
+0xc14b, //-6
+0xc129, //-5
+0xc100, //-4
+0xc0cb, //-3
+0xc080, //-2
+0xc000, //-1
+0x0000, //0
+0x4000, //1
+0x4080, //2
+0x40cb, //3
+0x4100, //4
+0x4129, //5
+0x414b, //6
+0x4167 //7
+};
@@ -289,8 +289,7 @@ void test4xlns16_float(int iter)
 	int ix,iy,count;
 	xlns16_float x1,y1,x,y,xnew,ynew,mone,two,four,xscale,yscale;
 
-	xlns16_hits=0;
-	xlns16_misses=0;
+	xlns16_cache_reset_stats();
 	mone = -1.0;
 	two = 2.0;
 	four = 4.0;
@@ -322,7 +321,7 @@ void test4xlns16_float(int iter)
 		printf("\n");
 	}
 	time(&t2);
-	printf("hits=%ld misses=%ld\n",xlns16_hits,xlns16_misses);
+	printf("hits=%llu misses=%llu\n",xlns16_cache_stats().hits,xlns16_cache_stats().misses);
 	printf("testxlns16_float new %d sec ",((int)(t2-t1)));
 	scanf("%c",&ch);
 }
@@ -30,3 +30,9 @@
  #define xlns16_whatcase "alt altopt\n"
 #endif
 
+#if xlns16case == 6
+ #define xlns16_alt
+ #define xlns16_altopt
+ #define xlns16_aicasb
+ #define xlns16_whatcase "alt altopt aicasb\n"
+#endif
@@ -79,14 +79,205 @@
 // Square: x^2 (efficient in LNS: double the log)
 #define xlns32_square(x) xlns32_mul((x), (x))
 
+// optional event counters: define xlns32_counters before including this file (C++11)
+//   cancel  x + -x gave exact zero (z==0 with opposite signs)
+//   esszer  the smaller term was below xlns32_esszer and was dropped
+//   ovf     a result saturated to the largest magnitude (xlns32_overflow)
+//   unf     a result flushed to zero (xlns32_overflow)
+// each thread counts into its own thread_local block with plain relaxed
+// stores (no lock, no read-modify-write on the hot path); the lock is only
+// taken when a thread starts or exits and by snapshot/reset.
+// xlns32_counters_snapshot() sums all threads since the last xlns32_counters_reset().
+// without xlns32_counters the xlns32_count macros are empty and the snapshot is all 0
+
+struct xlns32_counts {
+    unsigned long long cancel, esszer, ovf, unf;
+};
+
+#ifdef xlns32_counters
+#include <atomic>
+#include <mutex>
+
+struct xlns32_counter_block {
+    std::atomic<unsigned long long> cancel, esszer, ovf, unf;
+    xlns32_counter_block *next;
+    xlns32_counter_block();
+    ~xlns32_counter_block();
+};
+
+std::mutex xlns32_counter_lock;
+xlns32_counter_block *xlns32_counter_list = NULL;
+xlns32_counts xlns32_counter_retired = {0, 0, 0, 0};   // from threads that have exited
+xlns32_counts xlns32_counter_base = {0, 0, 0, 0};      // totals at the last reset
+thread_local xlns32_counter_block xlns32_counter_mine;
+
+xlns32_counter_block::xlns32_counter_block() : cancel(0), esszer(0), ovf(0), unf(0)
+{
+    std::lock_guard<std::mutex> g(xlns32_counter_lock);
+    next = xlns32_counter_list;
+    xlns32_counter_list = this;
+}
+
+xlns32_counter_block::~xlns32_counter_block()
+{
+    std::lock_guard<std::mutex> g(xlns32_counter_lock);
+    xlns32_counter_retired.cancel += cancel.load(std::memory_order_relaxed);
+    xlns32_counter_retired.esszer += esszer.load(std::memory_order_relaxed);
+    xlns32_counter_retired.ovf += ovf.load(std::memory_order_relaxed);
+    xlns32_counter_retired.unf += unf.load(std::memory_order_relaxed);
+    xlns32_counter_block **p = &xlns32_counter_list;
+    while (*p != this)
+        p = &(*p)->next;
+    *p = next;
+}
+
+// only the owning thread writes its block, so load+store is enough
+inline void xlns32_counter_bump(std::atomic<unsigned long long> &c, unsigned long long k)
+{
+    c.store(c.load(std::memory_order_relaxed) + k, std::memory_order_relaxed);
+}
+
+#define xlns32_count(ev)          xlns32_counter_bump(xlns32_counter_mine.ev, 1)
+#define xlns32_count_n(ev,k)      xlns32_counter_bump(xlns32_counter_mine.ev, (k))
+#define xlns32_count_if(cond,ev)  do { if (cond) xlns32_count(ev); } while (0)
+
+inline xlns32_counts xlns32_counters_total()   //caller holds xlns32_counter_lock
+{
+    xlns32_counts t = xlns32_counter_retired;
+    for (xlns32_counter_block *b = xlns32_counter_list; b != NULL; b = b->next)
+    {
+        t.cancel += b->cancel.load(std::memory_order_relaxed);
+        t.esszer += b->esszer.load(std::memory_order_relaxed);
+        t.ovf += b->ovf.load(std::memory_order_relaxed);
+        t.unf += b->unf.load(std::memory_order_relaxed);
+    }
+    return t;
+}
+
+inline xlns32_counts xlns32_counters_snapshot()
+{
+    std::lock_guard<std::mutex> g(xlns32_counter_lock);
+    xlns32_counts t = xlns32_counters_total();
+    t.cancel -= xlns32_counter_base.cancel;
+    t.esszer -= xlns32_counter_base.esszer;
+    t.ovf -= xlns32_counter_base.ovf;
+    t.unf -= xlns32_counter_base.unf;
+    return t;
+}
+
+inline void xlns32_counters_reset()
+{
+    std::lock_guard<std::mutex> g(xlns32_counter_lock);
+    xlns32_counter_base = xlns32_counters_total();
+}
+#else
+#define xlns32_count(ev)
+#define xlns32_count_n(ev,k)
+#define xlns32_count_if(cond,ev)
+inline xlns32_counts xlns32_counters_snapshot() { xlns32_counts t = {0, 0, 0, 0}; return t; }
+inline void xlns32_counters_reset() {}
+#endif
+
+// optional z profile: define xlns32_zprofile before including this file (C++11)
+//   every addition records -z (the log distance between the operands) in a
+//   histogram per kernel, separately for sb (same signs) and db (opposite signs).
+//   bin = -z >> xlns32_zprof_shift (as xlns32_zhshift, one bin per sb table entry); the last bin holds all
+//   -z beyond xlns32_esszer.  kernels name themselves with xlns32_zprof_kernel;
+//   the outermost named kernel on a thread gets the adds ("other" if none).
+//   xlns32_zprof_dump(f) writes the nonzero bins as text lines
+//      xlns32 <kernel> sb|db <bin> <count>
+//   for zprofreport.cpp, which estimates table footprints and hit rates.
+
+#define xlns32_zprof_shift    14
+#define xlns32_zprof_nbins    ((xlns32_esszer>>xlns32_zprof_shift)+1)
+
+#ifdef xlns32_zprofile
+#include <atomic>
+#include <mutex>
+#include <string.h>
+
+#define xlns32_zprof_maxkern  16
+
+struct xlns32_zprof_hist {
+    const char *name;
+    std::atomic<unsigned long long> sb[xlns32_zprof_nbins], db[xlns32_zprof_nbins];
+};
+
+xlns32_zprof_hist xlns32_zprof_tab[xlns32_zprof_maxkern];   // static, so all counts start at 0
+int xlns32_zprof_nkern = 1;                            // slot 0 is "other"
+std::mutex xlns32_zprof_lock;
+thread_local int xlns32_zprof_cur = 0;
+
+inline int xlns32_zprof_register(const char *name)
+{
+    std::lock_guard<std::mutex> g(xlns32_zprof_lock);
+    for (int k = 1; k < xlns32_zprof_nkern; k++)
+        if (strcmp(xlns32_zprof_tab[k].name, name) == 0)
+            return k;
+    if (xlns32_zprof_nkern == xlns32_zprof_maxkern)
+        return 0;
+    xlns32_zprof_tab[xlns32_zprof_nkern].name = name;
+    return xlns32_zprof_nkern++;
+}
+
+struct xlns32_zprof_scope {
+    int saved;
+    xlns32_zprof_scope(int k) : saved(xlns32_zprof_cur) { if (saved == 0) xlns32_zprof_cur = k; }
+    ~xlns32_zprof_scope() { xlns32_zprof_cur = saved; }
+};
+
+inline void xlns32_zprof_record(xlns32_signed negz, int usedb)   //negz >= 0
+{
+    int b = (negz >= xlns32_esszer) ? xlns32_zprof_nbins-1 : (negz >> xlns32_zprof_shift);
+    (usedb ? xlns32_zprof_tab[xlns32_zprof_cur].db[b] : xlns32_zprof_tab[xlns32_zprof_cur].sb[b])
+        .fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void xlns32_zprof_dump(FILE *f)
+{
+    std::lock_guard<std::mutex> g(xlns32_zprof_lock);
+    fprintf(f, "#zprofile xlns32 shift %d nbins %d esszer %d\n", xlns32_zprof_shift, xlns32_zprof_nbins, (int)xlns32_esszer);
+    for (int k = 0; k < xlns32_zprof_nkern; k++)
+        for (int b = 0; b < xlns32_zprof_nbins; b++)
+        {
+            unsigned long long s = xlns32_zprof_tab[k].sb[b].load(std::memory_order_relaxed);
+            unsigned long long d = xlns32_zprof_tab[k].db[b].load(std::memory_order_relaxed);
+            if (s) fprintf(f, "xlns32 %s sb %d %llu\n", k ? xlns32_zprof_tab[k].name : "other", b, s);
+            if (d) fprintf(f, "xlns32 %s db %d %llu\n", k ? xlns32_zprof_tab[k].name : "other", b, d);
+        }
+}
+
+inline void xlns32_zprof_reset()
+{
+    std::lock_guard<std::mutex> g(xlns32_zprof_lock);
+    for (int k = 0; k < xlns32_zprof_nkern; k++)
+        for (int b = 0; b < xlns32_zprof_nbins; b++)
+        {
+            xlns32_zprof_tab[k].sb[b].store(0, std::memory_order_relaxed);
+            xlns32_zprof_tab[k].db[b].store(0, std::memory_order_relaxed);
+        }
+}
+
+#define xlns32_zprof(negz,usedb)    xlns32_zprof_record((negz), (usedb) != 0)
+#define xlns32_zprof_kernel(name)   static int xlns32_zprof_id = xlns32_zprof_register(name); \
+                                    xlns32_zprof_scope xlns32_zprof_here(xlns32_zprof_id)
+#else
+#define xlns32_zprof(negz,usedb)
+#define xlns32_zprof_kernel(name)
+inline void xlns32_zprof_dump(FILE *) {}
+inline void xlns32_zprof_reset() {}
+#endif
+
 inline xlns32 xlns32_overflow(xlns32 xlns32_x, xlns32 xlns32_y, xlns32 xlns32_temp)
 {       //printf("%ld %ld %ld\n",xlns32_temp,xlns32_x,xlns32_y);
 	if (xlns32_logsignmask&xlns32_temp)
 	{
+		xlns32_count(unf);
 		return (xlns32_signmask&(xlns32_x^xlns32_y));
 	}
 	else
 	{
+		xlns32_count(ovf);
 		return (xlns32_signmask&(xlns32_x^xlns32_y))| xlns32_logmask;
 	}
 }
@@ -124,9 +315,22 @@ inline xlns32 xlns32_div(xlns32 x, xlns32 y)
 	return ((xlns32_signed) ((log( pow(2.0, ((double) z) / xlns32_scale) - 1 )/log(2.0))*xlns32_scale+.5));
   }
 #else
+ #ifdef xlns32_quad
+  #define xlns32_sb xlns32_sb_quad
+ #else
   #define xlns32_sb xlns32_sb_macro
+ #endif
+ #ifdef xlns32_dbquad
+  #define xlns32_db xlns32_db_quad
+ #else
   #define xlns32_db xlns32_dbtrans3
+ #endif
 
+#ifdef xlns32_tbl
+//tables with other parameters from xlns32gentbl.cpp, which defines them in the header,
+//e.g. -Dxlns32_tbl='"xlns32tbl_13_19_10.h"'
+#include xlns32_tbl
+#else
 #define xlns32_tablesize     (4096*3+1000)
 #define xlns32_zhmask        0x0fffc000L
 #define xlns32_zlmask        0x00003fffL
@@ -142,6 +346,7 @@ inline xlns32 xlns32_div(xlns32 x, xlns32 y)
 #define xlns32_db2size       1024
 
 #include "xlns32tbl.h"
+#endif
 
 xlns32 xlns32_z, xlns32_zh;
 
@@ -153,7 +358,7 @@ xlns32 xlns32_z, xlns32_zh;
    +(((xlns32)xlns32_sbhtable[xlns32_zh])<<16)+xlns32_sbltable[xlns32_zh]) \
  +( \
    ( \
-    (0x4000-(xlns32_zlmask&  \
+    ((xlns32_zlmask+1)-(xlns32_zlmask&  \
       ((xlns32_sbltable[xlns32_zh]-xlns32_sbltable[xlns32_zh+1])) \
     )) \
     *(xlns32_z&xlns32_zlmask)  \
@@ -169,6 +374,64 @@ xlns32 xlns32_z, xlns32_zh;
 //	return xlns32_sb_macro(z);
 //}
 
+#if defined(xlns32_quad) || defined(xlns32_dbquad)
+// sb and db by quadratic interpolation from about 15 Kbytes of tables
+// (xlns32quadtbl.h, written by xlns32genquad.cpp) instead of the linear
+// interpolation above, which reads about 66 Kbytes, and the cotransformation
+// below, which calls sb twice.  the segments widen with each octave of z as the
+// functions flatten out, and on each the chord between two nodes (kept to 2^-31)
+// is lowered by a 16-bit coefficient times t*(1-t).  sb adds log2(1+2^-z) to z;
+// db subtracts -log2(1-2^-z) from z, except that below octave xlns32_dbqlogoct
+// the table holds the smooth log2(z) - log2(1-2^-z) and log2(z) comes from the
+// leading bit of z and a third table.  both are within about half a unit of the
+// exact values (xlns32_db_ideal, which truncates, is up to 1.5 units off below
+// z = 1; db(0) is a large negative number, not -infinity), and return z from
+// octave xlns32_sbqoct on
+#include "xlns32quadtbl.h"
+
+// value at i + t/2^s, in units of 2^-(23+xlns32_sbqfrac)
+inline long long xlns32_quad_interp(const unsigned int *node, const short *c2,
+                                    unsigned int i, unsigned int s, long long t)
+{
+	long long a = node[i], b = node[i+1], h = (1LL << s) >> 1;
+	return a + (((b - a)*t + h) >> s) - ((c2[i]*((t*((1LL << s) - t)) >> s) + h) >> s);
+}
+
+inline xlns32 xlns32_sb_quad(xlns32 z)
+{
+	unsigned int k, s, i;
+	long long v;
+	k = z/xlns32_scale;
+	if (k >= xlns32_sbqoct)
+		return z;
+	i = xlns32_sbqoctave[k];
+	s = i & 0xff;
+	i = (i >> 8) + ((z & (xlns32_scale-1)) >> s);
+	v = xlns32_quad_interp(xlns32_sbqnode, xlns32_sbqc2, i, s, z & ((1 << s) - 1));
+	return z + (xlns32)((v + (1 << (xlns32_sbqfrac-1))) >> xlns32_sbqfrac);
+}
+
+inline xlns32 xlns32_db_quad(xlns32 z)
+{
+	unsigned int k, s, i, e, x;
+	long long v, l;
+	k = z/xlns32_scale;
+	if (k >= xlns32_sbqoct)
+		return z;
+	i = xlns32_dbqoctave[k];
+	s = i & 0xff;
+	i = (i >> 8) + ((z & (xlns32_scale-1)) >> s);
+	v = -xlns32_quad_interp(xlns32_dbqnode, xlns32_dbqc2, i, s, z & ((1 << s) - 1));
+	e = 31 - __builtin_clz(z | 1);                   // log2(z) = e - 23 + log2(1 + x/2^31)
+	x = (z << (31 - e)) & 0x7fffffff;
+	l = ((long long)e - 23)*((long long)xlns32_scale << xlns32_sbqfrac) +
+	    xlns32_quad_interp(xlns32_log2qnode, xlns32_log2qc2, x >> xlns32_log2qshift, xlns32_log2qshift,
+	                       x & ((1 << xlns32_log2qshift) - 1));
+	v += (k < xlns32_dbqlogoct) ? l : 0;
+	return z + (xlns32)((v + (1 << (xlns32_sbqfrac-1))) >> xlns32_sbqfrac);
+}
+#endif
+
 //xlns32_signed xlns32_dbtrans3(xlns32_signed z)
 xlns32 xlns32_dbtrans3(xlns32 z)
 {
@@ -235,6 +498,7 @@ inline xlns32 xlns32_add(xlns32 x, xlns32 y)
     maxxy  = (xl>yl) ? x  : y;
     z = minxyl - (maxxy&xlns32_logmask);
     usedb = xlns32_signmask&(x^y); 
+    xlns32_zprof(-z, usedb);
     #ifdef xlns32_ideal
      float pm1 = usedb ? -1.0 : 1.0;
      //adjust = log(1.0 + pm1*pow(2.0,((double)z)/xlns32_scale))/log(2.0)*xlns32_scale+.5;
@@ -245,6 +509,8 @@ inline xlns32 xlns32_add(xlns32 x, xlns32 y)
     #endif
     adjustez = (z < -xlns32_esszer) ? 0 : adjust; 
     //printf("z=%d %d %d\n",z,adjust,adjustez);
+    xlns32_count_if((z==0) && usedb, cancel);
+    xlns32_count_if(z < -xlns32_esszer, esszer);
     return ((z==0) && usedb) ? 
                      xlns32_zero :
                      xlns32_mul(maxxy, xlns32_logsignmask + adjustez);
@@ -267,17 +533,25 @@ xlns32 xlns32_add(xlns32 x, xlns32 y)
 		x = y;
 		y = t;
 	}
+	xlns32_zprof(z, xlns32_signmask&(x^y));
 	if (xlns32_signmask&(x^y))
 	{
 		if (z == 0)
+		{
+			xlns32_count(cancel);
 			return xlns32_zero;
+		}
 		if (z < xlns32_esszer)
 			return xlns32_neg(y + xlns32_db(z));
 		else
+		{
+			xlns32_count(esszer);
 			return xlns32_neg(y+z);
+		}
 	}
 	else
 	{
+		xlns32_count_if(z >= xlns32_esszer, esszer);
 		return y + xlns32_sb(z);
 	}
 }
@@ -389,10 +663,28 @@ inline xlns32 xlns32_fma(xlns32 a, xlns32 b, xlns32 c) {
     return xlns32_add(xlns32_mul(a, b), c);
 }
 
+// optional parallel batch kernels: define xlns_parallel before including this
+// file (C++11, link with -pthread); see xlnspool.cpp for the pool and its settings
+#ifdef xlns_parallel
+#include "xlnspool.cpp"
+#ifdef xlns32_zprofile
+// chunks of a parallel kernel count their adds under the kernel that split them
+inline int *xlns32_zprof_curvar() { return &xlns32_zprof_cur; }
+int xlns32_zprof_inherited = xlns_pool_inherits(xlns32_zprof_curvar);
+#endif
+#endif
+#ifndef xlns_parallel_split
+#define xlns_parallel_split(n, ...)
+#define xlns_parallel_sum(n, ...)
+#define xlns_parallel_loop(n, ...) { size_t i0 = 0, i1 = (n); __VA_ARGS__; }
+#define xlns_parallel_chunks(n, nchunks, ...) { size_t i0 = 0, i1 = (nchunks); __VA_ARGS__; }
+#endif
+
 // Batch conversion functions (for ggml tensor operations)
 
 // Batch convert float array to xlns32 array
 inline void xlns32_batch_from_float(const float *src, xlns32 *dst, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_from_float(src+i0, dst+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         dst[i] = fp2xlns32(src[i]);
     }
@@ -400,6 +692,7 @@ inline void xlns32_batch_from_float(const float *src, xlns32 *dst, size_t n) {
 
 // Batch convert xlns32 array to float array
 inline void xlns32_batch_to_float(const xlns32 *src, float *dst, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_to_float(src+i0, dst+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         dst[i] = xlns322fp(src[i]);
     }
@@ -407,15 +700,188 @@ inline void xlns32_batch_to_float(const xlns32 *src, float *dst, size_t n) {
 
 // Batch element-wise operations
 
+// SIMD element-wise operations (used when compiled with -mavx2 or better)
+// these give bit-identical results to the scalar functions above
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+// 8 lanes of xlns32_mul, including the xlns32_overflow saturation
+inline __m256i xlns32_mul_avx2(__m256i x, __m256i y)
+{
+    const __m256i logmask = _mm256_set1_epi32(xlns32_logmask);
+    __m256i temp = _mm256_sub_epi32(_mm256_add_epi32(_mm256_and_si256(x, logmask),
+                                                     _mm256_and_si256(y, logmask)),
+                                    _mm256_set1_epi32(xlns32_logsignmask));
+    __m256i sign = _mm256_and_si256(_mm256_xor_si256(x, y), _mm256_set1_epi32((int)xlns32_signmask));
+    __m256i ovf = _mm256_srai_epi32(temp, 31);                         // signmask&temp
+    __m256i unf = _mm256_srai_epi32(_mm256_slli_epi32(temp, 1), 31);   // logsignmask&temp
+    __m256i sat = _mm256_or_si256(sign, _mm256_andnot_si256(unf, logmask));
+    #ifdef xlns32_counters
+    xlns32_count_n(ovf, __builtin_popcount(_mm256_movemask_epi8(_mm256_andnot_si256(unf, ovf)))/4);
+    xlns32_count_n(unf, __builtin_popcount(_mm256_movemask_epi8(_mm256_and_si256(unf, ovf)))/4);
+    #endif
+    return _mm256_blendv_epi8(_mm256_or_si256(sign, temp), sat, ovf);
+}
+#endif
+
+// fp16 and blockwise int8/int4 conversion
+// As for xlns16 (see xlns16.cpp): IEEE half precision goes through its exponent
+// field and a 1024-entry table of 2^23*log2(1+m/1024) (from
+// xlns32genquanttbl.cpp), rounded to nearest, and blockwise int8/int4 values
+// are looked up and have the block scale added to their log, so
+// dst[i] == xlns32_mul(q82xlns32(q[i]), fp162xlns32(scale[i/block])), except that
+// q == 0 stays xlns32_zero (xlns32_qmul).  The batch versions use AVX2 gathers
+// and permutes and are split over the pool.
+
+#include <string.h>
+#include "xlns32quanttbl.h"
+
+typedef unsigned short xlns_fp16;     // IEEE binary16 bits
+
+inline xlns32 fp162xlns32(xlns_fp16 x) {
+    xlns32 s = (xlns32)(x & 0x8000) << 16;
+    unsigned int e = x & 0x7c00;
+    unsigned int m = x & 0x3ff;
+    if (e - 0x400 >= 0x7800) {                          // exponent field 0 or 31
+        if (e)
+            return s | xlns32_pos_inf;
+        if (m == 0)
+            return xlns32_zero;
+        int p = 31 - __builtin_clz(m);                  // subnormal m*2^-24
+        return s | (((xlns32)p << 23) + xlns32_logsignmask - (24 << 23) + xlns32fp16logtbl[(m << (10 - p)) & 0x3ff]);
+    }
+    return s | (((xlns32)e << 13) + xlns32_logsignmask - (15 << 23) + xlns32fp16logtbl[m]);
+}
+
+inline xlns32 q82xlns32(signed char q) {
+    return xlns32q8tbl[(unsigned char)q];
+}
+
+// table value times the block scale, keeping zero
+inline xlns32 xlns32_qmul(xlns32 t, xlns32 s) {
+    return (t == xlns32_zero) ? xlns32_zero : xlns32_mul(t, s);
+}
+
+#ifdef __AVX2__
+// 8 lanes of xlns32_qmul
+inline __m256i xlns32_qmul_avx2(__m256i t, __m256i s) {
+    return _mm256_andnot_si256(_mm256_cmpeq_epi32(t, _mm256_set1_epi32(xlns32_zero)), xlns32_mul_avx2(t, s));
+}
+#endif
+
+// Batch convert fp16 array to xlns32 array
+inline void xlns32_batch_from_fp16(const xlns_fp16 *src, xlns32 *dst, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_from_fp16(src+i0, dst+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    const __m256i expmask = _mm256_set1_epi32(0x7c00);
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src+i)));
+        __m256i e = _mm256_and_si256(x, expmask);
+        __m256i zero = _mm256_cmpeq_epi32(e, _mm256_setzero_si256());
+        __m256i m = _mm256_and_si256(x, _mm256_set1_epi32(0x3ff));
+        if (!_mm256_testz_si256(zero, m) || !_mm256_testz_si256(_mm256_cmpeq_epi32(e, expmask), expmask)) {
+            for (size_t k = i; k < i + 8; k++) dst[k] = fp162xlns32(src[k]);    // subnormal, inf, NaN
+            continue;
+        }
+        __m256i r = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(e, 13),
+                                                      _mm256_set1_epi32(xlns32_logsignmask - (15 << 23))),
+                                     _mm256_i32gather_epi32((const int *)xlns32fp16logtbl, m, 4));
+        r = _mm256_or_si256(r, _mm256_slli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x8000)), 16));
+        _mm256_storeu_si256((__m256i *)(dst+i), _mm256_andnot_si256(zero, r));
+    }
+    #endif
+    for (; i < n; i++) {
+        dst[i] = fp162xlns32(src[i]);
+    }
+}
+
+// Blockwise int8 to xlns32 over the elements [i0, i1)
+inline void xlns32_q8_range(const signed char *q, const xlns_fp16 *scale, size_t block, xlns32 *dst,
+                            size_t i0, size_t i1) {
+    while (i0 < i1) {
+        size_t b = i0/block;
+        size_t e = ((b+1)*block < i1) ? (b+1)*block : i1;
+        xlns32 s = fp162xlns32(scale[b]);
+        size_t i = i0;
+        #ifdef __AVX2__
+        const __m256i vs = _mm256_set1_epi32((int)s);
+        for (; i + 8 <= e; i += 8) {
+            __m256i k = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(q+i)));
+            __m256i t = _mm256_i32gather_epi32((const int *)xlns32q8tbl, k, 4);
+            _mm256_storeu_si256((__m256i *)(dst+i), xlns32_qmul_avx2(t, vs));
+        }
+        #endif
+        for (; i < e; i++)
+            dst[i] = xlns32_qmul(xlns32q8tbl[(unsigned char)q[i]], s);
+        i0 = e;
+    }
+}
+
+// Blockwise int4 (two per byte, low nibble first, stored as v+8) to xlns32 over [i0, i1)
+inline void xlns32_q4_range(const unsigned char *q, const xlns_fp16 *scale, size_t block, xlns32 *dst,
+                            size_t i0, size_t i1) {
+    #ifdef __AVX2__
+    const __m256i t0 = _mm256_loadu_si256((const __m256i *)xlns32q4tbl);
+    const __m256i t1 = _mm256_loadu_si256((const __m256i *)(xlns32q4tbl+8));
+    #endif
+    while (i0 < i1) {
+        size_t b = i0/block;
+        size_t e = ((b+1)*block < i1) ? (b+1)*block : i1;
+        xlns32 s = fp162xlns32(scale[b]);
+        size_t i = i0;
+        #ifdef __AVX2__
+        if (i & 1) {
+            dst[i] = xlns32_qmul(xlns32q4tbl[q[i/2] >> 4], s);
+            i++;
+        }
+        const __m256i vs = _mm256_set1_epi32((int)s);
+        for (; i + 8 <= e; i += 8) {
+            int w;
+            memcpy(&w, q+i/2, sizeof(w));                                // 8 nibbles
+            __m256i k = _mm256_srlv_epi32(_mm256_set1_epi32(w), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+            k = _mm256_and_si256(k, _mm256_set1_epi32(0xf));
+            __m256 hi = _mm256_castsi256_ps(_mm256_slli_epi32(k, 28));   // entries 8-15
+            __m256i t = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(_mm256_permutevar8x32_epi32(t0, k)),
+                                                             _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(t1, k)), hi));
+            _mm256_storeu_si256((__m256i *)(dst+i), xlns32_qmul_avx2(t, vs));
+        }
+        #endif
+        for (; i < e; i++)
+            dst[i] = xlns32_qmul(xlns32q4tbl[(q[i/2] >> (4*(i&1))) & 0xf], s);
+        i0 = e;
+    }
+}
+
+// Batch convert n int8 values with one fp16 scale per block of block values
+inline void xlns32_batch_from_q8(const signed char *q, const xlns_fp16 *scale, size_t block, xlns32 *dst, size_t n) {
+    xlns_parallel_loop(n, xlns32_q8_range(q, scale, block, dst, i0, i1));
+}
+
+// Batch convert n int4 values (n/2 bytes) with one fp16 scale per block of block values
+inline void xlns32_batch_from_q4(const unsigned char *q, const xlns_fp16 *scale, size_t block, xlns32 *dst, size_t n) {
+    xlns_parallel_loop(n, xlns32_q4_range(q, scale, block, dst, i0, i1));
+}
+
 // Batch multiplication: c[i] = a[i] * b[i]
 inline void xlns32_batch_mul(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns32_batch_mul(a+i0, b+i0, c+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns32_mul_avx2(_mm256_loadu_si256((const __m256i *)(a+i)),
+                                                              _mm256_loadu_si256((const __m256i *)(b+i))));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns32_mul(a[i], b[i]);
     }
 }
 
 // Batch addition: c[i] = a[i] + b[i]
 inline void xlns32_batch_add(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_add(a+i0, b+i0, c+i0, i1-i0));
+    xlns32_zprof_kernel("xlns32_batch_add");
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_add(a[i], b[i]);
     }
@@ -423,6 +889,8 @@ inline void xlns32_batch_add(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t
 
 // Batch subtraction: c[i] = a[i] - b[i]
 inline void xlns32_batch_sub(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_sub(a+i0, b+i0, c+i0, i1-i0));
+    xlns32_zprof_kernel("xlns32_batch_sub");
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_sub(a[i], b[i]);
     }
@@ -430,6 +898,7 @@ inline void xlns32_batch_sub(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t
 
 // Batch division: c[i] = a[i] / b[i]
 inline void xlns32_batch_div(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_div(a+i0, b+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_div(a[i], b[i]);
     }
@@ -437,13 +906,21 @@ inline void xlns32_batch_div(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t
 
 // Batch scale: c[i] = a[i] * scalar
 inline void xlns32_batch_scale(const xlns32 *a, xlns32 scalar, xlns32 *c, size_t n) {
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_split(n, xlns32_batch_scale(a+i0, scalar, c+i0, i1-i0));
+    size_t i = 0;
+    #ifdef __AVX2__
+    const __m256i s = _mm256_set1_epi32((int)scalar);
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns32_mul_avx2(_mm256_loadu_si256((const __m256i *)(a+i)), s));
+    #endif
+    for (; i < n; i++) {
         c[i] = xlns32_mul(a[i], scalar);
     }
 }
 
 // Batch negation: c[i] = -a[i]
 inline void xlns32_batch_neg(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_neg(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_neg(a[i]);
     }
@@ -451,16 +928,188 @@ inline void xlns32_batch_neg(const xlns32 *a, xlns32 *c, size_t n) {
 
 // Batch absolute value: c[i] = |a[i]|
 inline void xlns32_batch_abs(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_abs(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_abs(a[i]);
     }
 }
 
+// Log-domain addition over fixed-point logs (see xlns16_logadd): a stands for
+// 2^(a/xlns32_scale), xlns32_log_zero for 0, logs above xlns32_log_max saturate,
+// and the results have the same bits as xlns32_add, with 0 absorbed exactly
+#define xlns32_log_zero      (-(xlns32_signed)xlns32_logsignmask)
+#define xlns32_log_max       ((xlns32_signed)xlns32_logsignmask - 1)
+#define xlns322log(x)        ((xlns32_signed)(((x) & xlns32_logmask) - xlns32_logsignmask))
+
+inline xlns32 xlns32_log2xlns32(xlns32_signed a) {
+    if (a <= xlns32_log_zero) return xlns32_zero;
+    if (a >= xlns32_log_max) return xlns32_logmask;
+    return (xlns32)a + xlns32_logsignmask;
+}
+
+// xlns32_add of the xlns32 forms of two logs, with zero (of either sign) as 0
+inline xlns32 xlns32_add_log0(xlns32 x, xlns32 y) {
+    if (!(x & xlns32_logmask)) return y;
+    if (!(y & xlns32_logmask)) return x;
+    return xlns32_add(x, y);
+}
+
+inline xlns32_signed xlns32_logadd(xlns32_signed a, xlns32_signed b) {
+    return xlns322log(xlns32_add_log0(xlns32_log2xlns32(a), xlns32_log2xlns32(b)));
+}
+
+inline xlns32_signed xlns32_logsub(xlns32_signed a, xlns32_signed b) {
+    return xlns322log(xlns32_add_log0(xlns32_log2xlns32(a), xlns32_neg(xlns32_log2xlns32(b))));
+}
+
+// c[i] = log2(2^a[i] + 2^b[i])
+inline void xlns32_batch_logadd(const xlns32_signed *a, const xlns32_signed *b, xlns32_signed *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_logadd(a+i0, b+i0, c+i0, i1-i0));
+    xlns32_zprof_kernel("xlns32_batch_logadd");
+    for (size_t i = 0; i < n; i++)
+        c[i] = xlns32_logadd(a[i], b[i]);
+}
+
+// c[i] = log2|2^a[i] - 2^b[i]| (xlns32_log_zero where a[i] == b[i])
+inline void xlns32_batch_logsub(const xlns32_signed *a, const xlns32_signed *b, xlns32_signed *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_logsub(a+i0, b+i0, c+i0, i1-i0));
+    xlns32_zprof_kernel("xlns32_batch_logsub");
+    for (size_t i = 0; i < n; i++)
+        c[i] = xlns32_logsub(a[i], b[i]);
+}
+
+// r[i] = sb(z[i]) = log2(1 + 2^z[i]), as xlns32_logadd(z[i], 0)
+inline void xlns32_batch_sb(const xlns32_signed *z, xlns32_signed *r, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_sb(z+i0, r+i0, i1-i0));
+    for (size_t i = 0; i < n; i++)
+        r[i] = xlns32_logadd(z[i], 0);
+}
+
+// r[i] = db(z[i]) = log2|1 - 2^z[i]|, as xlns32_logsub(z[i], 0)
+inline void xlns32_batch_db(const xlns32_signed *z, xlns32_signed *r, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_db(z+i0, r+i0, i1-i0));
+    for (size_t i = 0; i < n; i++)
+        r[i] = xlns32_logsub(z[i], 0);
+}
+
+// Log-sum-exp over fixed-point logs, in lanes within blocks and the block sums
+// added pairwise (see xlns16_logsumexp; the SIMD log-domain sum for xlns32 is
+// xlns32_logsumexp_lpvip in xlns32lpvip.cpp)
+#define xlns32_logsumexp_lanes 16
+#define xlns32_logsumexp_block 256
+
+struct xlns32_logsumexp_acc {
+    xlns32 lane[xlns32_logsumexp_lanes];     // as positive xlns32
+    xlns32 level[8*sizeof(size_t)];
+    size_t count;
+};
+
+inline void xlns32_logsumexp_init(xlns32_logsumexp_acc *acc) {
+    acc->count = 0;
+}
+
+inline void xlns32_logsumexp_push(xlns32_logsumexp_acc *acc, const xlns32_signed *a, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        size_t k = acc->count % xlns32_logsumexp_block, j = k % xlns32_logsumexp_lanes;
+        xlns32 v = xlns32_log2xlns32(a[i]);
+        acc->lane[j] = (k < xlns32_logsumexp_lanes) ? v : xlns32_add_log0(acc->lane[j], v);
+        if (++acc->count % xlns32_logsumexp_block)
+            continue;
+        xlns32 s = acc->lane[0];
+        for (j = 1; j < xlns32_logsumexp_lanes; j++)
+            s = xlns32_add_log0(s, acc->lane[j]);
+        size_t l = 0, blocks = acc->count/xlns32_logsumexp_block - 1;
+        for (; blocks & 1; blocks >>= 1, l++)
+            s = xlns32_add_log0(acc->level[l], s);
+        acc->level[l] = s;
+    }
+}
+
+inline xlns32_signed xlns32_logsumexp_result(const xlns32_logsumexp_acc *acc) {
+    if (acc->count == 0) return xlns32_log_zero;
+    size_t blocks = acc->count/xlns32_logsumexp_block, k = acc->count % xlns32_logsumexp_block;
+    size_t lanes = (k < xlns32_logsumexp_lanes) ? k : xlns32_logsumexp_lanes;
+    xlns32 sum = xlns32_zero;
+    for (size_t l = 0; blocks; blocks >>= 1, l++)
+        if (blocks & 1)
+            sum = xlns32_add_log0(acc->level[l], sum);
+    for (size_t j = 0; j < lanes; j++)
+        sum = xlns32_add_log0(sum, acc->lane[j]);
+    return xlns322log(sum);
+}
+
+inline xlns32_signed xlns32_logsumexp(const xlns32_signed *a, size_t n) {
+    xlns32_zprof_kernel("xlns32_logsumexp");
+    xlns32_logsumexp_acc acc;
+    xlns32_logsumexp_init(&acc);
+    xlns32_logsumexp_push(&acc, a, n);
+    return xlns32_logsumexp_result(&acc);
+}
+
 // Vector operations (critical for ggml MUL_MAT)
 
+// Fixed-tree sums
+// the array is cut into xlns32_treechunk-element chunks, each chunk is summed in
+// order (by any thread), and the chunk sums are added pairwise, ((p0+p1)+(p2+p3))+...
+// the tree depends only on n, so the result has the same bits for any number of
+// threads, with or without xlns_parallel (it differs from the sequential xlns32_sum,
+// usually for the better, as the partial sums are of similar size)
+
+#include <vector>
+
+#ifndef xlns32_treechunk
+#define xlns32_treechunk 4096
+#endif
+
+inline xlns32 xlns32_add_fn(xlns32 x, xlns32 y) { return xlns32_add(x, y); }
+
+// partial(i0, i1) reduces elements [i0, i1) of a chunk to a T (n > 0); add
+// combines two partials
+template <class T, class P, class A>
+inline T xlns32_tree_reduce_of(size_t n, const P &partial, const A &add) {
+    size_t nc = (n + xlns32_treechunk - 1)/xlns32_treechunk;
+    std::vector<T> part(nc);
+    xlns_parallel_chunks(n, nc, for (size_t c = i0; c < i1; c++)
+        part[c] = partial(c*xlns32_treechunk, (c == nc-1) ? n : (c+1)*xlns32_treechunk));
+    for (size_t w = 1; w < nc; w *= 2)
+        for (size_t c = 0; c + w < nc; c += 2*w)
+            part[c] = add(part[c], part[c+w]);
+    return part[0];
+}
+
+template <class P, class A>
+inline xlns32 xlns32_tree_reduce(size_t n, const P &partial, const A &add) {
+    if (n == 0) return xlns32_zero;
+    return xlns32_tree_reduce_of<xlns32>(n, partial, add);
+}
+
+// Sum of array elements with the fixed tree
+inline xlns32 xlns32_sum_tree(const xlns32 *a, size_t n) {
+    xlns32_zprof_kernel("xlns32_sum_tree");
+    return xlns32_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns32 sum = a[i0];
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns32_add(sum, a[i]);
+        return sum;
+    }, xlns32_add_fn);
+}
+
+// Dot product with the fixed tree
+inline xlns32 xlns32_vec_dot_tree(const xlns32 *a, const xlns32 *b, size_t n) {
+    xlns32_zprof_kernel("xlns32_vec_dot_tree");
+    return xlns32_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns32 sum = xlns32_mul(a[i0], b[i0]);
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns32_add(sum, xlns32_mul(a[i], b[i]));
+        return sum;
+    }, xlns32_add_fn);
+}
+
 // Sum of array elements: result = Σ a[i]
 inline xlns32 xlns32_sum(const xlns32 *a, size_t n) {
+    xlns32_zprof_kernel("xlns32_sum");
     if (n == 0) return xlns32_zero;
+    xlns_parallel_sum(n, xlns32_sum_tree(a, n));
     xlns32 sum = a[0];
     for (size_t i = 1; i < n; i++) {
         sum = xlns32_add(sum, a[i]);
@@ -470,7 +1119,9 @@ inline xlns32 xlns32_sum(const xlns32 *a, size_t n) {
 
 // Vector dot product: result = Σ(a[i] * b[i])
 inline xlns32 xlns32_vec_dot(const xlns32 *a, const xlns32 *b, size_t n) {
+    xlns32_zprof_kernel("xlns32_vec_dot");
     if (n == 0) return xlns32_zero;
+    xlns_parallel_sum(n, xlns32_vec_dot_tree(a, b, n));
     xlns32 sum = xlns32_mul(a[0], b[0]);
     for (size_t i = 1; i < n; i++) {
         sum = xlns32_add(sum, xlns32_mul(a[i], b[i]));
@@ -489,6 +1140,155 @@ inline float xlns32_vec_dot_f32(const float *a, const float *b, size_t n) {
     return xlns322fp(sum);
 }
 
+// Matrix-vector products (batch-1 decode)
+// As for xlns16_gemv in xlns16.cpp: rows (or blocks of columns for the
+// transposed product) are split over the pool, the weights are prefetched
+// xlns32_prefetchdist elements ahead, the products use xlns32_batch_mul/
+// xlns32_batch_scale (SIMD with -mavx2) and the additions keep the order of
+// xlns32_vec_dot, so the bits do not depend on the number of threads.
+
+#if defined(__GNUC__)
+#define xlns32_prefetch(p) __builtin_prefetch((p), 0, 0)
+#else
+#define xlns32_prefetch(p)
+#endif
+#ifndef xlns32_prefetchdist
+#define xlns32_prefetchdist 512
+#endif
+#define xlns32_gemv_chunk 256
+
+// Prefetch the m elements at w+xlns32_prefetchdist (one per 64-byte line)
+inline void xlns32_prefetch_ahead(const xlns32 *w, size_t m) {
+    for (size_t k = 0; k < m; k += 16)
+        xlns32_prefetch(w + xlns32_prefetchdist + k);
+}
+
+// One row: the same bits as xlns32_vec_dot(w, x, cols)
+inline xlns32 xlns32_gemv_row(const xlns32 *w, const xlns32 *x, size_t cols) {
+    if (cols == 0) return xlns32_zero;
+    xlns32 prod[xlns32_gemv_chunk];
+    xlns32 sum = xlns32_zero;
+    for (size_t i = 0; i < cols; i += xlns32_gemv_chunk) {
+        size_t m = (cols - i < xlns32_gemv_chunk) ? cols - i : xlns32_gemv_chunk;
+        xlns32_prefetch_ahead(w+i, m);
+        xlns32_batch_mul(w+i, x+i, prod, m);
+        size_t k = 0;
+        if (i == 0) sum = prod[k++];
+        for (; k < m; k++)
+            sum = xlns32_add(sum, prod[k]);
+    }
+    return sum;
+}
+
+// y = W x: y[r] = xlns32_vec_dot(W + r*cols, x, cols), x has cols elements
+inline void xlns32_gemv(const xlns32 *W, const xlns32 *x, xlns32 *y, size_t rows, size_t cols) {
+    xlns32_zprof_kernel("xlns32_gemv");
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns32_gemv_row(W + r*cols, x, cols));
+}
+
+// y = W^T x: y[c] = dot product of column c of W with x (x has rows elements,
+// y has cols); each block of xlns32_gemv_chunk columns keeps its sums in y
+// and streams the rows of W
+inline void xlns32_gemv_t(const xlns32 *W, const xlns32 *x, xlns32 *y, size_t rows, size_t cols) {
+    xlns32_zprof_kernel("xlns32_gemv_t");
+    size_t nb = (cols + xlns32_gemv_chunk - 1)/xlns32_gemv_chunk;
+    xlns_parallel_chunks(rows*cols, nb, for (size_t b = i0; b < i1; b++) {
+        size_t c0 = b*xlns32_gemv_chunk;
+        size_t m = (cols - c0 < xlns32_gemv_chunk) ? cols - c0 : xlns32_gemv_chunk;
+        xlns32 prod[xlns32_gemv_chunk];
+        if (rows == 0) {
+            for (size_t k = 0; k < m; k++) y[c0+k] = xlns32_zero;
+            continue;
+        }
+        xlns32_batch_scale(W + c0, x[0], y + c0, m);
+        for (size_t r = 1; r < rows; r++) {
+            const xlns32 *w = W + r*cols + c0;
+            for (size_t k = 0; k < m; k += 16)
+                xlns32_prefetch(w + cols + k);   // same columns, next row
+            xlns32_batch_scale(w, x[r], prod, m);
+            for (size_t k = 0; k < m; k++)
+                y[c0+k] = xlns32_add(y[c0+k], prod[k]);
+        }
+    });
+}
+
+// Mixed-format products: float or bfloat16 activations, xlns32 weights, float outputs
+// The weights are converted to LNS once, ahead of time; each call converts the
+// activation vector once (xlns32_batch_from_float / xlns32_batch_from_bf16) into
+// scratch, then runs the rows as xlns32_gemv does.  scratch (at least cols
+// elements) can be passed in to be reused between calls; when it is NULL a
+// per-thread buffer, grown on demand, is used.  Every output is
+// xlns322fp(xlns32_vec_dot(W + r*cols, converted x, cols)).
+
+#include <string.h>
+
+#ifndef xlns_bf16_included
+#define xlns_bf16_included
+typedef unsigned short xlns_bf16;     // bfloat16 bits: the top half of a float
+#endif
+
+inline float xlns32_bf162fp(xlns_bf16 x) {
+    unsigned int u = (unsigned int)x << 16;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Batch convert bfloat16 array to xlns32 array
+inline void xlns32_batch_from_bf16(const xlns_bf16 *src, xlns32 *dst, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_from_bf16(src+i0, dst+i0, i1-i0));
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = fp2xlns32(xlns32_bf162fp(src[i]));
+    }
+}
+
+// Per-thread scratch of at least n elements (kept between calls)
+inline xlns32 *xlns32_scratch(size_t n) {
+    static thread_local std::vector<xlns32> buf;
+    if (buf.size() < n) buf.resize(n);
+    return buf.data();
+}
+
+// y[r] = xlns322fp(xlns32_vec_dot(W + r*cols, x, cols)), x already converted
+inline void xlns32_gemv_tofloat(const xlns32 *W, const xlns32 *x, float *y, size_t rows, size_t cols) {
+    xlns32_zprof_kernel("xlns32_gemv_tofloat");
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns322fp(xlns32_gemv_row(W + r*cols, x, cols)));
+}
+
+// y = W x with float x (cols elements) and float y (rows elements)
+inline void xlns32_gemv_f32(const xlns32 *W, const float *x, float *y, size_t rows, size_t cols,
+                            xlns32 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns32_scratch(cols);
+    xlns32_batch_from_float(x, scratch, cols);
+    xlns32_gemv_tofloat(W, scratch, y, rows, cols);
+}
+
+// y = W x with bfloat16 x (cols elements) and float y (rows elements)
+inline void xlns32_gemv_bf16(const xlns32 *W, const xlns_bf16 *x, float *y, size_t rows, size_t cols,
+                             xlns32 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns32_scratch(cols);
+    xlns32_batch_from_bf16(x, scratch, cols);
+    xlns32_gemv_tofloat(W, scratch, y, rows, cols);
+}
+
+// Dot product of LNS weights w with float activations x, float result
+inline float xlns32_vec_dot_f32x(const xlns32 *w, const float *x, size_t n, xlns32 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns32_scratch(n);
+    xlns32_batch_from_float(x, scratch, n);
+    xlns_parallel_sum(n, xlns322fp(xlns32_vec_dot_tree(w, scratch, n)));
+    return xlns322fp(xlns32_gemv_row(w, scratch, n));
+}
+
+// Dot product of LNS weights w with bfloat16 activations x, float result
+inline float xlns32_vec_dot_bf16x(const xlns32 *w, const xlns_bf16 *x, size_t n, xlns32 *scratch = NULL) {
+    if (scratch == NULL) scratch = xlns32_scratch(n);
+    xlns32_batch_from_bf16(x, scratch, n);
+    xlns_parallel_sum(n, xlns322fp(xlns32_vec_dot_tree(w, scratch, n)));
+    return xlns322fp(xlns32_gemv_row(w, scratch, n));
+}
+
 // Maximum element in array
 inline xlns32 xlns32_max_array(const xlns32 *a, size_t n) {
     if (n == 0) return xlns32_zero;
@@ -522,6 +1322,7 @@ inline xlns32 xlns32_relu(xlns32 x) {
 
 // Batch ReLU
 inline void xlns32_batch_relu(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_relu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_relu(a[i]);
     }
@@ -538,6 +1339,7 @@ inline xlns32 xlns32_sigmoid(xlns32 x) {
 
 // Batch sigmoid
 inline void xlns32_batch_sigmoid(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_sigmoid(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_sigmoid(a[i]);
     }
@@ -552,6 +1354,7 @@ inline xlns32 xlns32_tanh(xlns32 x) {
 
 // Batch tanh
 inline void xlns32_batch_tanh(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_tanh(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_tanh(a[i]);
     }
@@ -566,6 +1369,7 @@ inline xlns32 xlns32_silu(xlns32 x) {
 
 // Batch SiLU
 inline void xlns32_batch_silu(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_silu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_silu(a[i]);
     }
@@ -582,6 +1386,7 @@ inline xlns32 xlns32_gelu(xlns32 x) {
 
 // Batch GELU
 inline void xlns32_batch_gelu(const xlns32 *a, xlns32 *c, size_t n) {
+    xlns_parallel_split(n, xlns32_batch_gelu(a+i0, c+i0, i1-i0));
     for (size_t i = 0; i < n; i++) {
         c[i] = xlns32_gelu(a[i]);
     }
@@ -648,6 +1453,7 @@ inline xlns32 xlns32_pow(xlns32 base, xlns32 exponent) {
 // c may alias a (in-place): every pass only reads index i before writing
 // index i, and the sum pass runs after all per-element writes complete.
 inline void xlns32_softmax(const xlns32 *a, xlns32 *c, size_t n, xlns32 scale = xlns32_one) {
+    xlns32_zprof_kernel("xlns32_softmax");
     if (n == 0) return;
     xlns32 maxval = xlns32_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -656,11 +1462,11 @@ inline void xlns32_softmax(const xlns32 *a, xlns32 *c, size_t n, xlns32 scale =
         c[i] = v;
         if (xlns32_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns32_exp(xlns32_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns32_exp(xlns32_sub(c[i], maxval)));
     xlns32 total = xlns32_sum(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns32_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns32_div(c[i], total));
 }
 
 // Masked variant of xlns32_softmax. mask[i] is a pre-converted xlns32 value:
@@ -669,6 +1475,7 @@ inline void xlns32_softmax(const xlns32 *a, xlns32 *c, size_t n, xlns32 scale =
 // that position, anything else is treated as an additive bias (e.g. ALiBi).
 inline void xlns32_softmax_masked(const xlns32 *a, const xlns32 *mask, xlns32 *c,
                                    size_t n, xlns32 scale = xlns32_one) {
+    xlns32_zprof_kernel("xlns32_softmax_masked");
     if (n == 0) return;
     xlns32 maxval = xlns32_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -681,35 +1488,321 @@ inline void xlns32_softmax_masked(const xlns32 *a, const xlns32 *mask, xlns32 *c
         c[i] = v;
         if (xlns32_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns32_exp(xlns32_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns32_exp(xlns32_sub(c[i], maxval)));
     xlns32 total = xlns32_sum(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns32_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns32_div(c[i], total));
 }
 
 
+// Sum of squared differences from mean (starting from zero), for layernorm
+inline xlns32 xlns32_sum_sqdiff(const xlns32 *x, xlns32 mean, size_t n) {
+    auto partial = [=](size_t i0, size_t i1) {
+        xlns32 var = xlns32_zero;
+        for (size_t i = i0; i < i1; i++) {
+            xlns32 diff = xlns32_sub(x[i], mean);
+            var = xlns32_add(var, xlns32_mul(diff, diff));
+        }
+        return var;
+    };
+    xlns_parallel_sum(n, xlns32_tree_reduce(n, partial, xlns32_add_fn));
+    return partial(0, n);
+}
+
 // Layer normalization: (x - mean) / sqrt(var + eps) * gamma + beta
 inline void xlns32_layernorm(const xlns32 *x, xlns32 *out,
                        const xlns32 *gamma, const xlns32 *beta,
                        size_t n, float eps) {
+    xlns32_zprof_kernel("xlns32_layernorm");
+    xlns32 nn = fp2xlns32((float)n);
     // compute mean
     xlns32 mean = xlns32_sum(x, n);
-    mean = xlns32_div(mean, fp2xlns32((float)n));
+    mean = xlns32_div(mean, nn);
     // compute variance
-    xlns32 var = xlns32_zero;
-    for (size_t i = 0; i < n; i++) {
-        xlns32 diff = xlns32_sub(x[i], mean);
-        var = xlns32_add(var, xlns32_mul(diff, diff));
-    }
-    var = xlns32_div(var, fp2xlns32((float)n));
+    xlns32 var = xlns32_sum_sqdiff(x, mean, n);
+    var = xlns32_div(var, nn);
     // normalize
     xlns32 inv_std = fp2xlns32(1.0f / sqrt(xlns322fp(var) + eps));
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
         out[i] = xlns32_mul(xlns32_sub(x[i], mean), inv_std);
         if (gamma) out[i] = xlns32_mul(out[i], gamma[i]);
         if (beta)  out[i] = xlns32_add(out[i], beta[i]);
+    });
+}
+
+// RMS normalization: x / sqrt(mean(x^2) + eps) * gamma (see xlns16_rmsnorm)
+inline void xlns32_rmsnorm(const xlns32 *x, xlns32 *out, const xlns32 *gamma,
+                           size_t n, float eps) {
+    xlns32_zprof_kernel("xlns32_rmsnorm");
+    if (n == 0) return;
+    xlns32 ms = xlns32_div(xlns32_vec_dot_tree(x, x, n), fp2xlns32((float)n));
+    xlns32 inv_rms = xlns32_div(xlns32_one, xlns32_sqrt(xlns32_add(ms, fp2xlns32(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns32_mul(x[i], inv_rms);
+        if (gamma) out[i] = xlns32_mul(out[i], gamma[i]);
+    });
+}
+
+// Shifted sums for the one-pass layernorms (see xlns16_moments)
+struct xlns32_moments {
+    xlns32 s1, s2;
+};
+
+inline xlns32_moments xlns32_moments_add(xlns32_moments a, xlns32_moments b) {
+    xlns32_moments m = { xlns32_add(a.s1, b.s1), xlns32_add(a.s2, b.s2) };
+    return m;
+}
+
+inline xlns32_moments xlns32_moments_range(const xlns32 *x, xlns32 k, size_t i0, size_t i1) {
+    xlns32_moments m = { xlns32_zero, xlns32_zero };
+    for (size_t i = i0; i < i1; i++) {
+        xlns32 d = xlns32_sub(x[i], k);
+        m.s1 = xlns32_add(m.s1, d);
+        m.s2 = xlns32_add(m.s2, xlns32_mul(d, d));
     }
+    return m;
+}
+
+inline void xlns32_layernorm_moments(const xlns32 *x, xlns32 *out,
+                       const xlns32 *gamma, const xlns32 *beta,
+                       size_t n, float eps, xlns32 k, xlns32_moments s) {
+    xlns32 nn = fp2xlns32((float)n);
+    xlns32 dm = xlns32_div(s.s1, nn);                   // mean - k
+    xlns32 mean = xlns32_add(k, dm);
+    xlns32 var = xlns32_sub(xlns32_div(s.s2, nn), xlns32_mul(dm, dm));
+    if (xlns32_is_negative(var)) var = xlns32_zero;     // rounding
+    xlns32 inv_std = xlns32_div(xlns32_one, xlns32_sqrt(xlns32_add(var, fp2xlns32(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns32_mul(xlns32_sub(x[i], mean), inv_std);
+        if (gamma) out[i] = xlns32_mul(out[i], gamma[i]);
+        if (beta)  out[i] = xlns32_add(out[i], beta[i]);
+    });
+}
+
+// Layer normalization as xlns32_layernorm, with the mean and variance from a
+// single read of x (shifted sums over the fixed tree, see xlns16_layernorm_onepass)
+inline void xlns32_layernorm_onepass(const xlns32 *x, xlns32 *out,
+                       const xlns32 *gamma, const xlns32 *beta,
+                       size_t n, float eps) {
+    xlns32_zprof_kernel("xlns32_layernorm_onepass");
+    if (n == 0) return;
+    size_t m = (n < 16) ? n : 16;
+    xlns32 k = xlns32_div(xlns32_sum(x, m), fp2xlns32((float)m));
+    xlns32_moments s = xlns32_tree_reduce_of<xlns32_moments>(n, [=](size_t i0, size_t i1) {
+        return xlns32_moments_range(x, k, i0, i1);
+    }, xlns32_moments_add);
+    xlns32_layernorm_moments(x, out, gamma, beta, n, eps, k, s);
+}
+
+// Residual add fused with the following norm: xr = x + r (xr may be x) and
+// out = the norm of xr, with the statistics of each tree chunk taken as it is
+// written (see xlns16_add_rmsnorm)
+inline void xlns32_add_rmsnorm(const xlns32 *x, const xlns32 *r, xlns32 *xr, xlns32 *out,
+                               const xlns32 *gamma, size_t n, float eps) {
+    xlns32_zprof_kernel("xlns32_add_rmsnorm");
+    if (n == 0) return;
+    xlns32 ss = xlns32_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns32_batch_add(x+i0, r+i0, xr+i0, i1-i0);
+        xlns32 sum = xlns32_mul(xr[i0], xr[i0]);
+        for (size_t i = i0+1; i < i1; i++)
+            sum = xlns32_add(sum, xlns32_mul(xr[i], xr[i]));
+        return sum;
+    }, xlns32_add_fn);
+    xlns32 ms = xlns32_div(ss, fp2xlns32((float)n));
+    xlns32 inv_rms = xlns32_div(xlns32_one, xlns32_sqrt(xlns32_add(ms, fp2xlns32(eps))));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns32_mul(xr[i], inv_rms);
+        if (gamma) out[i] = xlns32_mul(out[i], gamma[i]);
+    });
+}
+
+inline void xlns32_add_layernorm(const xlns32 *x, const xlns32 *r, xlns32 *xr, xlns32 *out,
+                       const xlns32 *gamma, const xlns32 *beta,
+                       size_t n, float eps) {
+    xlns32_zprof_kernel("xlns32_add_layernorm");
+    if (n == 0) return;
+    size_t m = (n < 16) ? n : 16;                       // the shift comes first
+    xlns32_batch_add(x, r, xr, m);
+    xlns32 k = xlns32_div(xlns32_sum(xr, m), fp2xlns32((float)m));
+    xlns32_moments s = xlns32_tree_reduce_of<xlns32_moments>(n, [=](size_t i0, size_t i1) {
+        size_t j = (i0 < m) ? m : i0;
+        if (j < i1) xlns32_batch_add(x+j, r+j, xr+j, i1-j);
+        return xlns32_moments_range(xr, k, i0, i1);
+    }, xlns32_moments_add);
+    xlns32_layernorm_moments(xr, out, gamma, beta, n, eps, k, s);
+}
+
+// Row-wise kernels over 2-D tensors, split over the pool by rows, and the
+// implicit masks of the row-wise softmax (the same as for xlns16, see
+// xlns16_softmax_rows; xlns_mask is defined by whichever file comes first)
+#ifndef xlns_mask_included
+#define xlns_mask_included
+struct xlns_mask {
+    int causal;              // keep only j <= pos
+    size_t window;           // if not 0, keep only j > pos - window
+    size_t offset;           // position of the query of row 0 (keys already cached)
+    size_t rows_per_head;    // rows of each head; 0 if all rows are one head
+    size_t heads;            // if not 0, add the ALiBi bias for this many heads
+};
+
+// The kept columns [lo, hi) of row r (of n), with its query position and head
+inline void xlns_mask_row(const xlns_mask *m, size_t r, size_t n,
+                          size_t &lo, size_t &hi, size_t &pos, size_t &head) {
+    pos = m->offset + (m->rows_per_head ? r % m->rows_per_head : r);
+    head = m->rows_per_head ? r / m->rows_per_head : 0;
+    hi = (m->causal && pos + 1 < n) ? pos + 1 : n;
+    lo = (m->window && pos + 1 > m->window) ? pos + 1 - m->window : 0;
+    if (lo > hi) lo = hi;
+}
+#endif
+
+// ALiBi slope 2^(-8(head+1)/heads), rounded to the nearest xlns32
+inline xlns32 xlns32_alibi_slope(size_t head, size_t heads) {
+    return xlns32_logsignmask - (xlns32)((8*(head+1)*(unsigned long long)xlns32_scale + heads/2)/heads);
+}
+
+// Softmax of columns [lo, hi) of one row, as xlns32_softmax_masked with the
+// ALiBi bias of slope (xlns32_zero: none) for the query at pos; the other
+// columns get xlns32_zero.  dist[d] is fp2xlns32(d) for the distances d < n.
+// sum(p, m) adds the m exponentials.
+template <class S>
+inline void xlns32_softmax_span(const xlns32 *a, xlns32 *c, size_t n, size_t lo, size_t hi,
+                                xlns32 scale, xlns32 slope, size_t pos, const xlns32 *dist,
+                                const S &sum) {
+    xlns32 maxval = xlns32_neg_inf;
+    for (size_t i = lo; i < hi; i++) {
+        xlns32 v = a[i];
+        if (v != xlns32_neg_inf) {
+            v = xlns32_mul(v, scale);
+            if (slope != xlns32_zero && i != pos) {
+                size_t d = i < pos ? pos - i : i - pos;    // past n only if pos is
+                v = xlns32_sub(v, xlns32_mul(slope, d < n ? dist[d] : fp2xlns32((float)d)));
+            }
+        }
+        c[i] = v;
+        if (xlns32_gt(c[i], maxval)) maxval = c[i];
+    }
+    if (lo < hi) {
+        xlns_parallel_loop(hi - lo, for (size_t i = lo + i0; i < lo + i1; i++)
+            c[i] = xlns32_exp(xlns32_sub(c[i], maxval)));
+        xlns32 total = sum(c + lo, hi - lo);
+        xlns_parallel_loop(hi - lo, for (size_t i = lo + i0; i < lo + i1; i++)
+            c[i] = xlns32_div(c[i], total));
+    }
+    for (size_t i = 0; i < lo; i++) c[i] = xlns32_zero;
+    for (size_t i = hi; i < n; i++) c[i] = xlns32_zero;
+}
+
+// The rows of xlns32_softmax_rows, with the sum of the exponentials by sum
+template <class S>
+inline void xlns32_softmax_rows_sum(const xlns32 *a, size_t lda, xlns32 *c, size_t ldc,
+                                    size_t rows, size_t n, xlns32 scale,
+                                    const xlns_mask *mask, const S &sum) {
+    xlns32 *dist = NULL;
+    if (mask && mask->heads) {
+        dist = xlns32_scratch(n);
+        for (size_t d = 0; d < n; d++) dist[d] = fp2xlns32((float)d);
+    }
+    xlns_parallel_chunks(rows*n, rows, for (size_t r = i0; r < i1; r++) {
+        size_t lo = 0, hi = n, pos = 0, head = 0;
+        xlns32 slope = xlns32_zero;
+        if (mask) {
+            xlns_mask_row(mask, r, n, lo, hi, pos, head);
+            if (mask->heads) slope = xlns32_alibi_slope(head, mask->heads);
+        }
+        xlns32_softmax_span(a + r*lda, c + r*ldc, n, lo, hi, scale, slope, pos, dist, sum);
+    });
+}
+
+// Softmax of each row: c + r*ldc = softmax(scale * (a + r*lda)) over the columns
+// mask keeps (all when it is NULL), with the same bits as xlns32_softmax_masked
+// given the mask as an array; masked-out columns are xlns32_zero.  c may be a
+// (ldc == lda).
+inline void xlns32_softmax_rows(const xlns32 *a, size_t lda, xlns32 *c, size_t ldc,
+                                size_t rows, size_t n, xlns32 scale = xlns32_one,
+                                const xlns_mask *mask = NULL) {
+    xlns32_zprof_kernel("xlns32_softmax_rows");
+    xlns32_softmax_rows_sum(a, lda, c, ldc, rows, n, scale, mask, xlns32_sum);
+}
+
+// Layer normalization of each row (x + r*ldx to out + r*ldo) as xlns32_layernorm,
+// with the same gamma and beta for every row
+inline void xlns32_layernorm_rows(const xlns32 *x, size_t ldx, xlns32 *out, size_t ldo,
+                                  size_t rows, size_t n, const xlns32 *gamma,
+                                  const xlns32 *beta, float eps) {
+    xlns32_zprof_kernel("xlns32_layernorm_rows");
+    xlns_parallel_chunks(rows*n, rows, for (size_t r = i0; r < i1; r++)
+        xlns32_layernorm(x + r*ldx, out + r*ldo, gamma, beta, n, eps));
+}
+
+// Rotary position embedding (RoPE) with a cache of the cos and sin in LNS
+// (the same layouts and cache as for xlns16, see xlns16_rope)
+
+struct xlns32_rope_cache {
+    size_t pos0, npos, dims;
+    int interleaved;
+    std::vector<xlns32> cs, sn;     // npos rows of dims
+};
+
+inline void xlns32_rope_cache_init(xlns32_rope_cache *c, size_t pos0, size_t npos, size_t dims,
+                                   int interleaved = 1, float base = 10000.0f) {
+    size_t h = dims/2;
+    c->pos0 = pos0; c->npos = npos; c->dims = 2*h; c->interleaved = interleaved;
+    c->cs.resize(npos*2*h);
+    c->sn.resize(npos*2*h);
+    for (size_t p = 0; p < npos; p++)
+        for (size_t i = 0; i < h; i++) {
+            double a = (double)(pos0 + p)*pow((double)base, -2.0*i/(2*h));
+            xlns32 co = fp2xlns32((float)cos(a)), si = fp2xlns32((float)sin(a));
+            size_t j0 = interleaved ? 2*i : i, j1 = interleaved ? 2*i+1 : i+h;
+            c->cs[p*2*h + j0] = co;
+            c->cs[p*2*h + j1] = co;
+            c->sn[p*2*h + j0] = xlns32_neg(si);
+            c->sn[p*2*h + j1] = si;
+        }
+}
+
+// c[j] = a[j^swap]*b[j] for j < n (n even)
+inline void xlns32_rope_mul(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n, size_t swap) {
+    size_t j = 0;
+    #ifdef __AVX2__
+    for (; j + 8 <= n; j += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a+j));
+        if (swap) x = _mm256_shuffle_epi32(x, 0xb1);
+        _mm256_storeu_si256((__m256i *)(c+j), xlns32_mul_avx2(x, _mm256_loadu_si256((const __m256i *)(b+j))));
+    }
+    #endif
+    for (; j < n; j++)
+        c[j] = xlns32_mul(a[j^swap], b[j]);
+}
+
+// RoPE over tokens rows of heads heads of hd elements (see xlns16_rope)
+inline void xlns32_rope(const xlns32 *x, xlns32 *out, size_t tokens, size_t heads, size_t hd,
+                        size_t pos, const xlns32_rope_cache *c) {
+    xlns32_zprof_kernel("xlns32_rope");
+    size_t dims = c->dims, h = dims/2;
+    xlns_parallel_chunks(tokens*heads*hd, tokens*heads, {
+        std::vector<xlns32> p(dims), q(dims);
+        for (size_t r = i0; r < i1; r++) {
+            const xlns32 *xr = x + r*hd;
+            const xlns32 *cs = c->cs.data() + (pos + r/heads - c->pos0)*dims;
+            const xlns32 *sn = c->sn.data() + (pos + r/heads - c->pos0)*dims;
+            xlns32 *o = out + r*hd;
+            xlns32_rope_mul(xr, cs, p.data(), dims, 0);
+            if (c->interleaved)
+                xlns32_rope_mul(xr, sn, q.data(), dims, 1);
+            else {
+                xlns32_rope_mul(xr + h, sn, q.data(), h, 0);
+                xlns32_rope_mul(xr, sn + h, q.data() + h, h, 0);
+            }
+            for (size_t j = 0; j < dims; j++)
+                o[j] = xlns32_add(p[j], q[j]);
+            if (o != xr)
+                for (size_t j = dims; j < hd; j++)
+                    o[j] = xr[j];
+        }
+    });
 }
 
 /*END OF PORTABLE CODE THAT DEPENDS ON <math.h>*/
@@ -802,34 +1895,142 @@ float xlns32_2float(xlns32_float y) {
 	return xlns322fp(y.x);
 }
 
-#define xlns32_cachesize 1024
-xlns32 xlns32_cachecontent[xlns32_cachesize];
-float xlns32_cachetag[xlns32_cachesize];
-long xlns32_misses=0;
-long xlns32_hits=0;
-#define xlns32_cacheon 1
+// float -> xlns32 conversion cache used by xlns32_float (float2xlns32_)
+//   each thread has its own 2^xlns32_cachesetbits x xlns32_cacheways set-associative cache,
+//   so there is no sharing between threads; the set comes from a multiplicative
+//   hash of all 32 bits of the float, and a miss goes in front of its set,
+//   pushing out the oldest way.  the zero-filled cache is valid (bits 0 = 0.0).
+//   xlns32_cacheon turns it on or off at run time (set it before starting threads);
+//   define xlns32_nocache to compile it out.  hits/misses are kept per thread and
+//   summed by xlns32_cache_stats() since the last xlns32_cache_reset_stats().
+
+#ifndef xlns32_cachesetbits
+#define xlns32_cachesetbits  8
+#endif
+#define xlns32_cachesets     (1<<xlns32_cachesetbits)
+#ifndef xlns32_cacheways
+#define xlns32_cacheways   4
+#endif
+
+#ifndef xlns32_nocache
+int xlns32_cacheon = 1;
+#else
+int xlns32_cacheon = 0;
+#endif
+
+struct xlns32_cachestats {
+    unsigned long long hits, misses;
+};
+
+#ifndef xlns32_nocache
+#include <atomic>
+#include <mutex>
+#include <string.h>
+
+struct xlns32_cacheblock {
+    unsigned int tag[xlns32_cachesets][xlns32_cacheways];     // float bits
+    xlns32 content[xlns32_cachesets][xlns32_cacheways];
+    std::atomic<unsigned long long> hits, misses;
+    xlns32_cacheblock *next;
+    xlns32_cacheblock();
+    ~xlns32_cacheblock();
+};
+
+std::mutex xlns32_cache_lock;
+xlns32_cacheblock *xlns32_cache_list = NULL;
+xlns32_cachestats xlns32_cache_retired = {0, 0};   // from threads that have exited
+xlns32_cachestats xlns32_cache_base = {0, 0};      // totals at the last reset
+thread_local xlns32_cacheblock xlns32_cache_mine;
+
+xlns32_cacheblock::xlns32_cacheblock() : hits(0), misses(0)
+{
+    memset(tag, 0, sizeof(tag));
+    memset(content, 0, sizeof(content));      // fp2xlns32(0.0) == xlns32_zero == 0
+    std::lock_guard<std::mutex> g(xlns32_cache_lock);
+    next = xlns32_cache_list;
+    xlns32_cache_list = this;
+}
+
+xlns32_cacheblock::~xlns32_cacheblock()
+{
+    std::lock_guard<std::mutex> g(xlns32_cache_lock);
+    xlns32_cache_retired.hits += hits.load(std::memory_order_relaxed);
+    xlns32_cache_retired.misses += misses.load(std::memory_order_relaxed);
+    xlns32_cacheblock **p = &xlns32_cache_list;
+    while (*p != this)
+        p = &(*p)->next;
+    *p = next;
+}
+
+inline xlns32_cachestats xlns32_cache_total()   //caller holds xlns32_cache_lock
+{
+    xlns32_cachestats t = xlns32_cache_retired;
+    for (xlns32_cacheblock *b = xlns32_cache_list; b != NULL; b = b->next)
+    {
+        t.hits += b->hits.load(std::memory_order_relaxed);
+        t.misses += b->misses.load(std::memory_order_relaxed);
+    }
+    return t;
+}
+
+inline xlns32_cachestats xlns32_cache_stats()
+{
+    std::lock_guard<std::mutex> g(xlns32_cache_lock);
+    xlns32_cachestats t = xlns32_cache_total();
+    t.hits -= xlns32_cache_base.hits;
+    t.misses -= xlns32_cache_base.misses;
+    return t;
+}
+
+inline void xlns32_cache_reset_stats()
+{
+    std::lock_guard<std::mutex> g(xlns32_cache_lock);
+    xlns32_cache_base = xlns32_cache_total();
+}
+
+inline void xlns32_cache_flush()   //this thread's cache only
+{
+    memset(xlns32_cache_mine.tag, 0, sizeof(xlns32_cache_mine.tag));
+    memset(xlns32_cache_mine.content, 0, sizeof(xlns32_cache_mine.content));
+}
+
+inline xlns32 xlns32_cached_cvt(float y)
+{
+    unsigned int bits;
+    memcpy(&bits, &y, sizeof(bits));
+    if (!xlns32_cacheon)
+        return fp2xlns32(y);
+    xlns32_cacheblock &c = xlns32_cache_mine;
+    unsigned int set = (bits * 0x9e3779b1u) >> (32-xlns32_cachesetbits);
+    int hit = -1;
+    for (int w = 0; w < xlns32_cacheways; w++)   // no early exit: which way hits is unpredictable
+        hit = (c.tag[set][w] == bits) ? w : hit;
+    if (hit >= 0)
+    {
+        c.hits.store(c.hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return c.content[set][hit];
+    }
+    xlns32 r = fp2xlns32(y);
+    for (int w = xlns32_cacheways-1; w > 0; w--)
+    {
+        c.tag[set][w] = c.tag[set][w-1];
+        c.content[set][w] = c.content[set][w-1];
+    }
+    c.tag[set][0] = bits;
+    c.content[set][0] = r;
+    c.misses.store(c.misses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return r;
+}
+#else
+inline xlns32_cachestats xlns32_cache_stats() { xlns32_cachestats t = {0, 0}; return t; }
+inline void xlns32_cache_reset_stats() {}
+inline void xlns32_cache_flush() {}
+inline xlns32 xlns32_cached_cvt(float y) { return fp2xlns32(y); }
+#endif
 
 xlns32_float float2xlns32_(float y) {
 	xlns32_float z;
-	unsigned char * fpbyte;
-	int addr;
-	fpbyte=(unsigned char *)(&y);
-	addr = (fpbyte[2])^(fpbyte[3]<<2);
-	if ((xlns32_cachetag[addr] ==  y)&&xlns32_cacheon)
-	{
-//	  printf("hit  %f  %02x %02x %02x %02x addr=%d\n",y, fpbyte[0],fpbyte[1],fpbyte[2],fpbyte[3],addr);
-	  z.x = xlns32_cachecontent[addr];
-	  xlns32_hits++;
-	}
-	else
-	{
-//	  printf("miss %f  %02x %02x %02x %02x addr=%d\n",y, fpbyte[0],fpbyte[1],fpbyte[2],fpbyte[3],addr);
-	  z.x = fp2xlns32(y);
-	  xlns32_cachecontent[addr] = z.x;
-	  xlns32_cachetag[addr] = y;
-	  xlns32_misses++;
-	}
-//	getchar();
+	z.x = xlns32_cached_cvt(y);
 	return z;
 }
 
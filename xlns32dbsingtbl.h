@@ -0,0 +1,1290 @@
+double xlns32_dbsing_exphi[256] = {
+1, //0
+1.0027112750502025, //1
+1.0054299011128027, //2
+1.0081558981184175, //3
+1.0108892860517005, //4
+1.0136300849514894, //5
+1.0163783149109531, //6
+1.0191339960777379, //7
+1.0218971486541166, //8
+1.0246677928971357, //9
+1.0274459491187637, //10
+1.030231637686041, //11
+1.0330248790212284, //12
+1.0358256936019572, //13
+1.0386341019613787, //14
+1.0414501246883161, //15
+1.0442737824274138, //16
+1.0471050958792898, //17
+1.0499440858006872, //18
+1.0527907730046264, //19
+1.0556451783605572, //20
+1.0585073227945128, //21
+1.0613772272892621, //22
+1.0642549128844645, //23
+1.0671404006768237, //24
+1.0700337118202419, //25
+1.0729348675259756, //26
+1.075843889062791, //27
+1.0787607977571199, //28
+1.0816856149932152, //29
+1.0846183622133092, //30
+1.0875590609177697, //31
+1.0905077326652577, //32
+1.0934643990728858, //33
+1.0964290818163769, //34
+1.0994018026302219, //35
+1.1023825833078409, //36
+1.1053714457017412, //37
+1.1083684117236787, //38
+1.1113735033448175, //39
+1.1143867425958924, //40
+1.1174081515673693, //41
+1.1204377524096067, //42
+1.1234755673330199, //43
+1.1265216186082418, //44
+1.1295759285662881, //45
+1.1326385195987192, //46
+1.1357094141578055, //47
+1.1387886347566916, //48
+1.1418762039695616, //49
+1.1449721444318042, //50
+1.1480764788401789, //51
+1.1511892299529827, //52
+1.1543104205902159, //53
+1.1574400736337511, //54
+1.1605782120274988, //55
+1.1637248587775775, //56
+1.1668800369524817, //57
+1.1700437696832502, //58
+1.1732160801636373, //59
+1.1763969916502812, //60
+1.1795865274628758, //61
+1.182784710984341, //62
+1.1859915656609938, //63
+1.189207115002721, //64
+1.1924313825831512, //65
+1.1956643920398273, //66
+1.1989061670743806, //67
+1.2021567314527031, //68
+1.2054161090051239, //69
+1.2086843236265816, //70
+1.2119613992768012, //71
+1.215247359980469, //72
+1.2185422298274085, //73
+1.2218460329727576, //74
+1.2251587936371455, //75
+1.22848053610687, //76
+1.2318112847340759, //77
+1.2351510639369334, //78
+1.2384998981998165, //79
+1.241857812073484, //80
+1.245224830175258, //81
+1.2486009771892048, //82
+1.2519862778663162, //83
+1.2553807570246911, //84
+1.2587844395497165, //85
+1.2621973503942507, //86
+1.2656195145788063, //87
+1.2690509571917332, //88
+1.2724917033894028, //89
+1.275941778396392, //90
+1.2794012075056693, //91
+1.2828700160787783, //92
+1.2863482295460256, //93
+1.2898358734066657, //94
+1.2933329732290895, //95
+1.2968395546510096, //96
+1.3003556433796506, //97
+1.3038812651919358, //98
+1.3074164459346773, //99
+1.3109612115247644, //100
+1.3145155879493546, //101
+1.318079601266064, //102
+1.3216532776031575, //103
+1.3252366431597413, //104
+1.3288297242059544, //105
+1.3324325470831615, //106
+1.3360451382041458, //107
+1.3396675240533029, //108
+1.3432997311868353, //109
+1.3469417862329458, //110
+1.3505937158920345, //111
+1.3542555469368927, //112
+1.3579273062129011, //113
+1.3616090206382248, //114
+1.3653007172040119, //115
+1.3690024229745905, //116
+1.3727141650876684, //117
+1.3764359707545302, //118
+1.380167867260238, //119
+1.383909881963832, //120
+1.3876620422985291, //121
+1.3914243757719262, //122
+1.3951969099662003, //123
+1.3989796725383112, //124
+1.4027726912202048, //125
+1.4065759938190154, //126
+1.4103896082172707, //127
+1.4142135623730951, //128
+1.4180478843204152, //129
+1.4218926021691656, //130
+1.4257477441054942, //131
+1.42961333839197, //132
+1.4334894133677889, //133
+1.4373759974489824, //134
+1.4412731191286257, //135
+1.4451808069770467, //136
+1.449099089642035, //137
+1.4530279958490526, //138
+1.4569675544014438, //139
+1.460917794180647, //140
+1.4648787441464057, //141
+1.4688504333369818, //142
+1.4728328908693675, //143
+1.4768261459394993, //144
+1.4808302278224719, //145
+1.4848451658727524, //146
+1.488870989524397, //147
+1.4929077282912648, //148
+1.4969554117672355, //149
+1.5010140696264256, //150
+1.5050837316234065, //151
+1.5091644275934228, //152
+1.5132561874526098, //153
+1.5173590411982147, //154
+1.5214730189088146, //155
+1.5255981507445384, //156
+1.529734466947287, //157
+1.5338819978409559, //158
+1.5380407738316568, //159
+1.5422108254079407, //160
+1.5463921831410214, //161
+1.550584877685, //162
+1.5547889397770887, //163
+1.5590044002378369, //164
+1.5632312899713576, //165
+1.567469639965553, //166
+1.5717194812923414, //167
+1.5759808451078865, //168
+1.5802537626528246, //169
+1.5845382652524937, //170
+1.588834384317164, //171
+1.593142151342267, //172
+1.5974615979086271, //173
+1.6017927556826934, //174
+1.606135656416771, //175
+1.6104903319492543, //176
+1.6148568142048607, //177
+1.6192351351948637, //178
+1.6236253270173289, //179
+1.6280274218573478, //180
+1.632441451987275, //181
+1.6368674497669644, //182
+1.6413054476440063, //183
+1.6457554781539649, //184
+1.6502175739206177, //185
+1.6546917676561943, //186
+1.6591780921616162, //187
+1.6636765803267364, //188
+1.6681872651305825, //189
+1.6727101796415966, //190
+1.6772453570178785, //191
+1.681792830507429, //192
+1.6863526334483934, //193
+1.6909247992693053, //194
+1.6955093614893326, //195
+1.7001063537185235, //196
+1.7047158096580513, //197
+1.7093377631004629, //198
+1.713972247929926, //199
+1.7186192981224779, //200
+1.723278947746274, //201
+1.7279512309618377, //202
+1.7326361820223111, //203
+1.7373338352737062, //204
+1.7420442251551564, //205
+1.746767386199169, //206
+1.7515033530318782, //207
+1.7562521603732995, //208
+1.7610138430375839, //209
+1.7657884359332727, //210
+1.7705759740635547, //211
+1.7753764925265212, //212
+1.7801900265154245, //213
+1.785016611318935, //214
+1.789856282321401, //215
+1.7947090750031072, //216
+1.7995750249405351, //217
+1.8044541678066239, //218
+1.809346539371032, //219
+1.8142521755003989, //220
+1.8191711121586085, //221
+1.8241033854070534, //222
+1.8290490314048973, //223
+1.8340080864093424, //224
+1.8389805867758937, //225
+1.843966568958626, //226
+1.8489660695104508, //227
+1.8539791250833855, //228
+1.8590057724288205, //229
+1.864046048397789, //230
+1.8690999899412386, //231
+1.8741676341103, //232
+1.8792490180565602, //233
+1.8843441790323345, //234
+1.8894531543909392, //235
+1.8945759815869656, //236
+1.8997126981765553, //237
+1.9048633418176741, //238
+1.9100279502703899, //239
+1.9152065613971474, //240
+1.9203992131630474, //241
+1.925605943636125, //242
+1.9308267909876271, //243
+1.9360617934922943, //244
+1.9413109895286405, //245
+1.9465744175792332, //246
+1.9518521162309783, //247
+1.9571441241754002, //248
+1.9624504802089273, //249
+1.9677712232331759, //250
+1.9731063922552343, //251
+1.9784560263879509, //252
+1.9838201648502194, //253
+1.9891988469672663, //254
+1.9945921121709402, //255
+};
+double xlns32_dbsing_explo[256] = {
+0, //0
+-3.6320772778264399e-17, //1
+9.4976110309730188e-17, //2
+-3.2526065174565133e-17, //3
+-1.5287250632045613e-17, //4
+9.3241386833753381e-18, //5
+-5.7679555576228836e-17, //6
+3.5995512126518747e-17, //7
+5.1065922324067259e-17, //8
+-7.5568891422239659e-17, //9
+-4.9548039282587553e-17, //10
+3.3176586478056436e-17, //11
+7.589415207398531e-18, //12
+-7.8062556418956319e-17, //13
+5.9956380138448395e-17, //14
+3.7838655819744105e-17, //15
+8.55435514091063e-17, //16
+7.2749965773777348e-17, //17
+5.5944832100252029e-17, //18
+-9.6277152916712794e-17, //19
+1.7347234759768071e-18, //20
+-7.1557343384043293e-17, //21
+-1.1926223897340549e-17, //22
+5.0740661672321608e-17, //23
+-7.9038338374193273e-17, //24
+-9.9421339216920757e-17, //25
+-3.7947076036992655e-18, //26
+-9.9746599868666408e-18, //27
+-6.6570013390609972e-17, //28
+-4.7813315806610746e-17, //29
+3.1658703436576729e-17, //30
+5.4210108624275222e-18, //31
+-3.0466081046842675e-17, //32
+1.4419888894057209e-17, //33
+-5.9197438617708542e-17, //34
+7.1665763601291843e-17, //35
+5.2692225582795515e-17, //36
+8.2399365108898337e-17, //37
+-8.7820375971325859e-17, //38
+5.5619571448506377e-17, //39
+1.0408340855860843e-16, //40
+-7.9797279894933126e-17, //41
+-6.2016364266170854e-17, //42
+-9.7036094437452647e-17, //43
+5.1608023410310011e-17, //44
+6.7112114476852724e-17, //45
+3.2417644957316583e-17, //46
+5.0632241455073057e-17, //47
+8.9121418578308464e-17, //48
+4.651227319962814e-17, //49
+4.640385298237959e-17, //50
+6.8955258170078082e-17, //51
+3.2526065174565133e-17, //52
+1.0419182877585698e-16, //53
+-9.1289822923279473e-17, //54
+-3.2634485391813683e-17, //55
+3.8272336688738307e-17, //56
+-8.792879618857441e-17, //57
+-1.8431436932253575e-18, //58
+-7.2858385991025898e-17, //59
+5.5511151231257827e-17, //60
+1.0093922225840046e-16, //61
+1.5395670849294163e-17, //62
+-9.2157184661267877e-18, //63
+3.9790219730218013e-17, //64
+4.401860820291148e-17, //65
+4.6187012547882489e-17, //66
+-9.8120296609938151e-17, //67
+6.6461593173361422e-17, //68
+-3.3610267347050637e-17, //69
+-4.7488055154865094e-17, //70
+-4.889751797909625e-17, //71
+-7.7086774463719365e-17, //72
+-9.0097200533545418e-17, //73
+-1.0614339268633088e-16, //74
+-8.9012998361059914e-17, //75
+-1.8973538018496328e-17, //76
+7.3942588163511402e-17, //77
+-1.0755285551056204e-16, //78
+2.7647155398380363e-17, //79
+4.6620693416876691e-17, //80
+-4.6729113634125241e-17, //81
+-8.2616205543395438e-17, //82
+4.8355416892853498e-17, //83
+-6.7220534694101275e-18, //84
+-8.4242508802123695e-17, //85
+-3.0791341698588326e-17, //86
+4.2500725161431774e-17, //87
+2.6020852139652106e-18, //88
+-1.0625181290357943e-17, //89
+9.9096078565175105e-17, //90
+-9.7578195523695399e-17, //91
+1.713039432527097e-17, //92
+-3.415236843329339e-17, //93
+8.9555099447302666e-17, //94
+-2.9707139526102821e-17, //95
+2.5370330836160804e-17, //96
+5.6812193838240432e-17, //97
+8.6519333364343254e-17, //98
+-7.340048707726865e-17, //99
+-7.1774183818540394e-17, //100
+2.2659825404947043e-17, //101
+-5.4643789493269423e-17, //102
+-2.4828229749918052e-17, //103
+-2.8622937353617317e-17, //104
+4.0874421902703517e-17, //105
+-5.0957502106818708e-17, //106
+-5.8980598183211441e-17, //107
+8.9338259012805565e-17, //108
+-5.8004816227974487e-17, //109
+3.2309224740068032e-17, //110
+-8.2833045977892539e-17, //111
+7.6978354246470815e-17, //112
+-9.530137096147584e-17, //113
+1.5178830414797062e-18, //114
+-1.0007186052041206e-16, //115
+9.5951892264967142e-17, //116
+-4.4994390158148434e-17, //117
+-6.8955258170078082e-17, //118
+1.0516761073109393e-16, //119
+-6.7654215563095477e-17, //120
+8.4242508802123695e-17, //121
+-4.90059381963448e-17, //122
+-9.3241386833753381e-17, //123
+-9.6168732699464243e-17, //124
+-5.2909066017292616e-17, //125
+7.0473141211557788e-18, //126
+4.163336342344337e-17, //127
+-9.6710833785706996e-17, //128
+2.2768245622195593e-17, //129
+-1.6046192152785466e-17, //130
+9.8879238130678004e-17, //131
+-1.2034644114589099e-17, //132
+-5.8004816227974487e-17, //133
+-4.2067044292437572e-17, //134
+5.6378512969246231e-18, //135
+-3.0249240612345574e-17, //136
+-6.2666885569662156e-17, //137
+-5.7787975793477386e-17, //138
+5.6486933186494781e-17, //139
+-5.5944832100252029e-17, //140
+9.530137096147584e-17, //141
+8.4676189671117896e-17, //142
+6.6895274042355624e-17, //143
+-3.4911309954033243e-17, //144
+-9.6927674220204096e-17, //145
+1.0776969594505914e-16, //146
+6.1582683397176652e-17, //147
+1.4203048459560108e-17, //148
+-2.8622937353617317e-17, //149
+-6.4184768611141862e-17, //150
+7.0689981646054889e-17, //151
+-1.0169816377914032e-16, //152
+8.8904578143811364e-17, //153
+-4.3151246464923076e-17, //154
+-5.9631119486702744e-18, //155
+-1.102633609417758e-16, //156
+3.7838655819744105e-17, //157
+8.8687737709314263e-17, //158
+1.0169816377914032e-16, //159
+7.9472019243187475e-17, //160
+1.0690233420707074e-16, //161
+-1.463672932855431e-17, //162
+-8.0014120329430227e-17, //163
+3.7838655819744105e-17, //164
+7.4809949901499806e-17, //165
+-1.0354130747236567e-16, //166
+-3.3393426912553537e-17, //167
+-1.0191500421363742e-17, //168
+-5.1608023410310011e-17, //169
+-1.9298798670241979e-17, //170
+-5.9631119486702744e-18, //171
+-1.0093922225840046e-16, //172
+2.4828229749918052e-17, //173
+-6.0498481224691147e-17, //174
+-1.0354130747236567e-16, //175
+2.4719809532669501e-17, //176
+-7.3183646642771549e-17, //177
+2.0925101928970236e-17, //178
+-3.5778671692021646e-17, //179
+-6.7112114476852724e-17, //180
+9.8553977478932353e-17, //181
+7.6978354246470815e-17, //182
+-9.2482445313013528e-17, //183
+-1.0126448291014611e-16, //184
+9.1072982488782372e-18, //185
+9.6493993351209895e-17, //186
+-7.2749965773777348e-17, //187
+5.8872177965962891e-17, //188
+4.2717565595928875e-17, //189
+-5.4752209710517974e-17, //190
+8.304988641238964e-17, //191
+8.1965684239904135e-17, //192
+-7.1774183818540394e-17, //193
+-9.6710833785706996e-17, //194
+7.2424705122031696e-17, //195
+-8.0230960763927328e-18, //196
+-2.7321894746634712e-17, //197
+-9.8662397696180903e-17, //198
+6.4726869697384615e-17, //199
+-1.8539857149502126e-17, //200
+-9.5192950744227289e-17, //201
+-1.0755285551056204e-16, //202
+-1.7347234759768071e-18, //203
+3.1658703436576729e-17, //204
+-1.5178830414797062e-18, //205
+-1.0755285551056204e-16, //206
+-5.128276275856436e-17, //207
+2.9598719308854271e-17, //208
+-7.9472019243187475e-17, //209
+9.4650849657984537e-17, //210
+5.9631119486702744e-17, //211
+6.4293188828390413e-17, //212
+-5.2800645800044066e-17, //213
+1.5287250632045613e-17, //214
+-4.152494320619482e-17, //215
+1.8214596497756474e-17, //216
+-2.5261910618912253e-17, //217
+-5.1824863844807112e-17, //218
+-9.0314040968042519e-17, //219
+-9.9746599868666408e-17, //220
+7.4051008380759953e-17, //221
+-1.0158974356189177e-16, //222
+6.8846837952829532e-17, //223
+3.2851325826310784e-17, //224
+6.9388939039072284e-18, //225
+-5.9414279052205643e-17, //226
+9.0314040968042519e-17, //227
+9.7578195523695399e-17, //228
+-9.530137096147584e-17, //229
+6.5377391000875917e-17, //230
+-9.9421339216920757e-17, //231
+-6.1257422745431001e-17, //232
+-1.6263032587282567e-17, //233
+-8.2290944891649787e-17, //234
+-9.0097200533545418e-17, //235
+3.4043948216044839e-17, //236
+-3.8597597340483958e-17, //237
+6.5377391000875917e-17, //238
+-5.9089018400459992e-17, //239
+-1.0625181290357943e-16, //240
+7.1123662515049091e-17, //241
+-9.9096078565175105e-17, //242
+6.1691103614425202e-17, //243
+1.0332446703786857e-16, //244
+-6.6353172956112871e-17, //245
+6.8087896432089678e-17, //246
+-2.200930410145574e-17, //247
+8.9555099447302666e-17, //248
+1.0972125985553305e-16, //249
+-1.0310762660337147e-16, //250
+-7.4809949901499806e-18, //251
+4.0440741033709315e-17, //252
+-2.200930410145574e-17, //253
+8.2399365108898337e-18, //254
+1.7889335846010823e-17, //255
+};
+double xlns32_dbsing_loghi[256] = {
+0, //0
+0.0056245491938781067, //1
+0.011227255423254119, //2
+0.016808287686553888, //3
+0.02236781302845451, //4
+0.027905996569884482, //5
+0.03342300153745028, //6
+0.03891898929230235, //7
+0.044394119358453436, //8
+0.049848549450561525, //9
+0.055282435501189602, //10
+0.060695931687553939, //11
+0.066089190457772437, //12
+0.071462362556624151, //13
+0.076815597050830894, //14
+0.082149041353871563, //15
+0.087462841250339401, //16
+0.092757140919852446, //17
+0.09803208296052672, //18
+0.10328780841202195, //19
+0.10852445677816905, //20
+0.11374216604918833, //21
+0.11894107272350743, //22
+0.12412131182918758, //23
+0.12928301694496647, //24
+0.1344263202209261, //25
+0.13955135239879354, //26
+0.14465824283188233, //27
+0.14974711950468206, //28
+0.15481810905210402, //29
+0.15987133677838941, //30
+0.16490692667568779, //31
+0.16992500144231237, //32
+0.1749256825006788, //33
+0.17990909001493446, //34
+0.18487534290828386, //35
+0.18982455888001723, //36
+0.19475685442224788, //37
+0.1996723448363644, //38
+0.20457114424920361, //39
+0.20945336562894978, //40
+0.21431912080076579, //41
+0.21916852046216156, //42
+0.22400167419810504, //43
+0.22881869049588088, //44
+0.23361967675970205, //45
+0.23840473932507891, //46
+0.24317398347295091, //47
+0.24792751344358549, //48
+0.25266543245024864, //49
+0.25738784269265175, //50
+0.26209484537017941, //51
+0.26678654069490138, //52
+0.27146302790437454, //53
+0.27612440527423754, //54
+0.28077077013060253, //55
+0.28540221886224837, //56
+0.29001884693261831, //57
+0.29462074889162698, //58
+0.29920801838727884, //59
+0.30378074817710293, //60
+0.30833903013940728, //61
+0.31288295528435534, //62
+0.3174126137648694, //63
+0.32192809488736235, //64
+0.32642948712230313, //65
+0.33091687811461695, //66
+0.33539035469392492, //67
+0.33985000288462475, //68
+0.34429590791581688, //69
+0.34872815423107756, //70
+0.35314682549808252, //71
+0.35755200461808367, //72
+0.3619437737352415, //73
+0.36632221424581579, //74
+0.37068740680721768, //75
+0.37503943134692475, //76
+0.37937836707126216, //77
+0.38370429247405224, //78
+0.3880172853451348, //79
+0.39231742277876031, //80
+0.39660478118185849, //81
+0.40087943628218431, //82
+0.40514146313634392, //83
+0.40939093613770178, //84
+0.41362792902417245, //85
+0.41785251488589786, //86
+0.4220647661728123, //87
+0.42626475470209796, //88
+0.43045255166553142, //89
+0.43462822763672465, //90
+0.43879185257826092, //91
+0.44294349584872827, //92
+0.44708322620965224, //93
+0.45121111183232882, //94
+0.45532722030456069, //95
+0.45943161863729726, //96
+0.46352437327118029, //97
+0.46760555008299742, //98
+0.47167521439204441, //99
+0.47573343096639775, //100
+0.47978026402909968, //101
+0.4838157772642564, //102
+0.48784003382305136, //103
+0.49185309632967472, //104
+0.49585502688717098, //105
+0.49984588708320538, //106
+0.5038257379957507, //107
+0.50779464019869625, //108
+0.51175265376737955, //109
+0.51569983828404242, //110
+0.5196362528432128, //111
+0.52356195605701283, //112
+0.52747700606039605, //113
+0.53138146051631208, //114
+0.53527537662080327, //115
+0.53915881110803143, //116
+0.54303182025523777, //117
+0.54689445988763663, //118
+0.55074678538324318, //119
+0.55458885167763738, //120
+0.55842071326866427, //121
+0.56224242422107262, //122
+0.56605403817109168, //123
+0.56985560833094784, //124
+0.573647187493322, //125
+0.57742882803574869, //126
+0.58120058192495705, //127
+0.58496250072115619, //128
+0.58871463558226367, //129
+0.59245703726808041, //130
+0.59618975614441028, //131
+0.5999128421871277, //132
+0.60362634498619194, //133
+0.60733031374961066, //134
+0.61102479730735226, //135
+0.61470984411520824, //136
+0.61838550225860645, //137
+0.62205181945637622, //138
+0.62570884306446528, //139
+0.62935662007960957, //140
+0.63299519714295782, //141
+0.63662462054364888, //142
+0.6402449362223458, //143
+0.6438561897747247, //144
+0.64745842645492024, //145
+0.65105169117892858, //146
+0.65463602852796732, //147
+0.65821148275179475, //148
+0.66177809777198704, //149
+0.66533591718517626, //150
+0.66888498426624698, //151
+0.67242534197149562, //152
+0.6759570329417488, //153
+0.67948009950544608, //154
+0.68299458368168287, //155
+0.68650052718321841, //156
+0.68999797141944541, //157
+0.69348695749932521, //158
+0.69696752623428715, //159
+0.70043971814109218, //160
+0.70390357344466359, //161
+0.70735913208088275, //162
+0.71080643369935159, //163
+0.71424551766612265, //164
+0.71767642306639612, //165
+0.72109918870718515, //166
+0.72451385311994976, //167
+0.7279204545631992, //168
+0.73131903102506413, //169
+0.73470962022583819, //170
+0.73809225962049041, //171
+0.74146698640114694, //172
+0.74483383749954557, //173
+0.74819284958946031, //174
+0.75154405908909816, //175
+0.75488750216346856, //176
+0.75822321472672494, //177
+0.76155123244447931, //178
+0.76487159073609068, //179
+0.76818432477692633, //180
+0.77148946950059838, //181
+0.77478705960117344, //182
+0.77807712953535824, //183
+0.7813597135246596, //184
+0.78463484555752061, //185
+0.78790255939143161, //186
+0.79116288855501826, //187
+0.79441586635010597, //188
+0.79766152585376016, //189
+0.80089989992030475, //190
+0.80413102118331781, //191
+0.80735492205760406, //192
+0.81057163474114691, //193
+0.81378119121703707, //194
+0.81698362325538099, //195
+0.82017896241518773, //196
+0.82336724004623507, //197
+0.82654848729091501, //198
+0.82972273508605865, //199
+0.83289001416474162, //200
+0.83605035505806968, //201
+0.83920378809694396, //202
+0.84235034341380799, //203
+0.84549005094437524, //204
+0.84862294042933795, //205
+0.85174904141605756, //206
+0.8548683832602364, //207
+0.85798099512757209, //208
+0.86108690599539373, //209
+0.86418614465428023, //210
+0.86727873970966196, //211
+0.87036471958340456, //212
+0.87344411251537657, //213
+0.87651694656499968, //214
+0.87958324961278322, //215
+0.88264304936184124, //216
+0.88569637333939522, //217
+0.88874324889825906, //218
+0.89178370321831024, //219
+0.89481776330794349, //220
+0.89784545600551158, //221
+0.90086680798074859, //222
+0.90388184573618024, //223
+0.90689059560851848, //224
+0.90989308377004197, //225
+0.9128893362299616, //226
+0.91587937883577319, //227
+0.91886323727459451, //228
+0.92184093707449, //229
+0.92481250360578093, //230
+0.9277779620823422, //231
+0.93073733756288624, //232
+0.93369065495223369, //233
+0.93663793900257053, //234
+0.93957921431469305, //235
+0.94251450533923986, //236
+0.94544383637791152, //237
+0.94836723158467762, //238
+0.95128471496697198, //239
+0.95419631038687525, //240
+0.95710204156228618, //241
+0.96000193206808093, //242
+0.9628960053372605, //243
+0.96578428466208699, //244
+0.96866679319520843, //245
+0.97154355395077197, //246
+0.97441458980552709, //247
+0.97727992349991644, //248
+0.98013957763915704, //249
+0.98299357469431015, //250
+0.98584193700334055, //251
+0.98868468677216581, //252
+0.99152184607569527, //253
+0.99435343685885791, //254
+0.99717948093762132, //255
+};
+double xlns32_dbsing_loglo[256] = {
+0, //0
+2.5368636770266295e-19, //1
+8.6397360619938635e-19, //2
+1.0249098661777034e-18, //3
+-1.5941160067325932e-18, //4
+1.387439967602544e-18, //5
+-5.014435047745458e-19, //6
+8.7074986977742075e-19, //7
+1.3349239248727773e-18, //8
+2.6190258729102966e-18, //9
+-2.9815559743351372e-19, //10
+-2.5546513689189698e-18, //11
+-4.1335207826009857e-18, //12
+-6.4171216083985794e-18, //13
+-2.1684043449710089e-18, //14
+-2.3310346708438345e-18, //15
+6.7627110508783339e-18, //16
+3.2661590446125821e-18, //17
+-4.424900116456465e-18, //18
+-1.1248597539537109e-18, //19
+5.4074583352714534e-18, //20
+4.1741783640691921e-18, //21
+1.5585406229479126e-18, //22
+-6.057979638762756e-18, //23
+-1.1478990501190278e-17, //24
+-8.1315162936412833e-20, //25
+1.0259263057144086e-17, //26
+-1.2414114874959026e-17, //27
+3.3881317890172014e-18, //28
+-1.7347234759768071e-18, //29
+5.3396956994911093e-18, //30
+7.874018277675976e-18, //31
+-1.0448998437329049e-17, //32
+1.3525422101756668e-17, //33
+4.526544070126981e-18, //34
+-1.5720931501039814e-18, //35
+-2.439454888092385e-19, //36
+-8.0502011307048704e-18, //37
+3.2526065174565133e-19, //38
+-5.8275866771095863e-18, //39
+-1.7482760031328759e-18, //40
+1.1695830935687379e-17, //41
+7.03376159399971e-18, //42
+-1.1411227865409934e-17, //43
+-5.9631119486702744e-18, //44
+-3.2797115717686509e-18, //45
+-6.0986372202309624e-18, //46
+7.7520455332713567e-18, //47
+3.8624702394796095e-18, //48
+-1.4934884925987824e-17, //49
+2.4069288229178198e-17, //50
+-1.9732479539236181e-17, //51
+-1.1492543028346347e-17, //52
+1.9407218887490529e-17, //53
+1.7889335846010823e-17, //54
+9.5138740635603014e-18, //55
+-2.7267684638010437e-17, //56
+2.1467203015212988e-17, //57
+2.4069288229178198e-17, //58
+-2.1927988938519327e-17, //59
+-8.3483567281383841e-18, //60
+-2.3093506273941244e-17, //61
+2.5532961162033629e-17, //62
+-2.3229031545501932e-17, //63
+-3.7947076036992655e-19, //64
+-9.2157184661267877e-19, //65
+2.7267684638010437e-17, //66
+-1.713039432527097e-17, //67
+-2.0897996874658098e-17, //68
+-2.2768245622195593e-17, //69
+-5.8275866771095863e-18, //70
+2.2714035513571318e-17, //71
+1.8973538018496328e-17, //72
+-2.3364556817062621e-17, //73
+-5.990217002982412e-18, //74
+1.894643296418419e-17, //75
+1.0977546996415732e-17, //76
+-1.2197274440461925e-17, //77
+-1.9786689647860456e-17, //78
+-1.83772268236293e-17, //79
+-1.6317242695906842e-17, //80
+-2.4936649967166602e-17, //81
+1.1438332919722072e-17, //82
+-2.5831116759467143e-17, //83
+-2.1358782797964437e-17, //84
+1.7889335846010823e-17, //85
+-6.5865281978494394e-18, //86
+2.2199039481640703e-17, //87
+-1.9922214919421144e-17, //88
+-2.2714035513571318e-17, //89
+-1.83772268236293e-17, //90
+-1.3850682753502319e-17, //91
+2.7430314963883262e-17, //92
+-9.6493993351209895e-18, //93
+-1.1844908734404136e-17, //94
+1.780802068307441e-17, //95
+-3.7947076036992655e-19, //96
+2.439454888092385e-19, //97
+1.7076184216646695e-17, //98
+3.0357660829594124e-18, //99
+2.6562953225894859e-18, //100
+1.8187491443444337e-17, //101
+2.7132159366449748e-17, //102
+-1.0191500421363742e-17, //103
+-1.0814916670542907e-17, //104
+7.7249404789592191e-18, //105
+-1.5233040523421337e-17, //106
+-5.9631119486702744e-18, //107
+2.2388774861825667e-17, //108
+2.7159264420761886e-17, //109
+3.5724461583397371e-17, //110
+-2.7755575615628914e-17, //111
+3.8380756905986857e-17, //112
+8.5109870540112098e-18, //113
+5.3396956994911093e-17, //114
+1.962405932198763e-17, //115
+-4.2446515052807499e-17, //116
+3.2526065174565133e-18, //117
+3.415236843329339e-17, //118
+4.9168568522217626e-17, //119
+-1.22514845490862e-17, //120
+1.0625181290357943e-17, //121
+2.8731357570865868e-17, //122
+2.1358782797964437e-17, //123
+3.4694469519536142e-18, //124
+3.7513395167998453e-17, //125
+2.3852447794681098e-18, //126
+3.5561831257524545e-17, //127
+-5.2041704279304213e-18, //128
+4.3639137442541553e-17, //129
+8.7278274885083107e-18, //130
+2.5153490401663703e-17, //131
+-2.4123498337802474e-17, //132
+-1.0245710529988017e-17, //133
+2.7863995832877464e-17, //134
+1.7401444868392346e-17, //135
+-2.2226144535952841e-17, //136
+1.5070410197548512e-17, //137
+4.6349642873755315e-17, //138
+-8.7278274885083107e-18, //139
+4.4669129506402783e-17, //140
+-3.5670251474773096e-17, //141
+-3.9519169187096637e-17, //142
+-1.2468324983583301e-17, //143
+-7.589415207398531e-19, //144
+5.3939058081153846e-17, //145
+3.2255014631443757e-17, //146
+5.1716443627558562e-17, //147
+-1.4799359654427136e-17, //148
+3.426078865054194e-17, //149
+-3.3935527998796289e-17, //150
+5.3396956994911093e-17, //151
+-2.6237692574149207e-17, //152
+1.8973538018496328e-17, //153
+-3.6917083973131426e-17, //154
+3.1983964088322381e-17, //155
+-3.0899761915836876e-17, //156
+-4.4343868854657131e-17, //157
+2.7918205941501739e-17, //158
+-4.4885969940899884e-17, //159
+-2.2063514210080015e-17, //160
+2.4069288229178198e-17, //161
+3.4694469519536142e-18, //162
+4.9873299934333204e-18, //163
+-1.6696713456276768e-17, //164
+-3.8814437774981059e-17, //165
+-1.1655173354219173e-17, //166
+-2.2714035513571318e-17, //167
+-2.4774019641293776e-17, //168
+-2.1738253558334364e-17, //169
+5.3668007538032469e-17, //170
+-2.5695591487906455e-17, //171
+4.2825985813177425e-18, //172
+2.7863995832877464e-17, //173
+-2.0328790734103208e-17, //174
+-2.3852447794681098e-17, //175
+-1.5666721392415539e-17, //176
+-3.1333442784831078e-17, //177
+7.1557343384043293e-18, //178
+-2.8460307027744491e-17, //179
+2.7918205941501739e-17, //180
+-1.3281476612947429e-17, //181
+-3.3230796586680711e-17, //182
+-5.2095914387928488e-17, //183
+-7.589415207398531e-19, //184
+-3.2634485391813683e-17, //185
+-4.3042826247674526e-17, //186
+4.4777549723651333e-17, //187
+-6.9931040125315036e-18, //188
+-5.3234326669038268e-17, //189
+-1.4474099002681484e-17, //190
+-5.3722217646656745e-17, //191
+4.4398078963281407e-17, //192
+3.5453411040275995e-17, //193
+-1.1167282376600696e-17, //194
+-3.6917083973131426e-17, //195
+-2.0599841277224584e-17, //196
+1.6425662913155392e-17, //197
+-2.8893987896738693e-17, //198
+-3.3501847129802087e-17, //199
+5.4155898515650946e-17, //200
+1.7455654977016621e-17, //201
+-2.0220370516854658e-17, //202
+-3.664603343001005e-17, //203
+-1.7509865085640897e-17, //204
+3.0737131589964051e-17, //205
+-1.6696713456276768e-17, //206
+-1.1058862159352145e-17, //207
+3.2634485391813683e-17, //208
+1.2685165418080402e-17, //209
+6.5052130349130266e-18, //210
+-4.775910569798647e-17, //211
+-3.2471855065940858e-17, //212
+-2.9110828331235794e-17, //213
+4.28801959218017e-17, //214
+-3.664603343001005e-17, //215
+2.2280354644577116e-17, //216
+-2.0328790734103208e-17, //217
+4.1958624075189022e-17, //218
+-5.2366964931049864e-17, //219
+2.3418766925686896e-17, //220
+-3.5236570605778894e-17, //221
+-2.677979366039196e-17, //222
+-1.1384122811097797e-18, //223
+4.9927510042957479e-17, //224
+-2.3798237686056822e-17, //225
+1.7997756063259374e-17, //226
+-3.3447637021177812e-17, //227
+-7.589415207398531e-19, //228
+3.1008182133085427e-17, //229
+-2.6129272356900657e-17, //230
+-3.8272336688738307e-17, //231
+4.0928632011327792e-17, //232
+4.4452289071905682e-17, //233
+3.290553593493506e-17, //234
+1.8160386389132199e-17, //235
+1.3769367590565906e-17, //236
+1.1655173354219173e-17, //237
+3.7350764842125628e-17, //238
+-1.1221492485224971e-17, //239
+-3.7242344624877077e-17, //240
+-7.6978354246470815e-18, //241
+5.7462715141731735e-18, //242
+3.7730235602495554e-17, //243
+5.4372738950148047e-17, //244
+-2.5045070184415152e-17, //245
+2.564138137928218e-17, //246
+4.6620693416876691e-18, //247
+3.3935527998796289e-17, //248
+4.0332320816460765e-17, //249
+-1.7509865085640897e-17, //250
+-4.9331198848090452e-17, //251
+4.2717565595928875e-17, //252
+2.7592945289756088e-17, //253
+2.8948198005362968e-17, //254
+1.6425662913155392e-17, //255
+};
+double xlns32_dbsing_recip[256] = {
+1, //0
+0.99610894941634243, //1
+0.99224806201550386, //2
+0.98841698841698844, //3
+0.98461538461538467, //4
+0.98084291187739459, //5
+0.97709923664122134, //6
+0.97338403041825095, //7
+0.96969696969696972, //8
+0.96603773584905661, //9
+0.96240601503759393, //10
+0.95880149812734083, //11
+0.95522388059701491, //12
+0.95167286245353155, //13
+0.94814814814814818, //14
+0.94464944649446492, //15
+0.94117647058823528, //16
+0.93772893772893773, //17
+0.93430656934306566, //18
+0.93090909090909091, //19
+0.92753623188405798, //20
+0.92418772563176899, //21
+0.92086330935251803, //22
+0.91756272401433692, //23
+0.91428571428571426, //24
+0.91103202846975084, //25
+0.90780141843971629, //26
+0.90459363957597172, //27
+0.90140845070422537, //28
+0.89824561403508774, //29
+0.8951048951048951, //30
+0.89198606271777003, //31
+0.88888888888888884, //32
+0.88581314878892736, //33
+0.88275862068965516, //34
+0.8797250859106529, //35
+0.87671232876712324, //36
+0.87372013651877134, //37
+0.87074829931972786, //38
+0.8677966101694915, //39
+0.86486486486486491, //40
+0.86195286195286192, //41
+0.85906040268456374, //42
+0.85618729096989965, //43
+0.85333333333333339, //44
+0.85049833887043191, //45
+0.84768211920529801, //46
+0.84488448844884489, //47
+0.84210526315789469, //48
+0.83934426229508197, //49
+0.83660130718954251, //50
+0.83387622149837137, //51
+0.83116883116883122, //52
+0.82847896440129454, //53
+0.82580645161290323, //54
+0.82315112540192925, //55
+0.82051282051282048, //56
+0.8178913738019169, //57
+0.8152866242038217, //58
+0.8126984126984127, //59
+0.810126582278481, //60
+0.80757097791798105, //61
+0.80503144654088055, //62
+0.80250783699059558, //63
+0.80000000000000004, //64
+0.79750778816199375, //65
+0.79503105590062106, //66
+0.79256965944272451, //67
+0.79012345679012341, //68
+0.78769230769230769, //69
+0.78527607361963192, //70
+0.78287461773700306, //71
+0.78048780487804881, //72
+0.77811550151975684, //73
+0.77575757575757576, //74
+0.77341389728096677, //75
+0.77108433734939763, //76
+0.76876876876876876, //77
+0.76646706586826352, //78
+0.76417910447761195, //79
+0.76190476190476186, //80
+0.75964391691394662, //81
+0.75739644970414199, //82
+0.75516224188790559, //83
+0.75294117647058822, //84
+0.75073313782991202, //85
+0.74853801169590639, //86
+0.74635568513119532, //87
+0.7441860465116279, //88
+0.74202898550724639, //89
+0.73988439306358378, //90
+0.73775216138328525, //91
+0.73563218390804597, //92
+0.73352435530085958, //93
+0.73142857142857143, //94
+0.72934472934472938, //95
+0.72727272727272729, //96
+0.72521246458923516, //97
+0.7231638418079096, //98
+0.72112676056338032, //99
+0.7191011235955056, //100
+0.71708683473389356, //101
+0.71508379888268159, //102
+0.71309192200557103, //103
+0.71111111111111114, //104
+0.70914127423822715, //105
+0.70718232044198892, //106
+0.70523415977961434, //107
+0.70329670329670335, //108
+0.70136986301369864, //109
+0.69945355191256831, //110
+0.6975476839237057, //111
+0.69565217391304346, //112
+0.69376693766937669, //113
+0.69189189189189193, //114
+0.69002695417789761, //115
+0.68817204301075274, //116
+0.68632707774798929, //117
+0.68449197860962563, //118
+0.68266666666666664, //119
+0.68085106382978722, //120
+0.67904509283819625, //121
+0.67724867724867721, //122
+0.67546174142480209, //123
+0.67368421052631577, //124
+0.67191601049868765, //125
+0.67015706806282727, //126
+0.66840731070496084, //127
+0.66666666666666663, //128
+0.66493506493506493, //129
+0.66321243523316065, //130
+0.66149870801033595, //131
+0.65979381443298968, //132
+0.65809768637532129, //133
+0.65641025641025641, //134
+0.65473145780051156, //135
+0.65306122448979587, //136
+0.65139949109414763, //137
+0.64974619289340096, //138
+0.64810126582278482, //139
+0.64646464646464652, //140
+0.64483627204030225, //141
+0.64321608040201006, //142
+0.64160401002506262, //143
+0.64000000000000001, //144
+0.63840399002493764, //145
+0.63681592039800994, //146
+0.63523573200992556, //147
+0.63366336633663367, //148
+0.63209876543209875, //149
+0.63054187192118227, //150
+0.62899262899262898, //151
+0.62745098039215685, //152
+0.62591687041564792, //153
+0.62439024390243902, //154
+0.62287104622871048, //155
+0.62135922330097082, //156
+0.61985472154963683, //157
+0.61835748792270528, //158
+0.61686746987951813, //159
+0.61538461538461542, //160
+0.61390887290167862, //161
+0.61244019138755978, //162
+0.61097852028639621, //163
+0.60952380952380958, //164
+0.60807600950118768, //165
+0.60663507109004744, //166
+0.60520094562647753, //167
+0.60377358490566035, //168
+0.60235294117647054, //169
+0.60093896713615025, //170
+0.59953161592505855, //171
+0.59813084112149528, //172
+0.59673659673659674, //173
+0.59534883720930232, //174
+0.59396751740139209, //175
+0.59259259259259256, //176
+0.59122401847575057, //177
+0.58986175115207373, //178
+0.58850574712643677, //179
+0.58715596330275233, //180
+0.58581235697940504, //181
+0.58447488584474883, //182
+0.58314350797266512, //183
+0.58181818181818179, //184
+0.58049886621315194, //185
+0.579185520361991, //186
+0.57787810383747173, //187
+0.57657657657657657, //188
+0.57528089887640455, //189
+0.57399103139013452, //190
+0.57270693512304249, //191
+0.5714285714285714, //192
+0.57015590200445432, //193
+0.56888888888888889, //194
+0.56762749445676275, //195
+0.5663716814159292, //196
+0.56512141280353201, //197
+0.56387665198237891, //198
+0.56263736263736264, //199
+0.56140350877192979, //200
+0.56017505470459517, //201
+0.55895196506550215, //202
+0.55773420479302838, //203
+0.55652173913043479, //204
+0.55531453362255967, //205
+0.55411255411255411, //206
+0.55291576673866094, //207
+0.55172413793103448, //208
+0.55053763440860215, //209
+0.54935622317596566, //210
+0.54817987152034264, //211
+0.54700854700854706, //212
+0.54584221748400852, //213
+0.5446808510638298, //214
+0.54352441613588109, //215
+0.5423728813559322, //216
+0.54122621564482032, //217
+0.54008438818565396, //218
+0.53894736842105262, //219
+0.53781512605042014, //220
+0.5366876310272537, //221
+0.53556485355648531, //222
+0.53444676409185798, //223
+0.53333333333333333, //224
+0.53222453222453225, //225
+0.53112033195020747, //226
+0.53002070393374745, //227
+0.52892561983471076, //228
+0.52783505154639176, //229
+0.52674897119341568, //230
+0.52566735112936347, //231
+0.52459016393442626, //232
+0.52351738241308798, //233
+0.52244897959183678, //234
+0.52138492871690423, //235
+0.52032520325203258, //236
+0.51926977687626774, //237
+0.51821862348178138, //238
+0.51717171717171717, //239
+0.5161290322580645, //240
+0.51509054325955739, //241
+0.51405622489959835, //242
+0.51302605210420837, //243
+0.51200000000000001, //244
+0.51097804391217561, //245
+0.50996015936254979, //246
+0.50894632206759438, //247
+0.50793650793650791, //248
+0.50693069306930694, //249
+0.50592885375494068, //250
+0.50493096646942803, //251
+0.50393700787401574, //252
+0.50294695481335949, //253
+0.50196078431372548, //254
+0.50097847358121328, //255
+};
@@ -0,0 +1,48 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//tables for xlns32_db_sing in xlns32lpvip.cpp (db near the singularity, 0 < z < 1.0)
+//  2^(j/256) split into hi+lo doubles, log2(1+j/256) split into hi+lo doubles,
+//  and 1/(1+j/256); computed in long double and printed with 17 digits (exact)
+int main()
+{
+	FILE * f;
+	int j;
+	long double t[256], l[256];
+	double hi;
+	for (j=0; j<256; j++)
+	{
+		t[j] = exp2l(j/256.0L);
+		l[j] = log2l(1.0L + j/256.0L);
+	}
+	f = fopen("xlns32dbsingtbl.h","w");
+	fprintf(f,"double xlns32_dbsing_exphi[256] = {\n");
+	for (j=0; j<256; j++)
+		fprintf(f,"%.17g, //%d\n",(double)t[j],j);
+	fprintf(f,"};\n");
+	fprintf(f,"double xlns32_dbsing_explo[256] = {\n");
+	for (j=0; j<256; j++)
+	{
+		hi = (double)t[j];
+		fprintf(f,"%.17g, //%d\n",(double)(t[j]-hi),j);
+	}
+	fprintf(f,"};\n");
+	fprintf(f,"double xlns32_dbsing_loghi[256] = {\n");
+	for (j=0; j<256; j++)
+		fprintf(f,"%.17g, //%d\n",(double)l[j],j);
+	fprintf(f,"};\n");
+	fprintf(f,"double xlns32_dbsing_loglo[256] = {\n");
+	for (j=0; j<256; j++)
+	{
+		hi = (double)l[j];
+		fprintf(f,"%.17g, //%d\n",(double)(l[j]-hi),j);
+	}
+	fprintf(f,"};\n");
+	fprintf(f,"double xlns32_dbsing_recip[256] = {\n");
+	for (j=0; j<256; j++)
+		fprintf(f,"%.17g, //%d\n",(double)(1.0L/(1.0L + j/256.0L)),j);
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//tables for xlns32_sb_quad and xlns32_db_quad in xlns32.cpp (defined xlns32_quad or
+//  xlns32_dbquad), which interpolate quadratically:
+//    sb:   log2(1+2^-z), added to z
+//    db:   -log2(1-2^-z), subtracted from z, and below octave xlns32_dbqlogoct,
+//          around the singularity, P(z) = log2(z) - log2(1-2^-z), so that
+//          db(z) = z + log2(z) - P(z) with P smooth down to z=0 (P also bends
+//          less than -log2(1-2^-z) in the next two octaves, so it needs fewer
+//          segments there)
+//    log2: log2(1+x) for 0 <= x < 1, which gives log2(z) from the position of the
+//          leading bit of z
+//  octave k of z (0 <= k < xlns32_sbqoct) is cut into segments of 2^shift units
+//  (the low byte of xlns32_sbqoctave[k], likewise db), as long as the segment still
+//  meets the accuracy goal, so the segments widen as the functions flatten out;
+//  the log2 table has equal segments of 2^xlns32_log2qshift.  each segment has the
+//  value at its left node in units of 2^-(23+xlns32_sbqfrac) (the chord comes from
+//  the next node) and a 16-bit coefficient of the bump t*(1-t) under the chord,
+//  chosen to minimize the largest error on the segment.
+
+#define F 23
+#define FRAC 8
+#define U (1LL<<(F+FRAC))  //node units per octave
+#define OCT 25
+#define LOGOCT 3            //P(z) < 2 octaves still fits the 32-bit nodes
+#define GOAL (1.0/128)     //largest interpolation error allowed, in units of 2^-23
+#define NT 64              //points checked per segment
+#define SEARCH 64          //bump coefficients tried on either side of the first guess
+
+//the functions, with z in units of 2^-23 (x in units of 2^-31), in node units
+long double sbf(long double z)
+{
+	return log2l(1.0L + exp2l(-z/(1<<F)))*U;
+}
+
+long double dbp(long double z)
+{
+	long double x = z/(1<<F);
+	if (x == 0)
+		return -log2l(logl(2.0L))*U;
+	return -log2l(-expm1l(-x*logl(2.0L))/x)*U;
+}
+
+long double dbd(long double z)
+{
+	return -log2l(-expm1l(-z/(1<<F)*logl(2.0L)))*U;
+}
+
+long double lgf(long double x)
+{
+	return log2l(1.0L + x/U)*U;
+}
+
+//the interpolation exactly as xlns32_quad_interp does it
+long long quad(long long a, long long b, long long c, int s, long long t)
+{
+	long long h = (1LL << s) >> 1;
+	return a + (((b - a)*t + h) >> s) - ((c*((t*((1LL << s) - t)) >> s) + h) >> s);
+}
+
+//best bump coefficient for a segment and the error it leaves, in units of 2^-23:
+//start from the bump that is exact at the middle and search around it
+long double fit(long double (*f)(long double), long double z0, int s, long long a, long long b,
+                long long *cbest)
+{
+	long long c, c0;
+	long double e, emax, ebest, y[NT];
+	int j;
+	*cbest = 0;
+	if (s == 0)
+		return fabsl(a - f(z0))/(1<<FRAC);
+	for (j=0; j<NT; j++)
+		y[j] = f(z0 + (((long long)j << s)/NT));
+	c0 = (long long)floorl(4*((a + b)/2.0L - y[NT/2]) + .5L);
+	ebest = 1e30;
+	for (c=c0-SEARCH; c<=c0+SEARCH; c++)
+	{
+		if (c < -32768 || c > 32767)
+			continue;
+		emax = 0;
+		for (j=0; j<NT; j++)
+		{
+			e = fabsl(quad(a, b, c, s, ((long long)j << s)/NT) - y[j]);
+			if (e > emax) emax = e;
+		}
+		if (emax < ebest)
+		{
+			ebest = emax;
+			*cbest = c;
+		}
+	}
+	return ebest/(1<<FRAC);
+}
+
+long long node[1<<16], c2[1<<16];
+
+//cut [z0, z0 + 2^len) into the widest segments that meet GOAL, fill node[n..] and
+//c2[n..] and return the shift
+int segments(long double (*f)(long double), long double z0, int len, int n)
+{
+	int s, i;
+	long long c;
+	long double e;
+	for (s=len; s>0; s--)
+	{
+		e = 0;
+		for (i=0; i<(1<<(len-s)) && e<=GOAL; i++)
+		{
+			long double zs = z0 + ((long long)i << s);
+			long long a = (long long)floorl(f(zs) + .5L);
+			long long b = (long long)floorl(f(zs + (1LL<<s)) + .5L);
+			e = fit(f, zs, s, a, b, &c);
+			if (c < -32767 || c > 32766)
+				e = 1;
+		}
+		if (e <= GOAL)
+			break;
+	}
+	for (i=0; i<=(1<<(len-s)); i++)
+	{
+		node[n+i] = (long long)floorl(f(z0 + ((long long)i << s)) + .5L);
+		if (node[n+i] < 0 || node[n+i] > 0xffffffffLL)
+		{
+			fprintf(stderr, "node out of range\n");
+			exit(0);
+		}
+	}
+	for (i=0; i<(1<<(len-s)); i++)
+		fit(f, z0 + ((long long)i << s), s, node[n+i], node[n+i+1], &c2[n+i]);
+	c2[n+(1<<(len-s))] = 0;
+	return s;
+}
+
+void table(FILE *f, const char *name, int n)
+{
+	int i;
+	fprintf(f,"unsigned int xlns32_%snode[xlns32_%ssize] = {\n", name, name);
+	for (i=0; i<n; i++)
+		fprintf(f,"   0x%08llx,\n", node[i]);
+	fprintf(f,"};\n");
+	fprintf(f,"short xlns32_%sc2[xlns32_%ssize] = {\n", name, name);
+	for (i=0; i<n; i++)
+		fprintf(f,"   %lld,\n", c2[i]);
+	fprintf(f,"};\n");
+}
+
+int main()
+{
+	FILE * f;
+	int k, s, n, bytes = 0;
+	int first[OCT], shift[OCT];
+	f = fopen("xlns32quadtbl.h","w");
+	fprintf(f,"#define xlns32_sbqoct %d\n", OCT);
+	fprintf(f,"#define xlns32_sbqfrac %d\n", FRAC);
+	//sb
+	n = 0;
+	for (k=0; k<OCT; k++)
+	{
+		first[k] = n;
+		shift[k] = s = segments(sbf, (long double)k*(1<<F), F, n);
+		n += (1<<(F-s)) + 1;
+		fprintf(stderr, "sb octave %2d: shift %2d, %5d segments\n", k, s, 1<<(F-s));
+	}
+	fprintf(f,"#define xlns32_sbqsize %d\n", n);
+	fprintf(f,"unsigned int xlns32_sbqoctave[xlns32_sbqoct] = {  //first node<<8 | shift\n");
+	for (k=0; k<OCT; k++)
+		fprintf(f,"   (%d<<8) | %d, //%d\n", first[k], shift[k], k);
+	fprintf(f,"};\n");
+	table(f, "sbq", n);
+	bytes += n*6 + OCT*4;
+	//db
+	n = 0;
+	for (k=0; k<OCT; k++)
+	{
+		first[k] = n;
+		shift[k] = s = segments(k < LOGOCT ? dbp : dbd, (long double)k*(1<<F), F, n);
+		n += (1<<(F-s)) + 1;
+		fprintf(stderr, "db octave %2d: shift %2d, %5d segments\n", k, s, 1<<(F-s));
+	}
+	fprintf(f,"#define xlns32_dbqlogoct %d\n", LOGOCT);
+	fprintf(f,"#define xlns32_dbqsize %d\n", n);
+	fprintf(f,"unsigned int xlns32_dbqoctave[xlns32_sbqoct] = {  //first node<<8 | shift\n");
+	for (k=0; k<OCT; k++)
+		fprintf(f,"   (%d<<8) | %d, //%d\n", first[k], shift[k], k);
+	fprintf(f,"};\n");
+	table(f, "dbq", n);
+	bytes += n*6 + OCT*4;
+	//log2
+	s = segments(lgf, 0, F+FRAC, 0);
+	n = (1<<(F+FRAC-s)) + 1;
+	fprintf(stderr, "log2: shift %d, %d segments\n", s, n-1);
+	fprintf(f,"#define xlns32_log2qshift %d\n", s);
+	fprintf(f,"#define xlns32_log2qsize %d\n", n);
+	table(f, "log2q", n);
+	bytes += n*6;
+	fclose(f);
+	fprintf(stderr, "%d bytes\n", bytes);
+	return 1;
+}
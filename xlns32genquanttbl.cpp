@@ -0,0 +1,39 @@
+//generates xlns32quanttbl.h, the tables for converting IEEE fp16 and int8/int4
+//quantized weights to xlns32 (fp162xlns32 and xlns32_batch_from_fp16/_q8/_q4 in
+//xlns32.cpp); all round the log to nearest
+//   g++ xlns32genquanttbl.cpp -o xlns32genquanttbl -lm && ./xlns32genquanttbl
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// biased xlns32 of the integer q, rounded to nearest
+unsigned q2xlns32(int q)
+{
+	if (q == 0)
+		return 0;
+	return ((q < 0) ? 0x80000000u : 0) | ((unsigned)floor(8388608.0*log2(fabs((double)q))+0.5) + 0x40000000u);
+}
+
+int main()
+{
+	FILE * f;
+	int i;
+	f = fopen("xlns32quanttbl.h","w");
+	// fp16 mantissa m: 2^23*log2(1+m/1024), 2^23 carries into the exponent
+	fprintf(f,"const unsigned int xlns32fp16logtbl[1024] = {\n");
+	for (i=0; i<1024; i++)
+		fprintf(f,"%u%s //%d\n",(unsigned)floor(8388608.0*log2(1.0+i/1024.0)+0.5),(i < 1023) ? "," : "",i);
+	fprintf(f,"};\n");
+	// int8 q (indexed by its byte): xlns32 of q
+	fprintf(f,"const unsigned int xlns32q8tbl[256] = {\n");
+	for (i=0; i<256; i++)
+		fprintf(f,"0x%08x%s //%d\n",q2xlns32((signed char)i),(i < 255) ? "," : "",(signed char)i);
+	fprintf(f,"};\n");
+	// int4 nibble v (the value v-8): xlns32 of v-8
+	fprintf(f,"const unsigned int xlns32q4tbl[16] = {\n");
+	for (i=0; i<16; i++)
+		fprintf(f,"0x%08x%s //%d\n",q2xlns32(i-8),(i < 15) ? "," : "",i-8);
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
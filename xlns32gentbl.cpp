@@ -0,0 +1,362 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define xlns32_ideal
+#define xlns32_alt
+#include "xlns32.cpp"
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+
+//generates xlns32tbl.h, the tables of xlns32_sb_macro and xlns32_dbtrans3 in xlns32.cpp, and
+//explores other table parameters:
+//   g++ -std=c++11 -O2 -pthread xlns32gentbl.cpp -o xlns32gentbl
+//   ./xlns32gentbl                              xlns32tbl.h exactly as shipped (zhshift 14,
+//                                               db0shift 19, db1shift 10)
+//   ./xlns32gentbl zhshift db0shift db1shift [tablesize]
+//                                               a variant, xlns32tbl_<zhshift>_<db0shift>_<db1shift>.h,
+//                                               which carries its own parameters; compile with
+//                                               -Dxlns32_tbl='"xlns32tbl_13_19_10.h"'
+//   ./xlns32gentbl sweep [threads]              max and mean error against xlns32_sb_ideal and
+//                                               xlns32_db_ideal, table bytes and ns per xlns32_add
+//                                               for a grid of variants, and the Pareto front
+//  sb interpolates log2(1+2^-z) linearly between entries 2^zhshift apart (sbh holds bits 16..23,
+//  sbl bits 0..15, so zhshift <= 15 keeps the slope product in 32 bits); tablesize defaults to
+//  esszer>>zhshift, smaller sizes give up the tail of sb.  db(z) = log2(2^z-1) is split
+//  into z0+z1+z2 at db0shift and db1shift (bits 0..27), one table per field, combined by
+//  cotransformation with sb.  entries are truncated as the original tables were.
+
+#define ZMAX 28                 //z < 2^28 > esszer
+#define STRIDE 61               //z sampled by the sweep
+#define LATN (1 << 20)          //additions per latency chain
+#define REPS 5
+
+struct tbl
+{
+	int zhshift, db0shift, db1shift, tablesize;
+	std::vector<unsigned> sbl, db0, db1, db2;
+	std::vector<unsigned char> sbh;
+	int bytes() const
+	{
+		return tablesize*(sizeof(unsigned) + 1) + (db0.size() + db1.size() + db2.size())*sizeof(xlns32);
+	}
+};
+
+int nthreads = 1;
+
+//f(i0, i1) over [0, n) split among the threads
+template <class F> void parallel(long n, F f)
+{
+	std::vector<std::thread> th;
+	int t;
+	for (t=0; t<nthreads; t++)
+		th.push_back(std::thread(f, n*t/nthreads, n*(t+1)/nthreads));
+	for (t=0; t<nthreads; t++)
+		th[t].join();
+}
+
+//the table entries, computed in double as the original tables were
+xlns32 sbentry(long i, int shift)
+{
+	double z = ((double)(i << shift))/xlns32_scale;
+	return (xlns32)(log(1+pow(2.0,-z))/log(2.0)*xlns32_scale);
+}
+
+xlns32 dbentry(long j, int shift)
+{
+	double z = ((double)(j << shift))/xlns32_scale;
+	return j ? (xlns32)(int)(log(pow(2.0,z)-1)/log(2.0)*xlns32_scale) : 0;
+}
+
+void make(tbl &t, int zhshift, int db0shift, int db1shift, int tablesize)
+{
+	t.zhshift = zhshift;
+	t.db0shift = db0shift;
+	t.db1shift = db1shift;
+	t.tablesize = tablesize;
+	t.sbl.resize(tablesize);
+	t.sbh.resize(tablesize);
+	t.db0.resize(1 << (ZMAX-db0shift));
+	t.db1.resize(1 << (db0shift-db1shift));
+	t.db2.resize(1 << db1shift);
+	parallel(tablesize, [&](long i0, long i1) {
+		for (long i=i0; i<i1; i++)
+		{
+			xlns32 v = sbentry(i, zhshift);
+			t.sbl[i] = v & 0xffff;
+			t.sbh[i] = v >> 16;
+		}
+	});
+	parallel(t.db0.size() + t.db1.size() + t.db2.size(), [&](long i0, long i1) {
+		for (long j=i0; j<i1; j++)
+		{
+			long n0 = t.db0.size(), n1 = t.db1.size();
+			if (j < n0)
+				t.db0[j] = dbentry(j, db0shift);
+			else if (j < n0 + n1)
+				t.db1[j - n0] = dbentry(j - n0, db1shift);
+			else
+				t.db2[j - n0 - n1] = dbentry(j - n0 - n1, 0);
+		}
+	});
+}
+
+//one line per entry, CRLF as in the shipped header
+void dbtable(FILE *f, const char *name, const std::vector<unsigned> &d)
+{
+	size_t j;
+	fprintf(f,"xlns32 xlns32_%stable[xlns32_%ssize] = {0,\r\n", name, name);
+	for (j=1; j<d.size(); j++)
+		fprintf(f,"   0x%08x%s\r\n", d[j], (j+1 < d.size()) ? "," : "");
+	fprintf(f,"};\r\n");
+}
+
+void write(const tbl &t, const char *name, int params)
+{
+	FILE * f;
+	int i;
+	f = fopen(name,"wb");
+	if (params)
+	{
+		fprintf(f,"//generated by xlns32gentbl %d %d %d %d\r\n", t.zhshift, t.db0shift, t.db1shift,
+		        t.tablesize);
+		fprintf(f,"#define xlns32_tablesize     %d\r\n", t.tablesize);
+		fprintf(f,"#define xlns32_zhmask        0x%08xL\r\n", ((1u << ZMAX) - 1) & ~((1u << t.zhshift) - 1));
+		fprintf(f,"#define xlns32_zlmask        0x%08xL\r\n", (1u << t.zhshift) - 1);
+		fprintf(f,"#define xlns32_zhshift       %d\r\n", t.zhshift);
+		fprintf(f,"#define xlns32_db0shift      %d\r\n", t.db0shift);
+		fprintf(f,"#define xlns32_db1shift      %d\r\n", t.db1shift);
+		fprintf(f,"#define xlns32_db0mask       0x%08xL\r\n", ((1u << ZMAX) - 1) & ~((1u << t.db0shift) - 1));
+		fprintf(f,"#define xlns32_db1mask       0x%08xL\r\n", ((1u << t.db0shift) - 1) & ~((1u << t.db1shift) - 1));
+		fprintf(f,"#define xlns32_db2mask       0x%08xL\r\n", (1u << t.db1shift) - 1);
+		fprintf(f,"#define xlns32_db0size       %d\r\n", (int)t.db0.size());
+		fprintf(f,"#define xlns32_db1size       %d\r\n", (int)t.db1.size());
+		fprintf(f,"#define xlns32_db2size       %d\r\n", (int)t.db2.size());
+	}
+	fprintf(f,"unsigned /*short*/ xlns32_sbltable[xlns32_tablesize] = {\r\n");
+	for (i=0; i<t.tablesize; i++)
+		fprintf(f,"   0x%04x%s\r\n", t.sbl[i], (i+1 < t.tablesize) ? "," : "");
+	fprintf(f,"};\r\n");
+	fprintf(f,"unsigned char xlns32_sbhtable[xlns32_tablesize] = {\r\n");
+	for (i=0; i<t.tablesize; i++)
+		fprintf(f,"   0x%02x%s\r\n", t.sbh[i], (i+1 < t.tablesize) ? "," : "");
+	fprintf(f,"};\r\n");
+	dbtable(f, "db0", t.db0);
+	dbtable(f, "db1", t.db1);
+	dbtable(f, "db2", t.db2);
+	fclose(f);
+}
+
+//xlns32_sb_macro and xlns32_dbtrans3 on the tables of a variant
+inline xlns32 sb(const tbl &t, xlns32 z)
+{
+	xlns32 zh = z >> t.zhshift, zl = z & ((1u << t.zhshift) - 1);
+	if (zh >= (xlns32)t.tablesize-1)
+		return z;
+	return (z - zl) + (((xlns32)t.sbh[zh]) << 16) + t.sbl[zh] +
+	       ((((1u << t.zhshift) - (((1u << t.zhshift) - 1) & (t.sbl[zh] - t.sbl[zh+1]))) * zl) >> t.zhshift);
+}
+
+inline xlns32 db(const tbl &t, xlns32 z)
+{
+	xlns32 z0 = z >> t.db0shift, z1 = (z >> t.db1shift) & ((1u << (t.db0shift - t.db1shift)) - 1),
+	       z2 = z & ((1u << t.db1shift) - 1);
+	xlns32 d0 = t.db0[z0], d1 = t.db1[z1], d2 = t.db2[z2];
+	if (z1 == 0)
+	{
+		if (z2 == 0)
+			return z0 ? d0 : 0;
+		return z0 ? d2 + sb(t, z2 + d0 - d2) : d2;
+	}
+	else if (z2 == 0)
+		return z0 ? d1 + sb(t, (z1 << t.db1shift) + d0 - d1) : d1;
+	else if (z0 == 0)
+		return d2 + sb(t, z2 + d1 - d2);
+	return d2 + sb(t, z2 + d1 + sb(t, (z1 << t.db1shift) + d0 - d1) - d2);
+}
+
+//xlns32_add (xlns32_alt) on the tables of a variant
+inline xlns32 add(const tbl &t, xlns32 x, xlns32 y)
+{
+	xlns32 minxyl, maxxy, xl, yl, usedb;
+	xlns32_signed adjust, z;
+	xl = x & xlns32_logmask;
+	yl = y & xlns32_logmask;
+	minxyl = (yl>xl) ? xl : yl;
+	maxxy  = (xl>yl) ? x  : y;
+	z = minxyl - (maxxy&xlns32_logmask);
+	usedb = xlns32_signmask&(x^y);
+	adjust = usedb ? z + ((xlns32_signed)db(t, -z)) : z + ((xlns32_signed)sb(t, -z));
+	adjust = (z < -xlns32_esszer) ? 0 : adjust;
+	return ((z==0) && usedb) ? xlns32_zero : xlns32_mul(maxxy, xlns32_logsignmask + adjust);
+}
+
+double now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct result
+{
+	int zh, d0, d1, bytes, pareto;
+	double sbmax, sbmean, dbmax, dbmean, ns;
+};
+
+xlns32 checksum = 0;
+
+//ideal values at the sampled z, shared by all the variants
+std::vector<xlns32_signed> sbid, dbid;
+
+void measure(const tbl &t, result &r, const std::vector<xlns32> &xs)
+{
+	long n = sbid.size();
+	std::vector<double> smax(nthreads), ssum(nthreads), dmax(nthreads), dsum(nthreads);
+	int k;
+	parallel(nthreads, [&](long k0, long k1) {
+		for (long k=k0; k<k1; k++)
+			for (long i=n*k/nthreads; i<n*(k+1)/nthreads; i++)
+			{
+				xlns32 z = (xlns32)i*STRIDE;
+				double e = fabs((double)((xlns32_signed)sb(t, z) - sbid[i]));
+				smax[k] = (e > smax[k]) ? e : smax[k];
+				ssum[k] += e;
+				if (z == 0)
+					continue;
+				e = fabs((double)((xlns32_signed)db(t, z) - dbid[i]));
+				dmax[k] = (e > dmax[k]) ? e : dmax[k];
+				dsum[k] += e;
+			}
+	});
+	r.sbmax = r.sbmean = r.dbmax = r.dbmean = 0;
+	for (k=0; k<nthreads; k++)
+	{
+		r.sbmax = (smax[k] > r.sbmax) ? smax[k] : r.sbmax;
+		r.dbmax = (dmax[k] > r.dbmax) ? dmax[k] : r.dbmax;
+		r.sbmean += ssum[k]/n;
+		r.dbmean += dsum[k]/(n-1);
+	}
+	//one thread: a running sum, each addition waiting for the previous one
+	r.ns = 1e30;
+	for (k=0; k<REPS; k++)
+	{
+		xlns32 acc = xlns32_one;
+		double t1 = now();
+		for (size_t i=0; i<xs.size(); i++)
+			acc = add(t, acc, xs[i]);
+		double t2 = now();
+		r.ns = (t2 - t1 < r.ns) ? t2 - t1 : r.ns;
+		checksum += acc;
+	}
+	r.ns *= 1e9/xs.size();
+}
+
+int sweep()
+{
+	const int zhs[] = { 11, 12, 13, 14, 15 };
+	const int dbs[][2] = { {17, 8}, {18, 9}, {19, 10}, {20, 10}, {21, 11}, {22, 11} };
+	std::vector<result> res;
+	std::vector<xlns32> xs(LATN);
+	long n = xlns32_esszer/STRIDE + 1, i;
+	size_t a, b;
+	sbid.resize(n);
+	dbid.resize(n);
+	parallel(n, [&](long i0, long i1) {
+		for (long i=i0; i<i1; i++)
+		{
+			xlns32 z = (xlns32)i*STRIDE;
+			sbid[i] = xlns32_sb_ideal(z);
+			dbid[i] = z ? xlns32_db_ideal(z) : 0;
+		}
+	});
+	//a sum of terms within a few octaves of each other, half of them negative
+	srand(1);
+	for (i=0; i<LATN; i++)
+		xs[i] = fp2xlns32((rand() & 1 ? -1 : 1)*pow(2.0, 8.0*rand()/RAND_MAX - 4));
+	printf("%d threads, %ld z per variant, %d additions per latency chain\n", nthreads, n, LATN);
+	printf("zhshift db0 db1     bytes   sb max  sb mean   db max  db mean   ns/add  pareto\n");
+	for (int zh : zhs)
+		for (auto d : dbs)
+		{
+			tbl t;
+			result r;
+			make(t, zh, d[0], d[1], (xlns32_esszer + (1 << zh) - 1) >> zh);
+			r.zh = zh;
+			r.d0 = d[0];
+			r.d1 = d[1];
+			r.bytes = t.bytes();
+			measure(t, r, xs);
+			res.push_back(r);
+			fprintf(stderr, "%d %d %d done\n", zh, d[0], d[1]);
+		}
+	//a variant is on the front if no other one is at least as good in bytes, largest error
+	//(of sb and db), mean error (sb and db together) and ns/add, and better in one of them
+	for (a=0; a<res.size(); a++)
+	{
+		double ea = res[a].sbmax > res[a].dbmax ? res[a].sbmax : res[a].dbmax;
+		double ma = res[a].sbmean + res[a].dbmean;
+		res[a].pareto = 1;
+		for (b=0; b<res.size(); b++)
+		{
+			double eb = res[b].sbmax > res[b].dbmax ? res[b].sbmax : res[b].dbmax;
+			double mb = res[b].sbmean + res[b].dbmean;
+			if (res[b].bytes <= res[a].bytes && eb <= ea && mb <= ma && res[b].ns <= res[a].ns &&
+			    (res[b].bytes < res[a].bytes || eb < ea || mb < ma || res[b].ns < res[a].ns))
+				res[a].pareto = 0;
+		}
+	}
+	for (result &r : res)
+		printf("%7d %3d %3d %9d %8.3f %8.3f %8.3f %8.3f %8.2f  %s%s\n", r.zh, r.d0, r.d1, r.bytes,
+		       r.sbmax, r.sbmean, r.dbmax, r.dbmean, r.ns, r.pareto ? "*" : "",
+		       (r.zh == 14 && r.d0 == 19 && r.d1 == 10) ? " (xlns32tbl.h)" : "");
+	printf("pareto front (* above), smallest tables first:\n");
+	std::sort(res.begin(), res.end(), [](const result &x, const result &y) { return x.bytes < y.bytes; });
+	for (result &r : res)
+		if (r.pareto)
+			printf("   xlns32gentbl %2d %2d %2d   %7d bytes, max error %.0f, %.2f ns/add\n", r.zh, r.d0, r.d1,
+			       r.bytes, r.sbmax > r.dbmax ? r.sbmax : r.dbmax, r.ns);
+	printf("(checksum %08x)\n", checksum);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	tbl t;
+	char name[64];
+	int zh, d0, d1, size;
+	nthreads = std::thread::hardware_concurrency();
+	nthreads = (nthreads > 0) ? nthreads : 1;
+	if (argc > 1 && strcmp(argv[1], "sweep") == 0)
+	{
+		if (argc > 2)
+			nthreads = atoi(argv[2]);
+		return sweep();
+	}
+	if (argc == 1)
+	{
+		make(t, 14, 19, 10, 4096*3+1000);
+		write(t, "xlns32tbl.h", 0);
+		return 1;
+	}
+	if (argc < 4)
+	{
+		fprintf(stderr, "usage: xlns32gentbl [zhshift db0shift db1shift [tablesize] | sweep [threads]]\n");
+		return 0;
+	}
+	zh = atoi(argv[1]);
+	d0 = atoi(argv[2]);
+	d1 = atoi(argv[3]);
+	size = (argc > 4) ? atoi(argv[4]) : (xlns32_esszer + (1 << zh) - 1) >> zh;
+	if (zh < 8 || zh > 15 || d0 >= ZMAX || d1 < 1 || d1 >= d0 || size < 2 ||
+	    size > ((1 << ZMAX) >> zh))
+	{
+		fprintf(stderr, "need 8 <= zhshift <= 15, 0 < db1shift < db0shift < %d, 2 <= tablesize\n", ZMAX);
+		return 0;
+	}
+	make(t, zh, d0, d1, size);
+	sprintf(name, "xlns32tbl_%d_%d_%d.h", zh, d0, d1);
+	write(t, name, 1);
+	fprintf(stderr, "%s: %d bytes\n", name, t.bytes());
+	return 1;
+}
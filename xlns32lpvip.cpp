@@ -18,6 +18,40 @@
      return (((1<<xlns32_F)+(z&((1<<xlns32_F)-1)))>>(-(z>>xlns32_F)));
   }
 
+// db near the singularity (0 < z < 1<<F) without libm.  For every such z this
+// returns the same value as xlns32_db_ideal(z) (tests/xlns16_32_dbsing_test.cpp
+// checks all of them): 2^(z/scale)-1 comes from a 256-entry double-double table
+// (xlns32gendbsing.cpp) times a short exp polynomial, and its log2 from a
+// 256-entry table plus a short log polynomial, both far finer than the rounding.
+
+#include <string.h>
+#include "xlns32dbsingtbl.h"
+
+#define xlns32_dbsing_ln2     0.69314718055994530942
+#define xlns32_dbsing_invln2  1.44269504088896340736
+
+inline xlns32 xlns32_db_sing(xlns32_signed z)
+{
+    xlns32_signed jh = z >> (xlns32_F-8);
+    double a = (z & ((1<<(xlns32_F-8))-1)) * (xlns32_dbsing_ln2/xlns32_scale);
+    double e2 = a*(1+a*(1./2+a*(1./6+a*(1./24+a*(1./120+a*(1./720))))));
+    double p = xlns32_dbsing_exphi[jh] + (xlns32_dbsing_exphi[jh]*e2 +
+                                          (xlns32_dbsing_explo[jh] + xlns32_dbsing_explo[jh]*e2));
+    double q = p - 1.0;        // exact, as in xlns32_db_ideal
+    unsigned long long bits, mbits, hbits;
+    double m, mh;
+    memcpy(&bits, &q, sizeof(q));
+    int j = (int)((bits>>44)&255);
+    mbits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    hbits = (bits & 0x000ff00000000000ULL) | 0x3ff0000000000000ULL;
+    memcpy(&m, &mbits, sizeof(m));
+    memcpy(&mh, &hbits, sizeof(mh));
+    double r = (m - mh)*xlns32_dbsing_recip[j];
+    double l1 = r*(1 - r*(1./2 - r*(1./3 - r*(1./4 - r*(1./5 - r*(1./6 - r*(1./7)))))))*xlns32_dbsing_invln2;
+    double l = (double)((int)(bits>>52) - 1023) + xlns32_dbsing_loghi[j] + (xlns32_dbsing_loglo[j] + l1);
+    return ((xlns32_signed) (l*xlns32_scale+.5));
+}
+
 //need to define xlns32_aicasb if xlns32_add_lpvip is to give accurate summation
 
 
@@ -32,6 +66,7 @@ inline xlns32 xlns32_add_lpvip(xlns32 x, xlns32 y)
     maxxy  = (xl>yl) ? x  : y;
     z = minxyl - (maxxy&xlns32_logmask);
     usedb = xlns32_signmask&(x^y); 
+    xlns32_zprof(-z, usedb);
        xlns32_signed precond = (usedb==0) ? (
                                             #ifdef xlns32_aicasb
                                               (z > -(7<<(xlns32_F-1))) ? ((-z)>>3) : (7<<(xlns32_F-4)) 
@@ -46,21 +81,445 @@ inline xlns32 xlns32_add_lpvip(xlns32 x, xlns32 y)
                             z >= -(3<<(xlns32_F-2)) ? -(1<<(xlns32_F-6)): //6)) : 
                                                       +(1<<(xlns32_F-6)); //6));
        xlns32_signed mitch = (-z >= 1<<xlns32_F)||(usedb==0) ? xlns32_mitch(z+precond) : 
-                                          -xlns32_db_ideal(-z)-z; // use ideal for singularity
+                                          -xlns32_db_sing(-z)-z; // use table for singularity
        adjust = usedb ? -mitch : (z==0) ? 1<<(xlns32_F) : mitch + postcond;
       adjustez = (z < -xlns32_esszer) ? 0 : adjust; 
+    xlns32_count_if((z==0) && usedb, cancel);
+    xlns32_count_if(z < -xlns32_esszer, esszer);
     return ((z==0) && usedb) ? 
                      xlns32_zero :
                      xlns32_mul(maxxy, xlns32_logsignmask + adjustez);
 }
 
+// SIMD versions of xlns32_add_lpvip (compiled with -mavx2 or -mavx512f)
+// each lane gives exactly the same bits as the scalar xlns32_add_lpvip above.
+// lanes that land in the db singularity (0 < -z < 1<<F) use a vector
+// xlns32_db_sing with the same operations in the same order.
+// xlns32_mitch relies on the x86 shift count being taken mod 32, so the
+// vector shift count is masked the same way.
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#ifdef __AVX2__
+// 4 lanes of xlns32_db_sing (every lane must have 0 < z < 1<<F)
+inline __m128i xlns32_db_sing_avx2(__m128i z)
+{
+    const __m256i mantmask = _mm256_set1_epi64x(0x000fffffffffffffLL);
+    const __m256i highmask = _mm256_set1_epi64x(0x000ff00000000000LL);
+    const __m256i onebits  = _mm256_set1_epi64x(0x3ff0000000000000LL);
+    const __m256i magic    = _mm256_set1_epi64x(0x4330000000000000LL);   // 2^52
+    __m128i jh = _mm_srli_epi32(z, xlns32_F-8);
+    __m256d a = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_and_si128(z, _mm_set1_epi32((1<<(xlns32_F-8))-1))),
+                              _mm256_set1_pd(xlns32_dbsing_ln2/xlns32_scale));
+    __m256d t = _mm256_add_pd(_mm256_set1_pd(1./120), _mm256_mul_pd(a, _mm256_set1_pd(1./720)));
+    t = _mm256_add_pd(_mm256_set1_pd(1./24), _mm256_mul_pd(a, t));
+    t = _mm256_add_pd(_mm256_set1_pd(1./6), _mm256_mul_pd(a, t));
+    t = _mm256_add_pd(_mm256_set1_pd(1./2), _mm256_mul_pd(a, t));
+    __m256d e2 = _mm256_mul_pd(a, _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(a, t)));
+    __m256d th = _mm256_i32gather_pd(xlns32_dbsing_exphi, jh, 8);
+    __m256d tl = _mm256_i32gather_pd(xlns32_dbsing_explo, jh, 8);
+    __m256d p = _mm256_add_pd(th, _mm256_add_pd(_mm256_mul_pd(th, e2), _mm256_add_pd(tl, _mm256_mul_pd(tl, e2))));
+    __m256i bits = _mm256_castpd_si256(_mm256_sub_pd(p, _mm256_set1_pd(1.0)));
+    __m256i j = _mm256_and_si256(_mm256_srli_epi64(bits, 44), _mm256_set1_epi64x(255));
+    __m256d m  = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, mantmask), onebits));
+    __m256d mh = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, highmask), onebits));
+    __m256d r = _mm256_mul_pd(_mm256_sub_pd(m, mh), _mm256_i64gather_pd(xlns32_dbsing_recip, j, 8));
+    t = _mm256_sub_pd(_mm256_set1_pd(1./6), _mm256_mul_pd(r, _mm256_set1_pd(1./7)));
+    t = _mm256_sub_pd(_mm256_set1_pd(1./5), _mm256_mul_pd(r, t));
+    t = _mm256_sub_pd(_mm256_set1_pd(1./4), _mm256_mul_pd(r, t));
+    t = _mm256_sub_pd(_mm256_set1_pd(1./3), _mm256_mul_pd(r, t));
+    t = _mm256_sub_pd(_mm256_set1_pd(1./2), _mm256_mul_pd(r, t));
+    __m256d l1 = _mm256_mul_pd(_mm256_mul_pd(r, _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(r, t))),
+                               _mm256_set1_pd(xlns32_dbsing_invln2));
+    __m256d e = _mm256_sub_pd(_mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magic)),
+                                            _mm256_castsi256_pd(magic)), _mm256_set1_pd(1023.0));
+    __m256d l = _mm256_add_pd(_mm256_add_pd(e, _mm256_i64gather_pd(xlns32_dbsing_loghi, j, 8)),
+                              _mm256_add_pd(_mm256_i64gather_pd(xlns32_dbsing_loglo, j, 8), l1));
+    return _mm256_cvttpd_epi32(_mm256_add_pd(_mm256_mul_pd(l, _mm256_set1_pd(xlns32_scale)), _mm256_set1_pd(.5)));
+}
+
+inline __m256i xlns32_add_lpvip_avx2(__m256i x, __m256i y)
+{
+    const __m256i logmask = _mm256_set1_epi32(xlns32_logmask);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i xl = _mm256_and_si256(x, logmask);
+    __m256i yl = _mm256_and_si256(y, logmask);
+    __m256i minxyl = _mm256_min_epi32(xl, yl);
+    __m256i maxxy = _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi32(xl, yl));
+    __m256i z = _mm256_sub_epi32(minxyl, _mm256_and_si256(maxxy, logmask));
+    __m256i negz = _mm256_sub_epi32(zero, z);
+    __m256i usedb = _mm256_srai_epi32(_mm256_xor_si256(x, y), 31);
+    __m256i zeq = _mm256_cmpeq_epi32(z, zero);
+    #ifdef xlns32_zprofile
+    {
+        xlns32_signed zs[8], us[8];
+        _mm256_storeu_si256((__m256i *)zs, z);
+        _mm256_storeu_si256((__m256i *)us, usedb);
+        for (int j = 0; j < 8; j++)
+            xlns32_zprof(-zs[j], us[j]);
+    }
+    #endif
+    #ifdef xlns32_aicasb
+     __m256i sbpre = _mm256_blendv_epi8(_mm256_set1_epi32(7<<(xlns32_F-4)), _mm256_srli_epi32(negz, 3),
+                                        _mm256_cmpgt_epi32(z, _mm256_set1_epi32(-(7<<(xlns32_F-1)))));
+    #else
+     __m256i sbpre = _mm256_srli_epi32(negz, 3);
+    #endif
+    __m256i dbpre = _mm256_blendv_epi8(_mm256_add_epi32(_mm256_srai_epi32(z, 2), _mm256_set1_epi32(9<<(xlns32_F-3))),
+                                       _mm256_set1_epi32(5<<(xlns32_F-3)),
+                                       _mm256_cmpgt_epi32(_mm256_set1_epi32(-(2<<xlns32_F)), z));
+    __m256i precond = _mm256_blendv_epi8(sbpre, dbpre, usedb);
+    __m256i postcond = _mm256_and_si256(_mm256_cmpgt_epi32(z, _mm256_set1_epi32(-(3<<xlns32_F))),
+                         _mm256_blendv_epi8(_mm256_set1_epi32(+(1<<(xlns32_F-6))), _mm256_set1_epi32(-(1<<(xlns32_F-6))),
+                                            _mm256_cmpgt_epi32(z, _mm256_set1_epi32(-(3<<(xlns32_F-2))-1))));
+    __m256i w = _mm256_add_epi32(z, precond);
+    __m256i mitch = _mm256_srlv_epi32(_mm256_add_epi32(_mm256_set1_epi32(1<<xlns32_F),
+                                                       _mm256_and_si256(w, _mm256_set1_epi32((1<<xlns32_F)-1))),
+                                      _mm256_and_si256(_mm256_sub_epi32(zero, _mm256_srli_epi32(w, xlns32_F)),
+                                                       _mm256_set1_epi32(31)));
+    __m256i sing = _mm256_andnot_si256(_mm256_or_si256(zeq, _mm256_cmpgt_epi32(negz, _mm256_set1_epi32((1<<xlns32_F)-1))),
+                                       usedb);
+    if (!_mm256_testz_si256(sing, sing))
+    {
+        __m256i d = _mm256_blendv_epi8(_mm256_set1_epi32(1), negz, sing);
+        __m256i db = _mm256_inserti128_si256(_mm256_castsi128_si256(xlns32_db_sing_avx2(_mm256_castsi256_si128(d))),
+                                             xlns32_db_sing_avx2(_mm256_extracti128_si256(d, 1)), 1);
+        mitch = _mm256_blendv_epi8(mitch, _mm256_sub_epi32(negz, db), sing);   // -db(-z)-z
+    }
+    __m256i adjust = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_add_epi32(mitch, postcond),
+                                                           _mm256_set1_epi32(1<<xlns32_F), zeq),
+                                        _mm256_sub_epi32(zero, mitch), usedb);
+    __m256i adjustez = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(-xlns32_esszer), z), adjust);
+    // inline xlns32_mul(maxxy, xlns32_logsignmask + adjustez)
+    __m256i yy = _mm256_add_epi32(_mm256_set1_epi32(xlns32_logsignmask), adjustez);
+    __m256i temp = _mm256_sub_epi32(_mm256_add_epi32(_mm256_and_si256(maxxy, logmask), _mm256_and_si256(yy, logmask)),
+                                    _mm256_set1_epi32(xlns32_logsignmask));
+    __m256i sign = _mm256_and_si256(_mm256_xor_si256(maxxy, yy), _mm256_set1_epi32(xlns32_signmask));
+    __m256i unf = _mm256_srai_epi32(_mm256_slli_epi32(temp, 1), 31);
+    __m256i res = _mm256_blendv_epi8(_mm256_or_si256(sign, temp),
+                                     _mm256_or_si256(sign, _mm256_andnot_si256(unf, logmask)),
+                                     _mm256_srai_epi32(temp, 31));
+    #ifdef xlns32_counters
+    int cancel = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(zeq, usedb)));
+    int sat = _mm256_movemask_ps(_mm256_castsi256_ps(temp)) & ~cancel;
+    int under = _mm256_movemask_ps(_mm256_castsi256_ps(unf));
+    xlns32_count_n(cancel, __builtin_popcount(cancel));
+    xlns32_count_n(esszer, __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(
+                               _mm256_cmpgt_epi32(_mm256_set1_epi32(-xlns32_esszer), z)))));
+    xlns32_count_n(ovf, __builtin_popcount(sat & ~under));
+    xlns32_count_n(unf, __builtin_popcount(sat & under));
+    #endif
+    return _mm256_andnot_si256(_mm256_and_si256(zeq, usedb), res);
+}
+#endif
+
+#ifdef __AVX512F__
+// 8 lanes of xlns32_db_sing (every lane must have 0 < z < 1<<F)
+inline __m256i xlns32_db_sing_avx512(__m256i z)
+{
+    const __m512i mantmask = _mm512_set1_epi64(0x000fffffffffffffLL);
+    const __m512i highmask = _mm512_set1_epi64(0x000ff00000000000LL);
+    const __m512i onebits  = _mm512_set1_epi64(0x3ff0000000000000LL);
+    const __m512i magic    = _mm512_set1_epi64(0x4330000000000000LL);   // 2^52
+    __m256i jh = _mm256_srli_epi32(z, xlns32_F-8);
+    __m512d a = _mm512_mul_pd(_mm512_cvtepi32_pd(_mm256_and_si256(z, _mm256_set1_epi32((1<<(xlns32_F-8))-1))),
+                              _mm512_set1_pd(xlns32_dbsing_ln2/xlns32_scale));
+    __m512d t = _mm512_add_pd(_mm512_set1_pd(1./120), _mm512_mul_pd(a, _mm512_set1_pd(1./720)));
+    t = _mm512_add_pd(_mm512_set1_pd(1./24), _mm512_mul_pd(a, t));
+    t = _mm512_add_pd(_mm512_set1_pd(1./6), _mm512_mul_pd(a, t));
+    t = _mm512_add_pd(_mm512_set1_pd(1./2), _mm512_mul_pd(a, t));
+    __m512d e2 = _mm512_mul_pd(a, _mm512_add_pd(_mm512_set1_pd(1.0), _mm512_mul_pd(a, t)));
+    __m512d th = _mm512_i32gather_pd(jh, xlns32_dbsing_exphi, 8);
+    __m512d tl = _mm512_i32gather_pd(jh, xlns32_dbsing_explo, 8);
+    __m512d p = _mm512_add_pd(th, _mm512_add_pd(_mm512_mul_pd(th, e2), _mm512_add_pd(tl, _mm512_mul_pd(tl, e2))));
+    __m512i bits = _mm512_castpd_si512(_mm512_sub_pd(p, _mm512_set1_pd(1.0)));
+    __m512i j = _mm512_and_si512(_mm512_srli_epi64(bits, 44), _mm512_set1_epi64(255));
+    __m512d m  = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, mantmask), onebits));
+    __m512d mh = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, highmask), onebits));
+    __m512d r = _mm512_mul_pd(_mm512_sub_pd(m, mh), _mm512_i64gather_pd(j, xlns32_dbsing_recip, 8));
+    t = _mm512_sub_pd(_mm512_set1_pd(1./6), _mm512_mul_pd(r, _mm512_set1_pd(1./7)));
+    t = _mm512_sub_pd(_mm512_set1_pd(1./5), _mm512_mul_pd(r, t));
+    t = _mm512_sub_pd(_mm512_set1_pd(1./4), _mm512_mul_pd(r, t));
+    t = _mm512_sub_pd(_mm512_set1_pd(1./3), _mm512_mul_pd(r, t));
+    t = _mm512_sub_pd(_mm512_set1_pd(1./2), _mm512_mul_pd(r, t));
+    __m512d l1 = _mm512_mul_pd(_mm512_mul_pd(r, _mm512_sub_pd(_mm512_set1_pd(1.0), _mm512_mul_pd(r, t))),
+                               _mm512_set1_pd(xlns32_dbsing_invln2));
+    __m512d e = _mm512_sub_pd(_mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_srli_epi64(bits, 52), magic)),
+                                            _mm512_castsi512_pd(magic)), _mm512_set1_pd(1023.0));
+    __m512d l = _mm512_add_pd(_mm512_add_pd(e, _mm512_i64gather_pd(j, xlns32_dbsing_loghi, 8)),
+                              _mm512_add_pd(_mm512_i64gather_pd(j, xlns32_dbsing_loglo, 8), l1));
+    return _mm512_cvttpd_epi32(_mm512_add_pd(_mm512_mul_pd(l, _mm512_set1_pd(xlns32_scale)), _mm512_set1_pd(.5)));
+}
+
+inline __m512i xlns32_add_lpvip_avx512(__m512i x, __m512i y)
+{
+    const __m512i logmask = _mm512_set1_epi32(xlns32_logmask);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i xl = _mm512_and_si512(x, logmask);
+    __m512i yl = _mm512_and_si512(y, logmask);
+    __m512i minxyl = _mm512_min_epi32(xl, yl);
+    __m512i maxxy = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(xl, yl), y, x);
+    __m512i z = _mm512_sub_epi32(minxyl, _mm512_and_si512(maxxy, logmask));
+    __m512i negz = _mm512_sub_epi32(zero, z);
+    __mmask16 usedb = _mm512_cmplt_epi32_mask(_mm512_xor_si512(x, y), zero);
+    __mmask16 zeq = _mm512_cmpeq_epi32_mask(z, zero);
+    #ifdef xlns32_zprofile
+    {
+        xlns32_signed zs[16];
+        _mm512_storeu_si512(zs, z);
+        for (int j = 0; j < 16; j++)
+            xlns32_zprof(-zs[j], (usedb>>j)&1);
+    }
+    #endif
+    #ifdef xlns32_aicasb
+     __m512i sbpre = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(z, _mm512_set1_epi32(-(7<<(xlns32_F-1)))),
+                                             _mm512_set1_epi32(7<<(xlns32_F-4)), _mm512_srli_epi32(negz, 3));
+    #else
+     __m512i sbpre = _mm512_srli_epi32(negz, 3);
+    #endif
+    __m512i dbpre = _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(z, _mm512_set1_epi32(-(2<<xlns32_F))),
+                                            _mm512_add_epi32(_mm512_srai_epi32(z, 2), _mm512_set1_epi32(9<<(xlns32_F-3))),
+                                            _mm512_set1_epi32(5<<(xlns32_F-3)));
+    __m512i precond = _mm512_mask_blend_epi32(usedb, sbpre, dbpre);
+    __m512i postcond = _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(z, _mm512_set1_epi32(-(3<<xlns32_F))),
+                         _mm512_mask_blend_epi32(_mm512_cmpge_epi32_mask(z, _mm512_set1_epi32(-(3<<(xlns32_F-2)))),
+                                                 _mm512_set1_epi32(+(1<<(xlns32_F-6))), _mm512_set1_epi32(-(1<<(xlns32_F-6)))));
+    __m512i w = _mm512_add_epi32(z, precond);
+    __m512i mitch = _mm512_srlv_epi32(_mm512_add_epi32(_mm512_set1_epi32(1<<xlns32_F),
+                                                       _mm512_and_si512(w, _mm512_set1_epi32((1<<xlns32_F)-1))),
+                                      _mm512_and_si512(_mm512_sub_epi32(zero, _mm512_srli_epi32(w, xlns32_F)),
+                                                       _mm512_set1_epi32(31)));
+    __mmask16 sing = usedb & ~zeq & _mm512_cmplt_epi32_mask(negz, _mm512_set1_epi32(1<<xlns32_F));
+    if (sing)
+    {
+        __m512i d = _mm512_mask_blend_epi32(sing, _mm512_set1_epi32(1), negz);
+        __m512i db = _mm512_inserti64x4(_mm512_castsi256_si512(xlns32_db_sing_avx512(_mm512_castsi512_si256(d))),
+                                        xlns32_db_sing_avx512(_mm512_extracti64x4_epi64(d, 1)), 1);
+        mitch = _mm512_mask_sub_epi32(mitch, sing, negz, db);   // -db(-z)-z
+    }
+    __m512i adjust = _mm512_mask_blend_epi32(usedb,
+                         _mm512_mask_blend_epi32(zeq, _mm512_add_epi32(mitch, postcond), _mm512_set1_epi32(1<<xlns32_F)),
+                         _mm512_sub_epi32(zero, mitch));
+    __m512i adjustez = _mm512_mask_mov_epi32(adjust, _mm512_cmplt_epi32_mask(z, _mm512_set1_epi32(-xlns32_esszer)), zero);
+    // inline xlns32_mul(maxxy, xlns32_logsignmask + adjustez)
+    __m512i yy = _mm512_add_epi32(_mm512_set1_epi32(xlns32_logsignmask), adjustez);
+    __m512i temp = _mm512_sub_epi32(_mm512_add_epi32(_mm512_and_si512(maxxy, logmask), _mm512_and_si512(yy, logmask)),
+                                    _mm512_set1_epi32(xlns32_logsignmask));
+    __m512i sign = _mm512_and_si512(_mm512_xor_si512(maxxy, yy), _mm512_set1_epi32(xlns32_signmask));
+    __mmask16 unf = _mm512_test_epi32_mask(temp, _mm512_set1_epi32(xlns32_logsignmask));
+    __m512i sat = _mm512_or_si512(sign, _mm512_maskz_mov_epi32(~unf, logmask));
+    __m512i res = _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(temp, zero), _mm512_or_si512(sign, temp), sat);
+    #ifdef xlns32_counters
+    __mmask16 cancel = zeq & usedb;
+    __mmask16 satl = _mm512_cmplt_epi32_mask(temp, zero) & ~cancel;
+    xlns32_count_n(cancel, __builtin_popcount(cancel));
+    xlns32_count_n(esszer, __builtin_popcount(_mm512_cmplt_epi32_mask(z, _mm512_set1_epi32(-xlns32_esszer))));
+    xlns32_count_n(ovf, __builtin_popcount(satl & ~unf));
+    xlns32_count_n(unf, __builtin_popcount(satl & unf));
+    #endif
+    return _mm512_maskz_mov_epi32(~(zeq & usedb), res);
+}
+#endif
+
+// Element-wise lpvip addition: c[i] = xlns32_add_lpvip(a[i], b[i])
+inline void xlns32_batch_add_lpvip(const xlns32 *a, const xlns32 *b, xlns32 *c, size_t n)
+{
+    xlns_parallel_split(n, xlns32_batch_add_lpvip(a+i0, b+i0, c+i0, i1-i0));
+    xlns32_zprof_kernel("xlns32_batch_add_lpvip");
+    size_t i = 0;
+    #if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_si512(c+i, xlns32_add_lpvip_avx512(_mm512_loadu_si512(a+i), _mm512_loadu_si512(b+i)));
+    #elif defined(__AVX2__)
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(c+i), xlns32_add_lpvip_avx2(_mm256_loadu_si256((const __m256i *)(a+i)),
+                                                                    _mm256_loadu_si256((const __m256i *)(b+i))));
+    #endif
+    for (; i < n; i++)
+        c[i] = xlns32_add_lpvip(a[i], b[i]);
+}
+
+// Multi-lane lpvip32 accumulator
+// element k of the stream goes to lane k%xlns32_lpvip_lanes; each lane starts
+// with its first element (like xlns16_sum) and the lanes are folded in lane
+// order at the end.  The independent lanes hide the latency of the adder;
+// the order is fixed, so the SIMD and the portable code give identical bits.
+
+#define xlns32_lpvip_lanes 32
+
+struct xlns32_lpvip_acc {
+    xlns32 lane[xlns32_lpvip_lanes];
+    size_t count;
+};
+
+inline void xlns32_lpvip_acc_init(xlns32_lpvip_acc *acc)
+{
+    acc->count = 0;
+}
+
+// Push one xlns32 value into the accumulator
+inline void xlns32_lpvip_acc_push1(xlns32_lpvip_acc *acc, xlns32 v)
+{
+    size_t j = acc->count % xlns32_lpvip_lanes;
+    acc->lane[j] = (acc->count < xlns32_lpvip_lanes) ? v : xlns32_add_lpvip(acc->lane[j], v);
+    acc->count++;
+}
+
+// Push n xlns32 values into the accumulator (portable reference order)
+inline void xlns32_lpvip_acc_push(xlns32_lpvip_acc *acc, const xlns32 *a, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        xlns32_lpvip_acc_push1(acc, a[i]);
+}
+
+// Push n xlns32 values: the same bits as xlns32_lpvip_acc_push, with whole
+// rows of lanes through the SIMD adder once every lane is started
+inline void xlns32_lpvip_acc_push_simd(xlns32_lpvip_acc *acc, const xlns32 *a, size_t n)
+{
+    size_t i = 0;
+    for (; i < n && (acc->count < xlns32_lpvip_lanes || acc->count % xlns32_lpvip_lanes); i++)
+        xlns32_lpvip_acc_push1(acc, a[i]);
+    #if defined(__AVX512F__)
+    if (i + xlns32_lpvip_lanes <= n) {
+        __m512i l0 = _mm512_loadu_si512(acc->lane);
+        __m512i l1 = _mm512_loadu_si512(acc->lane+16);
+        for (; i + xlns32_lpvip_lanes <= n; i += xlns32_lpvip_lanes) {
+            l0 = xlns32_add_lpvip_avx512(l0, _mm512_loadu_si512(a+i));
+            l1 = xlns32_add_lpvip_avx512(l1, _mm512_loadu_si512(a+i+16));
+            acc->count += xlns32_lpvip_lanes;
+        }
+        _mm512_storeu_si512(acc->lane, l0);
+        _mm512_storeu_si512(acc->lane+16, l1);
+    }
+    #elif defined(__AVX2__)
+    if (i + xlns32_lpvip_lanes <= n) {
+        __m256i l[4];
+        for (int k = 0; k < 4; k++)
+            l[k] = _mm256_loadu_si256((const __m256i *)(acc->lane+8*k));
+        for (; i + xlns32_lpvip_lanes <= n; i += xlns32_lpvip_lanes) {
+            for (int k = 0; k < 4; k++)
+                l[k] = xlns32_add_lpvip_avx2(l[k], _mm256_loadu_si256((const __m256i *)(a+i+8*k)));
+            acc->count += xlns32_lpvip_lanes;
+        }
+        for (int k = 0; k < 4; k++)
+            _mm256_storeu_si256((__m256i *)(acc->lane+8*k), l[k]);
+    }
+    #endif
+    for (; i < n; i++)
+        xlns32_lpvip_acc_push1(acc, a[i]);
+}
+
+// Fold the lanes in order and return the xlns32 total
+inline xlns32 xlns32_lpvip_acc_result(const xlns32_lpvip_acc *acc)
+{
+    if (acc->count == 0) return xlns32_zero;
+    size_t lanes = (acc->count < xlns32_lpvip_lanes) ? acc->count : xlns32_lpvip_lanes;
+    xlns32 sum = acc->lane[0];
+    for (size_t j = 1; j < lanes; j++)
+        sum = xlns32_add_lpvip(sum, acc->lane[j]);
+    return sum;
+}
+
+// Log-sum-exp over fixed-point logs (see xlns32_logsumexp) with the lpvip
+// adder: the logs go into an xlns32_lpvip_acc as positive xlns32, whole rows of
+// lanes in SIMD, leaving out logs at or below xlns32_log_zero (they add 0); a
+// stream can be pushed piece by piece with xlns32_lpvip_acc_push_logs and read
+// with xlns322log(xlns32_lpvip_acc_result())
+inline void xlns32_lpvip_acc_push_logs(xlns32_lpvip_acc *acc, const xlns32_signed *a, size_t n)
+{
+    const size_t chunk = 8*xlns32_lpvip_lanes;
+    xlns32 v[chunk];
+    for (size_t i = 0; i < n; i += chunk) {
+        size_t m = (n - i < chunk) ? n - i : chunk, k = 0;
+        for (size_t j = 0; j < m; j++)
+            if (a[i+j] > xlns32_log_zero) v[k++] = xlns32_log2xlns32(a[i+j]);
+        xlns32_lpvip_acc_push_simd(acc, v, k);
+    }
+}
+
+inline xlns32_signed xlns32_logsumexp_lpvip(const xlns32_signed *a, size_t n)
+{
+    xlns32_zprof_kernel("xlns32_logsumexp_lpvip");
+    if (n == 0) return xlns32_log_zero;
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    xlns32_lpvip_acc_push_logs(&acc, a, n);
+    return xlns322log(xlns32_lpvip_acc_result(&acc));
+}
+
 #ifdef xlns16_zero
 
+// Push n xlns16 values (as xlns16<<16) into the accumulator; once every lane
+// is started, whole rows of lanes go through the SIMD adder
+inline void xlns32_lpvip_acc_push16(xlns32_lpvip_acc *acc, const xlns16 *a, size_t n)
+{
+    size_t i = 0;
+    for (; i < n && (acc->count < xlns32_lpvip_lanes || acc->count % xlns32_lpvip_lanes); i++)
+        xlns32_lpvip_acc_push1(acc, ((xlns32)a[i])<<16);
+    #if defined(__AVX512F__)
+    if (i + xlns32_lpvip_lanes <= n) {
+        __m512i l0 = _mm512_loadu_si512(acc->lane);
+        __m512i l1 = _mm512_loadu_si512(acc->lane+16);
+        for (; i + xlns32_lpvip_lanes <= n; i += xlns32_lpvip_lanes) {
+            l0 = xlns32_add_lpvip_avx512(l0, _mm512_slli_epi32(_mm512_cvtepu16_epi32(
+                                              _mm256_loadu_si256((const __m256i *)(a+i))), 16));
+            l1 = xlns32_add_lpvip_avx512(l1, _mm512_slli_epi32(_mm512_cvtepu16_epi32(
+                                              _mm256_loadu_si256((const __m256i *)(a+i+16))), 16));
+            acc->count += xlns32_lpvip_lanes;
+        }
+        _mm512_storeu_si512(acc->lane, l0);
+        _mm512_storeu_si512(acc->lane+16, l1);
+    }
+    #elif defined(__AVX2__)
+    if (i + xlns32_lpvip_lanes <= n) {
+        __m256i l[4];
+        for (int k = 0; k < 4; k++)
+            l[k] = _mm256_loadu_si256((const __m256i *)(acc->lane+8*k));
+        for (; i + xlns32_lpvip_lanes <= n; i += xlns32_lpvip_lanes) {
+            for (int k = 0; k < 4; k++)
+                l[k] = xlns32_add_lpvip_avx2(l[k], _mm256_slli_epi32(_mm256_cvtepu16_epi32(
+                                                 _mm_loadu_si128((const __m128i *)(a+i+8*k))), 16));
+            acc->count += xlns32_lpvip_lanes;
+        }
+        for (int k = 0; k < 4; k++)
+            _mm256_storeu_si256((__m256i *)(acc->lane+8*k), l[k]);
+    }
+    #else
+    for (; i + xlns32_lpvip_lanes <= n; i += xlns32_lpvip_lanes) {
+        for (size_t j = 0; j < xlns32_lpvip_lanes; j++)
+            acc->lane[j] = xlns32_add_lpvip(acc->lane[j], ((xlns32)a[i+j])<<16);
+        acc->count += xlns32_lpvip_lanes;
+    }
+    #endif
+    for (; i < n; i++)
+        xlns32_lpvip_acc_push1(acc, ((xlns32)a[i])<<16);
+}
+
+// acc[k] = xlns32_add_lpvip(acc[k], p[k]<<16) for k < m
+inline void xlns32_lpvip_add16(xlns32 *acc, const xlns16 *p, size_t m)
+{
+    size_t k = 0;
+    #if defined(__AVX512F__)
+    for (; k + 16 <= m; k += 16)
+        _mm512_storeu_si512(acc+k, xlns32_add_lpvip_avx512(_mm512_loadu_si512(acc+k),
+            _mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(p+k))), 16)));
+    #elif defined(__AVX2__)
+    for (; k + 8 <= m; k += 8)
+        _mm256_storeu_si256((__m256i *)(acc+k), xlns32_add_lpvip_avx2(_mm256_loadu_si256((const __m256i *)(acc+k)),
+            _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(p+k))), 16)));
+    #endif
+    for (; k < m; k++)
+        acc[k] = xlns32_add_lpvip(acc[k], ((xlns32)p[k])<<16);
+}
+
 
 // Vector operations (critical for ggml MUL_MAT) using xlns16 ops with xlns32 lpvip accumulation
 
 // Sum of array elements: result = Σ a[i]
 inline xlns16 xlns16_sum_lpvip32(const xlns16 *a, size_t n) {
+    xlns32_zprof_kernel("xlns16_sum_lpvip32");
     if (n == 0) return xlns16_zero;
     xlns32 sum = ((xlns32)a[0])<<16;
     for (size_t i = 1; i < n; i++) {
@@ -71,6 +530,7 @@ inline xlns16 xlns16_sum_lpvip32(const xlns16 *a, size_t n) {
 
 // Vector dot product: result = Σ(a[i] * b[i])
 inline xlns16 xlns16_vec_dot_lpvip32(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns32_zprof_kernel("xlns16_vec_dot_lpvip32");
     if (n == 0) return xlns16_zero;
     xlns32 sum = ((xlns32)xlns16_mul(a[0], b[0]))<<16;
     for (size_t i = 1; i < n; i++) {
@@ -83,6 +543,7 @@ inline xlns16 xlns16_vec_dot_lpvip32(const xlns16 *a, const xlns16 *b, size_t n)
 inline void xlns16_layernorm_lpvip32(const xlns16 *x, xlns16 *out,
                        const xlns16 *gamma, const xlns16 *beta,
                        size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_layernorm_lpvip32");
     // compute mean
     xlns16 mean = xlns16_sum_lpvip32(x, n);
     mean = xlns16_div(mean, fp2xlns16((float)n));
@@ -95,11 +556,11 @@ inline void xlns16_layernorm_lpvip32(const xlns16 *x, xlns16 *out,
     var = xlns32_div(var, fp2xlns32((float)n));
     // normalize
     xlns16 inv_std = fp2xlns16(1.0f / sqrt(xlns322fp(var) + eps));
-    for (size_t i = 0; i < n; i++) {
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
         out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
         if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
         if (beta)  out[i] = xlns16_add(out[i], beta[i]);
-    }
+    });
 }
 
 // Softmax: exp(scale*a[i] - max) / sum(exp(scale*a[j] - max)).
@@ -109,6 +570,7 @@ inline void xlns16_layernorm_lpvip32(const xlns16 *x, xlns16 *out,
 // multiply. c may alias a (in-place).
 inline void xlns16_softmax_lpvip32(const xlns16 *a, xlns16 *c, size_t n,
                                     xlns16 scale = xlns16_one) {
+    xlns32_zprof_kernel("xlns16_softmax_lpvip32");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -117,11 +579,11 @@ inline void xlns16_softmax_lpvip32(const xlns16 *a, xlns16 *c, size_t n,
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum_lpvip32(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
 }
 
 // Masked variant of xlns16_softmax_lpvip32. mask[i] is a pre-converted xlns16
@@ -130,6 +592,7 @@ inline void xlns16_softmax_lpvip32(const xlns16 *a, xlns16 *c, size_t n,
 inline void xlns16_softmax_masked_lpvip32(const xlns16 *a, const xlns16 *mask,
                                            xlns16 *c, size_t n,
                                            xlns16 scale = xlns16_one) {
+    xlns32_zprof_kernel("xlns16_softmax_masked_lpvip32");
     if (n == 0) return;
     xlns16 maxval = xlns16_neg_inf;
     for (size_t i = 0; i < n; i++) {
@@ -142,11 +605,338 @@ inline void xlns16_softmax_masked_lpvip32(const xlns16 *a, const xlns16 *mask,
         c[i] = v;
         if (xlns16_gt(c[i], maxval)) maxval = c[i];
     }
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_exp(xlns16_sub(c[i], maxval));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
     xlns16 total = xlns16_sum_lpvip32(c, n);
-    for (size_t i = 0; i < n; i++)
-        c[i] = xlns16_div(c[i], total);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
+}
+
+
+// Multi-lane (SIMD when available) versions of the above.  These accumulate
+// with xlns32_lpvip_acc, so the result is the same on every instruction set
+// (but not the same as the strictly sequential xlns16_sum_lpvip32).
+
+#define xlns32_lpvip_chunk 256
+
+// Sum of array elements: result = Σ a[i]
+inline xlns16 xlns16_sum_lpvip32_simd(const xlns16 *a, size_t n) {
+    xlns32_zprof_kernel("xlns16_sum_lpvip32_simd");
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    xlns32_lpvip_acc_push16(&acc, a, n);
+    return xlns32_lpvip_acc_result(&acc)>>16;
+}
+
+// Vector dot product: result = Σ(a[i] * b[i])
+inline xlns16 xlns16_vec_dot_lpvip32_simd(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns32_zprof_kernel("xlns16_vec_dot_lpvip32_simd");
+    xlns16 prod[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        xlns16_batch_mul(a+i, b+i, prod, m);
+        xlns32_lpvip_acc_push16(&acc, prod, m);
+    }
+    return xlns32_lpvip_acc_result(&acc)>>16;
+}
+
+// Layer normalization: (x - mean) / sqrt(var + eps) * gamma + beta
+inline void xlns16_layernorm_lpvip32_simd(const xlns16 *x, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_layernorm_lpvip32_simd");
+    // compute mean
+    xlns16 mean = xlns16_sum_lpvip32_simd(x, n);
+    mean = xlns16_div(mean, fp2xlns16((float)n));
+    // compute variance
+    xlns16 sq[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        for (size_t k = 0; k < m; k++) {
+            xlns16 diff = xlns16_sub(x[i+k], mean);
+            sq[k] = xlns16_mul(diff, diff);
+        }
+        xlns32_lpvip_acc_push16(&acc, sq, m);
+    }
+    xlns32 var = xlns32_div(xlns32_lpvip_acc_result(&acc), fp2xlns32((float)n));
+    // normalize
+    xlns16 inv_std = fp2xlns16(1.0f / sqrt(xlns322fp(var) + eps));
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+        if (beta)  out[i] = xlns16_add(out[i], beta[i]);
+    });
+}
+
+// RMS normalization as xlns16_rmsnorm, with the sum of squares and the
+// reciprocal square root in xlns32 (the squares through xlns32_lpvip_acc)
+inline void xlns16_rmsnorm_lpvip32(const xlns16 *x, xlns16 *out, const xlns16 *gamma,
+                                   size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_rmsnorm_lpvip32");
+    if (n == 0) return;
+    xlns16 sq[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        xlns16_batch_mul(x+i, x+i, sq, m);
+        xlns32_lpvip_acc_push16(&acc, sq, m);
+    }
+    xlns32 ms = xlns32_div(xlns32_lpvip_acc_result(&acc), fp2xlns32((float)n));
+    xlns16 inv_rms = xlns32_div(xlns32_one,
+                                xlns32_sqrt(xlns32_add_lpvip(ms, fp2xlns32(eps))))>>16;
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(x[i], inv_rms);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+    });
+}
+
+// Layer normalization as xlns16_layernorm_onepass, with the shifted values
+// x - k, their squares and the sums in xlns32: one read of x, in SIMD
+inline void xlns16_layernorm_onepass_lpvip32(const xlns16 *x, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_layernorm_onepass_lpvip32");
+    if (n == 0) return;
+    size_t m0 = (n < 16) ? n : 16;
+    xlns32 k = ((xlns32)xlns16_div(xlns16_sum(x, m0), fp2xlns16((float)m0)))<<16;
+    xlns32 d[xlns32_lpvip_chunk], sq[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc a1, a2;
+    xlns32_lpvip_acc_init(&a1);
+    xlns32_lpvip_acc_init(&a2);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        for (size_t j = 0; j < m; j++) d[j] = xlns32_neg(k);
+        xlns32_lpvip_add16(d, x+i, m);                  // x - k
+        for (size_t j = 0; j < m; j++) sq[j] = xlns32_mul(d[j], d[j]);
+        xlns32_lpvip_acc_push_simd(&a1, d, m);
+        xlns32_lpvip_acc_push_simd(&a2, sq, m);
+    }
+    xlns32 nn = fp2xlns32((float)n);
+    xlns32 dm = xlns32_div(xlns32_lpvip_acc_result(&a1), nn);
+    xlns32 var = xlns32_add_lpvip(xlns32_div(xlns32_lpvip_acc_result(&a2), nn),
+                                  xlns32_neg(xlns32_mul(dm, dm)));
+    if (var & xlns32_signmask) var = xlns32_zero;
+    xlns16 mean = xlns32_add_lpvip(k, dm)>>16;
+    xlns16 inv_std = xlns32_div(xlns32_one,
+                                xlns32_sqrt(xlns32_add_lpvip(var, fp2xlns32(eps))))>>16;
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xlns16_sub(x[i], mean), inv_std);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+        if (beta)  out[i] = xlns16_add(out[i], beta[i]);
+    });
+}
+
+// Residual add fused with the norm (see xlns16_add_rmsnorm): xr = x + r
+// (xr may be x), chunk by chunk, each chunk going on to the statistics while
+// it is in cache; the same bits as xlns16_batch_add and then
+// xlns16_rmsnorm_lpvip32 or xlns16_layernorm_onepass_lpvip32
+inline void xlns16_add_rmsnorm_lpvip32(const xlns16 *x, const xlns16 *r, xlns16 *xr, xlns16 *out,
+                                       const xlns16 *gamma, size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_add_rmsnorm_lpvip32");
+    if (n == 0) return;
+    xlns16 sq[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        for (size_t j = 0; j < m; j++) xr[i+j] = xlns16_add(x[i+j], r[i+j]);
+        xlns16_batch_mul(xr+i, xr+i, sq, m);
+        xlns32_lpvip_acc_push16(&acc, sq, m);
+    }
+    xlns32 ms = xlns32_div(xlns32_lpvip_acc_result(&acc), fp2xlns32((float)n));
+    xlns16 inv_rms = xlns32_div(xlns32_one,
+                                xlns32_sqrt(xlns32_add_lpvip(ms, fp2xlns32(eps))))>>16;
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xr[i], inv_rms);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+    });
+}
+
+inline void xlns16_add_layernorm_lpvip32(const xlns16 *x, const xlns16 *r, xlns16 *xr, xlns16 *out,
+                       const xlns16 *gamma, const xlns16 *beta,
+                       size_t n, float eps) {
+    xlns32_zprof_kernel("xlns16_add_layernorm_lpvip32");
+    if (n == 0) return;
+    size_t m0 = (n < 16) ? n : 16;
+    for (size_t j = 0; j < m0; j++) xr[j] = xlns16_add(x[j], r[j]);
+    xlns32 k = ((xlns32)xlns16_div(xlns16_sum(xr, m0), fp2xlns16((float)m0)))<<16;
+    xlns32 d[xlns32_lpvip_chunk], sq[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc a1, a2;
+    xlns32_lpvip_acc_init(&a1);
+    xlns32_lpvip_acc_init(&a2);
+    for (size_t i = 0; i < n; i += xlns32_lpvip_chunk) {
+        size_t m = (n - i < xlns32_lpvip_chunk) ? n - i : xlns32_lpvip_chunk;
+        for (size_t j = (i < m0) ? m0 - i : 0; j < m; j++) xr[i+j] = xlns16_add(x[i+j], r[i+j]);
+        for (size_t j = 0; j < m; j++) d[j] = xlns32_neg(k);
+        xlns32_lpvip_add16(d, xr+i, m);
+        for (size_t j = 0; j < m; j++) sq[j] = xlns32_mul(d[j], d[j]);
+        xlns32_lpvip_acc_push_simd(&a1, d, m);
+        xlns32_lpvip_acc_push_simd(&a2, sq, m);
+    }
+    xlns32 nn = fp2xlns32((float)n);
+    xlns32 dm = xlns32_div(xlns32_lpvip_acc_result(&a1), nn);
+    xlns32 var = xlns32_add_lpvip(xlns32_div(xlns32_lpvip_acc_result(&a2), nn),
+                                  xlns32_neg(xlns32_mul(dm, dm)));
+    if (var & xlns32_signmask) var = xlns32_zero;
+    xlns16 mean = xlns32_add_lpvip(k, dm)>>16;
+    xlns16 inv_std = xlns32_div(xlns32_one,
+                                xlns32_sqrt(xlns32_add_lpvip(var, fp2xlns32(eps))))>>16;
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++) {
+        out[i] = xlns16_mul(xlns16_sub(xr[i], mean), inv_std);
+        if (gamma) out[i] = xlns16_mul(out[i], gamma[i]);
+        if (beta)  out[i] = xlns16_add(out[i], beta[i]);
+    });
+}
+
+// Softmax: same as xlns16_softmax_lpvip32 but normalizes with
+// xlns16_sum_lpvip32_simd. c may alias a (in-place).
+inline void xlns16_softmax_lpvip32_simd(const xlns16 *a, xlns16 *c, size_t n,
+                                         xlns16 scale = xlns16_one) {
+    xlns32_zprof_kernel("xlns16_softmax_lpvip32_simd");
+    if (n == 0) return;
+    xlns16 maxval = xlns16_neg_inf;
+    for (size_t i = 0; i < n; i++) {
+        xlns16 v = a[i];
+        if (v != xlns16_neg_inf) v = xlns16_mul(v, scale);
+        c[i] = v;
+        if (xlns16_gt(c[i], maxval)) maxval = c[i];
+    }
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
+    xlns16 total = xlns16_sum_lpvip32_simd(c, n);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
+}
+
+// Masked variant of xlns16_softmax_lpvip32_simd (mask as in xlns16_softmax_masked)
+inline void xlns16_softmax_masked_lpvip32_simd(const xlns16 *a, const xlns16 *mask,
+                                                xlns16 *c, size_t n,
+                                                xlns16 scale = xlns16_one) {
+    xlns32_zprof_kernel("xlns16_softmax_masked_lpvip32_simd");
+    if (n == 0) return;
+    xlns16 maxval = xlns16_neg_inf;
+    for (size_t i = 0; i < n; i++) {
+        xlns16 v = a[i];
+        if (v != xlns16_neg_inf) {
+            v = xlns16_mul(v, scale);
+            if (mask[i] == xlns16_neg_inf) v = xlns16_neg_inf;
+            else if (!xlns16_is_zero(mask[i])) v = xlns16_add(v, mask[i]);
+        }
+        c[i] = v;
+        if (xlns16_gt(c[i], maxval)) maxval = c[i];
+    }
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_exp(xlns16_sub(c[i], maxval)));
+    xlns16 total = xlns16_sum_lpvip32_simd(c, n);
+    xlns_parallel_loop(n, for (size_t i = i0; i < i1; i++)
+        c[i] = xlns16_div(c[i], total));
+}
+
+
+// Row-wise versions (see xlns16_softmax_rows): each row as
+// xlns16_softmax_lpvip32_simd or xlns16_layernorm_lpvip32_simd would do it
+inline void xlns16_softmax_rows_lpvip32(const xlns16 *a, size_t lda, xlns16 *c, size_t ldc,
+                                        size_t rows, size_t n, xlns16 scale = xlns16_one,
+                                        const xlns_mask *mask = NULL) {
+    xlns32_zprof_kernel("xlns16_softmax_rows_lpvip32");
+    xlns16_softmax_rows_sum(a, lda, c, ldc, rows, n, scale, mask, xlns16_sum_lpvip32_simd);
+}
+
+inline void xlns16_layernorm_rows_lpvip32(const xlns16 *x, size_t ldx, xlns16 *out, size_t ldo,
+                                          size_t rows, size_t n, const xlns16 *gamma,
+                                          const xlns16 *beta, float eps) {
+    xlns32_zprof_kernel("xlns16_layernorm_rows_lpvip32");
+    xlns_parallel_chunks(rows*n, rows, for (size_t r = i0; r < i1; r++)
+        xlns16_layernorm_lpvip32_simd(x + r*ldx, out + r*ldo, gamma, beta, n, eps));
+}
+
+
+// Fixed-tree versions (see xlns16_sum_tree): each xlns32_treechunk-element chunk
+// goes through its own multi-lane accumulator, as in the _simd versions, and the
+// xlns32 chunk sums are added pairwise with xlns32_add_lpvip, so the result is
+// the same for any number of threads and any instruction set.
+
+inline xlns32 xlns32_add_lpvip_fn(xlns32 x, xlns32 y) { return xlns32_add_lpvip(x, y); }
+
+// Sum of array elements: result = Σ a[i]
+inline xlns16 xlns16_sum_lpvip32_tree(const xlns16 *a, size_t n) {
+    xlns32_zprof_kernel("xlns16_sum_lpvip32_tree");
+    return xlns32_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns32_lpvip_acc acc;
+        xlns32_lpvip_acc_init(&acc);
+        xlns32_lpvip_acc_push16(&acc, a+i0, i1-i0);
+        return xlns32_lpvip_acc_result(&acc);
+    }, xlns32_add_lpvip_fn)>>16;
+}
+
+// Vector dot product: result = Σ(a[i] * b[i])
+inline xlns16 xlns16_vec_dot_lpvip32_tree(const xlns16 *a, const xlns16 *b, size_t n) {
+    xlns32_zprof_kernel("xlns16_vec_dot_lpvip32_tree");
+    return xlns32_tree_reduce(n, [=](size_t i0, size_t i1) {
+        xlns16 prod[xlns32_lpvip_chunk];
+        xlns32_lpvip_acc acc;
+        xlns32_lpvip_acc_init(&acc);
+        for (size_t i = i0; i < i1; i += xlns32_lpvip_chunk) {
+            size_t m = (i1 - i < xlns32_lpvip_chunk) ? i1 - i : xlns32_lpvip_chunk;
+            xlns16_batch_mul(a+i, b+i, prod, m);
+            xlns32_lpvip_acc_push16(&acc, prod, m);
+        }
+        return xlns32_lpvip_acc_result(&acc);
+    }, xlns32_add_lpvip_fn)>>16;
+}
+
+
+// Matrix-vector products with lpvip32 accumulation (see xlns16_gemv)
+
+// One row: the same bits as xlns16_vec_dot_lpvip32_simd(w, x, cols)
+inline xlns16 xlns16_gemv_row_lpvip32(const xlns16 *w, const xlns16 *x, size_t cols) {
+    xlns16 prod[xlns32_lpvip_chunk];
+    xlns32_lpvip_acc acc;
+    xlns32_lpvip_acc_init(&acc);
+    for (size_t i = 0; i < cols; i += xlns32_lpvip_chunk) {
+        size_t m = (cols - i < xlns32_lpvip_chunk) ? cols - i : xlns32_lpvip_chunk;
+        xlns16_prefetch_ahead(w+i, m);
+        xlns16_batch_mul(w+i, x+i, prod, m);
+        xlns32_lpvip_acc_push16(&acc, prod, m);
+    }
+    return xlns32_lpvip_acc_result(&acc)>>16;
+}
+
+// y = W x: y[r] = xlns16_vec_dot_lpvip32_simd(W + r*cols, x, cols)
+inline void xlns16_gemv_lpvip32(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns32_zprof_kernel("xlns16_gemv_lpvip32");
+    xlns_parallel_chunks(rows*cols, rows, for (size_t r = i0; r < i1; r++)
+        y[r] = xlns16_gemv_row_lpvip32(W + r*cols, x, cols));
+}
+
+// y = W^T x: y[c] = xlns16_vec_dot_lpvip32 down column c of W (one xlns32
+// accumulator per column, the columns of a block added side by side in SIMD)
+inline void xlns16_gemv_t_lpvip32(const xlns16 *W, const xlns16 *x, xlns16 *y, size_t rows, size_t cols) {
+    xlns32_zprof_kernel("xlns16_gemv_t_lpvip32");
+    size_t nb = (cols + xlns16_gemv_chunk - 1)/xlns16_gemv_chunk;
+    xlns_parallel_chunks(rows*cols, nb, for (size_t b = i0; b < i1; b++) {
+        size_t c0 = b*xlns16_gemv_chunk;
+        size_t m = (cols - c0 < xlns16_gemv_chunk) ? cols - c0 : xlns16_gemv_chunk;
+        xlns16 prod[xlns16_gemv_chunk];
+        xlns32 acc[xlns16_gemv_chunk];
+        for (size_t k = 0; k < m; k++) acc[k] = xlns32_zero;
+        for (size_t r = 0; r < rows; r++) {
+            const xlns16 *w = W + r*cols + c0;
+            for (size_t k = 0; k < m; k += 32)
+                xlns16_prefetch(w + cols + k);   // same columns, next row
+            xlns16_batch_scale(w, x[r], prod, m);
+            if (r == 0)
+                for (size_t k = 0; k < m; k++) acc[k] = ((xlns32)prod[k])<<16;
+            else
+                xlns32_lpvip_add16(acc, prod, m);
+        }
+        for (size_t k = 0; k < m; k++) y[c0+k] = acc[k]>>16;
+    });
 }
 
 
@@ -0,0 +1,4895 @@
+#define xlns32_sbqoct 25
+#define xlns32_sbqfrac 8
+#define xlns32_sbqsize 1045
+unsigned int xlns32_sbqoctave[xlns32_sbqoct] = {  //first node<<8 | shift
+   (0<<8) | 16, //0
+   (129<<8) | 16, //1
+   (258<<8) | 16, //2
+   (387<<8) | 16, //3
+   (516<<8) | 16, //4
+   (645<<8) | 17, //5
+   (710<<8) | 17, //6
+   (775<<8) | 17, //7
+   (840<<8) | 18, //8
+   (873<<8) | 18, //9
+   (906<<8) | 18, //10
+   (939<<8) | 19, //11
+   (956<<8) | 19, //12
+   (973<<8) | 19, //13
+   (990<<8) | 20, //14
+   (999<<8) | 20, //15
+   (1008<<8) | 20, //16
+   (1017<<8) | 21, //17
+   (1022<<8) | 21, //18
+   (1027<<8) | 21, //19
+   (1032<<8) | 22, //20
+   (1035<<8) | 22, //21
+   (1038<<8) | 22, //22
+   (1041<<8) | 23, //23
+   (1043<<8) | 23, //24
+};
+unsigned int xlns32_sbqnode[xlns32_sbqsize] = {
+   0x80000000,
+   0x7f802c5d,
+   0x7f00b172,
+   0x7e818f40,
+   0x7e02c5c5,
+   0x7d845500,
+   0x7d063cf1,
+   0x7c887d94,
+   0x7c0b16e9,
+   0x7b8e08eb,
+   0x7b11539a,
+   0x7a94f6f0,
+   0x7a18f2ec,
+   0x799d4788,
+   0x7921f4c2,
+   0x78a6fa94,
+   0x782c58f9,
+   0x77b20fed,
+   0x77381f6a,
+   0x76be876a,
+   0x764547e7,
+   0x75cc60db,
+   0x7553d23e,
+   0x74db9c0a,
+   0x7463be37,
+   0x73ec38bd,
+   0x73750b95,
+   0x72fe36b6,
+   0x7287ba16,
+   0x721195ae,
+   0x719bc973,
+   0x7126555c,
+   0x70b1395f,
+   0x703c7571,
+   0x6fc80988,
+   0x6f53f598,
+   0x6ee03997,
+   0x6e6cd578,
+   0x6df9c930,
+   0x6d8714b2,
+   0x6d14b7f2,
+   0x6ca2b2e2,
+   0x6c310576,
+   0x6bbfaf9f,
+   0x6b4eb151,
+   0x6ade0a7c,
+   0x6a6dbb12,
+   0x69fdc305,
+   0x698e2244,
+   0x691ed8c2,
+   0x68afe66d,
+   0x68414b36,
+   0x67d3070c,
+   0x676519df,
+   0x66f7839e,
+   0x668a4437,
+   0x661d5b99,
+   0x65b0c9b1,
+   0x65448e6e,
+   0x64d8a9bd,
+   0x646d1b8b,
+   0x6401e3c4,
+   0x63970257,
+   0x632c772e,
+   0x62c24236,
+   0x6258635a,
+   0x61eeda87,
+   0x6185a7a6,
+   0x611ccaa2,
+   0x60b44367,
+   0x604c11de,
+   0x5fe435f2,
+   0x5f7caf8b,
+   0x5f157e94,
+   0x5eaea2f5,
+   0x5e481c96,
+   0x5de1eb62,
+   0x5d7c0f3f,
+   0x5d168816,
+   0x5cb155ce,
+   0x5c4c784f,
+   0x5be7ef80,
+   0x5b83bb47,
+   0x5b1fdb8c,
+   0x5abc5034,
+   0x5a591926,
+   0x59f63646,
+   0x5993a77c,
+   0x59316cab,
+   0x58cf85b9,
+   0x586df28b,
+   0x580cb305,
+   0x57abc70a,
+   0x574b2e80,
+   0x56eae949,
+   0x568af74a,
+   0x562b5864,
+   0x55cc0c7b,
+   0x556d1372,
+   0x550e6d2c,
+   0x54b01989,
+   0x5452186c,
+   0x53f469b7,
+   0x53970d4b,
+   0x533a0309,
+   0x52dd4ad3,
+   0x5280e488,
+   0x5224d009,
+   0x51c90d37,
+   0x516d9bf1,
+   0x51127c18,
+   0x50b7ad8a,
+   0x505d3027,
+   0x500303ce,
+   0x4fa9285d,
+   0x4f4f9db4,
+   0x4ef663b1,
+   0x4e9d7a32,
+   0x4e44e115,
+   0x4dec9838,
+   0x4d949f77,
+   0x4d3cf6b1,
+   0x4ce59dc3,
+   0x4c8e9489,
+   0x4c37dae0,
+   0x4be170a5,
+   0x4b8b55b3,
+   0x4b3589e7,
+   0x4ae00d1d,
+   0x4ae00d1d,
+   0x4a8adf30,
+   0x4a35fffc,
+   0x49e16f5d,
+   0x498d2d2c,
+   0x49393945,
+   0x48e59383,
+   0x48923bc1,
+   0x483f31d7,
+   0x47ec75a2,
+   0x479a06fa,
+   0x4747e5b9,
+   0x46f611ba,
+   0x46a48ad4,
+   0x465350e2,
+   0x460263bd,
+   0x45b1c33e,
+   0x45616f3c,
+   0x45116792,
+   0x44c1ac17,
+   0x44723ca3,
+   0x4423190e,
+   0x43d44131,
+   0x4385b4e2,
+   0x433773fb,
+   0x42e97e51,
+   0x429bd3bd,
+   0x424e7415,
+   0x42015f31,
+   0x41b494e6,
+   0x4168150d,
+   0x411bdf7b,
+   0x40cff407,
+   0x40845287,
+   0x4038fad1,
+   0x3fedecbb,
+   0x3fa3281b,
+   0x3f58acc6,
+   0x3f0e7a93,
+   0x3ec49156,
+   0x3e7af0e5,
+   0x3e319915,
+   0x3de889bc,
+   0x3d9fc2ad,
+   0x3d5743bf,
+   0x3d0f0cc5,
+   0x3cc71d94,
+   0x3c7f7601,
+   0x3c3815e0,
+   0x3bf0fd05,
+   0x3baa2b44,
+   0x3b63a072,
+   0x3b1d5c62,
+   0x3ad75ee8,
+   0x3a91a7d8,
+   0x3a4c3705,
+   0x3a070c43,
+   0x39c22766,
+   0x397d8840,
+   0x39392ea5,
+   0x38f51a68,
+   0x38b14b5c,
+   0x386dc154,
+   0x382a7c22,
+   0x37e77b9b,
+   0x37a4bf90,
+   0x376247d3,
+   0x37201439,
+   0x36de2492,
+   0x369c78b1,
+   0x365b1069,
+   0x3619eb8c,
+   0x35d909ec,
+   0x35986b5b,
+   0x35580fac,
+   0x3517f6af,
+   0x34d82037,
+   0x34988c17,
+   0x34593a1e,
+   0x341a2a21,
+   0x33db5bef,
+   0x339ccf5b,
+   0x335e8436,
+   0x33207a52,
+   0x32e2b180,
+   0x32a52991,
+   0x3267e257,
+   0x322adba4,
+   0x31ee1548,
+   0x31b18f14,
+   0x317548db,
+   0x3139426c,
+   0x30fd7b9a,
+   0x30c1f434,
+   0x3086ac0d,
+   0x304ba2f5,
+   0x3010d8be,
+   0x2fd64d37,
+   0x2f9c0032,
+   0x2f61f181,
+   0x2f2820f3,
+   0x2eee8e59,
+   0x2eb53985,
+   0x2e7c2248,
+   0x2e434871,
+   0x2e0aabd2,
+   0x2dd24c3b,
+   0x2d9a297e,
+   0x2d62436a,
+   0x2d2a99d2,
+   0x2cf32c84,
+   0x2cbbfb52,
+   0x2c85060d,
+   0x2c4e4c86,
+   0x2c17ce8c,
+   0x2be18bf1,
+   0x2bab8486,
+   0x2b75b81a,
+   0x2b40267f,
+   0x2b0acf85,
+   0x2ad5b2fd,
+   0x2aa0d0b8,
+   0x2a6c2886,
+   0x2a37ba38,
+   0x2a03859f,
+   0x29cf8a8b,
+   0x299bc8ce,
+   0x29684037,
+   0x2934f098,
+   0x2934f098,
+   0x2901d9c1,
+   0x28cefb83,
+   0x289c55af,
+   0x2869e816,
+   0x2837b288,
+   0x2805b4d7,
+   0x27d3eed4,
+   0x27a2604e,
+   0x27710918,
+   0x273fe902,
+   0x270effdc,
+   0x26de4d79,
+   0x26add1aa,
+   0x267d8c3e,
+   0x264d7d08,
+   0x261da3d8,
+   0x25ee0080,
+   0x25be92d1,
+   0x258f5a9c,
+   0x256057b2,
+   0x253189e6,
+   0x2502f107,
+   0x24d48ce8,
+   0x24a65d5a,
+   0x2478622f,
+   0x244a9b38,
+   0x241d0846,
+   0x23efa92c,
+   0x23c27dbb,
+   0x239585c4,
+   0x2368c11a,
+   0x233c2f8f,
+   0x230fd0f3,
+   0x22e3a51a,
+   0x22b7abd5,
+   0x228be4f7,
+   0x22605050,
+   0x2234edb5,
+   0x2209bcf6,
+   0x21debde6,
+   0x21b3f057,
+   0x2189541c,
+   0x215ee908,
+   0x2134aeec,
+   0x210aa59c,
+   0x20e0cce9,
+   0x20b724a8,
+   0x208dacaa,
+   0x206464c2,
+   0x203b4cc4,
+   0x20126481,
+   0x1fe9abcf,
+   0x1fc1227e,
+   0x1f98c864,
+   0x1f709d52,
+   0x1f48a11c,
+   0x1f20d397,
+   0x1ef93494,
+   0x1ed1c3e8,
+   0x1eaa8167,
+   0x1e836ce3,
+   0x1e5c8632,
+   0x1e35cd26,
+   0x1e0f4194,
+   0x1de8e34f,
+   0x1dc2b22d,
+   0x1d9cae00,
+   0x1d76d69e,
+   0x1d512bda,
+   0x1d2bad8a,
+   0x1d065b81,
+   0x1ce13594,
+   0x1cbc3b98,
+   0x1c976d61,
+   0x1c72cac5,
+   0x1c4e5399,
+   0x1c2a07b1,
+   0x1c05e6e2,
+   0x1be1f102,
+   0x1bbe25e6,
+   0x1b9a8564,
+   0x1b770f50,
+   0x1b53c381,
+   0x1b30a1cc,
+   0x1b0daa06,
+   0x1aeadc06,
+   0x1ac837a2,
+   0x1aa5bcb0,
+   0x1a836b05,
+   0x1a614277,
+   0x1a3f42df,
+   0x1a1d6c10,
+   0x19fbbde3,
+   0x19da382d,
+   0x19b8dac5,
+   0x1997a583,
+   0x1976983d,
+   0x1955b2c9,
+   0x1934f4ff,
+   0x19145eb7,
+   0x18f3efc7,
+   0x18d3a806,
+   0x18b3874d,
+   0x18938d72,
+   0x1873ba4e,
+   0x18540db8,
+   0x18348789,
+   0x18152797,
+   0x17f5edbb,
+   0x17d6d9cd,
+   0x17b7eba6,
+   0x1799231e,
+   0x177a800d,
+   0x175c024c,
+   0x173da9b3,
+   0x171f761c,
+   0x1701675f,
+   0x16e37d55,
+   0x16c5b7d8,
+   0x16a816c0,
+   0x168a99e7,
+   0x166d4126,
+   0x16500c57,
+   0x1632fb53,
+   0x16160df4,
+   0x15f94415,
+   0x15dc9d8e,
+   0x15c01a3a,
+   0x15c01a3a,
+   0x15a3b9f3,
+   0x15877c94,
+   0x156b61f6,
+   0x154f69f4,
+   0x15339469,
+   0x1517e130,
+   0x14fc5022,
+   0x14e0e11c,
+   0x14c593f8,
+   0x14aa6892,
+   0x148f5ec4,
+   0x14747669,
+   0x1459af5e,
+   0x143f097e,
+   0x142484a5,
+   0x140a20ae,
+   0x13efdd75,
+   0x13d5bad6,
+   0x13bbb8ae,
+   0x13a1d6d8,
+   0x13881531,
+   0x136e7395,
+   0x1354f1e1,
+   0x133b8ff2,
+   0x13224da4,
+   0x13092ad5,
+   0x12f02760,
+   0x12d74324,
+   0x12be7dfd,
+   0x12a5d7c9,
+   0x128d5065,
+   0x1274e7af,
+   0x125c9d84,
+   0x124471c3,
+   0x122c6449,
+   0x121474f4,
+   0x11fca3a2,
+   0x11e4f031,
+   0x11cd5a80,
+   0x11b5e26d,
+   0x119e87d7,
+   0x11874a9c,
+   0x11702a9c,
+   0x115927b4,
+   0x114241c4,
+   0x112b78ac,
+   0x1114cc49,
+   0x10fe3c7d,
+   0x10e7c925,
+   0x10d17222,
+   0x10bb3753,
+   0x10a51898,
+   0x108f15d0,
+   0x10792edd,
+   0x1063639e,
+   0x104db3f3,
+   0x10381fbc,
+   0x1022a6da,
+   0x100d492e,
+   0x0ff80697,
+   0x0fe2def8,
+   0x0fcdd230,
+   0x0fb8e021,
+   0x0fa408ab,
+   0x0f8f4bb1,
+   0x0f7aa913,
+   0x0f6620b2,
+   0x0f51b271,
+   0x0f3d5e30,
+   0x0f2923d3,
+   0x0f150339,
+   0x0f00fc46,
+   0x0eed0edc,
+   0x0ed93adc,
+   0x0ec58029,
+   0x0eb1dea6,
+   0x0e9e5634,
+   0x0e8ae6b7,
+   0x0e779011,
+   0x0e645225,
+   0x0e512cd6,
+   0x0e3e2008,
+   0x0e2b2b9c,
+   0x0e184f77,
+   0x0e058b7c,
+   0x0df2df8e,
+   0x0de04b90,
+   0x0dcdcf68,
+   0x0dbb6af8,
+   0x0da91e24,
+   0x0d96e8d0,
+   0x0d84cae1,
+   0x0d72c43b,
+   0x0d60d4c1,
+   0x0d4efc59,
+   0x0d3d3ae7,
+   0x0d2b9050,
+   0x0d19fc78,
+   0x0d087f44,
+   0x0cf7189a,
+   0x0ce5c85d,
+   0x0cd48e74,
+   0x0cc36ac4,
+   0x0cb25d32,
+   0x0ca165a3,
+   0x0c9083fe,
+   0x0c7fb828,
+   0x0c6f0206,
+   0x0c5e617f,
+   0x0c4dd678,
+   0x0c3d60d8,
+   0x0c2d0085,
+   0x0c1cb565,
+   0x0c0c7f5e,
+   0x0bfc5e58,
+   0x0bec5239,
+   0x0bdc5ae7,
+   0x0bcc7849,
+   0x0bbcaa46,
+   0x0bacf0c6,
+   0x0b9d4baf,
+   0x0b8dbae8,
+   0x0b7e3e59,
+   0x0b6ed5ea,
+   0x0b5f8182,
+   0x0b504107,
+   0x0b411463,
+   0x0b31fb7d,
+   0x0b31fb7d,
+   0x0b22f63d,
+   0x0b14048b,
+   0x0b05264f,
+   0x0af65b71,
+   0x0ae7a3d9,
+   0x0ad8ff71,
+   0x0aca6e20,
+   0x0abbefcf,
+   0x0aad8467,
+   0x0a9f2bd0,
+   0x0a90e5f4,
+   0x0a82b2bb,
+   0x0a74920f,
+   0x0a6683d8,
+   0x0a588800,
+   0x0a4a9e71,
+   0x0a3cc713,
+   0x0a2f01d1,
+   0x0a214e94,
+   0x0a13ad46,
+   0x0a061dd0,
+   0x09f8a01d,
+   0x09eb3416,
+   0x09ddd9a6,
+   0x09d090b7,
+   0x09c35933,
+   0x09b63304,
+   0x09a91e16,
+   0x099c1a52,
+   0x098f27a4,
+   0x098245f6,
+   0x09757533,
+   0x0968b546,
+   0x095c0619,
+   0x094f6799,
+   0x0942d9b0,
+   0x09365c4a,
+   0x0929ef51,
+   0x091d92b2,
+   0x09114658,
+   0x09050a2f,
+   0x08f8de23,
+   0x08ecc21e,
+   0x08e0b60e,
+   0x08d4b9de,
+   0x08c8cd7b,
+   0x08bcf0d0,
+   0x08b123c9,
+   0x08a56654,
+   0x0899b85d,
+   0x088e19d0,
+   0x08828a99,
+   0x08770aa6,
+   0x086b99e3,
+   0x0860383e,
+   0x0854e5a2,
+   0x0849a1fe,
+   0x083e6d3d,
+   0x0833474f,
+   0x0828301f,
+   0x081d279b,
+   0x08122db1,
+   0x0807424e,
+   0x07fc655f,
+   0x07f196d3,
+   0x07e6d698,
+   0x07dc249a,
+   0x07d180c9,
+   0x07c6eb11,
+   0x07bc6362,
+   0x07b1e9aa,
+   0x07a77dd6,
+   0x079d1fd5,
+   0x0792cf95,
+   0x07888d06,
+   0x077e5815,
+   0x077430b1,
+   0x076a16c9,
+   0x07600a4c,
+   0x07560b29,
+   0x074c194e,
+   0x074234ab,
+   0x07385d2f,
+   0x072e92c9,
+   0x0724d569,
+   0x071b24fd,
+   0x07118176,
+   0x0707eac2,
+   0x06fe60d1,
+   0x06f4e393,
+   0x06eb72f8,
+   0x06e20ef0,
+   0x06d8b76a,
+   0x06cf6c56,
+   0x06c62da5,
+   0x06bcfb46,
+   0x06b3d52a,
+   0x06aabb41,
+   0x06a1ad7b,
+   0x0698abc9,
+   0x068fb61b,
+   0x0686cc62,
+   0x067dee8e,
+   0x06751c90,
+   0x066c5659,
+   0x06639bda,
+   0x065aed03,
+   0x065249c5,
+   0x0649b212,
+   0x064125db,
+   0x0638a511,
+   0x06302fa4,
+   0x0627c587,
+   0x061f66ab,
+   0x06171301,
+   0x060eca7b,
+   0x06068d0a,
+   0x05fe5aa0,
+   0x05f6332f,
+   0x05ee16a9,
+   0x05e604ff,
+   0x05ddfe23,
+   0x05d60207,
+   0x05ce109e,
+   0x05c629da,
+   0x05be4dac,
+   0x05b67c07,
+   0x05aeb4dd,
+   0x05aeb4dd,
+   0x059f45c6,
+   0x058ffff9,
+   0x0580e30b,
+   0x0571ee93,
+   0x05632227,
+   0x05547d60,
+   0x0545ffd5,
+   0x0537a922,
+   0x052978e1,
+   0x051b6ead,
+   0x050d8a24,
+   0x04ffcae3,
+   0x04f23089,
+   0x04e4bab6,
+   0x04d7690a,
+   0x04ca3b26,
+   0x04bd30ae,
+   0x04b04943,
+   0x04a3848b,
+   0x0496e22b,
+   0x048a61c7,
+   0x047e0309,
+   0x0471c596,
+   0x0465a917,
+   0x0459ad37,
+   0x044dd19e,
+   0x044215f9,
+   0x043679f3,
+   0x042afd39,
+   0x041f9f78,
+   0x0414605f,
+   0x04093f9d,
+   0x03fe3ce2,
+   0x03f357de,
+   0x03e89043,
+   0x03dde5c4,
+   0x03d35814,
+   0x03c8e6e6,
+   0x03be91ee,
+   0x03b458e3,
+   0x03aa3b7a,
+   0x03a0396a,
+   0x0396526b,
+   0x038c8634,
+   0x0382d480,
+   0x03793d06,
+   0x036fbf83,
+   0x03665bb0,
+   0x035d114a,
+   0x0353e00d,
+   0x034ac7b6,
+   0x0341c802,
+   0x0338e0b1,
+   0x03301182,
+   0x03275a33,
+   0x031eba86,
+   0x0316323c,
+   0x030dc115,
+   0x030566d5,
+   0x02fd233f,
+   0x02f4f615,
+   0x02ecdf1c,
+   0x02e4de19,
+   0x02dcf2d1,
+   0x02dcf2d1,
+   0x02d51d0a,
+   0x02cd5c8a,
+   0x02c5b119,
+   0x02be1a7e,
+   0x02b69881,
+   0x02af2aec,
+   0x02a7d187,
+   0x02a08c1d,
+   0x02995a77,
+   0x02923c62,
+   0x028b31a8,
+   0x02843a16,
+   0x027d5578,
+   0x0276839b,
+   0x026fc44e,
+   0x0269175d,
+   0x02627c99,
+   0x025bf3cf,
+   0x02557cd0,
+   0x024f176c,
+   0x0248c373,
+   0x024280b7,
+   0x023c4f09,
+   0x02362e3c,
+   0x02301e22,
+   0x022a1e8d,
+   0x02242f52,
+   0x021e5045,
+   0x02188139,
+   0x0212c204,
+   0x020d127b,
+   0x02077274,
+   0x0201e1c5,
+   0x01fc6044,
+   0x01f6edc9,
+   0x01f18a2a,
+   0x01ec3541,
+   0x01e6eee5,
+   0x01e1b6ee,
+   0x01dc8d37,
+   0x01d77197,
+   0x01d263eb,
+   0x01cd640b,
+   0x01c871d2,
+   0x01c38d1b,
+   0x01beb5c3,
+   0x01b9eba4,
+   0x01b52e9b,
+   0x01b07e84,
+   0x01abdb3d,
+   0x01a744a3,
+   0x01a2ba93,
+   0x019e3cec,
+   0x0199cb8b,
+   0x01956650,
+   0x01910d19,
+   0x018cbfc7,
+   0x01887e38,
+   0x0184484d,
+   0x01801de6,
+   0x017bfee5,
+   0x0177eb2a,
+   0x0173e296,
+   0x016fe50b,
+   0x016fe50b,
+   0x016bf26c,
+   0x01680a9b,
+   0x01642d7a,
+   0x01605aec,
+   0x015c92d4,
+   0x0158d517,
+   0x01552198,
+   0x0151783b,
+   0x014dd8e4,
+   0x014a4379,
+   0x0146b7de,
+   0x014335f9,
+   0x013fbdb0,
+   0x013c4ee7,
+   0x0138e986,
+   0x01358d72,
+   0x01323a93,
+   0x012ef0cf,
+   0x012bb00d,
+   0x01287836,
+   0x01254930,
+   0x012222e4,
+   0x011f053a,
+   0x011bf01b,
+   0x0118e36e,
+   0x0115df1e,
+   0x0112e313,
+   0x010fef37,
+   0x010d0373,
+   0x010a1fb2,
+   0x010743dd,
+   0x01046fdf,
+   0x0101a3a3,
+   0x00fedf13,
+   0x00fc221b,
+   0x00f96ca5,
+   0x00f6be9e,
+   0x00f417f1,
+   0x00f1788a,
+   0x00eee055,
+   0x00ec4f3e,
+   0x00e9c533,
+   0x00e7421f,
+   0x00e4c5f0,
+   0x00e25092,
+   0x00dfe1f5,
+   0x00dd7a04,
+   0x00db18ad,
+   0x00d8bde0,
+   0x00d66989,
+   0x00d41b97,
+   0x00d1d3f8,
+   0x00cf929d,
+   0x00cd5772,
+   0x00cb2267,
+   0x00c8f36c,
+   0x00c6ca70,
+   0x00c4a763,
+   0x00c28a34,
+   0x00c072d3,
+   0x00be6130,
+   0x00bc553d,
+   0x00ba4ee8,
+   0x00b84e23,
+   0x00b84e23,
+   0x00b45d0c,
+   0x00b08180,
+   0x00acbb09,
+   0x00a90934,
+   0x00a56b92,
+   0x00a1e1b3,
+   0x009e6b2d,
+   0x009b0796,
+   0x0097b686,
+   0x0094779a,
+   0x00914a6d,
+   0x008e2ea0,
+   0x008b23d3,
+   0x008829aa,
+   0x00853fc9,
+   0x008265d9,
+   0x007f9b82,
+   0x007ce06f,
+   0x007a344d,
+   0x007796ca,
+   0x00750797,
+   0x00728665,
+   0x007012e8,
+   0x006dacd5,
+   0x006b53e3,
+   0x006907ca,
+   0x0066c844,
+   0x0064950c,
+   0x00626ddf,
+   0x0060527b,
+   0x005e42a1,
+   0x005c3e10,
+   0x005c3e10,
+   0x005a448b,
+   0x005855d7,
+   0x005671b7,
+   0x005497f1,
+   0x0052c84f,
+   0x00510297,
+   0x004f4693,
+   0x004d9410,
+   0x004bead8,
+   0x004a4ab9,
+   0x0048b381,
+   0x004724ff,
+   0x00459f04,
+   0x00442162,
+   0x0042abe9,
+   0x00413e6f,
+   0x003fd8c7,
+   0x003e7ac6,
+   0x003d2442,
+   0x003bd513,
+   0x003a8d11,
+   0x00394c13,
+   0x003811f5,
+   0x0036de8f,
+   0x0035b1be,
+   0x00348b5c,
+   0x00336b48,
+   0x0032515f,
+   0x00313d7e,
+   0x00302f85,
+   0x002f2754,
+   0x002e24ca,
+   0x002e24ca,
+   0x002d27ca,
+   0x002c3033,
+   0x002b3dea,
+   0x002a50d1,
+   0x002968cb,
+   0x002885bd,
+   0x0027a78b,
+   0x0026ce1b,
+   0x0025f953,
+   0x00252919,
+   0x00245d54,
+   0x002395ed,
+   0x0022d2ca,
+   0x002213d5,
+   0x002158f7,
+   0x0020a219,
+   0x001fef26,
+   0x001f4007,
+   0x001e94a9,
+   0x001decf6,
+   0x001d48db,
+   0x001ca843,
+   0x001c0b1b,
+   0x001b7151,
+   0x001adad2,
+   0x001a478d,
+   0x0019b76e,
+   0x00192a66,
+   0x0018a063,
+   0x00181955,
+   0x0017952b,
+   0x001713d6,
+   0x001713d6,
+   0x0016196c,
+   0x0015299f,
+   0x001443fb,
+   0x00136812,
+   0x0012957c,
+   0x0011cbd2,
+   0x00110ab4,
+   0x001051c5,
+   0x000fa0ad,
+   0x000ef716,
+   0x000e54b0,
+   0x000db92b,
+   0x000d243e,
+   0x000c95a1,
+   0x000c0d0f,
+   0x000b8a47,
+   0x000b8a47,
+   0x000b0d0b,
+   0x000a951d,
+   0x000a2245,
+   0x0009b44a,
+   0x00094afa,
+   0x0008e620,
+   0x0008858c,
+   0x00082911,
+   0x0007d081,
+   0x00077bb2,
+   0x00072a7b,
+   0x0006dcb6,
+   0x0006923d,
+   0x00064aec,
+   0x000606a1,
+   0x0005c53b,
+   0x0005c53b,
+   0x0005869b,
+   0x00054aa2,
+   0x00051134,
+   0x0004da36,
+   0x0004a58c,
+   0x0004731e,
+   0x000442d3,
+   0x00041494,
+   0x0003e84b,
+   0x0003bde3,
+   0x00039547,
+   0x00036e63,
+   0x00034926,
+   0x0003257d,
+   0x00030357,
+   0x0002e2a3,
+   0x0002e2a3,
+   0x0002a556,
+   0x00026d1f,
+   0x00023992,
+   0x00020a4d,
+   0x0001def4,
+   0x0001b734,
+   0x000192c0,
+   0x00017153,
+   0x00017153,
+   0x000152ac,
+   0x00013690,
+   0x00011cca,
+   0x00010527,
+   0x0000ef7a,
+   0x0000db9a,
+   0x0000c960,
+   0x0000b8aa,
+   0x0000b8aa,
+   0x0000a956,
+   0x00009b48,
+   0x00008e65,
+   0x00008294,
+   0x000077bd,
+   0x00006dcd,
+   0x000064b0,
+   0x00005c55,
+   0x00005c55,
+   0x00004da4,
+   0x0000414a,
+   0x000036e7,
+   0x00002e2b,
+   0x00002e2b,
+   0x000026d2,
+   0x000020a5,
+   0x00001b73,
+   0x00001715,
+   0x00001715,
+   0x00001369,
+   0x00001052,
+   0x00000dba,
+   0x00000b8b,
+   0x00000b8b,
+   0x00000829,
+   0x000005c5,
+   0x000005c5,
+   0x00000415,
+   0x000002e3,
+   0x000002e3,
+   0x0000020a,
+   0x00000171,
+   0x00000171,
+   0x000000b9,
+   0x000000b9,
+   0x0000005c,
+};
+short xlns32_sbqc2[xlns32_sbqsize] = {
+   11357,
+   11358,
+   11358,
+   11357,
+   11354,
+   11353,
+   11352,
+   11352,
+   11350,
+   11348,
+   11348,
+   11345,
+   11344,
+   11342,
+   11341,
+   11337,
+   11334,
+   11332,
+   11329,
+   11326,
+   11324,
+   11320,
+   11315,
+   11311,
+   11304,
+   11302,
+   11299,
+   11294,
+   11287,
+   11284,
+   11278,
+   11274,
+   11268,
+   11262,
+   11259,
+   11252,
+   11248,
+   11240,
+   11235,
+   11229,
+   11223,
+   11216,
+   11208,
+   11200,
+   11195,
+   11187,
+   11179,
+   11171,
+   11163,
+   11156,
+   11147,
+   11139,
+   11129,
+   11121,
+   11113,
+   11106,
+   11097,
+   11086,
+   11077,
+   11069,
+   11056,
+   11046,
+   11037,
+   11027,
+   11015,
+   11006,
+   10997,
+   10986,
+   10974,
+   10962,
+   10951,
+   10942,
+   10931,
+   10921,
+   10907,
+   10894,
+   10883,
+   10871,
+   10858,
+   10846,
+   10833,
+   10820,
+   10807,
+   10795,
+   10783,
+   10770,
+   10755,
+   10743,
+   10728,
+   10714,
+   10702,
+   10687,
+   10673,
+   10659,
+   10645,
+   10631,
+   10614,
+   10598,
+   10585,
+   10572,
+   10556,
+   10540,
+   10525,
+   10508,
+   10494,
+   10479,
+   10462,
+   10446,
+   10430,
+   10414,
+   10399,
+   10383,
+   10366,
+   10349,
+   10329,
+   10311,
+   10295,
+   10279,
+   10263,
+   10246,
+   10226,
+   10211,
+   10194,
+   10176,
+   10159,
+   10142,
+   10121,
+   10104,
+   0,
+   10084,
+   10064,
+   10049,
+   10031,
+   10011,
+   9992,
+   9975,
+   9955,
+   9937,
+   9918,
+   9898,
+   9879,
+   9860,
+   9838,
+   9818,
+   9801,
+   9779,
+   9760,
+   9742,
+   9724,
+   9703,
+   9683,
+   9661,
+   9641,
+   9621,
+   9600,
+   9581,
+   9560,
+   9538,
+   9517,
+   9496,
+   9477,
+   9456,
+   9436,
+   9416,
+   9396,
+   9372,
+   9351,
+   9328,
+   9306,
+   9285,
+   9263,
+   9241,
+   9220,
+   9200,
+   9178,
+   9155,
+   9135,
+   9114,
+   9091,
+   9070,
+   9048,
+   9026,
+   9003,
+   8981,
+   8958,
+   8935,
+   8915,
+   8892,
+   8869,
+   8847,
+   8823,
+   8800,
+   8776,
+   8755,
+   8730,
+   8709,
+   8688,
+   8664,
+   8639,
+   8617,
+   8595,
+   8570,
+   8550,
+   8526,
+   8502,
+   8480,
+   8456,
+   8433,
+   8410,
+   8387,
+   8365,
+   8341,
+   8318,
+   8295,
+   8270,
+   8247,
+   8224,
+   8200,
+   8177,
+   8154,
+   8131,
+   8106,
+   8080,
+   8058,
+   8035,
+   8013,
+   7987,
+   7964,
+   7944,
+   7918,
+   7893,
+   7871,
+   7849,
+   7825,
+   7800,
+   7776,
+   7752,
+   7730,
+   7706,
+   7680,
+   7656,
+   7634,
+   7611,
+   7586,
+   7564,
+   7539,
+   7516,
+   7493,
+   7469,
+   7444,
+   7422,
+   7397,
+   7371,
+   7350,
+   7327,
+   7305,
+   7281,
+   0,
+   7257,
+   7233,
+   7210,
+   7184,
+   7161,
+   7135,
+   7115,
+   7092,
+   7067,
+   7046,
+   7022,
+   6995,
+   6974,
+   6950,
+   6927,
+   6905,
+   6880,
+   6857,
+   6834,
+   6809,
+   6785,
+   6763,
+   6738,
+   6715,
+   6692,
+   6670,
+   6647,
+   6622,
+   6601,
+   6577,
+   6553,
+   6532,
+   6509,
+   6485,
+   6461,
+   6440,
+   6416,
+   6394,
+   6371,
+   6350,
+   6326,
+   6300,
+   6279,
+   6257,
+   6236,
+   6211,
+   6189,
+   6167,
+   6144,
+   6122,
+   6098,
+   6076,
+   6054,
+   6032,
+   6012,
+   5987,
+   5965,
+   5943,
+   5920,
+   5899,
+   5875,
+   5855,
+   5833,
+   5811,
+   5786,
+   5765,
+   5743,
+   5721,
+   5699,
+   5679,
+   5658,
+   5637,
+   5615,
+   5591,
+   5568,
+   5549,
+   5529,
+   5507,
+   5485,
+   5463,
+   5443,
+   5422,
+   5401,
+   5379,
+   5358,
+   5334,
+   5313,
+   5294,
+   5273,
+   5252,
+   5232,
+   5212,
+   5190,
+   5171,
+   5148,
+   5128,
+   5108,
+   5088,
+   5066,
+   5046,
+   5027,
+   5006,
+   4985,
+   4965,
+   4943,
+   4922,
+   4904,
+   4887,
+   4867,
+   4846,
+   4824,
+   4806,
+   4788,
+   4768,
+   4747,
+   4727,
+   4708,
+   4686,
+   4668,
+   4651,
+   4631,
+   4611,
+   4591,
+   4572,
+   4551,
+   4533,
+   4516,
+   4496,
+   0,
+   4476,
+   4458,
+   4440,
+   4421,
+   4401,
+   4384,
+   4366,
+   4345,
+   4325,
+   4310,
+   4293,
+   4273,
+   4252,
+   4236,
+   4218,
+   4201,
+   4185,
+   4164,
+   4147,
+   4130,
+   4111,
+   4093,
+   4074,
+   4054,
+   4039,
+   4023,
+   4006,
+   3988,
+   3971,
+   3954,
+   3936,
+   3918,
+   3900,
+   3883,
+   3867,
+   3851,
+   3836,
+   3817,
+   3798,
+   3782,
+   3764,
+   3747,
+   3732,
+   3717,
+   3698,
+   3683,
+   3665,
+   3651,
+   3637,
+   3621,
+   3604,
+   3589,
+   3569,
+   3551,
+   3538,
+   3524,
+   3508,
+   3491,
+   3476,
+   3458,
+   3445,
+   3430,
+   3414,
+   3397,
+   3382,
+   3369,
+   3352,
+   3336,
+   3320,
+   3306,
+   3290,
+   3275,
+   3261,
+   3247,
+   3230,
+   3217,
+   3203,
+   3186,
+   3171,
+   3156,
+   3141,
+   3128,
+   3115,
+   3100,
+   3087,
+   3075,
+   3057,
+   3042,
+   3031,
+   3015,
+   3000,
+   2985,
+   2972,
+   2959,
+   2944,
+   2930,
+   2917,
+   2905,
+   2891,
+   2878,
+   2866,
+   2849,
+   2838,
+   2825,
+   2810,
+   2796,
+   2785,
+   2774,
+   2761,
+   2748,
+   2736,
+   2721,
+   2710,
+   2693,
+   2681,
+   2670,
+   2660,
+   2646,
+   2632,
+   2619,
+   2608,
+   2594,
+   2580,
+   2568,
+   2558,
+   2545,
+   2531,
+   2519,
+   0,
+   2507,
+   2496,
+   2486,
+   2474,
+   2461,
+   2449,
+   2438,
+   2426,
+   2415,
+   2404,
+   2392,
+   2382,
+   2369,
+   2358,
+   2345,
+   2334,
+   2321,
+   2309,
+   2300,
+   2290,
+   2280,
+   2269,
+   2259,
+   2247,
+   2234,
+   2227,
+   2213,
+   2201,
+   2191,
+   2180,
+   2170,
+   2161,
+   2151,
+   2140,
+   2128,
+   2119,
+   2107,
+   2099,
+   2087,
+   2076,
+   2065,
+   2057,
+   2046,
+   2037,
+   2026,
+   2017,
+   2009,
+   1998,
+   1985,
+   1977,
+   1969,
+   1958,
+   1949,
+   1938,
+   1930,
+   1920,
+   1910,
+   1901,
+   1892,
+   1885,
+   1874,
+   1865,
+   1857,
+   1845,
+   1835,
+   1827,
+   1819,
+   1809,
+   1799,
+   1788,
+   1784,
+   1775,
+   1767,
+   1757,
+   1748,
+   1741,
+   1733,
+   1721,
+   1713,
+   1705,
+   1696,
+   1686,
+   1678,
+   1669,
+   1663,
+   1654,
+   1646,
+   1637,
+   1631,
+   1621,
+   1610,
+   1604,
+   1598,
+   1588,
+   1580,
+   1573,
+   1564,
+   1556,
+   1548,
+   1541,
+   1532,
+   1526,
+   1518,
+   1510,
+   1502,
+   1496,
+   1488,
+   1480,
+   1471,
+   1465,
+   1460,
+   1451,
+   1443,
+   1436,
+   1429,
+   1423,
+   1415,
+   1407,
+   1400,
+   1395,
+   1387,
+   1381,
+   1373,
+   1364,
+   1359,
+   1353,
+   1346,
+   1337,
+   0,
+   5311,
+   5259,
+   5205,
+   5151,
+   5098,
+   5048,
+   4995,
+   4945,
+   4896,
+   4846,
+   4796,
+   4747,
+   4698,
+   4651,
+   4604,
+   4558,
+   4510,
+   4465,
+   4418,
+   4374,
+   4330,
+   4284,
+   4242,
+   4197,
+   4155,
+   4108,
+   4067,
+   4025,
+   3985,
+   3944,
+   3903,
+   3864,
+   3824,
+   3785,
+   3743,
+   3704,
+   3669,
+   3632,
+   3594,
+   3555,
+   3519,
+   3483,
+   3446,
+   3410,
+   3376,
+   3340,
+   3305,
+   3271,
+   3237,
+   3204,
+   3171,
+   3137,
+   3103,
+   3070,
+   3040,
+   3007,
+   2977,
+   2946,
+   2914,
+   2885,
+   2856,
+   2826,
+   2796,
+   2768,
+   0,
+   2740,
+   2711,
+   2682,
+   2656,
+   2627,
+   2599,
+   2572,
+   2544,
+   2518,
+   2490,
+   2464,
+   2437,
+   2414,
+   2387,
+   2362,
+   2338,
+   2315,
+   2291,
+   2266,
+   2243,
+   2218,
+   2194,
+   2169,
+   2147,
+   2127,
+   2102,
+   2079,
+   2059,
+   2036,
+   2014,
+   1993,
+   1972,
+   1954,
+   1933,
+   1913,
+   1892,
+   1872,
+   1855,
+   1835,
+   1815,
+   1796,
+   1775,
+   1761,
+   1740,
+   1720,
+   1702,
+   1685,
+   1667,
+   1646,
+   1628,
+   1612,
+   1597,
+   1579,
+   1565,
+   1546,
+   1530,
+   1514,
+   1499,
+   1481,
+   1465,
+   1450,
+   1436,
+   1422,
+   1404,
+   0,
+   1388,
+   1375,
+   1363,
+   1349,
+   1333,
+   1317,
+   1305,
+   1291,
+   1275,
+   1262,
+   1247,
+   1235,
+   1223,
+   1210,
+   1197,
+   1185,
+   1172,
+   1161,
+   1147,
+   1134,
+   1122,
+   1108,
+   1098,
+   1087,
+   1076,
+   1064,
+   1054,
+   1044,
+   1033,
+   1021,
+   1012,
+   998,
+   988,
+   978,
+   966,
+   955,
+   944,
+   935,
+   926,
+   917,
+   907,
+   898,
+   889,
+   880,
+   868,
+   859,
+   852,
+   840,
+   832,
+   824,
+   817,
+   805,
+   797,
+   791,
+   780,
+   771,
+   762,
+   755,
+   748,
+   740,
+   730,
+   722,
+   716,
+   706,
+   0,
+   2784,
+   2726,
+   2669,
+   2611,
+   2558,
+   2504,
+   2450,
+   2397,
+   2346,
+   2295,
+   2247,
+   2199,
+   2154,
+   2107,
+   2063,
+   2017,
+   1974,
+   1932,
+   1891,
+   1848,
+   1811,
+   1774,
+   1735,
+   1697,
+   1663,
+   1627,
+   1595,
+   1562,
+   1527,
+   1492,
+   1460,
+   1431,
+   0,
+   1398,
+   1369,
+   1341,
+   1310,
+   1283,
+   1258,
+   1228,
+   1203,
+   1179,
+   1153,
+   1129,
+   1105,
+   1079,
+   1057,
+   1035,
+   1011,
+   991,
+   970,
+   947,
+   926,
+   907,
+   888,
+   870,
+   852,
+   834,
+   816,
+   796,
+   780,
+   763,
+   745,
+   731,
+   715,
+   0,
+   700,
+   683,
+   669,
+   656,
+   644,
+   630,
+   618,
+   604,
+   591,
+   579,
+   563,
+   553,
+   541,
+   529,
+   517,
+   506,
+   496,
+   485,
+   474,
+   464,
+   455,
+   446,
+   437,
+   425,
+   416,
+   408,
+   399,
+   389,
+   381,
+   374,
+   366,
+   358,
+   0,
+   1387,
+   1330,
+   1274,
+   1218,
+   1166,
+   1119,
+   1071,
+   1023,
+   982,
+   940,
+   901,
+   862,
+   825,
+   791,
+   757,
+   724,
+   0,
+   694,
+   667,
+   637,
+   609,
+   583,
+   561,
+   536,
+   512,
+   493,
+   470,
+   448,
+   429,
+   413,
+   396,
+   380,
+   363,
+   0,
+   349,
+   334,
+   318,
+   306,
+   293,
+   281,
+   270,
+   258,
+   246,
+   236,
+   228,
+   216,
+   206,
+   198,
+   191,
+   182,
+   0,
+   680,
+   624,
+   570,
+   523,
+   482,
+   442,
+   404,
+   369,
+   0,
+   340,
+   311,
+   286,
+   262,
+   238,
+   219,
+   200,
+   184,
+   0,
+   170,
+   154,
+   141,
+   131,
+   119,
+   109,
+   98,
+   91,
+   0,
+   324,
+   273,
+   232,
+   195,
+   0,
+   163,
+   137,
+   112,
+   95,
+   0,
+   80,
+   67,
+   57,
+   50,
+   0,
+   150,
+   106,
+   0,
+   75,
+   54,
+   0,
+   37,
+   24,
+   0,
+   63,
+   0,
+   30,
+   0,
+};
+#define xlns32_dbqlogoct 3
+#define xlns32_dbqsize 853
+unsigned int xlns32_dbqoctave[xlns32_sbqoct] = {  //first node<<8 | shift
+   (0<<8) | 17, //0
+   (65<<8) | 17, //1
+   (130<<8) | 17, //2
+   (195<<8) | 16, //3
+   (324<<8) | 16, //4
+   (453<<8) | 17, //5
+   (518<<8) | 17, //6
+   (583<<8) | 17, //7
+   (648<<8) | 18, //8
+   (681<<8) | 18, //9
+   (714<<8) | 18, //10
+   (747<<8) | 19, //11
+   (764<<8) | 19, //12
+   (781<<8) | 19, //13
+   (798<<8) | 20, //14
+   (807<<8) | 20, //15
+   (816<<8) | 20, //16
+   (825<<8) | 21, //17
+   (830<<8) | 21, //18
+   (835<<8) | 21, //19
+   (840<<8) | 22, //20
+   (843<<8) | 22, //21
+   (846<<8) | 22, //22
+   (849<<8) | 23, //23
+   (851<<8) | 23, //24
+};
+unsigned int xlns32_dbqnode[xlns32_dbqsize] = {
+   0x43ae9dd4,
+   0x44ae62ad,
+   0x45adb13c,
+   0x46ac897e,
+   0x47aaeb77,
+   0x48a8d726,
+   0x49a64c8e,
+   0x4aa34bb0,
+   0x4b9fd48e,
+   0x4c9be72c,
+   0x4d97838c,
+   0x4e92a9b2,
+   0x4f8d59a2,
+   0x5087935f,
+   0x518156ee,
+   0x527aa453,
+   0x53737b95,
+   0x546bdcb8,
+   0x5563c7c2,
+   0x565b3cba,
+   0x57523ba5,
+   0x5848c48c,
+   0x593ed775,
+   0x5a347467,
+   0x5b299b6b,
+   0x5c1e4c89,
+   0x5d1287ca,
+   0x5e064d36,
+   0x5ef99cd7,
+   0x5fec76b7,
+   0x60dedae0,
+   0x61d0c95c,
+   0x62c24236,
+   0x63b34579,
+   0x64a3d330,
+   0x6593eb68,
+   0x66838e2b,
+   0x6772bb88,
+   0x6861738a,
+   0x694fb63f,
+   0x6a3d83b4,
+   0x6b2adbf7,
+   0x6c17bf16,
+   0x6d042d20,
+   0x6df02624,
+   0x6edbaa30,
+   0x6fc6b955,
+   0x70b153a2,
+   0x719b7927,
+   0x728529f5,
+   0x736e661c,
+   0x74572daf,
+   0x753f80bd,
+   0x76275f5b,
+   0x770ec998,
+   0x77f5bf89,
+   0x78dc413f,
+   0x79c24ece,
+   0x7aa7e84a,
+   0x7b8d0dc6,
+   0x7c71bf56,
+   0x7d55fd0f,
+   0x7e39c705,
+   0x7f1d1d4f,
+   0x80000000,
+   0x80000000,
+   0x80e26f2f,
+   0x81c46af2,
+   0x82a5f360,
+   0x8387088e,
+   0x8467aa94,
+   0x8547d989,
+   0x86279585,
+   0x8706dea0,
+   0x87e5b4f2,
+   0x88c41893,
+   0x89a2099d,
+   0x8a7f8828,
+   0x8b5c944e,
+   0x8c392e29,
+   0x8d1555d2,
+   0x8df10b65,
+   0x8ecc4efb,
+   0x8fa720b0,
+   0x9081809e,
+   0x915b6ee2,
+   0x9234eb97,
+   0x930df6da,
+   0x93e690c6,
+   0x94beb979,
+   0x9596710f,
+   0x966db7a5,
+   0x97448d5a,
+   0x981af24b,
+   0x98f0e695,
+   0x99c66a58,
+   0x9a9b7db3,
+   0x9b7020c3,
+   0x9c4453a8,
+   0x9d181682,
+   0x9deb6970,
+   0x9ebe4c93,
+   0x9f90c00b,
+   0xa062c3f8,
+   0xa134587a,
+   0xa2057db4,
+   0xa2d633c6,
+   0xa3a67ad3,
+   0xa47652fb,
+   0xa545bc61,
+   0xa614b728,
+   0xa6e34371,
+   0xa7b16160,
+   0xa87f1118,
+   0xa94c52bd,
+   0xaa192671,
+   0xaae58c59,
+   0xabb18498,
+   0xac7d0f54,
+   0xad482cb0,
+   0xae12dcd2,
+   0xaedd1fde,
+   0xafa6f5fa,
+   0xb0705f4c,
+   0xb1395bf8,
+   0xb201ec25,
+   0xb2ca0ffa,
+   0xb391c79c,
+   0xb4591332,
+   0xb51ff2e3,
+   0xb51ff2e3,
+   0xb5e666d6,
+   0xb6ac6f33,
+   0xb7720c20,
+   0xb8373dc6,
+   0xb8fc044d,
+   0xb9c05fdc,
+   0xba84509d,
+   0xbb47d6b7,
+   0xbc0af253,
+   0xbccda39a,
+   0xbd8feab6,
+   0xbe51c7d0,
+   0xbf133b11,
+   0xbfd444a3,
+   0xc094e4b0,
+   0xc1551b62,
+   0xc214e8e4,
+   0xc2d44d60,
+   0xc3934901,
+   0xc451dbf1,
+   0xc510065c,
+   0xc5cdc86c,
+   0xc68b224e,
+   0xc748142d,
+   0xc8049e35,
+   0xc8c0c091,
+   0xc97c7b6e,
+   0xca37cef8,
+   0xcaf2bb5c,
+   0xcbad40c5,
+   0xcc675f62,
+   0xcd21175e,
+   0xcdda68e7,
+   0xce93542a,
+   0xcf4bd955,
+   0xd003f895,
+   0xd0bbb218,
+   0xd173060c,
+   0xd229f49e,
+   0xd2e07dfd,
+   0xd396a257,
+   0xd44c61dc,
+   0xd501bcb8,
+   0xd5b6b31b,
+   0xd66b4534,
+   0xd71f7332,
+   0xd7d33d44,
+   0xd886a399,
+   0xd939a661,
+   0xd9ec45cb,
+   0xda9e8206,
+   0xdb505b44,
+   0xdc01d1b2,
+   0xdcb2e582,
+   0xdd6396e4,
+   0xde13e608,
+   0xdec3d31d,
+   0xdf735e56,
+   0xe02287e1,
+   0xe0d14ff1,
+   0xe17fb6b5,
+   0xe22dbc5f,
+   0xe2db611f,
+   0xe388a528,
+   0x18a8980b,
+   0x188422a9,
+   0x185fe6d1,
+   0x183be41e,
+   0x18181a2a,
+   0x17f48890,
+   0x17d12eee,
+   0x17ae0ce1,
+   0x178b2206,
+   0x17686dfd,
+   0x1745f065,
+   0x1723a8df,
+   0x1701970d,
+   0x16dfba90,
+   0x16be130b,
+   0x169ca021,
+   0x167b6178,
+   0x165a56b4,
+   0x16397f7a,
+   0x1618db72,
+   0x15f86a43,
+   0x15d82b94,
+   0x15b81f0f,
+   0x1598445c,
+   0x15789b26,
+   0x15592317,
+   0x1539dbdb,
+   0x151ac51d,
+   0x14fbde8b,
+   0x14dd27d2,
+   0x14bea0a0,
+   0x14a048a4,
+   0x14821f8c,
+   0x14642509,
+   0x144658cc,
+   0x1428ba85,
+   0x140b49e7,
+   0x13ee06a3,
+   0x13d0f06d,
+   0x13b406f9,
+   0x139749fa,
+   0x137ab926,
+   0x135e5431,
+   0x13421ad2,
+   0x13260cbf,
+   0x130a29af,
+   0x12ee715a,
+   0x12d2e379,
+   0x12b77fc2,
+   0x129c45f1,
+   0x128135bf,
+   0x12664ee6,
+   0x124b9121,
+   0x1230fc2b,
+   0x12168fc0,
+   0x11fc4b9e,
+   0x11e22f7f,
+   0x11c83b23,
+   0x11ae6e47,
+   0x1194c8a9,
+   0x117b4a08,
+   0x1161f224,
+   0x1148c0bd,
+   0x112fb592,
+   0x1116d065,
+   0x10fe10f7,
+   0x10e5770a,
+   0x10cd0260,
+   0x10b4b2bc,
+   0x109c87e0,
+   0x10848191,
+   0x106c9f92,
+   0x1054e1a8,
+   0x103d4798,
+   0x1025d126,
+   0x100e7e1a,
+   0x0ff74e38,
+   0x0fe04148,
+   0x0fc95711,
+   0x0fb28f59,
+   0x0f9be9ea,
+   0x0f85668b,
+   0x0f6f0504,
+   0x0f58c51f,
+   0x0f42a6a6,
+   0x0f2ca961,
+   0x0f16cd1c,
+   0x0f0111a1,
+   0x0eeb76ba,
+   0x0ed5fc34,
+   0x0ec0a1da,
+   0x0eab6779,
+   0x0e964cdb,
+   0x0e8151d0,
+   0x0e6c7623,
+   0x0e57b9a3,
+   0x0e431c1c,
+   0x0e2e9d5f,
+   0x0e1a3d38,
+   0x0e05fb78,
+   0x0df1d7ed,
+   0x0dddd268,
+   0x0dc9eab8,
+   0x0db620ad,
+   0x0da27419,
+   0x0d8ee4cc,
+   0x0d7b7298,
+   0x0d681d4e,
+   0x0d54e4c1,
+   0x0d41c8c2,
+   0x0d2ec925,
+   0x0d1be5bc,
+   0x0d091e5b,
+   0x0cf672d4,
+   0x0ce3e2fd,
+   0x0cd16ea9,
+   0x0cbf15ad,
+   0x0cacd7dd,
+   0x0c9ab50f,
+   0x0c88ad18,
+   0x0c76bfcd,
+   0x0c64ed06,
+   0x0c533497,
+   0x0c419657,
+   0x0c30121e,
+   0x0c1ea7c3,
+   0x0c0d571c,
+   0x0bfc2001,
+   0x0beb024b,
+   0x0beb024b,
+   0x0bd9fdd2,
+   0x0bc9126e,
+   0x0bb83ff7,
+   0x0ba78648,
+   0x0b96e539,
+   0x0b865ca3,
+   0x0b75ec61,
+   0x0b65944c,
+   0x0b55543f,
+   0x0b452c15,
+   0x0b351ba8,
+   0x0b2522d4,
+   0x0b154173,
+   0x0b057761,
+   0x0af5c47a,
+   0x0ae6289b,
+   0x0ad6a39f,
+   0x0ac73563,
+   0x0ab7ddc3,
+   0x0aa89c9d,
+   0x0a9971ce,
+   0x0a8a5d34,
+   0x0a7b5eac,
+   0x0a6c7613,
+   0x0a5da349,
+   0x0a4ee62b,
+   0x0a403e99,
+   0x0a31ac70,
+   0x0a232f91,
+   0x0a14c7d9,
+   0x0a067529,
+   0x09f83761,
+   0x09ea0e60,
+   0x09dbfa06,
+   0x09cdfa34,
+   0x09c00ecb,
+   0x09b237aa,
+   0x09a474b3,
+   0x0996c5c7,
+   0x09892ac7,
+   0x097ba396,
+   0x096e3013,
+   0x0960d023,
+   0x095383a6,
+   0x09464a7f,
+   0x09392491,
+   0x092c11be,
+   0x091f11e8,
+   0x091224f5,
+   0x09054ac5,
+   0x08f8833e,
+   0x08ebce42,
+   0x08df2bb5,
+   0x08d29b7c,
+   0x08c61d7a,
+   0x08b9b194,
+   0x08ad57af,
+   0x08a10faf,
+   0x0894d979,
+   0x0888b4f2,
+   0x087ca200,
+   0x0870a087,
+   0x0864b06e,
+   0x0858d19a,
+   0x084d03f1,
+   0x08414759,
+   0x08359bb8,
+   0x082a00f5,
+   0x081e76f7,
+   0x0812fda3,
+   0x080794e2,
+   0x07fc3c99,
+   0x07f0f4b1,
+   0x07e5bd11,
+   0x07da959f,
+   0x07cf7e45,
+   0x07c476e9,
+   0x07b97f73,
+   0x07ae97cd,
+   0x07a3bfdd,
+   0x0798f78e,
+   0x078e3ec6,
+   0x0783956f,
+   0x0778fb71,
+   0x076e70b7,
+   0x0763f528,
+   0x075988af,
+   0x074f2b34,
+   0x0744dca2,
+   0x073a9ce1,
+   0x07306bdc,
+   0x0726497e,
+   0x071c35af,
+   0x0712305b,
+   0x0708396b,
+   0x06fe50cb,
+   0x06f47664,
+   0x06eaaa23,
+   0x06e0ebf1,
+   0x06d73bba,
+   0x06cd9969,
+   0x06c404ea,
+   0x06ba7e27,
+   0x06b1050d,
+   0x06a79987,
+   0x069e3b81,
+   0x0694eae7,
+   0x068ba7a5,
+   0x068271a8,
+   0x067948db,
+   0x06702d2c,
+   0x06671e86,
+   0x065e1cd6,
+   0x0655280a,
+   0x064c400e,
+   0x064364cf,
+   0x063a963b,
+   0x0631d43e,
+   0x06291ec6,
+   0x062075c1,
+   0x0617d91d,
+   0x060f48c6,
+   0x0606c4ab,
+   0x05fe4cba,
+   0x05f5e0e0,
+   0x05ed810d,
+   0x05e52d2f,
+   0x05dce532,
+   0x05dce532,
+   0x05cc789d,
+   0x05bc3ac2,
+   0x05ac2b18,
+   0x059c4918,
+   0x058c943d,
+   0x057d0c03,
+   0x056dafe6,
+   0x055e7f66,
+   0x054f7a04,
+   0x05409f42,
+   0x0531eea3,
+   0x052367ad,
+   0x051509e6,
+   0x0506d4d6,
+   0x04f8c807,
+   0x04eae305,
+   0x04dd255a,
+   0x04cf8e95,
+   0x04c21e45,
+   0x04b4d3fb,
+   0x04a7af48,
+   0x049aafbe,
+   0x048dd4f4,
+   0x04811e7d,
+   0x04748bf1,
+   0x04681ce9,
+   0x045bd0fd,
+   0x044fa7c8,
+   0x0443a0e5,
+   0x0437bbf3,
+   0x042bf88e,
+   0x04205656,
+   0x0414d4eb,
+   0x040973ef,
+   0x03fe3305,
+   0x03f311d0,
+   0x03e80ff5,
+   0x03dd2d1a,
+   0x03d268e5,
+   0x03c7c300,
+   0x03bd3b11,
+   0x03b2d0c5,
+   0x03a883c5,
+   0x039e53bd,
+   0x0394405b,
+   0x038a494d,
+   0x03806e41,
+   0x0376aee6,
+   0x036d0aef,
+   0x0363820c,
+   0x035a13f0,
+   0x0350c04f,
+   0x034786dd,
+   0x033e674e,
+   0x0335615a,
+   0x032c74b6,
+   0x0323a11c,
+   0x031ae643,
+   0x031243e4,
+   0x0309b9bb,
+   0x03014782,
+   0x02f8ecf5,
+   0x02f0a9d0,
+   0x02e87dd1,
+   0x02e87dd1,
+   0x02e068b6,
+   0x02d86a3e,
+   0x02d08228,
+   0x02c8b036,
+   0x02c0f427,
+   0x02b94dbf,
+   0x02b1bcbe,
+   0x02aa40ea,
+   0x02a2da04,
+   0x029b87d3,
+   0x02944a1c,
+   0x028d20a4,
+   0x02860b31,
+   0x027f098c,
+   0x02781b7c,
+   0x027140ca,
+   0x026a793f,
+   0x0263c4a4,
+   0x025d22c5,
+   0x0256936b,
+   0x02501664,
+   0x0249ab7a,
+   0x0243527b,
+   0x023d0b34,
+   0x0236d573,
+   0x0230b106,
+   0x022a9dbd,
+   0x02249b68,
+   0x021ea9d6,
+   0x0218c8d7,
+   0x0212f83f,
+   0x020d37dd,
+   0x02078785,
+   0x0201e709,
+   0x01fc563c,
+   0x01f6d4f3,
+   0x01f16301,
+   0x01ec003c,
+   0x01e6ac79,
+   0x01e1678d,
+   0x01dc314e,
+   0x01d70994,
+   0x01d1f036,
+   0x01cce50b,
+   0x01c7e7eb,
+   0x01c2f8af,
+   0x01be172f,
+   0x01b94346,
+   0x01b47ccd,
+   0x01afc39e,
+   0x01ab1793,
+   0x01a67889,
+   0x01a1e65a,
+   0x019d60e3,
+   0x0198e800,
+   0x01947b8d,
+   0x01901b67,
+   0x018bc76d,
+   0x01877f7b,
+   0x01834371,
+   0x017f132d,
+   0x017aee8d,
+   0x0176d572,
+   0x0172c7ba,
+   0x0172c7ba,
+   0x016ec547,
+   0x016acdf8,
+   0x0166e1ae,
+   0x0163004b,
+   0x015f29b0,
+   0x015b5dbe,
+   0x01579c59,
+   0x0153e562,
+   0x015038bc,
+   0x014c964a,
+   0x0148fdf1,
+   0x01456f92,
+   0x0141eb14,
+   0x013e705a,
+   0x013aff48,
+   0x013797c5,
+   0x013439b4,
+   0x0130e4fc,
+   0x012d9983,
+   0x012a572f,
+   0x01271de5,
+   0x0123ed8e,
+   0x0120c610,
+   0x011da752,
+   0x011a913d,
+   0x011783b6,
+   0x01147ea8,
+   0x011181fa,
+   0x010e8d95,
+   0x010ba162,
+   0x0108bd49,
+   0x0105e135,
+   0x01030d0f,
+   0x010040c0,
+   0x00fd7c34,
+   0x00fabf54,
+   0x00f80a0b,
+   0x00f55c44,
+   0x00f2b5e9,
+   0x00f016e7,
+   0x00ed7f29,
+   0x00eaee9a,
+   0x00e86527,
+   0x00e5e2bb,
+   0x00e36744,
+   0x00e0f2ad,
+   0x00de84e4,
+   0x00dc1dd6,
+   0x00d9bd70,
+   0x00d7639f,
+   0x00d51051,
+   0x00d2c374,
+   0x00d07cf6,
+   0x00ce3cc6,
+   0x00cc02d2,
+   0x00c9cf08,
+   0x00c7a157,
+   0x00c579af,
+   0x00c357fe,
+   0x00c13c34,
+   0x00bf2641,
+   0x00bd1614,
+   0x00bb0b9e,
+   0x00b906ce,
+   0x00b906ce,
+   0x00b50de3,
+   0x00b12ad7,
+   0x00ad5d32,
+   0x00a9a47d,
+   0x00a60045,
+   0x00a27019,
+   0x009ef389,
+   0x009b8a2a,
+   0x00983391,
+   0x0094ef58,
+   0x0091bd17,
+   0x008e9c6d,
+   0x008b8cf9,
+   0x00888e5a,
+   0x0085a035,
+   0x0082c22e,
+   0x007ff3ed,
+   0x007d351b,
+   0x007a8562,
+   0x0077e46f,
+   0x007551f1,
+   0x0072cd98,
+   0x00705716,
+   0x006dee1f,
+   0x006b9268,
+   0x006943a8,
+   0x00670199,
+   0x0064cbf2,
+   0x0062a272,
+   0x006084d4,
+   0x005e72d7,
+   0x005c6c3b,
+   0x005c6c3b,
+   0x005a70c1,
+   0x0058802c,
+   0x00569a41,
+   0x0054bec4,
+   0x0052ed7b,
+   0x00512630,
+   0x004f68aa,
+   0x004db4b5,
+   0x004c0a1a,
+   0x004a68a8,
+   0x0048d02b,
+   0x00474072,
+   0x0045b94e,
+   0x00443a8e,
+   0x0042c404,
+   0x00415584,
+   0x003feee2,
+   0x003e8ff1,
+   0x003d3888,
+   0x003be87d,
+   0x003a9fa7,
+   0x00395de0,
+   0x00382300,
+   0x0036eee1,
+   0x0035c15f,
+   0x00349a54,
+   0x0033799e,
+   0x00325f19,
+   0x00314aa3,
+   0x00303c1b,
+   0x002f3361,
+   0x002e3055,
+   0x002e3055,
+   0x002d32d7,
+   0x002c3ac9,
+   0x002b480d,
+   0x002a5a85,
+   0x00297216,
+   0x00288ea3,
+   0x0027b010,
+   0x0026d644,
+   0x00260123,
+   0x00253095,
+   0x0024647f,
+   0x00239cc9,
+   0x0022d95c,
+   0x00221a20,
+   0x00215efe,
+   0x0020a7de,
+   0x001ff4ac,
+   0x001f4552,
+   0x001e99ba,
+   0x001df1d0,
+   0x001d4d80,
+   0x001cacb6,
+   0x001c0f5e,
+   0x001b7566,
+   0x001adebb,
+   0x001a4b4b,
+   0x0019bb04,
+   0x00192dd5,
+   0x0018a3ac,
+   0x00181c7b,
+   0x0017982f,
+   0x001716b9,
+   0x001716b9,
+   0x00161c11,
+   0x00152c0c,
+   0x00144634,
+   0x00136a1d,
+   0x0012975b,
+   0x0011cd89,
+   0x00110c47,
+   0x00105336,
+   0x000fa200,
+   0x000ef84d,
+   0x000e55cc,
+   0x000dba30,
+   0x000d252d,
+   0x000c967c,
+   0x000c0dd9,
+   0x000b8b00,
+   0x000b8b00,
+   0x000b0db4,
+   0x000a95b8,
+   0x000a22d3,
+   0x0009b4cd,
+   0x00094b71,
+   0x0008e68e,
+   0x000885f1,
+   0x0008296d,
+   0x0007d0d5,
+   0x00077c00,
+   0x00072ac3,
+   0x0006dcf7,
+   0x00069279,
+   0x00064b23,
+   0x000606d3,
+   0x0005c569,
+   0x0005c569,
+   0x000586c5,
+   0x00054ac9,
+   0x00051158,
+   0x0004da56,
+   0x0004a5aa,
+   0x00047339,
+   0x000442ec,
+   0x000414ab,
+   0x0003e860,
+   0x0003bdf6,
+   0x00039558,
+   0x00036e74,
+   0x00034935,
+   0x0003258b,
+   0x00030363,
+   0x0002e2af,
+   0x0002e2af,
+   0x0002a55f,
+   0x00026d27,
+   0x00023999,
+   0x00020a53,
+   0x0001def9,
+   0x0001b738,
+   0x000192c4,
+   0x00017156,
+   0x00017156,
+   0x000152af,
+   0x00013692,
+   0x00011ccc,
+   0x00010529,
+   0x0000ef7c,
+   0x0000db9b,
+   0x0000c961,
+   0x0000b8ab,
+   0x0000b8ab,
+   0x0000a957,
+   0x00009b49,
+   0x00008e66,
+   0x00008294,
+   0x000077be,
+   0x00006dce,
+   0x000064b1,
+   0x00005c55,
+   0x00005c55,
+   0x00004da4,
+   0x0000414a,
+   0x000036e7,
+   0x00002e2b,
+   0x00002e2b,
+   0x000026d2,
+   0x000020a5,
+   0x00001b73,
+   0x00001715,
+   0x00001715,
+   0x00001369,
+   0x00001052,
+   0x00000dba,
+   0x00000b8b,
+   0x00000b8b,
+   0x00000829,
+   0x000005c5,
+   0x000005c5,
+   0x00000415,
+   0x000002e3,
+   0x000002e3,
+   0x0000020a,
+   0x00000171,
+   0x00000171,
+   0x000000b9,
+   0x000000b9,
+   0x0000005c,
+};
+short xlns32_dbqc2[xlns32_dbqsize] = {
+   -15143,
+   -15143,
+   -15142,
+   -15142,
+   -15140,
+   -15138,
+   -15138,
+   -15136,
+   -15136,
+   -15134,
+   -15134,
+   -15130,
+   -15128,
+   -15126,
+   -15124,
+   -15122,
+   -15118,
+   -15116,
+   -15112,
+   -15110,
+   -15106,
+   -15099,
+   -15095,
+   -15093,
+   -15088,
+   -15084,
+   -15079,
+   -15076,
+   -15071,
+   -15067,
+   -15061,
+   -15055,
+   -15049,
+   -15043,
+   -15036,
+   -15031,
+   -15026,
+   -15020,
+   -15011,
+   -15004,
+   -14997,
+   -14991,
+   -14985,
+   -14976,
+   -14968,
+   -14961,
+   -14951,
+   -14941,
+   -14933,
+   -14927,
+   -14919,
+   -14909,
+   -14900,
+   -14890,
+   -14882,
+   -14872,
+   -14862,
+   -14852,
+   -14843,
+   -14830,
+   -14821,
+   -14812,
+   -14802,
+   -14790,
+   0,
+   -14780,
+   -14770,
+   -14758,
+   -14744,
+   -14733,
+   -14723,
+   -14713,
+   -14701,
+   -14687,
+   -14675,
+   -14663,
+   -14650,
+   -14637,
+   -14624,
+   -14610,
+   -14597,
+   -14582,
+   -14570,
+   -14555,
+   -14544,
+   -14530,
+   -14516,
+   -14500,
+   -14486,
+   -14469,
+   -14456,
+   -14443,
+   -14426,
+   -14411,
+   -14398,
+   -14382,
+   -14362,
+   -14349,
+   -14336,
+   -14319,
+   -14304,
+   -14286,
+   -14268,
+   -14252,
+   -14237,
+   -14221,
+   -14204,
+   -14184,
+   -14169,
+   -14150,
+   -14133,
+   -14117,
+   -14100,
+   -14081,
+   -14062,
+   -14043,
+   -14026,
+   -14009,
+   -13991,
+   -13974,
+   -13956,
+   -13937,
+   -13917,
+   -13897,
+   -13879,
+   -13860,
+   -13839,
+   -13820,
+   -13801,
+   0,
+   -13782,
+   -13762,
+   -13742,
+   -13724,
+   -13703,
+   -13683,
+   -13661,
+   -13640,
+   -13618,
+   -13600,
+   -13581,
+   -13560,
+   -13537,
+   -13516,
+   -13496,
+   -13477,
+   -13457,
+   -13435,
+   -13411,
+   -13388,
+   -13367,
+   -13346,
+   -13327,
+   -13306,
+   -13281,
+   -13259,
+   -13238,
+   -13215,
+   -13193,
+   -13170,
+   -13148,
+   -13124,
+   -13102,
+   -13080,
+   -13058,
+   -13035,
+   -13012,
+   -12987,
+   -12964,
+   -12942,
+   -12919,
+   -12898,
+   -12874,
+   -12849,
+   -12826,
+   -12802,
+   -12779,
+   -12755,
+   -12731,
+   -12706,
+   -12684,
+   -12659,
+   -12635,
+   -12612,
+   -12588,
+   -12562,
+   -12539,
+   -12516,
+   -12490,
+   -12465,
+   -12440,
+   -12417,
+   -12393,
+   -12370,
+   0,
+   7392,
+   7339,
+   7287,
+   7239,
+   7189,
+   7137,
+   7089,
+   7043,
+   6992,
+   6945,
+   6894,
+   6850,
+   6805,
+   6758,
+   6712,
+   6664,
+   6621,
+   6575,
+   6528,
+   6485,
+   6440,
+   6396,
+   6355,
+   6313,
+   6271,
+   6229,
+   6187,
+   6142,
+   6101,
+   6062,
+   6023,
+   5984,
+   5940,
+   5902,
+   5863,
+   5826,
+   5786,
+   5747,
+   5710,
+   5673,
+   5635,
+   5598,
+   5563,
+   5524,
+   5488,
+   5448,
+   5416,
+   5380,
+   5342,
+   5308,
+   5276,
+   5242,
+   5208,
+   5172,
+   5139,
+   5107,
+   5071,
+   5041,
+   5008,
+   4975,
+   4942,
+   4910,
+   4878,
+   4846,
+   4814,
+   4782,
+   4751,
+   4722,
+   4692,
+   4662,
+   4633,
+   4603,
+   4575,
+   4545,
+   4517,
+   4488,
+   4458,
+   4430,
+   4399,
+   4372,
+   4348,
+   4319,
+   4291,
+   4265,
+   4238,
+   4210,
+   4185,
+   4156,
+   4129,
+   4103,
+   4079,
+   4052,
+   4027,
+   4003,
+   3979,
+   3952,
+   3927,
+   3903,
+   3878,
+   3852,
+   3828,
+   3808,
+   3782,
+   3758,
+   3735,
+   3711,
+   3688,
+   3664,
+   3643,
+   3620,
+   3599,
+   3578,
+   3555,
+   3531,
+   3510,
+   3489,
+   3468,
+   3445,
+   3426,
+   3403,
+   3383,
+   3365,
+   3341,
+   3319,
+   3301,
+   3281,
+   3259,
+   3239,
+   0,
+   3220,
+   3200,
+   3181,
+   3161,
+   3145,
+   3126,
+   3105,
+   3086,
+   3064,
+   3046,
+   3027,
+   3011,
+   2994,
+   2975,
+   2955,
+   2938,
+   2922,
+   2904,
+   2887,
+   2867,
+   2849,
+   2833,
+   2818,
+   2800,
+   2782,
+   2766,
+   2750,
+   2733,
+   2717,
+   2702,
+   2683,
+   2666,
+   2651,
+   2633,
+   2618,
+   2603,
+   2590,
+   2574,
+   2558,
+   2542,
+   2527,
+   2512,
+   2497,
+   2482,
+   2467,
+   2452,
+   2440,
+   2424,
+   2410,
+   2397,
+   2382,
+   2368,
+   2354,
+   2338,
+   2323,
+   2309,
+   2295,
+   2283,
+   2270,
+   2255,
+   2243,
+   2230,
+   2217,
+   2205,
+   2192,
+   2181,
+   2166,
+   2152,
+   2141,
+   2127,
+   2115,
+   2102,
+   2089,
+   2079,
+   2067,
+   2053,
+   2044,
+   2030,
+   2017,
+   2005,
+   1994,
+   1983,
+   1972,
+   1958,
+   1947,
+   1936,
+   1925,
+   1913,
+   1903,
+   1892,
+   1878,
+   1869,
+   1858,
+   1849,
+   1838,
+   1828,
+   1815,
+   1805,
+   1796,
+   1784,
+   1773,
+   1764,
+   1753,
+   1742,
+   1734,
+   1723,
+   1712,
+   1701,
+   1692,
+   1683,
+   1674,
+   1665,
+   1655,
+   1645,
+   1636,
+   1626,
+   1618,
+   1608,
+   1598,
+   1587,
+   1578,
+   1573,
+   1562,
+   1553,
+   1543,
+   1532,
+   1527,
+   1517,
+   0,
+   6015,
+   5948,
+   5880,
+   5811,
+   5743,
+   5680,
+   5616,
+   5551,
+   5486,
+   5426,
+   5365,
+   5304,
+   5243,
+   5182,
+   5119,
+   5064,
+   5008,
+   4950,
+   4893,
+   4838,
+   4785,
+   4730,
+   4676,
+   4625,
+   4569,
+   4518,
+   4468,
+   4419,
+   4367,
+   4319,
+   4272,
+   4225,
+   4175,
+   4126,
+   4080,
+   4033,
+   3988,
+   3945,
+   3899,
+   3857,
+   3814,
+   3770,
+   3730,
+   3687,
+   3643,
+   3604,
+   3566,
+   3525,
+   3483,
+   3446,
+   3405,
+   3369,
+   3334,
+   3296,
+   3260,
+   3221,
+   3185,
+   3152,
+   3115,
+   3079,
+   3046,
+   3013,
+   2981,
+   2948,
+   0,
+   2915,
+   2883,
+   2849,
+   2817,
+   2786,
+   2756,
+   2725,
+   2695,
+   2664,
+   2633,
+   2606,
+   2580,
+   2549,
+   2519,
+   2492,
+   2463,
+   2438,
+   2410,
+   2384,
+   2358,
+   2331,
+   2308,
+   2282,
+   2256,
+   2232,
+   2207,
+   2179,
+   2157,
+   2136,
+   2110,
+   2088,
+   2065,
+   2042,
+   2020,
+   1995,
+   1974,
+   1951,
+   1929,
+   1910,
+   1891,
+   1868,
+   1846,
+   1827,
+   1808,
+   1792,
+   1770,
+   1749,
+   1729,
+   1712,
+   1692,
+   1674,
+   1654,
+   1634,
+   1617,
+   1601,
+   1585,
+   1566,
+   1550,
+   1532,
+   1514,
+   1500,
+   1484,
+   1468,
+   1451,
+   0,
+   1434,
+   1420,
+   1402,
+   1386,
+   1372,
+   1356,
+   1340,
+   1329,
+   1315,
+   1299,
+   1285,
+   1271,
+   1256,
+   1244,
+   1230,
+   1216,
+   1204,
+   1189,
+   1176,
+   1164,
+   1151,
+   1136,
+   1125,
+   1112,
+   1102,
+   1089,
+   1076,
+   1065,
+   1055,
+   1044,
+   1033,
+   1020,
+   1010,
+   998,
+   987,
+   979,
+   967,
+   957,
+   945,
+   932,
+   925,
+   915,
+   905,
+   895,
+   885,
+   875,
+   864,
+   856,
+   849,
+   841,
+   830,
+   819,
+   810,
+   802,
+   794,
+   787,
+   778,
+   767,
+   761,
+   750,
+   742,
+   734,
+   726,
+   720,
+   0,
+   2830,
+   2768,
+   2710,
+   2650,
+   2593,
+   2538,
+   2485,
+   2429,
+   2376,
+   2326,
+   2275,
+   2224,
+   2179,
+   2133,
+   2086,
+   2039,
+   1996,
+   1955,
+   1913,
+   1871,
+   1831,
+   1790,
+   1752,
+   1715,
+   1678,
+   1638,
+   1607,
+   1572,
+   1536,
+   1507,
+   1475,
+   1441,
+   0,
+   1412,
+   1379,
+   1349,
+   1321,
+   1291,
+   1263,
+   1236,
+   1210,
+   1184,
+   1157,
+   1134,
+   1108,
+   1086,
+   1065,
+   1040,
+   1016,
+   995,
+   976,
+   955,
+   934,
+   914,
+   892,
+   875,
+   852,
+   836,
+   819,
+   802,
+   786,
+   767,
+   749,
+   732,
+   718,
+   0,
+   703,
+   689,
+   675,
+   660,
+   644,
+   631,
+   616,
+   604,
+   590,
+   579,
+   568,
+   553,
+   540,
+   529,
+   520,
+   509,
+   494,
+   485,
+   475,
+   465,
+   455,
+   446,
+   437,
+   427,
+   419,
+   413,
+   402,
+   393,
+   382,
+   374,
+   368,
+   361,
+   0,
+   1390,
+   1331,
+   1274,
+   1221,
+   1171,
+   1121,
+   1073,
+   1023,
+   983,
+   943,
+   901,
+   861,
+   824,
+   789,
+   757,
+   726,
+   0,
+   694,
+   665,
+   637,
+   611,
+   583,
+   559,
+   537,
+   512,
+   490,
+   471,
+   454,
+   430,
+   412,
+   398,
+   380,
+   363,
+   0,
+   348,
+   334,
+   320,
+   304,
+   292,
+   280,
+   267,
+   257,
+   245,
+   235,
+   224,
+   215,
+   208,
+   199,
+   190,
+   182,
+   0,
+   681,
+   622,
+   572,
+   526,
+   483,
+   442,
+   407,
+   372,
+   0,
+   341,
+   310,
+   286,
+   265,
+   242,
+   221,
+   200,
+   185,
+   0,
+   171,
+   156,
+   143,
+   132,
+   121,
+   112,
+   103,
+   92,
+   0,
+   324,
+   272,
+   230,
+   195,
+   0,
+   163,
+   136,
+   112,
+   95,
+   0,
+   80,
+   67,
+   57,
+   50,
+   0,
+   150,
+   106,
+   0,
+   75,
+   54,
+   0,
+   37,
+   24,
+   0,
+   63,
+   0,
+   30,
+   0,
+};
+#define xlns32_log2qshift 22
+#define xlns32_log2qsize 513
+unsigned int xlns32_log2qnode[xlns32_log2qsize] = {
+   0x00000000,
+   0x005c3e10,
+   0x00b84e23,
+   0x01143068,
+   0x016fe50b,
+   0x01cb6c3b,
+   0x0226c623,
+   0x0281f2f1,
+   0x02dcf2d1,
+   0x0337c5ef,
+   0x03926c77,
+   0x03ece696,
+   0x04473475,
+   0x04a15641,
+   0x04fb4c25,
+   0x0555164b,
+   0x05aeb4dd,
+   0x06082807,
+   0x06616ff1,
+   0x06ba8cc6,
+   0x07137eae,
+   0x076c45d4,
+   0x07c4e261,
+   0x081d547c,
+   0x08759c50,
+   0x08cdba03,
+   0x0925adbf,
+   0x097d77ab,
+   0x09d517ef,
+   0x0a2c8eb2,
+   0x0a83dc1b,
+   0x0adb0052,
+   0x0b31fb7d,
+   0x0b88cdc4,
+   0x0bdf774b,
+   0x0c35f83b,
+   0x0c8c50b7,
+   0x0ce280e7,
+   0x0d3888f0,
+   0x0d8e68f6,
+   0x0de42120,
+   0x0e39b193,
+   0x0e8f1a72,
+   0x0ee45be2,
+   0x0f397609,
+   0x0f8e6909,
+   0x0fe33508,
+   0x1037da28,
+   0x108c588d,
+   0x10e0b05b,
+   0x1134e1b5,
+   0x1188ecbd,
+   0x11dcd197,
+   0x12309066,
+   0x1284294b,
+   0x12d79c69,
+   0x132ae9e2,
+   0x137e11d9,
+   0x13d1146e,
+   0x1423f1c3,
+   0x1476a9fa,
+   0x14c93d33,
+   0x151bab90,
+   0x156df533,
+   0x15c01a3a,
+   0x16121ac7,
+   0x1663f6fb,
+   0x16b5aef5,
+   0x170742d5,
+   0x1758b2bb,
+   0x17a9fec8,
+   0x17fb271a,
+   0x184c2bd0,
+   0x189d0d0b,
+   0x18edcae8,
+   0x193e6588,
+   0x198edd07,
+   0x19df3187,
+   0x1a2f6323,
+   0x1a7f71fb,
+   0x1acf5e2e,
+   0x1b1f27d8,
+   0x1b6ecf17,
+   0x1bbe540a,
+   0x1c0db6ce,
+   0x1c5cf780,
+   0x1cac163c,
+   0x1cfb1322,
+   0x1d49ee4c,
+   0x1d98a7d9,
+   0x1de73fe4,
+   0x1e35b68a,
+   0x1e840be7,
+   0x1ed24018,
+   0x1f205339,
+   0x1f6e4565,
+   0x1fbc16b9,
+   0x2009c750,
+   0x20575745,
+   0x20a4c6b3,
+   0x20f215b7,
+   0x213f446b,
+   0x218c52eb,
+   0x21d94150,
+   0x22260fb6,
+   0x2272be37,
+   0x22bf4ced,
+   0x230bbbf4,
+   0x23580b65,
+   0x23a43b5a,
+   0x23f04bee,
+   0x243c3d39,
+   0x24880f56,
+   0x24d3c25e,
+   0x251f566b,
+   0x256acb96,
+   0x25b621f9,
+   0x260159ab,
+   0x264c72c7,
+   0x26976d65,
+   0x26e2499d,
+   0x272d0789,
+   0x2777a741,
+   0x27c228dd,
+   0x280c8c76,
+   0x2856d224,
+   0x28a0f9fe,
+   0x28eb041c,
+   0x2934f098,
+   0x297ebf87,
+   0x29c87102,
+   0x2a120520,
+   0x2a5b7bf9,
+   0x2aa4d5a3,
+   0x2aee1236,
+   0x2b3731ca,
+   0x2b803474,
+   0x2bc91a4c,
+   0x2c11e368,
+   0x2c5a8fe0,
+   0x2ca31fc9,
+   0x2ceb933a,
+   0x2d33ea49,
+   0x2d7c250d,
+   0x2dc4439b,
+   0x2e0c460a,
+   0x2e542c70,
+   0x2e9bf6e1,
+   0x2ee3a575,
+   0x2f2b3840,
+   0x2f72af59,
+   0x2fba0ad4,
+   0x30014ac6,
+   0x30486f46,
+   0x308f7868,
+   0x30d66641,
+   0x311d38e6,
+   0x3163f06c,
+   0x31aa8ce7,
+   0x31f10e6d,
+   0x32377512,
+   0x327dc0ea,
+   0x32c3f20a,
+   0x330a0886,
+   0x33500472,
+   0x3395e5e3,
+   0x33dbaceb,
+   0x342159a0,
+   0x3466ec15,
+   0x34ac645e,
+   0x34f1c28e,
+   0x353706b9,
+   0x357c30f3,
+   0x35c1414f,
+   0x360637e0,
+   0x364b14b9,
+   0x368fd7ee,
+   0x36d48192,
+   0x371911b8,
+   0x375d8872,
+   0x37a1e5d4,
+   0x37e629f0,
+   0x382a54d8,
+   0x386e66a0,
+   0x38b25f5a,
+   0x38f63f19,
+   0x393a05ee,
+   0x397db3eb,
+   0x39c14924,
+   0x3a04c5ab,
+   0x3a482990,
+   0x3a8b74e7,
+   0x3acea7c0,
+   0x3b11c22f,
+   0x3b54c444,
+   0x3b97ae11,
+   0x3bda7fa9,
+   0x3c1d391b,
+   0x3c5fda7a,
+   0x3ca263d7,
+   0x3ce4d544,
+   0x3d272ed1,
+   0x3d697090,
+   0x3dab9a91,
+   0x3dedace6,
+   0x3e2fa7a0,
+   0x3e718acf,
+   0x3eb35685,
+   0x3ef50ad2,
+   0x3f36a7c6,
+   0x3f782d72,
+   0x3fb99be7,
+   0x3ffaf335,
+   0x403c336d,
+   0x407d5c9e,
+   0x40be6ed9,
+   0x40ff6a2e,
+   0x41404eae,
+   0x41811c68,
+   0x41c1d36c,
+   0x420273ca,
+   0x4242fd92,
+   0x428370d4,
+   0x42c3cd9f,
+   0x43041403,
+   0x43444410,
+   0x43845dd5,
+   0x43c46162,
+   0x44044ec5,
+   0x4444260f,
+   0x4483e74e,
+   0x44c39293,
+   0x450327eb,
+   0x4542a765,
+   0x45821112,
+   0x45c16500,
+   0x4600a33e,
+   0x463fcbda,
+   0x467edee4,
+   0x46bddc6a,
+   0x46fcc47a,
+   0x473b9724,
+   0x477a5476,
+   0x47b8fc7f,
+   0x47f78f4c,
+   0x48360ced,
+   0x4874756f,
+   0x48b2c8e1,
+   0x48f10751,
+   0x492f30cd,
+   0x496d4563,
+   0x49ab4521,
+   0x49e93016,
+   0x4a27064f,
+   0x4a64c7da,
+   0x4aa274c5,
+   0x4ae00d1d,
+   0x4b1d90f1,
+   0x4b5b004d,
+   0x4b985b40,
+   0x4bd5a1d8,
+   0x4c12d421,
+   0x4c4ff228,
+   0x4c8cfbfd,
+   0x4cc9f1ab,
+   0x4d06d340,
+   0x4d43a0c9,
+   0x4d805a54,
+   0x4dbcffee,
+   0x4df991a3,
+   0x4e360f81,
+   0x4e727994,
+   0x4eaecfeb,
+   0x4eeb1290,
+   0x4f274192,
+   0x4f635cfd,
+   0x4f9f64de,
+   0x4fdb5942,
+   0x50173a35,
+   0x505307c3,
+   0x508ec1fa,
+   0x50ca68e6,
+   0x5105fc93,
+   0x51417d0e,
+   0x517cea63,
+   0x51b8449e,
+   0x51f38bcb,
+   0x522ebff8,
+   0x5269e12f,
+   0x52a4ef7e,
+   0x52dfeaf0,
+   0x531ad391,
+   0x5355a96d,
+   0x53906c90,
+   0x53cb1d07,
+   0x5405badc,
+   0x5440461c,
+   0x547abed3,
+   0x54b5250c,
+   0x54ef78d2,
+   0x5529ba33,
+   0x5563e938,
+   0x559e05ee,
+   0x55d81060,
+   0x5612089a,
+   0x564beea7,
+   0x5685c293,
+   0x56bf8468,
+   0x56f93433,
+   0x5732d1fe,
+   0x576c5dd4,
+   0x57a5d7c1,
+   0x57df3fd0,
+   0x5818960d,
+   0x5851da81,
+   0x588b0d38,
+   0x58c42e3d,
+   0x58fd3d9c,
+   0x59363b5e,
+   0x596f278f,
+   0x59a80239,
+   0x59e0cb68,
+   0x5a198326,
+   0x5a52297d,
+   0x5a8abe79,
+   0x5ac34225,
+   0x5afbb489,
+   0x5b3415b2,
+   0x5b6c65aa,
+   0x5ba4a47b,
+   0x5bdcd22f,
+   0x5c14eed2,
+   0x5c4cfa6c,
+   0x5c84f50a,
+   0x5cbcdeb4,
+   0x5cf4b776,
+   0x5d2c7f59,
+   0x5d643668,
+   0x5d9bdcad,
+   0x5dd37231,
+   0x5e0af6ff,
+   0x5e426b22,
+   0x5e79cea2,
+   0x5eb1218b,
+   0x5ee863e5,
+   0x5f1f95bb,
+   0x5f56b717,
+   0x5f8dc802,
+   0x5fc4c886,
+   0x5ffbb8ad,
+   0x60329882,
+   0x6069680c,
+   0x60a02757,
+   0x60d6d66b,
+   0x610d7553,
+   0x61440418,
+   0x617a82c3,
+   0x61b0f15e,
+   0x61e74ff2,
+   0x621d9e89,
+   0x6253dd2c,
+   0x628a0be5,
+   0x62c02abc,
+   0x62f639bc,
+   0x632c38ed,
+   0x63622859,
+   0x63980809,
+   0x63cdd805,
+   0x64039858,
+   0x6439490a,
+   0x646eea24,
+   0x64a47bb0,
+   0x64d9fdb7,
+   0x650f7040,
+   0x6544d356,
+   0x657a2701,
+   0x65af6b4b,
+   0x65e4a03b,
+   0x6619c5db,
+   0x664edc34,
+   0x6683e34f,
+   0x66b8db33,
+   0x66edc3eb,
+   0x67229d7e,
+   0x675767f5,
+   0x678c2359,
+   0x67c0cfb3,
+   0x67f56d0b,
+   0x6829fb69,
+   0x685e7ad7,
+   0x6892eb5c,
+   0x68c74d01,
+   0x68fb9fce,
+   0x692fe3cd,
+   0x69641904,
+   0x69983f7e,
+   0x69cc5741,
+   0x6a006056,
+   0x6a345ac6,
+   0x6a684699,
+   0x6a9c23d6,
+   0x6acff287,
+   0x6b03b2b2,
+   0x6b376462,
+   0x6b6b079c,
+   0x6b9e9c6b,
+   0x6bd222d4,
+   0x6c059ae2,
+   0x6c39049b,
+   0x6c6c6008,
+   0x6c9fad30,
+   0x6cd2ec1c,
+   0x6d061cd3,
+   0x6d393f5d,
+   0x6d6c53c2,
+   0x6d9f5a0a,
+   0x6dd2523d,
+   0x6e053c63,
+   0x6e381882,
+   0x6e6ae6a4,
+   0x6e9da6ce,
+   0x6ed0590b,
+   0x6f02fd60,
+   0x6f3593d5,
+   0x6f681c73,
+   0x6f9a9740,
+   0x6fcd0445,
+   0x6fff6388,
+   0x7031b512,
+   0x7063f8e9,
+   0x70962f16,
+   0x70c8579f,
+   0x70fa728c,
+   0x712c7fe4,
+   0x715e7faf,
+   0x719071f4,
+   0x71c256ba,
+   0x71f42e09,
+   0x7225f7e8,
+   0x7257b45e,
+   0x72896373,
+   0x72bb052d,
+   0x72ec9993,
+   0x731e20ae,
+   0x734f9a83,
+   0x7381071b,
+   0x73b2667b,
+   0x73e3b8ac,
+   0x7414fdb5,
+   0x7446359b,
+   0x74776067,
+   0x74a87e1f,
+   0x74d98eca,
+   0x750a926f,
+   0x753b8916,
+   0x756c72c4,
+   0x759d4f81,
+   0x75ce1f53,
+   0x75fee242,
+   0x762f9855,
+   0x76604191,
+   0x7690ddfe,
+   0x76c16da3,
+   0x76f1f085,
+   0x772266ad,
+   0x7752d020,
+   0x77832ce6,
+   0x77b37d04,
+   0x77e3c082,
+   0x7813f766,
+   0x784421b7,
+   0x78743f7b,
+   0x78a450b8,
+   0x78d45576,
+   0x79044dbb,
+   0x7934398d,
+   0x796418f2,
+   0x7993ebf2,
+   0x79c3b292,
+   0x79f36cd9,
+   0x7a231ace,
+   0x7a52bc76,
+   0x7a8251d8,
+   0x7ab1dafa,
+   0x7ae157e3,
+   0x7b10c899,
+   0x7b402d22,
+   0x7b6f8585,
+   0x7b9ed1c7,
+   0x7bce11ef,
+   0x7bfd4603,
+   0x7c2c6e09,
+   0x7c5b8a07,
+   0x7c8a9a04,
+   0x7cb99e06,
+   0x7ce89612,
+   0x7d17822f,
+   0x7d466263,
+   0x7d7536b4,
+   0x7da3ff27,
+   0x7dd2bbc4,
+   0x7e016c8f,
+   0x7e30118f,
+   0x7e5eaaca,
+   0x7e8d3846,
+   0x7ebbba08,
+   0x7eea3017,
+   0x7f189a78,
+   0x7f46f932,
+   0x7f754c4a,
+   0x7fa393c5,
+   0x7fd1cfab,
+   0x80000000,
+};
+short xlns32_log2qc2[xlns32_log2qsize] = {
+   -5897,
+   -5876,
+   -5854,
+   -5831,
+   -5806,
+   -5783,
+   -5761,
+   -5738,
+   -5717,
+   -5697,
+   -5675,
+   -5653,
+   -5634,
+   -5611,
+   -5589,
+   -5569,
+   -5546,
+   -5525,
+   -5503,
+   -5483,
+   -5464,
+   -5443,
+   -5423,
+   -5403,
+   -5382,
+   -5362,
+   -5343,
+   -5321,
+   -5302,
+   -5281,
+   -5265,
+   -5245,
+   -5226,
+   -5206,
+   -5186,
+   -5167,
+   -5149,
+   -5130,
+   -5112,
+   -5094,
+   -5075,
+   -5055,
+   -5037,
+   -5021,
+   -5002,
+   -4983,
+   -4963,
+   -4949,
+   -4930,
+   -4914,
+   -4896,
+   -4880,
+   -4862,
+   -4843,
+   -4827,
+   -4812,
+   -4794,
+   -4774,
+   -4758,
+   -4741,
+   -4726,
+   -4711,
+   -4694,
+   -4676,
+   -4662,
+   -4646,
+   -4628,
+   -4611,
+   -4598,
+   -4583,
+   -4565,
+   -4549,
+   -4535,
+   -4519,
+   -4501,
+   -4488,
+   -4473,
+   -4456,
+   -4445,
+   -4429,
+   -4411,
+   -4398,
+   -4385,
+   -4370,
+   -4352,
+   -4338,
+   -4326,
+   -4310,
+   -4296,
+   -4280,
+   -4267,
+   -4253,
+   -4242,
+   -4226,
+   -4213,
+   -4200,
+   -4184,
+   -4168,
+   -4157,
+   -4145,
+   -4131,
+   -4116,
+   -4101,
+   -4087,
+   -4074,
+   -4065,
+   -4052,
+   -4037,
+   -4025,
+   -4009,
+   -3998,
+   -3985,
+   -3973,
+   -3962,
+   -3948,
+   -3934,
+   -3921,
+   -3908,
+   -3895,
+   -3886,
+   -3874,
+   -3860,
+   -3850,
+   -3837,
+   -3823,
+   -3810,
+   -3800,
+   -3788,
+   -3775,
+   -3765,
+   -3752,
+   -3741,
+   -3729,
+   -3719,
+   -3707,
+   -3694,
+   -3683,
+   -3673,
+   -3662,
+   -3649,
+   -3638,
+   -3628,
+   -3616,
+   -3605,
+   -3596,
+   -3584,
+   -3572,
+   -3563,
+   -3551,
+   -3541,
+   -3526,
+   -3517,
+   -3508,
+   -3497,
+   -3487,
+   -3476,
+   -3464,
+   -3457,
+   -3448,
+   -3437,
+   -3427,
+   -3416,
+   -3406,
+   -3396,
+   -3385,
+   -3374,
+   -3366,
+   -3355,
+   -3344,
+   -3335,
+   -3326,
+   -3316,
+   -3305,
+   -3295,
+   -3287,
+   -3280,
+   -3270,
+   -3259,
+   -3249,
+   -3240,
+   -3231,
+   -3222,
+   -3213,
+   -3204,
+   -3194,
+   -3182,
+   -3177,
+   -3168,
+   -3158,
+   -3147,
+   -3138,
+   -3131,
+   -3122,
+   -3113,
+   -3105,
+   -3094,
+   -3084,
+   -3077,
+   -3069,
+   -3060,
+   -3051,
+   -3042,
+   -3034,
+   -3027,
+   -3019,
+   -3011,
+   -3003,
+   -2992,
+   -2983,
+   -2975,
+   -2968,
+   -2959,
+   -2949,
+   -2941,
+   -2934,
+   -2927,
+   -2920,
+   -2910,
+   -2902,
+   -2895,
+   -2887,
+   -2881,
+   -2871,
+   -2864,
+   -2857,
+   -2849,
+   -2841,
+   -2834,
+   -2826,
+   -2820,
+   -2811,
+   -2799,
+   -2795,
+   -2790,
+   -2781,
+   -2772,
+   -2765,
+   -2758,
+   -2749,
+   -2742,
+   -2737,
+   -2732,
+   -2724,
+   -2714,
+   -2707,
+   -2699,
+   -2692,
+   -2683,
+   -2676,
+   -2670,
+   -2665,
+   -2658,
+   -2651,
+   -2644,
+   -2636,
+   -2628,
+   -2622,
+   -2616,
+   -2611,
+   -2602,
+   -2593,
+   -2589,
+   -2584,
+   -2575,
+   -2569,
+   -2564,
+   -2557,
+   -2550,
+   -2543,
+   -2536,
+   -2530,
+   -2523,
+   -2517,
+   -2512,
+   -2506,
+   -2501,
+   -2493,
+   -2485,
+   -2480,
+   -2475,
+   -2467,
+   -2461,
+   -2454,
+   -2447,
+   -2440,
+   -2435,
+   -2431,
+   -2423,
+   -2418,
+   -2410,
+   -2404,
+   -2397,
+   -2394,
+   -2388,
+   -2381,
+   -2376,
+   -2370,
+   -2363,
+   -2358,
+   -2352,
+   -2345,
+   -2342,
+   -2337,
+   -2331,
+   -2326,
+   -2318,
+   -2314,
+   -2307,
+   -2299,
+   -2295,
+   -2291,
+   -2286,
+   -2279,
+   -2271,
+   -2267,
+   -2263,
+   -2258,
+   -2249,
+   -2244,
+   -2240,
+   -2236,
+   -2229,
+   -2224,
+   -2221,
+   -2214,
+   -2208,
+   -2205,
+   -2199,
+   -2192,
+   -2188,
+   -2182,
+   -2178,
+   -2173,
+   -2167,
+   -2165,
+   -2157,
+   -2152,
+   -2145,
+   -2141,
+   -2138,
+   -2132,
+   -2127,
+   -2122,
+   -2116,
+   -2112,
+   -2105,
+   -2101,
+   -2096,
+   -2094,
+   -2088,
+   -2082,
+   -2078,
+   -2075,
+   -2069,
+   -2063,
+   -2058,
+   -2053,
+   -2048,
+   -2044,
+   -2041,
+   -2035,
+   -2031,
+   -2027,
+   -2021,
+   -2017,
+   -2009,
+   -2006,
+   -2003,
+   -1998,
+   -1995,
+   -1991,
+   -1984,
+   -1978,
+   -1976,
+   -1973,
+   -1968,
+   -1963,
+   -1958,
+   -1956,
+   -1951,
+   -1945,
+   -1942,
+   -1936,
+   -1933,
+   -1929,
+   -1925,
+   -1919,
+   -1914,
+   -1910,
+   -1904,
+   -1900,
+   -1898,
+   -1893,
+   -1890,
+   -1885,
+   -1879,
+   -1877,
+   -1872,
+   -1867,
+   -1863,
+   -1860,
+   -1858,
+   -1851,
+   -1848,
+   -1846,
+   -1841,
+   -1837,
+   -1831,
+   -1827,
+   -1823,
+   -1819,
+   -1814,
+   -1811,
+   -1809,
+   -1806,
+   -1802,
+   -1797,
+   -1793,
+   -1788,
+   -1786,
+   -1782,
+   -1777,
+   -1774,
+   -1771,
+   -1768,
+   -1764,
+   -1760,
+   -1757,
+   -1752,
+   -1747,
+   -1742,
+   -1739,
+   -1736,
+   -1732,
+   -1728,
+   -1726,
+   -1724,
+   -1720,
+   -1716,
+   -1711,
+   -1705,
+   -1703,
+   -1700,
+   -1696,
+   -1693,
+   -1688,
+   -1688,
+   -1682,
+   -1677,
+   -1676,
+   -1670,
+   -1668,
+   -1666,
+   -1662,
+   -1657,
+   -1654,
+   -1652,
+   -1650,
+   -1646,
+   -1640,
+   -1637,
+   -1633,
+   -1631,
+   -1629,
+   -1625,
+   -1622,
+   -1618,
+   -1616,
+   -1612,
+   -1608,
+   -1603,
+   -1601,
+   -1600,
+   -1594,
+   -1589,
+   -1588,
+   -1585,
+   -1581,
+   -1579,
+   -1575,
+   -1570,
+   -1568,
+   -1566,
+   -1565,
+   -1560,
+   -1558,
+   -1553,
+   -1549,
+   -1547,
+   -1543,
+   -1541,
+   -1540,
+   -1538,
+   -1533,
+   -1530,
+   -1529,
+   -1524,
+   -1520,
+   -1517,
+   -1515,
+   -1510,
+   -1509,
+   -1506,
+   -1502,
+   -1499,
+   -1497,
+   -1494,
+   -1492,
+   -1486,
+   -1485,
+   -1483,
+   -1478,
+   0,
+};
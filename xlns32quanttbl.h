@@ -0,0 +1,1302 @@
+const unsigned int xlns32fp16logtbl[1024] = {
+0, //0
+11813, //1
+23614, //2
+35404, //3
+47182, //4
+58949, //5
+70704, //6
+82448, //7
+94181, //8
+105902, //9
+117612, //10
+129311, //11
+140998, //12
+152674, //13
+164339, //14
+175992, //15
+187635, //16
+199266, //17
+210886, //18
+222495, //19
+234092, //20
+245679, //21
+257255, //22
+268819, //23
+280372, //24
+291915, //25
+303446, //26
+314967, //27
+326476, //28
+337975, //29
+349462, //30
+360939, //31
+372405, //32
+383860, //33
+395304, //34
+406737, //35
+418160, //36
+429572, //37
+440973, //38
+452363, //39
+463743, //40
+475112, //41
+486470, //42
+497817, //43
+509154, //44
+520481, //45
+531796, //46
+543102, //47
+554396, //48
+565680, //49
+576954, //50
+588217, //51
+599470, //52
+610712, //53
+621944, //54
+633165, //55
+644376, //56
+655576, //57
+666767, //58
+677947, //59
+689116, //60
+700275, //61
+711424, //62
+722563, //63
+733691, //64
+744810, //65
+755918, //66
+767016, //67
+778103, //68
+789181, //69
+800248, //70
+811306, //71
+822353, //72
+833390, //73
+844417, //74
+855434, //75
+866441, //76
+877438, //77
+888425, //78
+899402, //79
+910369, //80
+921326, //81
+932274, //82
+943211, //83
+954138, //84
+965056, //85
+975964, //86
+986862, //87
+997750, //88
+1008628, //89
+1019497, //90
+1030356, //91
+1041205, //92
+1052044, //93
+1062874, //94
+1073694, //95
+1084505, //96
+1095305, //97
+1106096, //98
+1116878, //99
+1127650, //100
+1138412, //101
+1149165, //102
+1159908, //103
+1170642, //104
+1181366, //105
+1192080, //106
+1202786, //107
+1213481, //108
+1224168, //109
+1234844, //110
+1245512, //111
+1256170, //112
+1266819, //113
+1277458, //114
+1288088, //115
+1298708, //116
+1309320, //117
+1319922, //118
+1330514, //119
+1341098, //120
+1351672, //121
+1362237, //122
+1372793, //123
+1383340, //124
+1393877, //125
+1404405, //126
+1414924, //127
+1425434, //128
+1435935, //129
+1446427, //130
+1456909, //131
+1467383, //132
+1477847, //133
+1488303, //134
+1498749, //135
+1509187, //136
+1519615, //137
+1530035, //138
+1540445, //139
+1550847, //140
+1561239, //141
+1571623, //142
+1581998, //143
+1592364, //144
+1602721, //145
+1613069, //146
+1623408, //147
+1633739, //148
+1644061, //149
+1654374, //150
+1664678, //151
+1674973, //152
+1685260, //153
+1695538, //154
+1705807, //155
+1716067, //156
+1726319, //157
+1736562, //158
+1746796, //159
+1757022, //160
+1767239, //161
+1777448, //162
+1787648, //163
+1797839, //164
+1808022, //165
+1818196, //166
+1828362, //167
+1838519, //168
+1848667, //169
+1858807, //170
+1868939, //171
+1879062, //172
+1889177, //173
+1899283, //174
+1909381, //175
+1919470, //176
+1929551, //177
+1939624, //178
+1949688, //179
+1959744, //180
+1969791, //181
+1979831, //182
+1989861, //183
+1999884, //184
+2009898, //185
+2019904, //186
+2029902, //187
+2039891, //188
+2049872, //189
+2059845, //190
+2069810, //191
+2079767, //192
+2089715, //193
+2099655, //194
+2109587, //195
+2119511, //196
+2129427, //197
+2139335, //198
+2149234, //199
+2159126, //200
+2169009, //201
+2178884, //202
+2188752, //203
+2198611, //204
+2208462, //205
+2218305, //206
+2228141, //207
+2237968, //208
+2247787, //209
+2257598, //210
+2267402, //211
+2277197, //212
+2286984, //213
+2296764, //214
+2306536, //215
+2316299, //216
+2326055, //217
+2335803, //218
+2345544, //219
+2355276, //220
+2365000, //221
+2374717, //222
+2384426, //223
+2394127, //224
+2403821, //225
+2413506, //226
+2423184, //227
+2432854, //228
+2442517, //229
+2452172, //230
+2461819, //231
+2471458, //232
+2481090, //233
+2490714, //234
+2500330, //235
+2509939, //236
+2519540, //237
+2529133, //238
+2538719, //239
+2548298, //240
+2557868, //241
+2567432, //242
+2576987, //243
+2586535, //244
+2596076, //245
+2605609, //246
+2615134, //247
+2624652, //248
+2634163, //249
+2643666, //250
+2653162, //251
+2662650, //252
+2672131, //253
+2681604, //254
+2691070, //255
+2700529, //256
+2709980, //257
+2719424, //258
+2728860, //259
+2738289, //260
+2747711, //261
+2757125, //262
+2766532, //263
+2775932, //264
+2785324, //265
+2794710, //266
+2804088, //267
+2813458, //268
+2822822, //269
+2832178, //270
+2841527, //271
+2850868, //272
+2860203, //273
+2869530, //274
+2878850, //275
+2888163, //276
+2897469, //277
+2906768, //278
+2916059, //279
+2925344, //280
+2934621, //281
+2943891, //282
+2953154, //283
+2962410, //284
+2971659, //285
+2980901, //286
+2990136, //287
+2999364, //288
+3008584, //289
+3017798, //290
+3027005, //291
+3036204, //292
+3045397, //293
+3054583, //294
+3063762, //295
+3072933, //296
+3082098, //297
+3091256, //298
+3100407, //299
+3109551, //300
+3118689, //301
+3127819, //302
+3136942, //303
+3146059, //304
+3155168, //305
+3164271, //306
+3173367, //307
+3182456, //308
+3191539, //309
+3200614, //310
+3209683, //311
+3218745, //312
+3227800, //313
+3236848, //314
+3245890, //315
+3254925, //316
+3263953, //317
+3272974, //318
+3281989, //319
+3290997, //320
+3299998, //321
+3308993, //322
+3317981, //323
+3326962, //324
+3335937, //325
+3344905, //326
+3353866, //327
+3362820, //328
+3371768, //329
+3380710, //330
+3389645, //331
+3398573, //332
+3407495, //333
+3416410, //334
+3425318, //335
+3434220, //336
+3443115, //337
+3452004, //338
+3460887, //339
+3469763, //340
+3478632, //341
+3487495, //342
+3496351, //343
+3505201, //344
+3514044, //345
+3522881, //346
+3531712, //347
+3540536, //348
+3549354, //349
+3558165, //350
+3566970, //351
+3575768, //352
+3584560, //353
+3593346, //354
+3602125, //355
+3610898, //356
+3619664, //357
+3628424, //358
+3637178, //359
+3645926, //360
+3654667, //361
+3663402, //362
+3672131, //363
+3680853, //364
+3689569, //365
+3698279, //366
+3706982, //367
+3715679, //368
+3724370, //369
+3733055, //370
+3741734, //371
+3750406, //372
+3759072, //373
+3767732, //374
+3776386, //375
+3785033, //376
+3793674, //377
+3802310, //378
+3810939, //379
+3819562, //380
+3828178, //381
+3836789, //382
+3845393, //383
+3853992, //384
+3862584, //385
+3871170, //386
+3879750, //387
+3888324, //388
+3896892, //389
+3905454, //390
+3914010, //391
+3922560, //392
+3931103, //393
+3939641, //394
+3948173, //395
+3956698, //396
+3965218, //397
+3973732, //398
+3982240, //399
+3990741, //400
+3999237, //401
+4007727, //402
+4016211, //403
+4024689, //404
+4033161, //405
+4041627, //406
+4050087, //407
+4058541, //408
+4066989, //409
+4075432, //410
+4083868, //411
+4092299, //412
+4100724, //413
+4109143, //414
+4117556, //415
+4125963, //416
+4134364, //417
+4142760, //418
+4151150, //419
+4159533, //420
+4167912, //421
+4176284, //422
+4184650, //423
+4193011, //424
+4201366, //425
+4209715, //426
+4218059, //427
+4226397, //428
+4234729, //429
+4243055, //430
+4251375, //431
+4259690, //432
+4267999, //433
+4276303, //434
+4284600, //435
+4292892, //436
+4301179, //437
+4309459, //438
+4317734, //439
+4326004, //440
+4334267, //441
+4342526, //442
+4350778, //443
+4359025, //444
+4367266, //445
+4375502, //446
+4383732, //447
+4391956, //448
+4400175, //449
+4408388, //450
+4416596, //451
+4424798, //452
+4432994, //453
+4441185, //454
+4449371, //455
+4457551, //456
+4465725, //457
+4473894, //458
+4482057, //459
+4490215, //460
+4498368, //461
+4506515, //462
+4514656, //463
+4522792, //464
+4530922, //465
+4539047, //466
+4547167, //467
+4555281, //468
+4563390, //469
+4571493, //470
+4579591, //471
+4587683, //472
+4595770, //473
+4603852, //474
+4611928, //475
+4619999, //476
+4628064, //477
+4636124, //478
+4644179, //479
+4652228, //480
+4660272, //481
+4668311, //482
+4676344, //483
+4684372, //484
+4692395, //485
+4700412, //486
+4708425, //487
+4716431, //488
+4724433, //489
+4732429, //490
+4740420, //491
+4748405, //492
+4756386, //493
+4764361, //494
+4772331, //495
+4780295, //496
+4788255, //497
+4796209, //498
+4804158, //499
+4812101, //500
+4820040, //501
+4827973, //502
+4835901, //503
+4843824, //504
+4851742, //505
+4859654, //506
+4867562, //507
+4875464, //508
+4883361, //509
+4891253, //510
+4899140, //511
+4907021, //512
+4914898, //513
+4922769, //514
+4930635, //515
+4938496, //516
+4946352, //517
+4954203, //518
+4962049, //519
+4969890, //520
+4977726, //521
+4985556, //522
+4993382, //523
+5001202, //524
+5009018, //525
+5016828, //526
+5024633, //527
+5032434, //528
+5040229, //529
+5048019, //530
+5055805, //531
+5063585, //532
+5071360, //533
+5079130, //534
+5086896, //535
+5094656, //536
+5102411, //537
+5110162, //538
+5117907, //539
+5125648, //540
+5133383, //541
+5141114, //542
+5148839, //543
+5156560, //544
+5164276, //545
+5171987, //546
+5179693, //547
+5187394, //548
+5195090, //549
+5202781, //550
+5210467, //551
+5218149, //552
+5225825, //553
+5233497, //554
+5241164, //555
+5248826, //556
+5256483, //557
+5264136, //558
+5271783, //559
+5279426, //560
+5287064, //561
+5294697, //562
+5302325, //563
+5309949, //564
+5317567, //565
+5325181, //566
+5332790, //567
+5340394, //568
+5347994, //569
+5355589, //570
+5363179, //571
+5370764, //572
+5378344, //573
+5385920, //574
+5393491, //575
+5401057, //576
+5408619, //577
+5416175, //578
+5423728, //579
+5431275, //580
+5438818, //581
+5446356, //582
+5453889, //583
+5461417, //584
+5468941, //585
+5476461, //586
+5483975, //587
+5491485, //588
+5498990, //589
+5506491, //590
+5513987, //591
+5521478, //592
+5528965, //593
+5536447, //594
+5543924, //595
+5551397, //596
+5558865, //597
+5566329, //598
+5573788, //599
+5581242, //600
+5588692, //601
+5596137, //602
+5603578, //603
+5611014, //604
+5618445, //605
+5625872, //606
+5633295, //607
+5640713, //608
+5648126, //609
+5655535, //610
+5662939, //611
+5670339, //612
+5677734, //613
+5685124, //614
+5692511, //615
+5699892, //616
+5707269, //617
+5714642, //618
+5722010, //619
+5729374, //620
+5736733, //621
+5744088, //622
+5751438, //623
+5758784, //624
+5766125, //625
+5773462, //626
+5780794, //627
+5788123, //628
+5795446, //629
+5802765, //630
+5810080, //631
+5817390, //632
+5824696, //633
+5831998, //634
+5839295, //635
+5846587, //636
+5853876, //637
+5861160, //638
+5868439, //639
+5875714, //640
+5882985, //641
+5890251, //642
+5897513, //643
+5904771, //644
+5912024, //645
+5919273, //646
+5926518, //647
+5933758, //648
+5940994, //649
+5948226, //650
+5955453, //651
+5962677, //652
+5969895, //653
+5977110, //654
+5984320, //655
+5991526, //656
+5998727, //657
+6005924, //658
+6013117, //659
+6020306, //660
+6027491, //661
+6034671, //662
+6041847, //663
+6049018, //664
+6056186, //665
+6063349, //666
+6070508, //667
+6077663, //668
+6084813, //669
+6091959, //670
+6099102, //671
+6106239, //672
+6113373, //673
+6120502, //674
+6127628, //675
+6134749, //676
+6141866, //677
+6148978, //678
+6156087, //679
+6163191, //680
+6170291, //681
+6177387, //682
+6184479, //683
+6191567, //684
+6198650, //685
+6205730, //686
+6212805, //687
+6219876, //688
+6226943, //689
+6234006, //690
+6241064, //691
+6248119, //692
+6255170, //693
+6262216, //694
+6269258, //695
+6276297, //696
+6283331, //697
+6290361, //698
+6297387, //699
+6304409, //700
+6311426, //701
+6318440, //702
+6325450, //703
+6332455, //704
+6339457, //705
+6346454, //706
+6353448, //707
+6360437, //708
+6367423, //709
+6374404, //710
+6381381, //711
+6388355, //712
+6395324, //713
+6402289, //714
+6409251, //715
+6416208, //716
+6423161, //717
+6430111, //718
+6437056, //719
+6443997, //720
+6450935, //721
+6457868, //722
+6464797, //723
+6471723, //724
+6478644, //725
+6485562, //726
+6492475, //727
+6499385, //728
+6506291, //729
+6513192, //730
+6520090, //731
+6526984, //732
+6533874, //733
+6540760, //734
+6547642, //735
+6554520, //736
+6561395, //737
+6568265, //738
+6575132, //739
+6581994, //740
+6588853, //741
+6595708, //742
+6602559, //743
+6609406, //744
+6616249, //745
+6623088, //746
+6629924, //747
+6636755, //748
+6643583, //749
+6650407, //750
+6657227, //751
+6664043, //752
+6670856, //753
+6677664, //754
+6684469, //755
+6691270, //756
+6698067, //757
+6704860, //758
+6711650, //759
+6718435, //760
+6725217, //761
+6731995, //762
+6738769, //763
+6745540, //764
+6752307, //765
+6759069, //766
+6765829, //767
+6772584, //768
+6779336, //769
+6786083, //770
+6792827, //771
+6799568, //772
+6806304, //773
+6813037, //774
+6819766, //775
+6826491, //776
+6833213, //777
+6839931, //778
+6846645, //779
+6853355, //780
+6860062, //781
+6866765, //782
+6873464, //783
+6880160, //784
+6886852, //785
+6893540, //786
+6900224, //787
+6906905, //788
+6913582, //789
+6920255, //790
+6926925, //791
+6933591, //792
+6940254, //793
+6946912, //794
+6953567, //795
+6960219, //796
+6966867, //797
+6973511, //798
+6980151, //799
+6986788, //800
+6993421, //801
+7000051, //802
+7006676, //803
+7013299, //804
+7019917, //805
+7026532, //806
+7033144, //807
+7039752, //808
+7046356, //809
+7052956, //810
+7059553, //811
+7066147, //812
+7072737, //813
+7079323, //814
+7085906, //815
+7092485, //816
+7099060, //817
+7105632, //818
+7112200, //819
+7118765, //820
+7125326, //821
+7131884, //822
+7138438, //823
+7144989, //824
+7151536, //825
+7158079, //826
+7164619, //827
+7171156, //828
+7177689, //829
+7184218, //830
+7190744, //831
+7197266, //832
+7203785, //833
+7210300, //834
+7216812, //835
+7223321, //836
+7229825, //837
+7236327, //838
+7242824, //839
+7249319, //840
+7255810, //841
+7262297, //842
+7268781, //843
+7275261, //844
+7281738, //845
+7288212, //846
+7294682, //847
+7301148, //848
+7307612, //849
+7314071, //850
+7320527, //851
+7326980, //852
+7333430, //853
+7339876, //854
+7346318, //855
+7352757, //856
+7359193, //857
+7365625, //858
+7372054, //859
+7378479, //860
+7384901, //861
+7391320, //862
+7397735, //863
+7404147, //864
+7410555, //865
+7416960, //866
+7423361, //867
+7429760, //868
+7436155, //869
+7442546, //870
+7448934, //871
+7455319, //872
+7461700, //873
+7468078, //874
+7474453, //875
+7480824, //876
+7487192, //877
+7493556, //878
+7499918, //879
+7506275, //880
+7512630, //881
+7518981, //882
+7525329, //883
+7531674, //884
+7538015, //885
+7544353, //886
+7550687, //887
+7557019, //888
+7563346, //889
+7569671, //890
+7575992, //891
+7582310, //892
+7588625, //893
+7594937, //894
+7601245, //895
+7607550, //896
+7613851, //897
+7620150, //898
+7626445, //899
+7632736, //900
+7639025, //901
+7645310, //902
+7651592, //903
+7657871, //904
+7664146, //905
+7670418, //906
+7676687, //907
+7682953, //908
+7689216, //909
+7695475, //910
+7701731, //911
+7707984, //912
+7714233, //913
+7720479, //914
+7726722, //915
+7732962, //916
+7739199, //917
+7745432, //918
+7751663, //919
+7757890, //920
+7764113, //921
+7770334, //922
+7776551, //923
+7782766, //924
+7788977, //925
+7795185, //926
+7801389, //927
+7807591, //928
+7813789, //929
+7819984, //930
+7826176, //931
+7832365, //932
+7838551, //933
+7844733, //934
+7850912, //935
+7857089, //936
+7863262, //937
+7869431, //938
+7875598, //939
+7881762, //940
+7887922, //941
+7894079, //942
+7900234, //943
+7906385, //944
+7912533, //945
+7918677, //946
+7924819, //947
+7930958, //948
+7937093, //949
+7943226, //950
+7949355, //951
+7955481, //952
+7961604, //953
+7967724, //954
+7973841, //955
+7979955, //956
+7986065, //957
+7992173, //958
+7998277, //959
+8004379, //960
+8010477, //961
+8016572, //962
+8022665, //963
+8028754, //964
+8034840, //965
+8040923, //966
+8047003, //967
+8053080, //968
+8059154, //969
+8065225, //970
+8071292, //971
+8077357, //972
+8083419, //973
+8089478, //974
+8095533, //975
+8101586, //976
+8107635, //977
+8113682, //978
+8119725, //979
+8125766, //980
+8131804, //981
+8137838, //982
+8143870, //983
+8149898, //984
+8155924, //985
+8161946, //986
+8167966, //987
+8173982, //988
+8179996, //989
+8186006, //990
+8192014, //991
+8198018, //992
+8204020, //993
+8210018, //994
+8216014, //995
+8222007, //996
+8227996, //997
+8233983, //998
+8239967, //999
+8245948, //1000
+8251926, //1001
+8257901, //1002
+8263873, //1003
+8269842, //1004
+8275808, //1005
+8281771, //1006
+8287731, //1007
+8293688, //1008
+8299643, //1009
+8305594, //1010
+8311543, //1011
+8317488, //1012
+8323431, //1013
+8329370, //1014
+8335307, //1015
+8341241, //1016
+8347172, //1017
+8353100, //1018
+8359025, //1019
+8364948, //1020
+8370867, //1021
+8376784, //1022
+8382697 //1023
+};
+const unsigned int xlns32q8tbl[256] = {
+0x00000000, //0
+0x40000000, //1
+0x40800000, //2
+0x40cae00d, //3
+0x41000000, //4
+0x412934f1, //5
+0x414ae00d, //6
+0x41675768, //7
+0x41800000, //8
+0x4195c01a, //9
+0x41a934f1, //10
+0x41bacea8, //11
+0x41cae00d, //12
+0x41d9a802, //13
+0x41e75768, //14
+0x41f414fe, //15
+0x42000000, //16
+0x420b31fb, //17
+0x4215c01a, //18
+0x421fbc17, //19
+0x422934f1, //20
+0x42323775, //21
+0x423acea8, //22
+0x42430414, //23
+0x424ae00d, //24
+0x425269e1, //25
+0x4259a802, //26
+0x4260a027, //27
+0x42675768, //28
+0x426dd252, //29
+0x427414fe, //30
+0x427a231b, //31
+0x42800000, //32
+0x4285aeb5, //33
+0x428b31fb, //34
+0x42908c59, //35
+0x4295c01a, //36
+0x429acf5e, //37
+0x429fbc17, //38
+0x42a4880f, //39
+0x42a934f1, //40
+0x42adc444, //41
+0x42b23775, //42
+0x42b68fd8, //43
+0x42bacea8, //44
+0x42bef50b, //45
+0x42c30414, //46
+0x42c6fcc4, //47
+0x42cae00d, //48
+0x42ceaed0, //49
+0x42d269e1, //50
+0x42d61209, //51
+0x42d9a802, //52
+0x42dd2c7f, //53
+0x42e0a027, //54
+0x42e40398, //55
+0x42e75768, //56
+0x42ea9c24, //57
+0x42edd252, //58
+0x42f0fa73, //59
+0x42f414fe, //60
+0x42f72267, //61
+0x42fa231b, //62
+0x42fd1782, //63
+0x43000000, //64
+0x4302dcf3, //65
+0x4305aeb5, //66
+0x4308759c, //67
+0x430b31fb, //68
+0x430de421, //69
+0x43108c59, //70
+0x43132aea, //71
+0x4315c01a, //72
+0x43184c2c, //73
+0x431acf5e, //74
+0x431d49ee, //75
+0x431fbc17, //76
+0x43222610, //77
+0x4324880f, //78
+0x4326e24a, //79
+0x432934f1, //80
+0x432b8034, //81
+0x432dc444, //82
+0x4330014b, //83
+0x43323775, //84
+0x433466ec, //85
+0x43368fd8, //86
+0x4338b25f, //87
+0x433acea8, //88
+0x433ce4d5, //89
+0x433ef50b, //90
+0x4340ff6a, //91
+0x43430414, //92
+0x43450328, //93
+0x4346fcc4, //94
+0x4348f107, //95
+0x434ae00d, //96
+0x434cc9f2, //97
+0x434eaed0, //98
+0x43508ec2, //99
+0x435269e1, //100
+0x43544046, //101
+0x43561209, //102
+0x4357df40, //103
+0x4359a802, //104
+0x435b6c66, //105
+0x435d2c7f, //106
+0x435ee864, //107
+0x4360a027, //108
+0x436253dd, //109
+0x43640398, //110
+0x4365af6b, //111
+0x43675768, //112
+0x4368fba0, //113
+0x436a9c24, //114
+0x436c3905, //115
+0x436dd252, //116
+0x436f681c, //117
+0x4370fa73, //118
+0x43728963, //119
+0x437414fe, //120
+0x43759d50, //121
+0x43772267, //122
+0x4378a451, //123
+0x437a231b, //124
+0x437b9ed2, //125
+0x437d1782, //126
+0x437e8d38, //127
+0xc3800000, //-128
+0xc37e8d38, //-127
+0xc37d1782, //-126
+0xc37b9ed2, //-125
+0xc37a231b, //-124
+0xc378a451, //-123
+0xc3772267, //-122
+0xc3759d50, //-121
+0xc37414fe, //-120
+0xc3728963, //-119
+0xc370fa73, //-118
+0xc36f681c, //-117
+0xc36dd252, //-116
+0xc36c3905, //-115
+0xc36a9c24, //-114
+0xc368fba0, //-113
+0xc3675768, //-112
+0xc365af6b, //-111
+0xc3640398, //-110
+0xc36253dd, //-109
+0xc360a027, //-108
+0xc35ee864, //-107
+0xc35d2c7f, //-106
+0xc35b6c66, //-105
+0xc359a802, //-104
+0xc357df40, //-103
+0xc3561209, //-102
+0xc3544046, //-101
+0xc35269e1, //-100
+0xc3508ec2, //-99
+0xc34eaed0, //-98
+0xc34cc9f2, //-97
+0xc34ae00d, //-96
+0xc348f107, //-95
+0xc346fcc4, //-94
+0xc3450328, //-93
+0xc3430414, //-92
+0xc340ff6a, //-91
+0xc33ef50b, //-90
+0xc33ce4d5, //-89
+0xc33acea8, //-88
+0xc338b25f, //-87
+0xc3368fd8, //-86
+0xc33466ec, //-85
+0xc3323775, //-84
+0xc330014b, //-83
+0xc32dc444, //-82
+0xc32b8034, //-81
+0xc32934f1, //-80
+0xc326e24a, //-79
+0xc324880f, //-78
+0xc3222610, //-77
+0xc31fbc17, //-76
+0xc31d49ee, //-75
+0xc31acf5e, //-74
+0xc3184c2c, //-73
+0xc315c01a, //-72
+0xc3132aea, //-71
+0xc3108c59, //-70
+0xc30de421, //-69
+0xc30b31fb, //-68
+0xc308759c, //-67
+0xc305aeb5, //-66
+0xc302dcf3, //-65
+0xc3000000, //-64
+0xc2fd1782, //-63
+0xc2fa231b, //-62
+0xc2f72267, //-61
+0xc2f414fe, //-60
+0xc2f0fa73, //-59
+0xc2edd252, //-58
+0xc2ea9c24, //-57
+0xc2e75768, //-56
+0xc2e40398, //-55
+0xc2e0a027, //-54
+0xc2dd2c7f, //-53
+0xc2d9a802, //-52
+0xc2d61209, //-51
+0xc2d269e1, //-50
+0xc2ceaed0, //-49
+0xc2cae00d, //-48
+0xc2c6fcc4, //-47
+0xc2c30414, //-46
+0xc2bef50b, //-45
+0xc2bacea8, //-44
+0xc2b68fd8, //-43
+0xc2b23775, //-42
+0xc2adc444, //-41
+0xc2a934f1, //-40
+0xc2a4880f, //-39
+0xc29fbc17, //-38
+0xc29acf5e, //-37
+0xc295c01a, //-36
+0xc2908c59, //-35
+0xc28b31fb, //-34
+0xc285aeb5, //-33
+0xc2800000, //-32
+0xc27a231b, //-31
+0xc27414fe, //-30
+0xc26dd252, //-29
+0xc2675768, //-28
+0xc260a027, //-27
+0xc259a802, //-26
+0xc25269e1, //-25
+0xc24ae00d, //-24
+0xc2430414, //-23
+0xc23acea8, //-22
+0xc2323775, //-21
+0xc22934f1, //-20
+0xc21fbc17, //-19
+0xc215c01a, //-18
+0xc20b31fb, //-17
+0xc2000000, //-16
+0xc1f414fe, //-15
+0xc1e75768, //-14
+0xc1d9a802, //-13
+0xc1cae00d, //-12
+0xc1bacea8, //-11
+0xc1a934f1, //-10
+0xc195c01a, //-9
+0xc1800000, //-8
+0xc1675768, //-7
+0xc14ae00d, //-6
+0xc12934f1, //-5
+0xc1000000, //-4
+0xc0cae00d, //-3
+0xc0800000, //-2
+0xc0000000 //-1
+};
+const unsigned int xlns32q4tbl[16] = {
+0xc1800000, //-8
+0xc1675768, //-7
+0xc14ae00d, //-6
+0xc12934f1, //-5
+0xc1000000, //-4
+0xc0cae00d, //-3
+0xc0800000, //-2
+0xc0000000, //-1
+0x00000000, //0
+0x40000000, //1
+0x40800000, //2
+0x40cae00d, //3
+0x41000000, //4
+0x412934f1, //5
+0x414ae00d, //6
+0x41675768 //7
+};
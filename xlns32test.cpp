@@ -278,8 +278,7 @@ void test4xlns32_float(int iter)
 	int ix,iy,count;
 	xlns32_float x1,y1,x,y,xnew,ynew,mone,two,four,xscale,yscale;
 
-	xlns32_hits=0;
-	xlns32_misses=0;
+	xlns32_cache_reset_stats();
 	mone = -1.0;
 	two = 2.0;
 	four = 4.0;
@@ -311,7 +310,7 @@ void test4xlns32_float(int iter)
 		printf("\n");
 	}
 	time(&t2);
-	printf("hits=%ld misses=%ld\n",xlns32_hits,xlns32_misses);
+	printf("hits=%llu misses=%llu\n",xlns32_cache_stats().hits,xlns32_cache_stats().misses);
 	printf("testxlns32_float new %d sec ",((int)(t2-t1)));
 	scanf("%c",&ch);
 }
@@ -0,0 +1,341 @@
+// 64-bit XLNS for C++
+// a wider companion of xlns32.cpp: an accumulator for xlns32 sums and dot
+// products (as xlns32lpvip.cpp is for xlns16), or a replacement for double
+//    +------+--------------------+-----------------------+
+//    | sign | int(log2), 11 bits | frac(log2), 52 bits   |
+//    +------+--------------------+-----------------------+
+//    the int(log2) is offset (logsignmask XORed) as in xlns16 and xlns32, so
+//    the magnitudes run from 2^-1024 to 2^1024, about the range of IEEE 754
+//    double, in relative steps of 2^-52*ln(2), a little finer than its ulp
+//    there is an exact representation of 0.0, but no subnormals or NaNs
+// sb and db do not use libm (or big tables): 2^-d is a 257-entry table of
+//    2^(-j/256) times a short exp polynomial, and log2(1 +- 2^-d) a 256-entry
+//    table of log2(1+j/256) plus a short log polynomial (xlns64gentbl.cpp
+//    makes xlns64tbl.h), all carried as hi+lo doubles.  1 - 2^-d keeps its
+//    relative accuracy near the singularity, where it comes from the exp
+//    polynomial alone, so xlns64_add is within about half a unit in the last
+//    place (2^-52 in the log) of the exact result everywhere.  fp2xlns64 and
+//    xlns642fp use the same tables and round to nearest.
+// there are no counters or z profile for xlns64, and no xlns64_ideal.
+// included after xlns32.cpp, this also gives xlns322xlns64/xlns642xlns32 and
+//    xlns32_sum_xlns64/xlns32_vec_dot_xlns64, which add the xlns32 values or
+//    products in xlns64 and round to xlns32 once, at the end.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned long long xlns64;
+typedef signed long long xlns64_signed;
+#define xlns64_zero          0x0000000000000000ULL
+#define xlns64_scale         0x0010000000000000ULL
+#define xlns64_logmask       0x7fffffffffffffffULL
+#define xlns64_signmask      0x8000000000000000ULL
+#define xlns64_logsignmask   0x4000000000000000ULL
+#define xlns64_canonmask     0x8000000000000000ULL
+#define xlns64_sqrtmask      0x2000000000000000ULL
+#define xlns64_esszer        0x0360000000000000ULL      // 54.0: sb and db round to 0 beyond
+#define xlns64_canonshift    63
+#define xlns64_F             52
+
+// Useful constant values (as for xlns32: log2 scaled by 2^52, XORed with logsignmask)
+#define xlns64_one          0x4000000000000000ULL
+#define xlns64_neg_one      0xC000000000000000ULL
+#define xlns64_two          0x4010000000000000ULL
+#define xlns64_neg_two      0xC010000000000000ULL
+#define xlns64_half         0x3FF0000000000000ULL
+#define xlns64_neg_half     0xBFF0000000000000ULL
+#define xlns64_pos_inf      0x7FFFFFFFFFFFFFFFULL
+#define xlns64_neg_inf      0xFFFFFFFFFFFFFFFFULL
+
+// Basic unary operations (macros for efficiency)
+#define xlns64_sign(x)  ((x) & xlns64_signmask)
+#define xlns64_neg(x)   ((x) ^ xlns64_signmask)
+#define xlns64_abs(x)   ((x) & xlns64_logmask)
+#define xlns64_recip(x) (xlns64_sign(x)|xlns64_abs((~x)+1))
+#define xlns64_sqrt(x)   (xlns64_abs(((xlns64_signed)((x)<<1))/4)^xlns64_sqrtmask)
+#define xlns64_canon(x) ((x)^(-((x)>>xlns64_canonshift)|xlns64_signmask))
+
+// Square: x^2 (efficient in LNS: double the log)
+#define xlns64_square(x) xlns64_mul((x), (x))
+
+inline xlns64 xlns64_overflow(xlns64 xlns64_x, xlns64 xlns64_y, xlns64 xlns64_temp)
+{
+	if (xlns64_logsignmask&xlns64_temp)
+		return (xlns64_signmask&(xlns64_x^xlns64_y));
+	else
+		return (xlns64_signmask&(xlns64_x^xlns64_y))| xlns64_logmask;
+}
+
+inline xlns64 xlns64_mul(xlns64 x, xlns64 y)
+{
+   xlns64 xlns64_temp;
+   xlns64_temp=(xlns64_logmask&(x))+(xlns64_logmask&(y))-xlns64_logsignmask;
+   return  (xlns64_signmask&(xlns64_temp)) ? xlns64_overflow(x,y,xlns64_temp)
+                                       :(xlns64_signmask&(x^y))|xlns64_temp;
+}
+
+inline xlns64 xlns64_div(xlns64 x, xlns64 y)
+{
+   xlns64 xlns64_temp;
+   xlns64_temp=(xlns64_logmask&(x))-(xlns64_logmask&(y))+xlns64_logsignmask;
+   return  (xlns64_signmask&(xlns64_temp)) ? xlns64_overflow(x,y,xlns64_temp)
+                                       :(xlns64_signmask&(x^y))|xlns64_temp;
+}
+
+// sb and db without libm
+
+#include "xlns64tbl.h"
+
+#define xlns64_ln2     0.69314718055994530942
+#define xlns64_ln2hi   0.69140625                  // 177/256
+#define xlns64_ln2lo   0.00174093055994530942      // ln(2) - 177/256
+#define xlns64_invln2  1.44269504088896340736
+
+// 2^k as a double, for -1022 <= k <= 1023 (0.0 for k = -1023)
+inline double xlns64_pow2(int k)
+{
+    unsigned long long b = (unsigned long long)(k + 1023) << 52;
+    double d;
+    memcpy(&d, &b, sizeof(d));
+    return d;
+}
+
+// 2^(-f/2^52) = t + m + rest for 0 <= f <= 2^52, with t = 2^(-j/256) to 20 bits
+// and m = -t*(f's next 24 bits)*177/256 exact (all 44 bits when t = 1), so that
+// 1 - t and t + m lose nothing to rounding; rest is the small remainder
+inline void xlns64_exp2neg(xlns64 f, double &t, double &m, double &rest)
+{
+    int j = (int)(f >> (xlns64_F-8));
+    xlns64 rem = f & ((1ULL<<(xlns64_F-8))-1);
+    xlns64 remhi = j ? rem & ~((1ULL<<(xlns64_F-32))-1) : rem;
+    double rh = (double)remhi * (xlns64_ln2hi/xlns64_scale);               // exact
+    double rl = (double)(rem - remhi) * (xlns64_ln2/xlns64_scale) + (double)remhi * (xlns64_ln2lo/xlns64_scale);
+    double r = rh + rl;
+    double w = r*(1./2 - r*(1./6 - r*(1./24 - r*(1./120 - r*(1./720)))));
+    double el = r*w - rl;                                                 // exp(-r) - 1 = -rh + el
+    t = xlns64_exphi[j];
+    m = -t*rh;                                                            // exact
+    rest = t*el + (xlns64_explo[j] + xlns64_explo[j]*(el - rh));
+}
+
+// 2^52*log2(qh + ql) rounded to nearest, for a positive normal qh and |ql| < ulp(qh)
+inline xlns64_signed xlns64_log2hl(double qh, double ql)
+{
+    unsigned long long bits, mbits, hbits;
+    double m, mh;
+    memcpy(&bits, &qh, sizeof(qh));
+    int e = (int)(bits>>52) - 1023;
+    int j = (int)((bits>>44)&255);
+    mbits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    hbits = (bits & 0x000ff00000000000ULL) | 0x3ff0000000000000ULL;
+    memcpy(&m, &mbits, sizeof(m));
+    memcpy(&mh, &hbits, sizeof(mh));
+    double r = ((m - mh) + ql*xlns64_pow2(-e))*xlns64_recip[j];
+    double l1 = r*(1 - r*(1./2 - r*(1./3 - r*(1./4 - r*(1./5 - r*(1./6))))))*xlns64_invln2;
+    double h = xlns64_loghi[j]*xlns64_scale;                 // exact
+    xlns64_signed ih = (xlns64_signed)h;
+    double fr = (h - ih) + (xlns64_loglo[j] + l1)*xlns64_scale + .5;
+    xlns64_signed il = (xlns64_signed)fr;
+    il -= (il > fr);                                          // floor
+    return (xlns64_signed)e*(xlns64_signed)xlns64_scale + ih + il;
+}
+
+// 2^52*log2(1 + 2^-d) (sb) or 2^52*log2(1 - 2^-d) (db), d = negz/2^52,
+// for 0 <= negz < xlns64_esszer (0 < negz for db), rounded to nearest
+inline xlns64_signed xlns64_sbdb(xlns64_signed negz, int usedb)
+{
+    double t, m, rest, s, sl, u, bb, ql;
+    xlns64_exp2neg(negz & (xlns64_scale-1), t, m, rest);
+    double p = xlns64_pow2(-(int)(negz >> xlns64_F));
+    t *= p;
+    m *= p;
+    rest *= p;
+    if (usedb)
+    {
+        t = -t;
+        m = -m;
+        rest = -rest;
+    }
+    s = 1.0 + t;                           // 1 +- 2^-d = s + sl, summed exactly
+    sl = ((1.0 - s) + t) + rest;           // apart from rest
+    u = s + m;
+    bb = u - s;
+    sl += (s - (u - bb)) + (m - bb);
+    s = u + sl;
+    bb = s - u;
+    ql = (u - (s - bb)) + (sl - bb);
+    return xlns64_log2hl(s, ql);
+}
+
+inline xlns64_signed xlns64_sb(xlns64_signed negz) { return xlns64_sbdb(negz, 0); }
+inline xlns64_signed xlns64_db(xlns64_signed negz) { return xlns64_sbdb(negz, 1); }
+
+inline xlns64 xlns64_add(xlns64 x, xlns64 y)
+{
+    xlns64 minxyl, maxxy, xl, yl, usedb;
+    xlns64_signed z, adjustez;
+    xl = x & xlns64_logmask;
+    yl = y & xlns64_logmask;
+    minxyl = (yl>xl) ? xl : yl;
+    maxxy  = (xl>yl) ? x  : y;
+    z = minxyl - (maxxy&xlns64_logmask);
+    usedb = xlns64_signmask&(x^y);
+    if ((z==0) && usedb)
+        return xlns64_zero;
+    adjustez = (z < -(xlns64_signed)xlns64_esszer) ? 0 : xlns64_sbdb(-z, usedb != 0);
+    return xlns64_mul(maxxy, xlns64_logsignmask + adjustez);
+}
+
+#define xlns64_sub(x,y) xlns64_add(x,xlns64_neg(y))
+
+// Conversion to and from double (rounded to nearest)
+// magnitudes under 2^-1024 (most double subnormals) become zero, infinities
+// and NaNs saturate to xlns64_pos_inf/neg_inf (about DBL_MAX); xlns642fp gives
+// subnormals for the magnitudes under 2^-1022
+
+xlns64 fp2xlns64(double x)
+{
+	unsigned long long bits;
+	int adj = 0;
+	memcpy(&bits, &x, sizeof(x));
+	xlns64 s = bits & xlns64_signmask;
+	bits &= xlns64_logmask;
+	if ((bits >> 52) == 0x7ff)
+		return s | xlns64_logmask;
+	if (bits == 0)
+		return xlns64_zero;
+	if ((bits >> 52) == 0)                  // subnormal: scale by 2^64
+	{
+		double d;
+		memcpy(&d, &bits, sizeof(d));
+		d *= xlns64_pow2(64);
+		memcpy(&bits, &d, sizeof(d));
+		adj = 64;
+	}
+	double q;
+	memcpy(&q, &bits, sizeof(q));
+	xlns64_signed l = xlns64_log2hl(q, 0.0) - (xlns64_signed)adj*(xlns64_signed)xlns64_scale
+	                  + (xlns64_signed)xlns64_logsignmask;
+	return (l <= 0) ? xlns64_zero : s | (xlns64)l;
+}
+
+double xlns642fp(xlns64 x)
+{
+	if (xlns64_abs(x) == xlns64_zero)
+		return 0.0;
+	xlns64_signed l = (xlns64_signed)(xlns64_abs(x) - xlns64_logsignmask);
+	int n = (int)(l >> xlns64_F) + 1;        // 2^(l/2^52) = 2^n * 2^(-(2^52 - frac)/2^52)
+	double t, m, rest, v;
+	xlns64_exp2neg(xlns64_scale - (l & (xlns64_scale-1)), t, m, rest);
+	v = t + (m + rest);
+	if (n > 1023)
+		v = v*xlns64_pow2(1023)*2.0;
+	else if (n < -1022)
+		v = v*xlns64_pow2(n + 600)*xlns64_pow2(-600);
+	else
+		v = v*xlns64_pow2(n);
+	return xlns64_sign(x) ? -v : v;
+}
+
+// Comparison and utility functions
+
+inline int xlns64_is_zero(xlns64 x) {
+    return xlns64_abs(x) == xlns64_zero;
+}
+
+inline int xlns64_gt(xlns64 a, xlns64 b) {
+    return xlns64_canon(a) > xlns64_canon(b);
+}
+
+inline int xlns64_lt(xlns64 a, xlns64 b) {
+    return xlns64_canon(a) < xlns64_canon(b);
+}
+
+// Sum of array elements: result = Σ a[i]
+inline xlns64 xlns64_sum(const xlns64 *a, size_t n) {
+    if (n == 0) return xlns64_zero;
+    xlns64 sum = a[0];
+    for (size_t i = 1; i < n; i++)
+        sum = xlns64_add(sum, a[i]);
+    return sum;
+}
+
+// Vector dot product: result = Σ(a[i] * b[i])
+inline xlns64 xlns64_vec_dot(const xlns64 *a, const xlns64 *b, size_t n) {
+    if (n == 0) return xlns64_zero;
+    xlns64 sum = xlns64_mul(a[0], b[0]);
+    for (size_t i = 1; i < n; i++)
+        sum = xlns64_add(sum, xlns64_mul(a[i], b[i]));
+    return sum;
+}
+
+// xlns32 accumulated in xlns64 (include xlns32.cpp first)
+// widening is exact; narrowing rounds the log to nearest, flushing magnitudes
+// under the xlns32 range to zero and saturating those above it.  The products
+// are xlns32_mul's, as in xlns32_vec_dot; only the additions are wider.
+#ifdef xlns32_zero
+
+inline xlns64 xlns322xlns64(xlns32 x) {
+    if (xlns32_abs(x) == xlns32_zero)
+        return xlns64_zero;
+    return ((xlns64)xlns32_sign(x) << 32) | (((xlns64)xlns32_abs(x) << 29) + 0x3800000000000000ULL);
+}
+
+inline xlns32 xlns642xlns32(xlns64 x) {
+    xlns64_signed a = (xlns64_signed)(xlns64_abs(x) - 0x3800000000000000ULL + (1ULL << 28)) >> 29;
+    if (a <= 0)
+        return xlns32_zero;
+    return (xlns32)(xlns64_sign(x) >> 32) | (xlns32)(a < xlns32_logmask ? a : xlns32_logmask);
+}
+
+// Sum of array elements: result = Σ a[i], rounded to xlns32 once
+inline xlns32 xlns32_sum_xlns64(const xlns32 *a, size_t n) {
+    if (n == 0) return xlns32_zero;
+    xlns64 sum = xlns322xlns64(a[0]);
+    for (size_t i = 1; i < n; i++)
+        sum = xlns64_add(sum, xlns322xlns64(a[i]));
+    return xlns642xlns32(sum);
+}
+
+// Vector dot product: result = Σ(a[i] * b[i]), rounded to xlns32 once
+inline xlns32 xlns32_vec_dot_xlns64(const xlns32 *a, const xlns32 *b, size_t n) {
+    if (n == 0) return xlns32_zero;
+    xlns64 sum = xlns322xlns64(xlns32_mul(a[0], b[0]));
+    for (size_t i = 1; i < n; i++)
+        sum = xlns64_add(sum, xlns322xlns64(xlns32_mul(a[i], b[i])));
+    return xlns642xlns32(sum);
+}
+
+#endif
+
+#include <iostream>
+
+// xlns64_float: xlns64 with the arithmetic operators, mixing with double
+class xlns64_float {
+    xlns64 x;
+    static xlns64_float xlns64_float_(xlns64 v) { xlns64_float r; r.x = v; return r; }
+ public:
+    xlns64_float() : x(xlns64_zero) {}
+    xlns64_float(double d) : x(fp2xlns64(d)) {}
+    friend xlns64 xlns64_internal(xlns64_float y) { return y.x; }
+    friend double xlns64_2double(xlns64_float y) { return xlns642fp(y.x); }
+    friend xlns64_float operator+(xlns64_float a, xlns64_float b) { return xlns64_float_(xlns64_add(a.x, b.x)); }
+    friend xlns64_float operator-(xlns64_float a, xlns64_float b) { return xlns64_float_(xlns64_sub(a.x, b.x)); }
+    friend xlns64_float operator*(xlns64_float a, xlns64_float b) { return xlns64_float_(xlns64_mul(a.x, b.x)); }
+    friend xlns64_float operator/(xlns64_float a, xlns64_float b) { return xlns64_float_(xlns64_div(a.x, b.x)); }
+    friend xlns64_float operator-(xlns64_float a) { return xlns64_float_(xlns64_neg(a.x)); }
+    xlns64_float &operator+=(xlns64_float b) { x = xlns64_add(x, b.x); return *this; }
+    xlns64_float &operator-=(xlns64_float b) { x = xlns64_sub(x, b.x); return *this; }
+    xlns64_float &operator*=(xlns64_float b) { x = xlns64_mul(x, b.x); return *this; }
+    xlns64_float &operator/=(xlns64_float b) { x = xlns64_div(x, b.x); return *this; }
+    friend xlns64_float abs(xlns64_float a) { return xlns64_float_(xlns64_abs(a.x)); }
+    friend xlns64_float sqrt(xlns64_float a) { return xlns64_float_(xlns64_sqrt(a.x)); }
+    friend int operator==(xlns64_float a, xlns64_float b) { return a.x == b.x; }
+    friend int operator!=(xlns64_float a, xlns64_float b) { return a.x != b.x; }
+    friend int operator<(xlns64_float a, xlns64_float b) { return xlns64_canon(a.x) < xlns64_canon(b.x); }
+    friend int operator>(xlns64_float a, xlns64_float b) { return xlns64_canon(a.x) > xlns64_canon(b.x); }
+    friend int operator<=(xlns64_float a, xlns64_float b) { return xlns64_canon(a.x) <= xlns64_canon(b.x); }
+    friend int operator>=(xlns64_float a, xlns64_float b) { return xlns64_canon(a.x) >= xlns64_canon(b.x); }
+    friend std::ostream &operator<<(std::ostream &s, xlns64_float a) { return s << xlns642fp(a.x); }
+};
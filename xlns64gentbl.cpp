@@ -0,0 +1,50 @@
+//generates xlns64tbl.h, the tables for the libm-free sb, db and conversions in
+//xlns64.cpp: 2^(-j/256) (j = 0..256) split into a hi double of 20 bits (so its
+//products with 32-bit numbers are exact) and a lo double, log2(1+j/256) split
+//into hi+lo doubles, and 1/(1+j/256); computed in long double and printed with
+//17 digits (exact)
+//   g++ xlns64gentbl.cpp -o xlns64gentbl -lm && ./xlns64gentbl
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+int main()
+{
+	FILE * f;
+	int j;
+	long double t[257], l[256];
+	double hi;
+	for (j=0; j<257; j++)
+		t[j] = exp2l(-j/256.0L);
+	for (j=0; j<256; j++)
+		l[j] = log2l(1.0L + j/256.0L);
+	f = fopen("xlns64tbl.h","w");
+	fprintf(f,"const double xlns64_exphi[257] = {\n");
+	for (j=0; j<257; j++)
+		fprintf(f,"%.17g, //%d\n",(double)(floorl(t[j]*1048576.0L+0.5L)/1048576.0L),j);
+	fprintf(f,"};\n");
+	fprintf(f,"const double xlns64_explo[257] = {\n");
+	for (j=0; j<257; j++)
+	{
+		hi = (double)(floorl(t[j]*1048576.0L+0.5L)/1048576.0L);
+		fprintf(f,"%.17g, //%d\n",(double)(t[j]-hi),j);
+	}
+	fprintf(f,"};\n");
+	fprintf(f,"const double xlns64_loghi[256] = {\n");
+	for (j=0; j<256; j++)
+		fprintf(f,"%.17g, //%d\n",(double)l[j],j);
+	fprintf(f,"};\n");
+	fprintf(f,"const double xlns64_loglo[256] = {\n");
+	for (j=0; j<256; j++)
+	{
+		hi = (double)l[j];
+		fprintf(f,"%.17g, //%d\n",(double)(l[j]-hi),j);
+	}
+	fprintf(f,"};\n");
+	fprintf(f,"const double xlns64_recip[256] = {\n");
+	for (j=0; j<256; j++)
+		fprintf(f,"%.17g, //%d\n",(double)(1.0L/(1.0L + j/256.0L)),j);
+	fprintf(f,"};\n");
+	fclose(f);
+	return 1;
+}
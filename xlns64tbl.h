@@ -0,0 +1,1292 @@
+const double xlns64_exphi[257] = {
+1, //0
+0.99729633331298828, //1
+0.99459934234619141, //2
+0.99190998077392578, //3
+0.98922824859619141, //4
+0.98655319213867188, //5
+0.98388576507568359, //6
+0.98122501373291016, //7
+0.97857189178466797, //8
+0.97592639923095703, //9
+0.97328758239746094, //10
+0.97065544128417969, //11
+0.96803092956542969, //12
+0.96541309356689453, //13
+0.96280288696289062, //14
+0.96019935607910156, //15
+0.95760345458984375, //16
+0.95501422882080078, //17
+0.95243167877197266, //18
+0.94985675811767578, //19
+0.94728755950927734, //20
+0.94472694396972656, //21
+0.94217205047607422, //22
+0.93962478637695312, //23
+0.93708419799804688, //24
+0.93455028533935547, //25
+0.93202304840087891, //26
+0.92950248718261719, //27
+0.92698955535888672, //28
+0.92448329925537109, //29
+0.92198371887207031, //30
+0.91948986053466797, //31
+0.91700363159179688, //32
+0.91452407836914062, //33
+0.91205215454101562, //34
+0.90958595275878906, //35
+0.90712642669677734, //36
+0.90467357635498047, //37
+0.90222740173339844, //38
+0.89978790283203125, //39
+0.8973541259765625, //40
+0.894927978515625, //41
+0.89250850677490234, //42
+0.89009475708007812, //43
+0.88768863677978516, //44
+0.88528823852539062, //45
+0.88289451599121094, //46
+0.88050651550292969, //47
+0.87812614440917969, //48
+0.87575149536132812, //49
+0.87338352203369141, //50
+0.87102222442626953, //51
+0.86866664886474609, //52
+0.8663177490234375, //53
+0.86397552490234375, //54
+0.86163902282714844, //55
+0.85930919647216797, //56
+0.85698604583740234, //57
+0.85466861724853516, //58
+0.85235786437988281, //59
+0.85005283355712891, //60
+0.84775447845458984, //61
+0.84546279907226562, //62
+0.84317588806152344, //63
+0.8408966064453125, //64
+0.838623046875, //65
+0.83635520935058594, //66
+0.83409404754638672, //67
+0.83183860778808594, //68
+0.82958889007568359, //69
+0.82734584808349609, //70
+0.82510852813720703, //71
+0.82287788391113281, //72
+0.82065296173095703, //73
+0.81843376159667969, //74
+0.81622028350830078, //75
+0.81401348114013672, //76
+0.81181240081787109, //77
+0.80961799621582031, //78
+0.80742835998535156, //79
+0.80524539947509766, //80
+0.80306816101074219, //81
+0.80089664459228516, //82
+0.79873085021972656, //83
+0.79657077789306641, //84
+0.79441738128662109, //85
+0.79226875305175781, //86
+0.79012680053710938, //87
+0.78799057006835938, //88
+0.78586006164550781, //89
+0.78373527526855469, //90
+0.78161525726318359, //91
+0.77950191497802734, //92
+0.77739429473876953, //93
+0.77529239654541016, //94
+0.77319622039794922, //95
+0.77110576629638672, //96
+0.76902008056640625, //97
+0.76694107055664062, //98
+0.76486682891845703, //99
+0.76279926300048828, //100
+0.76073646545410156, //101
+0.75867938995361328, //102
+0.75662803649902344, //103
+0.75458240509033203, //104
+0.75254154205322266, //105
+0.75050735473632812, //106
+0.74847793579101562, //107
+0.74645423889160156, //108
+0.74443531036376953, //109
+0.74242305755615234, //110
+0.74041557312011719, //111
+0.73841285705566406, //112
+0.73641681671142578, //113
+0.73442554473876953, //114
+0.73243904113769531, //115
+0.73045921325683594, //116
+0.72848415374755859, //117
+0.72651386260986328, //118
+0.72454929351806641, //119
+0.72259044647216797, //120
+0.72063636779785156, //121
+0.71868801116943359, //122
+0.71674442291259766, //123
+0.71480655670166016, //124
+0.71287345886230469, //125
+0.71094608306884766, //126
+0.70902347564697266, //127
+0.70710659027099609, //128
+0.70519447326660156, //129
+0.70328807830810547, //130
+0.70138645172119141, //131
+0.69948959350585938, //132
+0.69759845733642578, //133
+0.69571208953857422, //134
+0.69383144378662109, //135
+0.69195461273193359, //136
+0.69008350372314453, //137
+0.68821811676025391, //138
+0.68635749816894531, //139
+0.68450164794921875, //140
+0.68265056610107422, //141
+0.68080425262451172, //142
+0.67896366119384766, //143
+0.67712783813476562, //144
+0.67529678344726562, //145
+0.67347049713134766, //146
+0.67164993286132812, //147
+0.66983413696289062, //148
+0.66802215576171875, //149
+0.66621589660644531, //150
+0.66441440582275391, //151
+0.66261863708496094, //152
+0.66082668304443359, //153
+0.65903949737548828, //154
+0.65725803375244141, //155
+0.65548038482666016, //156
+0.65370845794677734, //157
+0.65194034576416016, //158
+0.65017795562744141, //159
+0.64841938018798828, //160
+0.64666652679443359, //161
+0.64491748809814453, //162
+0.64317417144775391, //163
+0.64143466949462891, //164
+0.63970088958740234, //165
+0.63797092437744141, //166
+0.6362457275390625, //167
+0.63452529907226562, //168
+0.63280963897705078, //169
+0.63109874725341797, //170
+0.62939262390136719, //171
+0.62769031524658203, //172
+0.62599277496337891, //173
+0.62430095672607422, //174
+0.62261199951171875, //175
+0.62092876434326172, //176
+0.61925029754638672, //177
+0.61757564544677734, //178
+0.61590576171875, //179
+0.61424064636230469, //180
+0.612579345703125, //181
+0.61092281341552734, //182
+0.60927104949951172, //183
+0.60762405395507812, //184
+0.60598087310791016, //185
+0.60434246063232422, //186
+0.60270786285400391, //187
+0.60107803344726562, //188
+0.59945297241210938, //189
+0.59783172607421875, //190
+0.59621524810791016, //191
+0.59460353851318359, //192
+0.59299564361572266, //193
+0.59139251708984375, //194
+0.58979320526123047, //195
+0.58819866180419922, //196
+0.58660793304443359, //197
+0.58502197265625, //198
+0.58343982696533203, //199
+0.58186244964599609, //200
+0.58028888702392578, //201
+0.5787200927734375, //202
+0.57715511322021484, //203
+0.57559490203857422, //204
+0.57403850555419922, //205
+0.57248592376708984, //206
+0.5709381103515625, //207
+0.56939411163330078, //208
+0.56785488128662109, //209
+0.56631946563720703, //210
+0.56478786468505859, //211
+0.56326103210449219, //212
+0.56173801422119141, //213
+0.56021881103515625, //214
+0.55870437622070312, //215
+0.55719375610351562, //216
+0.55568695068359375, //217
+0.5541839599609375, //218
+0.55268573760986328, //219
+0.55119132995605469, //220
+0.54970073699951172, //221
+0.54821491241455078, //222
+0.54673194885253906, //223
+0.54525375366210938, //224
+0.54377937316894531, //225
+0.54230880737304688, //226
+0.54084300994873047, //227
+0.53938007354736328, //228
+0.53792190551757812, //229
+0.53646755218505859, //230
+0.53501701354980469, //231
+0.53357028961181641, //232
+0.53212738037109375, //233
+0.53068828582763672, //234
+0.52925395965576172, //235
+0.52782249450683594, //236
+0.52639579772949219, //237
+0.52497196197509766, //238
+0.52355289459228516, //239
+0.52213668823242188, //240
+0.52072525024414062, //241
+0.51931667327880859, //242
+0.51791286468505859, //243
+0.51651287078857422, //244
+0.51511573791503906, //245
+0.51372337341308594, //246
+0.51233386993408203, //247
+0.51094818115234375, //248
+0.5095672607421875, //249
+0.50818920135498047, //250
+0.50681495666503906, //251
+0.50544452667236328, //252
+0.50407791137695312, //253
+0.50271511077880859, //254
+0.50135517120361328, //255
+0.5, //256
+};
+const double xlns64_explo[257] = {
+0, //0
+-2.7722751815500253e-07, //1
+8.113744176941988e-08, //2
+1.0165118390369253e-07, //3
+-2.3540221592209488e-07, //4
+3.9889452814532815e-09, //5
+-1.5345909570467281e-07, //6
+2.2637155355710765e-07, //7
+1.7030303216573287e-07, //8
+-3.4111546788330406e-07, //9
+-3.7360784429433906e-07, //10
+5.3480140505121274e-08, //11
+-3.2819282462200668e-08, //12
+3.0192691905271208e-07, //13
+8.4855171839505299e-08, //14
+2.5050242217442703e-07, //15
+-1.7389127010308987e-07, //16
+-2.536856058850249e-07, //17
+-7.8631355544052546e-09, //18
+-4.0902939814888885e-07, //19
+4.3128420547692507e-07, //20
+-3.6677425701078922e-07, //21
+3.9040093006081304e-08, //22
+-2.7734867303599777e-07, //23
+-3.8094289692434989e-07, //24
+-2.9036873621632363e-07, //25
+-2.4201984383861053e-08, //26
+3.9903179300480049e-07, //27
+7.1828060654258868e-09, //28
+-2.6450014562953835e-07, //29
+-4.3439275734997486e-07, //30
+4.3285327889011627e-07, //31
+4.1161287435675367e-07, //32
+4.3733330804652344e-07, //33
+-4.6183748896949867e-07, //34
+-3.9667948477833991e-07, //35
+-3.3894657796565072e-07, //36
+-3.0666946453447455e-07, //37
+-3.1783008649737248e-07, //38
+-3.9036176370396908e-07, //39
+4.1152499109320742e-07, //40
+1.6264507549801225e-07, //41
+-2.0111543485369946e-07, //42
+2.5617763407950267e-07, //43
+-3.9051652452997678e-07, //44
+-2.5149361323822342e-07, //45
+-2.9802457452695946e-07, //46
+4.060158622245613e-07, //47
+-6.4222529945945264e-08, //48
+1.8115461095303187e-07, //49
+1.7106589306377373e-07, //50
+-1.1184869130951691e-07, //51
+2.6877210703075451e-07, //52
+3.4198771803242017e-07, //53
+9.0578575031100006e-08, //54
+4.5104598851112166e-07, //55
+4.5258907098905165e-07, //56
+7.8127560675545372e-08, //57
+2.643016962573146e-07, //58
+4.0449142799320673e-08, //59
+3.4330213282850099e-07, //60
+2.0229007650376073e-07, //61
+-3.9943761303402013e-07, //62
+4.2866267321048455e-07, //63
+-1.9119159795698108e-07, //64
+-3.6836606072409867e-07, //65
+-1.1952978765068312e-07, //66
+-4.1498109546540731e-07, //67
+-3.1762471771999571e-07, //68
+1.5600512444895057e-07, //69
+3.5744601105066644e-08, //70
+2.588231018442206e-07, //71
+-1.4483415039024446e-07, //72
+-2.3790895391689925e-07, //73
+-3.6713197443618596e-08, //74
+4.4248533675393361e-07, //75
+2.2978853716468283e-07, //76
+2.6269079332218084e-07, //77
+-4.2861838843785824e-07, //78
+4.7117078757531478e-08, //79
+-2.3350047050215393e-07, //80
+-3.3280235672464948e-07, //81
+-2.6675093847932773e-07, //82
+-5.1265413013388671e-08, //83
+2.9777806704272105e-07, //84
+-1.8912803912161718e-07, //85
+3.7957448905257939e-07, //86
+8.0789302888415251e-08, //87
+-1.4751441613179966e-07, //88
+-3.2099933712785751e-07, //89
+-4.5528577824097789e-07, //90
+3.8772249525830405e-07, //91
+2.8514089113978016e-07, //92
+1.751497747548179e-07, //93
+4.2297089823293502e-08, //94
+-1.2882743844128738e-07, //95
+-3.5359241630695702e-07, //96
+3.0634942221419246e-07, //97
+-7.1636162624131965e-08, //98
+4.0455518648068291e-07, //99
+-1.8762821912783135e-07, //100
+4.4000305729279768e-08, //101
+1.3064549406812277e-07, //102
+5.7227281513626618e-08, //103
+-1.9129362066139331e-07, //104
+3.2375848061576111e-07, //105
+-3.1992311536489099e-07, //106
+-2.2990739791161133e-07, //107
+-3.7474596913789461e-07, //108
+1.8439842900145817e-07, //109
+-4.746197760934932e-07, //110
+-4.5920888130230025e-07, //111
+2.1591408559315777e-07, //112
+-3.7127674198375376e-07, //113
+-3.280702785678105e-07, //114
+3.3093550760079351e-07, //115
+-3.1616651244314488e-07, //116
+-3.7654683668293448e-07, //117
+1.3531466300117879e-07, //118
+2.5130295108397298e-07, //119
+-4.2983644658737327e-08, //120
+1.9176646126888193e-07, //121
+-1.2444942430961739e-08, //122
+2.8377129676501961e-07, //123
+1.1249432484936603e-07, //124
+4.1319044246593967e-07, //125
+2.1801573512367049e-07, //126
+4.6651323494268249e-07, //127
+1.9091555143063189e-07, //128
+3.3084203378969113e-07, //129
+-8.139859774750199e-08, //130
+-1.0611108905303826e-07, //131
+2.4276329619509146e-07, //132
+-2.353325692086225e-09, //133
+9.8347388874852823e-08, //134
+-4.2263735651422224e-07, //135
+3.2824998238371178e-07, //136
+4.2990697451657321e-07, //137
+-1.3138298885612652e-07, //138
+-4.1562511112787489e-07, //139
+-4.3646192344402824e-07, //140
+-2.0749906831104377e-07, //141
+2.5769460065903482e-07, //142
+-8.0873971330052384e-09, //143
+-6.4666319260866557e-08, //144
+7.449875157072329e-08, //145
+3.9598512526167837e-07, //146
+-6.7267910493077395e-08, //147
+-3.7493623912228727e-07, //148
+4.1334035413669035e-07, //149
+3.76935135412205e-07, //150
+4.5628022329148111e-07, //151
+-3.1550509029020304e-07, //152
+-4.4242854836597668e-08, //153
+3.0325754371606298e-07, //154
+-2.3977776407701481e-07, //155
+2.2093572201473208e-07, //156
+-2.3497943872136844e-07, //157
+2.8683180779305855e-07, //158
+-1.3393761608073047e-07, //159
+3.9713751655171079e-07, //160
+-4.0179888875367838e-08, //161
+4.4860518837489764e-07, //162
+-5.6674741139440665e-08, //163
+3.3854476023411056e-07, //164
+-2.8583456773028683e-07, //165
+-3.5179245356088511e-08, //166
+1.2415563887559471e-07, //167
+1.7952360098624429e-07, //168
+1.1831235238084561e-07, //169
+-7.2056292614716341e-08, //170
+-4.0412650896597341e-07, //171
+6.3265763513534364e-08, //172
+3.6396977922878698e-07, //173
+-4.6813147185043816e-07, //174
+4.1557591021640925e-07, //175
+1.4169348030556705e-07, //176
+-3.4844647843484825e-07, //177
+-1.1347831069090375e-07, //178
+-1.1935171203203334e-07, //179
+-3.7830886968464586e-07, //180
+5.1115447718865902e-08, //181
+2.0307085141468536e-07, //182
+6.5414192462114138e-08, //183
+-3.7396484368592197e-07, //184
+-1.7346950955901162e-07, //185
+-2.98819033430083e-07, //186
+1.9164855800653333e-07, //187
+3.3227908594605409e-07, //188
+1.1112508086587097e-07, //189
+4.6994569493730241e-07, //190
+4.4318366545484291e-07, //191
+1.8988176939593784e-08, //192
+1.3921477425943253e-07, //193
+-1.6159767323505481e-07, //194
+5.8470207504001098e-08, //195
+-1.6597905858062312e-07, //196
+1.0703738503002602e-07, //197
+-8.781462490595757e-08, //198
+1.9151090875402276e-07, //199
+-2.0257207336853069e-08, //200
+2.1898982359192269e-07, //201
+-5.5956561985219012e-08, //202
+9.707489317603438e-08, //203
+-2.8706208286583164e-07, //204
+-2.6613410971537167e-07, //205
+1.4844881226594268e-07, //206
+-8.3667816886431705e-09, //207
+2.0574504504559856e-07, //208
+-1.7420771833664668e-07, //209
+-2.0583784741723442e-07, //210
+9.959808547924066e-08, //211
+-2.2280037123762787e-07, //212
+-2.3055468150590249e-07, //213
+6.5169647092211749e-08, //214
+-3.0043701852548732e-07, //215
+-3.8480556935685528e-07, //216
+-1.9901118494808486e-07, //217
+2.4590090181902859e-07, //218
+-1.4758992653452624e-08, //219
+-3.8302134215705864e-08, //220
+1.6431559927396243e-07, //221
+-3.7150636236955598e-07, //222
+2.5068390386461708e-07, //223
+1.1267051945460438e-07, //224
+1.5728993952017923e-07, //225
+3.7373360774390664e-07, //226
+-2.0245212286777248e-07, //227
+3.2533119661561864e-07, //228
+3.9013817393915642e-08, //229
+-1.18422070818035e-07, //230
+-1.5763968380075365e-07, //231
+-8.9273404597185139e-08, //232
+7.6071138524870865e-08, //233
+3.2781699432174894e-07, //234
+-2.9825850537371253e-07, //235
+9.467344264189187e-08, //236
+-4.1122717902393122e-07, //237
+8.0925245976798746e-08, //238
+-3.4665264022319545e-07, //239
+2.0298128504517331e-07, //240
+-1.8789998255437255e-07, //241
+3.7770188080155304e-07, //242
+-1.7884080033732375e-08, //243
+-4.3127796000750566e-07, //244
+8.0927981443924997e-08, //245
+-3.9885370408922422e-07, //246
+2.6514485791347738e-08, //247
+3.9317471458910408e-07, //248
+-2.6270331852516933e-07, //249
+-4.3899503949758681e-08, //250
+8.5810705656940399e-08, //251
+1.1635348694873397e-07, //252
+3.7682255632888809e-08, //253
+-1.6022240718308219e-07, //254
+4.6632148796148807e-07, //255
+0, //256
+};
+const double xlns64_loghi[256] = {
+0, //0
+0.0056245491938781067, //1
+0.011227255423254119, //2
+0.016808287686553888, //3
+0.02236781302845451, //4
+0.027905996569884482, //5
+0.03342300153745028, //6
+0.03891898929230235, //7
+0.044394119358453436, //8
+0.049848549450561525, //9
+0.055282435501189602, //10
+0.060695931687553939, //11
+0.066089190457772437, //12
+0.071462362556624151, //13
+0.076815597050830894, //14
+0.082149041353871563, //15
+0.087462841250339401, //16
+0.092757140919852446, //17
+0.09803208296052672, //18
+0.10328780841202195, //19
+0.10852445677816905, //20
+0.11374216604918833, //21
+0.11894107272350743, //22
+0.12412131182918758, //23
+0.12928301694496647, //24
+0.1344263202209261, //25
+0.13955135239879354, //26
+0.14465824283188233, //27
+0.14974711950468206, //28
+0.15481810905210402, //29
+0.15987133677838941, //30
+0.16490692667568779, //31
+0.16992500144231237, //32
+0.1749256825006788, //33
+0.17990909001493446, //34
+0.18487534290828386, //35
+0.18982455888001723, //36
+0.19475685442224788, //37
+0.1996723448363644, //38
+0.20457114424920361, //39
+0.20945336562894978, //40
+0.21431912080076579, //41
+0.21916852046216156, //42
+0.22400167419810504, //43
+0.22881869049588088, //44
+0.23361967675970205, //45
+0.23840473932507891, //46
+0.24317398347295091, //47
+0.24792751344358549, //48
+0.25266543245024864, //49
+0.25738784269265175, //50
+0.26209484537017941, //51
+0.26678654069490138, //52
+0.27146302790437454, //53
+0.27612440527423754, //54
+0.28077077013060253, //55
+0.28540221886224837, //56
+0.29001884693261831, //57
+0.29462074889162698, //58
+0.29920801838727884, //59
+0.30378074817710293, //60
+0.30833903013940728, //61
+0.31288295528435534, //62
+0.3174126137648694, //63
+0.32192809488736235, //64
+0.32642948712230313, //65
+0.33091687811461695, //66
+0.33539035469392492, //67
+0.33985000288462475, //68
+0.34429590791581688, //69
+0.34872815423107756, //70
+0.35314682549808252, //71
+0.35755200461808367, //72
+0.3619437737352415, //73
+0.36632221424581579, //74
+0.37068740680721768, //75
+0.37503943134692475, //76
+0.37937836707126216, //77
+0.38370429247405224, //78
+0.3880172853451348, //79
+0.39231742277876031, //80
+0.39660478118185849, //81
+0.40087943628218431, //82
+0.40514146313634392, //83
+0.40939093613770178, //84
+0.41362792902417245, //85
+0.41785251488589786, //86
+0.4220647661728123, //87
+0.42626475470209796, //88
+0.43045255166553142, //89
+0.43462822763672465, //90
+0.43879185257826092, //91
+0.44294349584872827, //92
+0.44708322620965224, //93
+0.45121111183232882, //94
+0.45532722030456069, //95
+0.45943161863729726, //96
+0.46352437327118029, //97
+0.46760555008299742, //98
+0.47167521439204441, //99
+0.47573343096639775, //100
+0.47978026402909968, //101
+0.4838157772642564, //102
+0.48784003382305136, //103
+0.49185309632967472, //104
+0.49585502688717098, //105
+0.49984588708320538, //106
+0.5038257379957507, //107
+0.50779464019869625, //108
+0.51175265376737955, //109
+0.51569983828404242, //110
+0.5196362528432128, //111
+0.52356195605701283, //112
+0.52747700606039605, //113
+0.53138146051631208, //114
+0.53527537662080327, //115
+0.53915881110803143, //116
+0.54303182025523777, //117
+0.54689445988763663, //118
+0.55074678538324318, //119
+0.55458885167763738, //120
+0.55842071326866427, //121
+0.56224242422107262, //122
+0.56605403817109168, //123
+0.56985560833094784, //124
+0.573647187493322, //125
+0.57742882803574869, //126
+0.58120058192495705, //127
+0.58496250072115619, //128
+0.58871463558226367, //129
+0.59245703726808041, //130
+0.59618975614441028, //131
+0.5999128421871277, //132
+0.60362634498619194, //133
+0.60733031374961066, //134
+0.61102479730735226, //135
+0.61470984411520824, //136
+0.61838550225860645, //137
+0.62205181945637622, //138
+0.62570884306446528, //139
+0.62935662007960957, //140
+0.63299519714295782, //141
+0.63662462054364888, //142
+0.6402449362223458, //143
+0.6438561897747247, //144
+0.64745842645492024, //145
+0.65105169117892858, //146
+0.65463602852796732, //147
+0.65821148275179475, //148
+0.66177809777198704, //149
+0.66533591718517626, //150
+0.66888498426624698, //151
+0.67242534197149562, //152
+0.6759570329417488, //153
+0.67948009950544608, //154
+0.68299458368168287, //155
+0.68650052718321841, //156
+0.68999797141944541, //157
+0.69348695749932521, //158
+0.69696752623428715, //159
+0.70043971814109218, //160
+0.70390357344466359, //161
+0.70735913208088275, //162
+0.71080643369935159, //163
+0.71424551766612265, //164
+0.71767642306639612, //165
+0.72109918870718515, //166
+0.72451385311994976, //167
+0.7279204545631992, //168
+0.73131903102506413, //169
+0.73470962022583819, //170
+0.73809225962049041, //171
+0.74146698640114694, //172
+0.74483383749954557, //173
+0.74819284958946031, //174
+0.75154405908909816, //175
+0.75488750216346856, //176
+0.75822321472672494, //177
+0.76155123244447931, //178
+0.76487159073609068, //179
+0.76818432477692633, //180
+0.77148946950059838, //181
+0.77478705960117344, //182
+0.77807712953535824, //183
+0.7813597135246596, //184
+0.78463484555752061, //185
+0.78790255939143161, //186
+0.79116288855501826, //187
+0.79441586635010597, //188
+0.79766152585376016, //189
+0.80089989992030475, //190
+0.80413102118331781, //191
+0.80735492205760406, //192
+0.81057163474114691, //193
+0.81378119121703707, //194
+0.81698362325538099, //195
+0.82017896241518773, //196
+0.82336724004623507, //197
+0.82654848729091501, //198
+0.82972273508605865, //199
+0.83289001416474162, //200
+0.83605035505806968, //201
+0.83920378809694396, //202
+0.84235034341380799, //203
+0.84549005094437524, //204
+0.84862294042933795, //205
+0.85174904141605756, //206
+0.8548683832602364, //207
+0.85798099512757209, //208
+0.86108690599539373, //209
+0.86418614465428023, //210
+0.86727873970966196, //211
+0.87036471958340456, //212
+0.87344411251537657, //213
+0.87651694656499968, //214
+0.87958324961278322, //215
+0.88264304936184124, //216
+0.88569637333939522, //217
+0.88874324889825906, //218
+0.89178370321831024, //219
+0.89481776330794349, //220
+0.89784545600551158, //221
+0.90086680798074859, //222
+0.90388184573618024, //223
+0.90689059560851848, //224
+0.90989308377004197, //225
+0.9128893362299616, //226
+0.91587937883577319, //227
+0.91886323727459451, //228
+0.92184093707449, //229
+0.92481250360578093, //230
+0.9277779620823422, //231
+0.93073733756288624, //232
+0.93369065495223369, //233
+0.93663793900257053, //234
+0.93957921431469305, //235
+0.94251450533923986, //236
+0.94544383637791152, //237
+0.94836723158467762, //238
+0.95128471496697198, //239
+0.95419631038687525, //240
+0.95710204156228618, //241
+0.96000193206808093, //242
+0.9628960053372605, //243
+0.96578428466208699, //244
+0.96866679319520843, //245
+0.97154355395077197, //246
+0.97441458980552709, //247
+0.97727992349991644, //248
+0.98013957763915704, //249
+0.98299357469431015, //250
+0.98584193700334055, //251
+0.98868468677216581, //252
+0.99152184607569527, //253
+0.99435343685885791, //254
+0.99717948093762132, //255
+};
+const double xlns64_loglo[256] = {
+0, //0
+2.5368636770266295e-19, //1
+8.6397360619938635e-19, //2
+1.0249098661777034e-18, //3
+-1.5941160067325932e-18, //4
+1.387439967602544e-18, //5
+-5.014435047745458e-19, //6
+8.7074986977742075e-19, //7
+1.3349239248727773e-18, //8
+2.6190258729102966e-18, //9
+-2.9815559743351372e-19, //10
+-2.5546513689189698e-18, //11
+-4.1335207826009857e-18, //12
+-6.4171216083985794e-18, //13
+-2.1684043449710089e-18, //14
+-2.3310346708438345e-18, //15
+6.7627110508783339e-18, //16
+3.2661590446125821e-18, //17
+-4.424900116456465e-18, //18
+-1.1248597539537109e-18, //19
+5.4074583352714534e-18, //20
+4.1741783640691921e-18, //21
+1.5585406229479126e-18, //22
+-6.057979638762756e-18, //23
+-1.1478990501190278e-17, //24
+-8.1315162936412833e-20, //25
+1.0259263057144086e-17, //26
+-1.2414114874959026e-17, //27
+3.3881317890172014e-18, //28
+-1.7347234759768071e-18, //29
+5.3396956994911093e-18, //30
+7.874018277675976e-18, //31
+-1.0448998437329049e-17, //32
+1.3525422101756668e-17, //33
+4.526544070126981e-18, //34
+-1.5720931501039814e-18, //35
+-2.439454888092385e-19, //36
+-8.0502011307048704e-18, //37
+3.2526065174565133e-19, //38
+-5.8275866771095863e-18, //39
+-1.7482760031328759e-18, //40
+1.1695830935687379e-17, //41
+7.03376159399971e-18, //42
+-1.1411227865409934e-17, //43
+-5.9631119486702744e-18, //44
+-3.2797115717686509e-18, //45
+-6.0986372202309624e-18, //46
+7.7520455332713567e-18, //47
+3.8624702394796095e-18, //48
+-1.4934884925987824e-17, //49
+2.4069288229178198e-17, //50
+-1.9732479539236181e-17, //51
+-1.1492543028346347e-17, //52
+1.9407218887490529e-17, //53
+1.7889335846010823e-17, //54
+9.5138740635603014e-18, //55
+-2.7267684638010437e-17, //56
+2.1467203015212988e-17, //57
+2.4069288229178198e-17, //58
+-2.1927988938519327e-17, //59
+-8.3483567281383841e-18, //60
+-2.3093506273941244e-17, //61
+2.5532961162033629e-17, //62
+-2.3229031545501932e-17, //63
+-3.7947076036992655e-19, //64
+-9.2157184661267877e-19, //65
+2.7267684638010437e-17, //66
+-1.713039432527097e-17, //67
+-2.0897996874658098e-17, //68
+-2.2768245622195593e-17, //69
+-5.8275866771095863e-18, //70
+2.2714035513571318e-17, //71
+1.8973538018496328e-17, //72
+-2.3364556817062621e-17, //73
+-5.990217002982412e-18, //74
+1.894643296418419e-17, //75
+1.0977546996415732e-17, //76
+-1.2197274440461925e-17, //77
+-1.9786689647860456e-17, //78
+-1.83772268236293e-17, //79
+-1.6317242695906842e-17, //80
+-2.4936649967166602e-17, //81
+1.1438332919722072e-17, //82
+-2.5831116759467143e-17, //83
+-2.1358782797964437e-17, //84
+1.7889335846010823e-17, //85
+-6.5865281978494394e-18, //86
+2.2199039481640703e-17, //87
+-1.9922214919421144e-17, //88
+-2.2714035513571318e-17, //89
+-1.83772268236293e-17, //90
+-1.3850682753502319e-17, //91
+2.7430314963883262e-17, //92
+-9.6493993351209895e-18, //93
+-1.1844908734404136e-17, //94
+1.780802068307441e-17, //95
+-3.7947076036992655e-19, //96
+2.439454888092385e-19, //97
+1.7076184216646695e-17, //98
+3.0357660829594124e-18, //99
+2.6562953225894859e-18, //100
+1.8187491443444337e-17, //101
+2.7132159366449748e-17, //102
+-1.0191500421363742e-17, //103
+-1.0814916670542907e-17, //104
+7.7249404789592191e-18, //105
+-1.5233040523421337e-17, //106
+-5.9631119486702744e-18, //107
+2.2388774861825667e-17, //108
+2.7159264420761886e-17, //109
+3.5724461583397371e-17, //110
+-2.7755575615628914e-17, //111
+3.8380756905986857e-17, //112
+8.5109870540112098e-18, //113
+5.3396956994911093e-17, //114
+1.962405932198763e-17, //115
+-4.2446515052807499e-17, //116
+3.2526065174565133e-18, //117
+3.415236843329339e-17, //118
+4.9168568522217626e-17, //119
+-1.22514845490862e-17, //120
+1.0625181290357943e-17, //121
+2.8731357570865868e-17, //122
+2.1358782797964437e-17, //123
+3.4694469519536142e-18, //124
+3.7513395167998453e-17, //125
+2.3852447794681098e-18, //126
+3.5561831257524545e-17, //127
+-5.2041704279304213e-18, //128
+4.3639137442541553e-17, //129
+8.7278274885083107e-18, //130
+2.5153490401663703e-17, //131
+-2.4123498337802474e-17, //132
+-1.0245710529988017e-17, //133
+2.7863995832877464e-17, //134
+1.7401444868392346e-17, //135
+-2.2226144535952841e-17, //136
+1.5070410197548512e-17, //137
+4.6349642873755315e-17, //138
+-8.7278274885083107e-18, //139
+4.4669129506402783e-17, //140
+-3.5670251474773096e-17, //141
+-3.9519169187096637e-17, //142
+-1.2468324983583301e-17, //143
+-7.589415207398531e-19, //144
+5.3939058081153846e-17, //145
+3.2255014631443757e-17, //146
+5.1716443627558562e-17, //147
+-1.4799359654427136e-17, //148
+3.426078865054194e-17, //149
+-3.3935527998796289e-17, //150
+5.3396956994911093e-17, //151
+-2.6237692574149207e-17, //152
+1.8973538018496328e-17, //153
+-3.6917083973131426e-17, //154
+3.1983964088322381e-17, //155
+-3.0899761915836876e-17, //156
+-4.4343868854657131e-17, //157
+2.7918205941501739e-17, //158
+-4.4885969940899884e-17, //159
+-2.2063514210080015e-17, //160
+2.4069288229178198e-17, //161
+3.4694469519536142e-18, //162
+4.9873299934333204e-18, //163
+-1.6696713456276768e-17, //164
+-3.8814437774981059e-17, //165
+-1.1655173354219173e-17, //166
+-2.2714035513571318e-17, //167
+-2.4774019641293776e-17, //168
+-2.1738253558334364e-17, //169
+5.3668007538032469e-17, //170
+-2.5695591487906455e-17, //171
+4.2825985813177425e-18, //172
+2.7863995832877464e-17, //173
+-2.0328790734103208e-17, //174
+-2.3852447794681098e-17, //175
+-1.5666721392415539e-17, //176
+-3.1333442784831078e-17, //177
+7.1557343384043293e-18, //178
+-2.8460307027744491e-17, //179
+2.7918205941501739e-17, //180
+-1.3281476612947429e-17, //181
+-3.3230796586680711e-17, //182
+-5.2095914387928488e-17, //183
+-7.589415207398531e-19, //184
+-3.2634485391813683e-17, //185
+-4.3042826247674526e-17, //186
+4.4777549723651333e-17, //187
+-6.9931040125315036e-18, //188
+-5.3234326669038268e-17, //189
+-1.4474099002681484e-17, //190
+-5.3722217646656745e-17, //191
+4.4398078963281407e-17, //192
+3.5453411040275995e-17, //193
+-1.1167282376600696e-17, //194
+-3.6917083973131426e-17, //195
+-2.0599841277224584e-17, //196
+1.6425662913155392e-17, //197
+-2.8893987896738693e-17, //198
+-3.3501847129802087e-17, //199
+5.4155898515650946e-17, //200
+1.7455654977016621e-17, //201
+-2.0220370516854658e-17, //202
+-3.664603343001005e-17, //203
+-1.7509865085640897e-17, //204
+3.0737131589964051e-17, //205
+-1.6696713456276768e-17, //206
+-1.1058862159352145e-17, //207
+3.2634485391813683e-17, //208
+1.2685165418080402e-17, //209
+6.5052130349130266e-18, //210
+-4.775910569798647e-17, //211
+-3.2471855065940858e-17, //212
+-2.9110828331235794e-17, //213
+4.28801959218017e-17, //214
+-3.664603343001005e-17, //215
+2.2280354644577116e-17, //216
+-2.0328790734103208e-17, //217
+4.1958624075189022e-17, //218
+-5.2366964931049864e-17, //219
+2.3418766925686896e-17, //220
+-3.5236570605778894e-17, //221
+-2.677979366039196e-17, //222
+-1.1384122811097797e-18, //223
+4.9927510042957479e-17, //224
+-2.3798237686056822e-17, //225
+1.7997756063259374e-17, //226
+-3.3447637021177812e-17, //227
+-7.589415207398531e-19, //228
+3.1008182133085427e-17, //229
+-2.6129272356900657e-17, //230
+-3.8272336688738307e-17, //231
+4.0928632011327792e-17, //232
+4.4452289071905682e-17, //233
+3.290553593493506e-17, //234
+1.8160386389132199e-17, //235
+1.3769367590565906e-17, //236
+1.1655173354219173e-17, //237
+3.7350764842125628e-17, //238
+-1.1221492485224971e-17, //239
+-3.7242344624877077e-17, //240
+-7.6978354246470815e-18, //241
+5.7462715141731735e-18, //242
+3.7730235602495554e-17, //243
+5.4372738950148047e-17, //244
+-2.5045070184415152e-17, //245
+2.564138137928218e-17, //246
+4.6620693416876691e-18, //247
+3.3935527998796289e-17, //248
+4.0332320816460765e-17, //249
+-1.7509865085640897e-17, //250
+-4.9331198848090452e-17, //251
+4.2717565595928875e-17, //252
+2.7592945289756088e-17, //253
+2.8948198005362968e-17, //254
+1.6425662913155392e-17, //255
+};
+const double xlns64_recip[256] = {
+1, //0
+0.99610894941634243, //1
+0.99224806201550386, //2
+0.98841698841698844, //3
+0.98461538461538467, //4
+0.98084291187739459, //5
+0.97709923664122134, //6
+0.97338403041825095, //7
+0.96969696969696972, //8
+0.96603773584905661, //9
+0.96240601503759393, //10
+0.95880149812734083, //11
+0.95522388059701491, //12
+0.95167286245353155, //13
+0.94814814814814818, //14
+0.94464944649446492, //15
+0.94117647058823528, //16
+0.93772893772893773, //17
+0.93430656934306566, //18
+0.93090909090909091, //19
+0.92753623188405798, //20
+0.92418772563176899, //21
+0.92086330935251803, //22
+0.91756272401433692, //23
+0.91428571428571426, //24
+0.91103202846975084, //25
+0.90780141843971629, //26
+0.90459363957597172, //27
+0.90140845070422537, //28
+0.89824561403508774, //29
+0.8951048951048951, //30
+0.89198606271777003, //31
+0.88888888888888884, //32
+0.88581314878892736, //33
+0.88275862068965516, //34
+0.8797250859106529, //35
+0.87671232876712324, //36
+0.87372013651877134, //37
+0.87074829931972786, //38
+0.8677966101694915, //39
+0.86486486486486491, //40
+0.86195286195286192, //41
+0.85906040268456374, //42
+0.85618729096989965, //43
+0.85333333333333339, //44
+0.85049833887043191, //45
+0.84768211920529801, //46
+0.84488448844884489, //47
+0.84210526315789469, //48
+0.83934426229508197, //49
+0.83660130718954251, //50
+0.83387622149837137, //51
+0.83116883116883122, //52
+0.82847896440129454, //53
+0.82580645161290323, //54
+0.82315112540192925, //55
+0.82051282051282048, //56
+0.8178913738019169, //57
+0.8152866242038217, //58
+0.8126984126984127, //59
+0.810126582278481, //60
+0.80757097791798105, //61
+0.80503144654088055, //62
+0.80250783699059558, //63
+0.80000000000000004, //64
+0.79750778816199375, //65
+0.79503105590062106, //66
+0.79256965944272451, //67
+0.79012345679012341, //68
+0.78769230769230769, //69
+0.78527607361963192, //70
+0.78287461773700306, //71
+0.78048780487804881, //72
+0.77811550151975684, //73
+0.77575757575757576, //74
+0.77341389728096677, //75
+0.77108433734939763, //76
+0.76876876876876876, //77
+0.76646706586826352, //78
+0.76417910447761195, //79
+0.76190476190476186, //80
+0.75964391691394662, //81
+0.75739644970414199, //82
+0.75516224188790559, //83
+0.75294117647058822, //84
+0.75073313782991202, //85
+0.74853801169590639, //86
+0.74635568513119532, //87
+0.7441860465116279, //88
+0.74202898550724639, //89
+0.73988439306358378, //90
+0.73775216138328525, //91
+0.73563218390804597, //92
+0.73352435530085958, //93
+0.73142857142857143, //94
+0.72934472934472938, //95
+0.72727272727272729, //96
+0.72521246458923516, //97
+0.7231638418079096, //98
+0.72112676056338032, //99
+0.7191011235955056, //100
+0.71708683473389356, //101
+0.71508379888268159, //102
+0.71309192200557103, //103
+0.71111111111111114, //104
+0.70914127423822715, //105
+0.70718232044198892, //106
+0.70523415977961434, //107
+0.70329670329670335, //108
+0.70136986301369864, //109
+0.69945355191256831, //110
+0.6975476839237057, //111
+0.69565217391304346, //112
+0.69376693766937669, //113
+0.69189189189189193, //114
+0.69002695417789761, //115
+0.68817204301075274, //116
+0.68632707774798929, //117
+0.68449197860962563, //118
+0.68266666666666664, //119
+0.68085106382978722, //120
+0.67904509283819625, //121
+0.67724867724867721, //122
+0.67546174142480209, //123
+0.67368421052631577, //124
+0.67191601049868765, //125
+0.67015706806282727, //126
+0.66840731070496084, //127
+0.66666666666666663, //128
+0.66493506493506493, //129
+0.66321243523316065, //130
+0.66149870801033595, //131
+0.65979381443298968, //132
+0.65809768637532129, //133
+0.65641025641025641, //134
+0.65473145780051156, //135
+0.65306122448979587, //136
+0.65139949109414763, //137
+0.64974619289340096, //138
+0.64810126582278482, //139
+0.64646464646464652, //140
+0.64483627204030225, //141
+0.64321608040201006, //142
+0.64160401002506262, //143
+0.64000000000000001, //144
+0.63840399002493764, //145
+0.63681592039800994, //146
+0.63523573200992556, //147
+0.63366336633663367, //148
+0.63209876543209875, //149
+0.63054187192118227, //150
+0.62899262899262898, //151
+0.62745098039215685, //152
+0.62591687041564792, //153
+0.62439024390243902, //154
+0.62287104622871048, //155
+0.62135922330097082, //156
+0.61985472154963683, //157
+0.61835748792270528, //158
+0.61686746987951813, //159
+0.61538461538461542, //160
+0.61390887290167862, //161
+0.61244019138755978, //162
+0.61097852028639621, //163
+0.60952380952380958, //164
+0.60807600950118768, //165
+0.60663507109004744, //166
+0.60520094562647753, //167
+0.60377358490566035, //168
+0.60235294117647054, //169
+0.60093896713615025, //170
+0.59953161592505855, //171
+0.59813084112149528, //172
+0.59673659673659674, //173
+0.59534883720930232, //174
+0.59396751740139209, //175
+0.59259259259259256, //176
+0.59122401847575057, //177
+0.58986175115207373, //178
+0.58850574712643677, //179
+0.58715596330275233, //180
+0.58581235697940504, //181
+0.58447488584474883, //182
+0.58314350797266512, //183
+0.58181818181818179, //184
+0.58049886621315194, //185
+0.579185520361991, //186
+0.57787810383747173, //187
+0.57657657657657657, //188
+0.57528089887640455, //189
+0.57399103139013452, //190
+0.57270693512304249, //191
+0.5714285714285714, //192
+0.57015590200445432, //193
+0.56888888888888889, //194
+0.56762749445676275, //195
+0.5663716814159292, //196
+0.56512141280353201, //197
+0.56387665198237891, //198
+0.56263736263736264, //199
+0.56140350877192979, //200
+0.56017505470459517, //201
+0.55895196506550215, //202
+0.55773420479302838, //203
+0.55652173913043479, //204
+0.55531453362255967, //205
+0.55411255411255411, //206
+0.55291576673866094, //207
+0.55172413793103448, //208
+0.55053763440860215, //209
+0.54935622317596566, //210
+0.54817987152034264, //211
+0.54700854700854706, //212
+0.54584221748400852, //213
+0.5446808510638298, //214
+0.54352441613588109, //215
+0.5423728813559322, //216
+0.54122621564482032, //217
+0.54008438818565396, //218
+0.53894736842105262, //219
+0.53781512605042014, //220
+0.5366876310272537, //221
+0.53556485355648531, //222
+0.53444676409185798, //223
+0.53333333333333333, //224
+0.53222453222453225, //225
+0.53112033195020747, //226
+0.53002070393374745, //227
+0.52892561983471076, //228
+0.52783505154639176, //229
+0.52674897119341568, //230
+0.52566735112936347, //231
+0.52459016393442626, //232
+0.52351738241308798, //233
+0.52244897959183678, //234
+0.52138492871690423, //235
+0.52032520325203258, //236
+0.51926977687626774, //237
+0.51821862348178138, //238
+0.51717171717171717, //239
+0.5161290322580645, //240
+0.51509054325955739, //241
+0.51405622489959835, //242
+0.51302605210420837, //243
+0.51200000000000001, //244
+0.51097804391217561, //245
+0.50996015936254979, //246
+0.50894632206759438, //247
+0.50793650793650791, //248
+0.50693069306930694, //249
+0.50592885375494068, //250
+0.50493096646942803, //251
+0.50393700787401574, //252
+0.50294695481335949, //253
+0.50196078431372548, //254
+0.50097847358121328, //255
+};
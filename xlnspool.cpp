@@ -0,0 +1,351 @@
+// thread pool and parallel loops for the xlns16/xlns32 batch kernels
+// copyright 2025 (same terms as xlns16.cpp and xlns32.cpp)
+//
+// define xlns_parallel before including xlns16.cpp and/or xlns32.cpp to make the
+// batch kernels split work over this pool when they get at least
+// xlns_parallel_min elements (or include this file directly to use
+// xlns_parallel_for in your own code).  needs C++11; link with -pthread.
+//
+//   xlns_pool_init(nthreads, pin)  start nthreads-1 workers (the calling thread
+//                                  is the other one); 0 means $XLNS_THREADS or all
+//                                  cores; pin=1 binds worker i to core i (Linux).
+//                                  done automatically on first use if not called
+//   xlns_pool_shutdown()           stop and join the workers
+//   xlns_parallel_for(n, f)        f(begin, end) over chunks of [0, n)
+//   xlns_parallel_reduce(n, grain, map, combine)
+//                                  partial = map(begin, end) per chunk, then
+//                                  combine(combine(p0, p1), p2)... in chunk order;
+//                                  map(0, 0) when n is 0
+//
+// each thread has its own deque of chunks; an idle thread takes from the back
+// of its own deque and steals from the front of the others.  a thread that
+// waits for its loop to finish runs chunks itself, and a loop started inside a
+// chunk runs serially, so nested kernels cannot deadlock.
+//
+// LNS addition is not associative, so splitting a sum changes its rounding.
+// the batch kernels therefore only split sums (xlns16_sum, xlns16_vec_dot and
+// the sums inside softmax and layernorm) when xlns_parallel_reductions is set,
+// and then they use the fixed reduction tree of xlns16_sum_tree (chunks and
+// combine order set by n alone), so the result is the same for any number of
+// threads.  xlns_parallel_reduce itself folds the chunk partials in order; its
+// chunk boundaries follow the thread count unless xlns_pool_deterministic is
+// set, which makes every chunk exactly the grain.
+//
+// a chunk runs with the caller's values of the thread-locals registered with
+// xlns_pool_inherits (such as the kernel a z profile counts adds under), as if
+// the caller had run it.
+
+#ifndef xlns_pool_included
+#define xlns_pool_included
+
+#include <stdlib.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+size_t xlns_parallel_min = 1<<15;     // smallest n a batch kernel splits
+size_t xlns_parallel_grain = 1<<12;   // smallest chunk (exact chunk when deterministic)
+int xlns_parallel_reductions = 0;     // also split sums (changes their rounding)
+int xlns_pool_deterministic = 0;      // fixed chunk boundaries, whatever the thread count
+
+// thread-local ints that chunks inherit from the thread that started their loop,
+// each given by a function that returns the running thread's copy
+#define xlns_pool_maxinherit 4
+int *(*xlns_pool_inherited[xlns_pool_maxinherit])();
+int xlns_pool_ninherited = 0;
+
+// call during static initialization (before any threads); returns the slot
+inline int xlns_pool_inherits(int *(*var)())
+{
+    if (xlns_pool_ninherited == xlns_pool_maxinherit)
+        return -1;
+    xlns_pool_inherited[xlns_pool_ninherited] = var;
+    return xlns_pool_ninherited++;
+}
+
+struct xlns_pool_job {
+    void (*fn)(const void *f, size_t begin, size_t end);
+    const void *f;
+    std::atomic<size_t> left;         // chunks not yet finished
+    int inherit[xlns_pool_maxinherit];   // the caller's values of xlns_pool_inherited
+};
+
+struct xlns_pool_task {
+    xlns_pool_job *job;
+    size_t begin, end;
+};
+
+struct xlns_pool_queue {
+    std::mutex lock;
+    std::deque<xlns_pool_task> q;
+};
+
+struct xlns_pool_state {
+    int nthreads;                      // workers + the caller
+    std::vector<std::thread> workers;
+    xlns_pool_queue *queues;           // [0] is shared by callers, [i] by worker i
+    std::mutex sleeplock;
+    std::condition_variable wake;
+    std::atomic<long> queued;
+    bool stop;
+};
+
+xlns_pool_state *xlns_pool = NULL;
+std::mutex xlns_pool_initlock;
+thread_local int xlns_pool_me = 0;         // which queue this thread pops first
+thread_local int xlns_pool_inside = 0;     // running a chunk: nested loops go serial
+
+inline int xlns_pool_take(xlns_pool_task &t, int me)
+{
+    xlns_pool_state *p = xlns_pool;
+    {
+        std::lock_guard<std::mutex> g(p->queues[me].lock);
+        if (!p->queues[me].q.empty())
+        {
+            t = p->queues[me].q.back();
+            p->queues[me].q.pop_back();
+            p->queued--;
+            return 1;
+        }
+    }
+    for (int k = 1; k < p->nthreads; k++)
+    {
+        int v = (me + k) % p->nthreads;
+        std::lock_guard<std::mutex> g(p->queues[v].lock);
+        if (!p->queues[v].q.empty())
+        {
+            t = p->queues[v].q.front();
+            p->queues[v].q.pop_front();
+            p->queued--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+inline void xlns_pool_runtask(xlns_pool_task &t)
+{
+    int saved = xlns_pool_inside, savedvar[xlns_pool_maxinherit];
+    for (int k = 0; k < xlns_pool_ninherited; k++)
+    {
+        savedvar[k] = *xlns_pool_inherited[k]();
+        *xlns_pool_inherited[k]() = t.job->inherit[k];
+    }
+    xlns_pool_inside = 1;
+    t.job->fn(t.job->f, t.begin, t.end);
+    xlns_pool_inside = saved;
+    for (int k = 0; k < xlns_pool_ninherited; k++)
+        *xlns_pool_inherited[k]() = savedvar[k];
+    t.job->left.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+inline void xlns_pool_worker(int me, int pin)
+{
+    #ifdef __linux__
+    if (pin)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(me % CPU_SETSIZE, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    #endif
+    xlns_pool_me = me;
+    xlns_pool_task t;
+    for (;;)
+    {
+        if (xlns_pool_take(t, me))
+        {
+            xlns_pool_runtask(t);
+            continue;
+        }
+        std::unique_lock<std::mutex> lk(xlns_pool->sleeplock);
+        xlns_pool->wake.wait(lk, []{ return xlns_pool->queued > 0 || xlns_pool->stop; });
+        if (xlns_pool->stop)
+            return;
+    }
+}
+
+inline void xlns_pool_shutdown()
+{
+    std::lock_guard<std::mutex> g(xlns_pool_initlock);
+    if (xlns_pool == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lk(xlns_pool->sleeplock);
+        xlns_pool->stop = true;
+    }
+    xlns_pool->wake.notify_all();
+    for (size_t i = 0; i < xlns_pool->workers.size(); i++)
+        xlns_pool->workers[i].join();
+    delete [] xlns_pool->queues;
+    delete xlns_pool;
+    xlns_pool = NULL;
+}
+
+// call with xlns_pool_initlock held
+inline void xlns_pool_start(int nthreads, int pin)
+{
+    if (nthreads <= 0 && getenv("XLNS_THREADS"))
+        nthreads = atoi(getenv("XLNS_THREADS"));
+    if (nthreads <= 0)
+        nthreads = std::thread::hardware_concurrency();
+    if (nthreads <= 0)
+        nthreads = 1;
+    xlns_pool_state *p = new xlns_pool_state;
+    p->nthreads = nthreads;
+    p->queues = new xlns_pool_queue[nthreads];
+    p->queued = 0;
+    p->stop = false;
+    xlns_pool = p;
+    for (int i = 1; i < nthreads; i++)
+        p->workers.push_back(std::thread(xlns_pool_worker, i, pin));
+}
+
+inline void xlns_pool_init(int nthreads = 0, int pin = 0)
+{
+    xlns_pool_shutdown();
+    std::lock_guard<std::mutex> g(xlns_pool_initlock);
+    if (xlns_pool == NULL)
+        xlns_pool_start(nthreads, pin);
+}
+
+// first use of the pool without xlns_pool_init
+inline void xlns_pool_lazyinit()
+{
+    std::lock_guard<std::mutex> g(xlns_pool_initlock);
+    if (xlns_pool == NULL)
+        xlns_pool_start(0, 0);
+}
+
+inline int xlns_pool_threads()
+{
+    return xlns_pool ? xlns_pool->nthreads : 1;
+}
+
+struct xlns_pool_atexit {
+    ~xlns_pool_atexit() { xlns_pool_shutdown(); }
+} xlns_pool_atexit_instance;
+
+// chunk size: exactly grain when deterministic, else about 4 chunks per thread
+inline size_t xlns_pool_chunk(size_t n, size_t grain)
+{
+    if (grain == 0)
+        grain = 1;
+    if (xlns_pool_deterministic)
+        return grain;
+    size_t c = (n + 4*xlns_pool_threads() - 1)/(4*xlns_pool_threads());
+    return (c < grain) ? grain : c;
+}
+
+// run fn(f, begin, end) over [0, n) in chunks of the given size
+inline void xlns_pool_run(void (*fn)(const void *, size_t, size_t), const void *f, size_t n, size_t chunk)
+{
+    size_t nchunks = (n + chunk - 1)/chunk;
+    if (xlns_pool == NULL || xlns_pool->nthreads == 1 || nchunks <= 1 || xlns_pool_inside)
+    {
+        int saved = xlns_pool_inside;
+        xlns_pool_inside = 1;
+        for (size_t b = 0; b < n; b += chunk)
+            fn(f, b, (b + chunk < n) ? b + chunk : n);
+        xlns_pool_inside = saved;
+        return;
+    }
+    xlns_pool_state *p = xlns_pool;
+    xlns_pool_job job;
+    job.fn = fn;
+    job.f = f;
+    job.left = nchunks;
+    for (int k = 0; k < xlns_pool_ninherited; k++)
+        job.inherit[k] = *xlns_pool_inherited[k]();
+    for (size_t c = 0; c < nchunks; c++)
+    {
+        xlns_pool_task t = { &job, c*chunk, ((c+1)*chunk < n) ? (c+1)*chunk : n };
+        int q = (int)(c % p->nthreads);
+        std::lock_guard<std::mutex> g(p->queues[q].lock);
+        p->queues[q].q.push_back(t);
+        p->queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lk(p->sleeplock);
+    }
+    p->wake.notify_all();
+    xlns_pool_task t;
+    while (job.left.load(std::memory_order_acquire) != 0)
+        if (xlns_pool_take(t, xlns_pool_me))
+            xlns_pool_runtask(t);
+        else
+            std::this_thread::yield();
+}
+
+template <class F>
+void xlns_pool_call(const void *f, size_t begin, size_t end)
+{
+    (*(const F *)f)(begin, end);
+}
+
+template <class F>
+void xlns_parallel_for(size_t n, const F &f, size_t grain = xlns_parallel_grain)
+{
+    if (xlns_pool == NULL && !xlns_pool_inside)
+        xlns_pool_lazyinit();
+    xlns_pool_run(&xlns_pool_call<F>, &f, n, xlns_pool_chunk(n, grain));
+}
+
+template <class T, class M, class C>
+T xlns_parallel_reduce(size_t n, size_t grain, const M &map, const C &combine)
+{
+    if (xlns_pool == NULL && !xlns_pool_inside)
+        xlns_pool_lazyinit();
+    if (n == 0)
+        return map(0, 0);
+    size_t chunk = xlns_pool_chunk(n, grain);
+    size_t nchunks = (n + chunk - 1)/chunk;
+    std::vector<T> part(nchunks);
+    xlns_parallel_for(nchunks, [&](size_t c0, size_t c1) {
+        for (size_t c = c0; c < c1; c++)
+            part[c] = map(c*chunk, ((c+1)*chunk < n) ? (c+1)*chunk : n);
+    }, 1);
+    T r = part[0];
+    for (size_t c = 1; c < nchunks; c++)
+        r = combine(r, part[c]);
+    return r;
+}
+
+// for the batch kernels: is n big enough to split, and are we not already in a chunk
+inline int xlns_parallel_use(size_t n)
+{
+    return n >= xlns_parallel_min && !xlns_pool_inside;
+}
+
+// first statement of an elementwise batch kernel: run the statement that follows
+// n (which uses i0, i1) over chunks in parallel and return, if n is big enough
+#define xlns_parallel_split(n, ...) \
+    if (xlns_parallel_use(n)) { xlns_parallel_for((n), [=](size_t i0, size_t i1) { __VA_ARGS__; }); return; }
+
+// first statement of a sum kernel: if sums may be split, return the expression
+// that follows n (the fixed-tree version of the kernel)
+#define xlns_parallel_sum(n, ...) \
+    if (xlns_parallel_reductions && xlns_parallel_use(n)) return __VA_ARGS__;
+
+// a loop over nchunks independent pieces (chunk partials of a fixed-tree sum,
+// rows of a matrix) that together cost n elements of work: the statement that
+// follows nchunks, over pieces [i0, i1), in parallel if n is big enough
+#define xlns_parallel_chunks(n, nchunks, ...) \
+    if (xlns_parallel_use(n)) xlns_parallel_for((nchunks), [&](size_t i0, size_t i1) { __VA_ARGS__; }, 1); \
+    else { size_t i0 = 0, i1 = (nchunks); __VA_ARGS__; }
+
+// one elementwise pass inside a bigger kernel: the statement that follows n,
+// over [i0, i1), in parallel chunks or once over [0, n)
+#define xlns_parallel_loop(n, ...) \
+    if (xlns_parallel_use(n)) xlns_parallel_for((n), [&](size_t i0, size_t i1) { __VA_ARGS__; }); \
+    else { size_t i0 = 0, i1 = (n); __VA_ARGS__; }
+
+#endif
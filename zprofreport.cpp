@@ -0,0 +1,187 @@
+//report on a z profile written by xlns16_zprof_dump/xlns32_zprof_dump
+//(compile the program being profiled with -Dxlns16_zprofile and/or -Dxlns32_zprofile)
+//for each kernel: how the adds split between sb and db, where -z falls, and
+//for candidate sb/db table layouts the bytes, the cache lines touched, and an
+//estimated hit rate if only the most used lines of the tables stay in L1
+//(an ideal least-frequently-used model; cold misses are ignored)
+//   g++ -O2 zprofreport.cpp -o zprofreport
+//   ./zprofreport profile.txt     (or ./zprofreport < profile.txt)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#define LINE 64
+
+struct fmtinfo { int shift, nbins, esszer; };
+
+struct hist {
+	std::vector<unsigned long long> sb, db;
+};
+
+std::map<std::string, fmtinfo> fmts;
+std::map<std::string, std::map<std::string, hist> > prof;   // format -> kernel -> histogram
+
+// fraction of all weight in the heaviest lines that fit in budget bytes
+double lfuhit(std::map<long, unsigned long long> &lines, long budget)
+{
+	std::vector<unsigned long long> w;
+	unsigned long long tot = 0, got = 0;
+	for (std::map<long, unsigned long long>::iterator it = lines.begin(); it != lines.end(); ++it)
+	{
+		w.push_back(it->second);
+		tot += it->second;
+	}
+	std::sort(w.begin(), w.end(), std::greater<unsigned long long>());
+	for (size_t i = 0; i < w.size() && (long)(i+1)*LINE <= budget; i++)
+		got += w[i];
+	return tot ? 100.0*got/tot : 100.0;
+}
+
+void layout(const char *name, long bytes, std::map<long, unsigned long long> &lines,
+            double hotpct, const long *budgets)
+{
+	printf("  %-28s %7ld %6zu ", name, bytes, lines.size());
+	if (hotpct >= 0)
+		printf(" %6.2f ", hotpct);
+	else
+		printf("     -  ");
+	for (int i = 0; budgets[i]; i++)
+		printf(" %6.2f", lfuhit(lines, budgets[i]));
+	printf("\n");
+}
+
+void report(const std::string &f, const std::string &k, hist &h)
+{
+	fmtinfo fi = fmts[f];
+	int n = fi.nbins;
+	unsigned long long sb = 0, db = 0, ez = h.sb[n-1] + h.db[n-1];
+	for (int b = 0; b < n; b++) { sb += h.sb[b]; db += h.db[b]; }
+	unsigned long long tot = sb + db;
+	if (tot == 0) return;
+	printf("%s %s: %llu adds, sb %.2f%%, db %.2f%%, beyond esszer %.2f%%\n", f.c_str(), k.c_str(),
+	       tot, 100.0*sb/tot, 100.0*db/tot, 100.0*ez/tot);
+
+	double pct[] = { 50, 90, 99, 99.9 };
+	printf("  -z percentiles (log2 units):");
+	for (int p = 0; p < 4; p++)
+	{
+		unsigned long long want = (unsigned long long)(pct[p]/100.0*tot), acc = 0;
+		int b = 0;
+		while (b < n-1 && (acc += h.sb[b] + h.db[b]) < want) b++;
+		printf("  p%g %.3f%s", pct[p], (double)((long)b<<fi.shift)/(f == "xlns16" ? 128.0 : 8388608.0),
+		       (b == n-1) ? "+" : "");
+	}
+	printf("\n");
+
+	const long budgets[] = { 1024, 2048, 4096, 8192, 16384, 0 };
+	printf("  layout                         bytes  lines   hot%%  hit%% in L1 share of 1K     2K     4K     8K    16K\n");
+	std::map<long, unsigned long long> full;
+	if (f == "xlns16")
+	{
+		// xlns16_table: xlns16sbtbl/xlns16dbtbl, 2-byte entries, index min(-z, esszer-1)
+		int te = fi.esszer;
+		for (int b = 0; b < n; b++)
+		{
+			int i = (b < te) ? b : te-1;
+			if (h.sb[b]) full[(i*2)/LINE] += h.sb[b];
+			if (h.db[b]) full[1000000 + (i*2)/LINE] += h.db[b];
+		}
+		layout("sb+db tables (xlns16_table)", 2L*2*te, full, -1, budgets);
+		int hots[] = { 64, 128, 256, 512 };
+		for (int j = 0; j < 4; j++)
+		{
+			unsigned long long hit = 0;
+			for (int b = 0; b < hots[j] && b < n-1; b++) hit += h.sb[b] + h.db[b];
+			std::map<long, unsigned long long> hot;
+			for (int b = 0; b < hots[j] && b < n-1; b++)
+			{
+				if (h.sb[b]) hot[(b*2)/LINE] += h.sb[b];
+				if (h.db[b]) hot[1000000 + (b*2)/LINE] += h.db[b];
+			}
+			char name[64];
+			sprintf(name, "hot %d + cold (hot part)", hots[j]);
+			layout(name, 2L*2*hots[j], hot, 100.0*hit/tot, budgets);
+		}
+	}
+	else
+	{
+		// non-ideal xlns32: sb reads xlns32_sbltable[zh], [zh+1] (2 bytes) and
+		// xlns32_sbhtable[zh] (1 byte); db reads xlns32_db0table[-z>>19] (4 bytes),
+		// plus db1/db2 entries picked by low bits of z that the profile does not
+		// resolve (counted as spread over the whole 6 Kbyte) and nested sb calls (ignored)
+		long tsize = 4096*3+1000;
+		for (int b = 0; b < n; b++)
+		{
+			long zh = (b < tsize-1) ? b : tsize-2;
+			if (h.sb[b])
+			{
+				full[(zh*2)/LINE] += h.sb[b];
+				full[((zh+1)*2)/LINE] += h.sb[b];
+				full[2000000 + zh/LINE] += h.sb[b];
+			}
+			if (h.db[b])
+				full[3000000 + ((b>>5)*4)/LINE] += h.db[b];
+		}
+		unsigned long long dbspread = db/(6144/LINE) + 1;
+		for (long l = 0; db && l < 6144/LINE; l++)
+			full[4000000 + l] += dbspread;
+		layout("sbl+sbh+db0+db1+db2 tables", tsize*3 + 8192, full, -1, budgets);
+		int hots[] = { 512, 1024, 2048, 4096 };
+		for (int j = 0; j < 4; j++)
+		{
+			unsigned long long hit = 0;
+			std::map<long, unsigned long long> hot;
+			for (int b = 0; b < hots[j] && b < n-1; b++)
+			{
+				hit += h.sb[b];
+				if (h.sb[b])
+				{
+					hot[(b*2)/LINE] += h.sb[b];
+					hot[2000000 + b/LINE] += h.sb[b];
+				}
+			}
+			char name[64];
+			sprintf(name, "sb hot %d + cold (hot part)", hots[j]);
+			layout(name, 3L*hots[j], hot, sb ? 100.0*hit/sb : 100.0, budgets);
+		}
+	}
+	printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+	FILE *in = stdin;
+	if (argc > 1 && (in = fopen(argv[1], "r")) == NULL)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	char buf[512], f[64], k[256], op[8];
+	int b;
+	unsigned long long c;
+	fmtinfo fi;
+	while (fgets(buf, sizeof(buf), in))
+	{
+		if (sscanf(buf, "#zprofile %63s shift %d nbins %d esszer %d", f, &fi.shift, &fi.nbins, &fi.esszer) == 4)
+			fmts[f] = fi;
+		else if (buf[0] != '#' && sscanf(buf, "%63s %255s %7s %d %llu", f, k, op, &b, &c) == 5)
+		{
+			if (fmts.count(f) == 0 || b < 0 || b >= fmts[f].nbins)
+				continue;
+			hist &h = prof[f][k];
+			hist &a = prof[f]["(all kernels)"];
+			if (h.sb.empty()) { h.sb.assign(fmts[f].nbins, 0); h.db.assign(fmts[f].nbins, 0); }
+			if (a.sb.empty()) { a.sb.assign(fmts[f].nbins, 0); a.db.assign(fmts[f].nbins, 0); }
+			(strcmp(op, "db") == 0 ? h.db : h.sb)[b] += c;
+			(strcmp(op, "db") == 0 ? a.db : a.sb)[b] += c;
+		}
+	}
+	for (std::map<std::string, std::map<std::string, hist> >::iterator it = prof.begin(); it != prof.end(); ++it)
+		for (std::map<std::string, hist>::iterator kt = it->second.begin(); kt != it->second.end(); ++kt)
+			report(it->first, kt->first, kt->second);
+	return 0;
+}